@@ -0,0 +1,368 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "block_replayer.hpp"
+#include "replay_storage_unit.hpp"
+
+#include "chain/transaction.hpp"
+#include "core/mutex.hpp"
+#include "ledger/execution_manager.hpp"
+#include "ledger/executor.hpp"
+#include "ledger/executor_interface.hpp"
+#include "telemetry/histogram.hpp"
+#include "telemetry/registry.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <thread>
+#include <utility>
+
+using fetch::ledger::ExecutionManager;
+using fetch::ledger::Executor;
+using fetch::ledger::ExecutorInterface;
+using fetch::telemetry::Histogram;
+using fetch::telemetry::Registry;
+
+namespace {
+
+using namespace std::chrono_literals;
+
+using Clock          = std::chrono::steady_clock;
+using Seconds        = std::chrono::duration<double>;
+using Timing         = BlockReplayer::Timing;
+using Timings        = BlockReplayer::Timings;
+using ContractLabels = BlockReplayer::ContractLabels;
+using Transaction    = fetch::chain::Transaction;
+using ContractMode   = Transaction::ContractMode;
+using State          = ExecutionManager::State;
+using ScheduleStatus = ExecutionManager::ScheduleStatus;
+
+constexpr auto POLL_INTERVAL = 100us;
+
+char const *const UNKNOWN_LABEL = "(unknown)";
+
+struct Stage
+{
+  char const *label;
+  char const *histogram;
+};
+
+/// The stages of transaction execution, as measured by the executor telemetry
+constexpr Stage STAGES[] = {
+    {"tx retrieve", "ledger_executor_tx_retrieve_duration"},
+    {"validation checks", "ledger_executor_validation_checks_duration"},
+    {"contract execution", "ledger_executor_contract_execution_duration"},
+    {"transfers", "ledger_executor_transfers_duration"},
+    {"deduct fees", "ledger_executor_deduct_fees_duration"},
+    {"settle fees", "ledger_executor_settle_fees_duration"},
+    {"(overall)", "ledger_executor_overall_duration"},
+};
+
+Timings SnapshotStages()
+{
+  Timings timings{};
+
+  for (auto const &stage : STAGES)
+  {
+    auto const histogram = Registry::Instance().LookupMeasurement<Histogram>(stage.histogram);
+    if (histogram)
+    {
+      timings[stage.label] = Timing{histogram->count(), histogram->sum()};
+    }
+  }
+
+  return timings;
+}
+
+/**
+ * The per contract execution times, shared between all the executors of a run
+ */
+class ContractProfile
+{
+public:
+  void Record(std::string const &label, Clock::duration duration)
+  {
+    FETCH_LOCK(lock_);
+
+    auto &timing = timings_[label];
+    ++timing.count;
+    timing.total += Seconds{duration}.count();
+  }
+
+  Timings timings() const
+  {
+    FETCH_LOCK(lock_);
+    return timings_;
+  }
+
+private:
+  mutable fetch::Mutex lock_;
+  Timings              timings_;
+};
+
+using ContractProfilePtr = std::shared_ptr<ContractProfile>;
+
+/**
+ * Executor which measures the time taken to execute each transaction
+ */
+class TimedExecutor : public ExecutorInterface
+{
+public:
+  using ExecutorPtr       = std::shared_ptr<ExecutorInterface>;
+  using ContractLabelsPtr = std::shared_ptr<ContractLabels const>;
+
+  TimedExecutor(ExecutorPtr executor, ContractLabelsPtr labels, ContractProfilePtr profile)
+    : executor_{std::move(executor)}
+    , labels_{std::move(labels)}
+    , profile_{std::move(profile)}
+  {}
+
+  Result Execute(fetch::Digest const &digest, BlockIndex block, SliceIndex slice,
+                 fetch::BitVector const &shards) override
+  {
+    auto const start  = Clock::now();
+    auto const result = executor_->Execute(digest, block, slice, shards);
+    auto const end    = Clock::now();
+
+    // the labels are precomputed, so that no transaction lookups are made around the execution
+    auto const it = labels_->find(digest);
+    profile_->Record((it != labels_->end()) ? it->second : UNKNOWN_LABEL, end - start);
+
+    return result;
+  }
+
+  Result ExecuteTransaction(TransactionPtr const &tx, BlockIndex block, SliceIndex slice,
+                            fetch::BitVector const &shards) override
+  {
+    auto const start  = Clock::now();
+    auto const result = executor_->ExecuteTransaction(tx, block, slice, shards);
+    profile_->Record(BlockReplayer::ContractLabel(*tx), Clock::now() - start);
+
+    return result;
+  }
+
+  void SettleFees(fetch::chain::Address const &miner, BlockIndex block, TokenAmount amount,
+                  uint32_t log2_num_lanes, fetch::ledger::StakeUpdateEvents const &stake_updates)
+      override
+  {
+    executor_->SettleFees(miner, block, amount, log2_num_lanes, stake_updates);
+  }
+
+private:
+  ExecutorPtr        executor_;
+  ContractLabelsPtr  labels_;
+  ContractProfilePtr profile_;
+};
+
+void PrintTimings(std::ostream &stream, Timings const &timings, double total)
+{
+  std::size_t width{0};
+  for (auto const &entry : timings)
+  {
+    width = std::max(width, entry.first.size());
+  }
+
+  // order the entries by the time spent on them
+  std::vector<std::pair<std::string, Timing>> ordered(timings.begin(), timings.end());
+  std::sort(ordered.begin(), ordered.end(),
+            [](auto const &a, auto const &b) { return a.second.total > b.second.total; });
+
+  for (auto const &entry : ordered)
+  {
+    Timing const &timing = entry.second;
+    double const  count  = static_cast<double>(timing.count);
+    double const  mean   = (timing.count > 0) ? timing.total / count : 0;
+    double const  share  = (total > 0) ? (timing.total * 100.0) / total : 0;
+
+    stream << "    " << std::left << std::setw(static_cast<int>(width)) << entry.first << std::right
+           << std::setw(10) << timing.count << std::setw(12) << (timing.total * 1e3) << " ms"
+           << std::setw(12) << (mean * 1e6) << " us" << std::setw(8) << share << " %\n";
+  }
+}
+
+}  // namespace
+
+double BlockReplayer::Report::rate() const
+{
+  return (execution_time > 0) ? static_cast<double>(transactions) / execution_time : 0.0;
+}
+
+void BlockReplayer::Report::Print(std::ostream &stream) const
+{
+  stream << std::fixed << std::setprecision(1);
+  stream << "Replay with " << num_executors << " executor(s): " << blocks << " blocks, "
+         << transactions << " transactions\n";
+  stream << "  Execution: " << (execution_time * 1e3) << " ms (" << rate()
+         << " tx/s), slowest block: " << (max_block_time * 1e3) << " ms\n";
+  stream << "  State check & commit: " << (commit_time * 1e3) << " ms\n";
+
+  // the contract timings are shares of the total time spent in the executors
+  double contracts_total{0};
+  for (auto const &entry : contracts)
+  {
+    contracts_total += entry.second.total;
+  }
+
+  stream << "  Executor time per contract (count, total, mean, share):\n";
+  PrintTimings(stream, contracts, contracts_total);
+
+  auto const overall = stages.find("(overall)");
+  stream << "  Executor time per stage (count, total, mean, share of overall):\n";
+  PrintTimings(stream, stages, (overall != stages.end()) ? overall->second.total : 0);
+
+  if (!error.empty())
+  {
+    stream << "  ERROR: " << error << '\n';
+  }
+
+  stream << std::flush;
+}
+
+/**
+ * Determine the name under which the execution time of a transaction is reported
+ */
+std::string BlockReplayer::ContractLabel(Transaction const &tx)
+{
+  switch (tx.contract_mode())
+  {
+  case ContractMode::NOT_PRESENT:
+    return "(transfer)";
+  case ContractMode::PRESENT:
+    return static_cast<std::string>(tx.contract_address().display()) + "." +
+           static_cast<std::string>(tx.action());
+  case ContractMode::CHAIN_CODE:
+    return static_cast<std::string>(tx.chain_code()) + "." +
+           static_cast<std::string>(tx.action());
+  case ContractMode::SYNERGETIC:
+    return "(synergetic) " + static_cast<std::string>(tx.contract_address().display());
+  }
+
+  return UNKNOWN_LABEL;
+}
+
+BlockReplayer::BlockReplayer(StoragePtr storage, uint32_t log2_num_lanes, ContractLabels labels)
+  : storage_{std::move(storage)}
+  , log2_num_lanes_{log2_num_lanes}
+  , labels_{std::make_shared<ContractLabels const>(std::move(labels))}
+{}
+
+/**
+ * Replay a sequence of blocks
+ *
+ * @param parent The parent of the first block, whose state the replay starts from
+ * @param blocks The consecutive blocks to be replayed
+ * @param num_executors The number of executors to use
+ * @return The report of the run
+ */
+BlockReplayer::Report BlockReplayer::Run(Block const &parent, Blocks const &blocks,
+                                         std::size_t num_executors)
+{
+  Report report{};
+  report.num_executors = num_executors;
+
+  if (!storage_->RevertToHash(parent.merkle_hash, parent.block_number))
+  {
+    report.error = "Unable to revert the state to block " + std::to_string(parent.block_number);
+    return report;
+  }
+
+  auto profile = std::make_shared<ContractProfile>();
+  auto storage = storage_;
+  auto labels  = labels_;
+
+  auto manager = std::make_shared<ExecutionManager>(
+      num_executors, log2_num_lanes_, storage_,
+      [storage, labels, profile]() {
+        return std::make_shared<TimedExecutor>(std::make_shared<Executor>(storage), labels,
+                                               profile);
+      },
+      nullptr);
+
+  manager->Start();
+  manager->SetLastProcessedBlock(parent.hash);
+
+  // the executor histograms are shared with any previous runs, so only the difference is reported
+  Timings const stages_before = SnapshotStages();
+
+  for (auto const &block : blocks)
+  {
+    auto const start = Clock::now();
+
+    auto const status = manager->Execute(block);
+    if (status != ScheduleStatus::SCHEDULED)
+    {
+      report.error = "Unable to schedule block " + std::to_string(block.block_number) + ": " +
+                     ToString(status);
+      break;
+    }
+
+    State state{State::ACTIVE};
+    while ((state = manager->GetState()) == State::ACTIVE)
+    {
+      std::this_thread::sleep_for(POLL_INTERVAL);
+    }
+
+    auto const executed = Clock::now();
+
+    if (state != State::IDLE)
+    {
+      report.error = "Execution of block " + std::to_string(block.block_number) +
+                     " did not complete: " + ToString(state);
+      break;
+    }
+
+    auto const state_hash = storage_->CurrentHash();
+    if (state_hash != block.merkle_hash)
+    {
+      std::ostringstream oss;
+      oss << "Merkle hash mismatch (block num: " << block.block_number << " block: 0x"
+          << block.hash.ToHex() << " expected: 0x" << block.merkle_hash.ToHex() << " actual: 0x"
+          << state_hash.ToHex() << ")";
+
+      report.error = oss.str();
+      break;
+    }
+
+    storage_->Commit(block.block_number);
+
+    double const execution_time = Seconds{executed - start}.count();
+
+    ++report.blocks;
+    report.transactions += block.GetTransactionCount();
+    report.execution_time += execution_time;
+    report.commit_time += Seconds{Clock::now() - executed}.count();
+    report.max_block_time = std::max(report.max_block_time, execution_time);
+  }
+
+  manager->Stop();
+
+  report.contracts = profile->timings();
+
+  for (auto const &entry : SnapshotStages())
+  {
+    Timing const &before = stages_before.at(entry.first);
+
+    report.stages[entry.first] =
+        Timing{entry.second.count - before.count, entry.second.total - before.total};
+  }
+
+  return report;
+}
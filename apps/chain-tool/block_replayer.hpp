@@ -0,0 +1,96 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "chain/transaction.hpp"
+#include "core/digest.hpp"
+#include "ledger/chain/block.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class ReplayStorageUnit;
+
+/**
+ * Re-executes a recorded sequence of blocks through the execution manager.
+ *
+ * Before each run the state is reverted to the one recorded for the parent of the first block, so
+ * that repeated runs (e.g. with different numbers of executors) all start from the same state.
+ * After each block the resulting merkle root is checked against the one recorded in the block and
+ * the state is committed, exactly as the block coordinator would do.
+ */
+class BlockReplayer
+{
+public:
+  using Block          = fetch::ledger::Block;
+  using Blocks         = std::vector<Block>;
+  using StoragePtr     = std::shared_ptr<ReplayStorageUnit>;
+  using Transaction    = fetch::chain::Transaction;
+  using ContractLabels = std::unordered_map<fetch::Digest, std::string>;
+
+  struct Timing
+  {
+    uint64_t count{0};
+    double   total{0};  ///< Seconds
+  };
+
+  using Timings = std::map<std::string, Timing>;
+
+  struct Report
+  {
+    std::size_t num_executors{0};
+    std::size_t blocks{0};          ///< The number of blocks successfully replayed
+    std::size_t transactions{0};    ///< The number of transactions in those blocks
+    double      execution_time{0};  ///< Seconds spent executing the blocks
+    double      commit_time{0};     ///< Seconds spent checking and committing the state
+    double      max_block_time{0};  ///< Seconds spent executing the slowest block
+    Timings     contracts;          ///< Executor time spent on each contract (or transfers)
+    Timings     stages;             ///< Executor time spent in each stage of execution
+    std::string error;              ///< Empty if all the blocks were replayed successfully
+
+    double rate() const;
+    void   Print(std::ostream &stream) const;
+  };
+
+  static std::string ContractLabel(Transaction const &tx);
+
+  // Construction / Destruction
+  BlockReplayer(StoragePtr storage, uint32_t log2_num_lanes, ContractLabels labels);
+  BlockReplayer(BlockReplayer const &) = delete;
+  BlockReplayer(BlockReplayer &&)      = delete;
+  ~BlockReplayer()                     = default;
+
+  Report Run(Block const &parent, Blocks const &blocks, std::size_t num_executors);
+
+  // Operators
+  BlockReplayer &operator=(BlockReplayer const &) = delete;
+  BlockReplayer &operator=(BlockReplayer &&) = delete;
+
+private:
+  using ContractLabelsPtr = std::shared_ptr<ContractLabels const>;
+
+  StoragePtr        storage_;
+  uint32_t          log2_num_lanes_;
+  ContractLabelsPtr labels_;  ///< The contract label of each transaction, keyed by digest
+};
@@ -16,6 +16,9 @@
 //
 //------------------------------------------------------------------------------
 
+#include "block_replayer.hpp"
+#include "replay_storage_unit.hpp"
+
 #include "chain/transaction.hpp"
 #include "chain/transaction_layout.hpp"
 #include "chain/transaction_layout_rpc_serializers.hpp"
@@ -28,8 +31,11 @@
 
 #include "storage/object_store.hpp"
 
+#include <algorithm>
 #include <fstream>
+#include <iomanip>
 #include <regex>
+#include <sstream>
 
 #include <dirent.h>
 
@@ -882,6 +888,148 @@ void ProcessTransactions(BlockChainForwardTree const &bch, BlockChain const &hea
   }
 }
 
+struct ReplayConfig
+{
+  uint64_t                 from{1};
+  uint64_t                 count{0};
+  std::vector<std::size_t> executors{};
+};
+
+std::vector<std::size_t> ParseExecutorCounts(std::string const &text)
+{
+  std::vector<std::size_t> counts;
+
+  std::istringstream reader{text};
+  std::string        item;
+  while (std::getline(reader, item, ','))
+  {
+    std::size_t const count{std::stoul(item)};
+    if (count == 0)
+    {
+      throw std::invalid_argument("The number of executors must be positive");
+    }
+
+    counts.push_back(count);
+  }
+
+  if (counts.empty())
+  {
+    throw std::invalid_argument("No numbers of executors given");
+  }
+
+  return counts;
+}
+
+/*
+ * Re-execute a range of blocks of the chain against a working copy of the node state and report
+ * the execution performance, once for each of the requested numbers of executors.
+ */
+int ReplayChain(BlockChainForwardTree const &bch, BlockChain const &chain, TxStores &tx_stores,
+                ReplayConfig const &config)
+{
+  auto const log2_num_of_lanes{static_cast<uint32_t>(meta::Log2(tx_stores.size()))};
+
+  // collect the blocks to be replayed, preceded by the parent of the first one
+  BlockReplayer::Blocks blocks;
+  bch.IterateChainBackward(chain, [&blocks, &config](BlockNode const &node, BlockHash const &) {
+    auto const block_number{node.db_record.block.block_number};
+    if (block_number + 1 < config.from)
+    {
+      return false;
+    }
+
+    if (config.count == 0 || block_number < config.from + config.count)
+    {
+      blocks.push_back(node.db_record.block);
+    }
+
+    return true;
+  });
+  std::reverse(blocks.begin(), blocks.end());
+
+  if (blocks.size() < 2 || blocks.front().block_number + 1 != config.from)
+  {
+    std::cerr << "ERROR: No blocks to replay from block index " << config.from << std::endl;
+    return -20;
+  }
+
+  Block const parent{blocks.front()};
+  blocks.erase(blocks.begin());
+
+  std::shared_ptr<ReplayStorageUnit> storage;
+  try
+  {
+    storage = std::make_shared<ReplayStorageUnit>(log2_num_of_lanes, "node_storage", "replay");
+  }
+  catch (std::exception const &ex)
+  {
+    std::cerr << "ERROR: Unable to prepare a copy of the node state: " << ex.what() << std::endl;
+    return -21;
+  }
+
+  // load all the transactions up front so reading the archive is not part of the measurements
+  BlockReplayer::ContractLabels labels;
+  std::size_t                   missing_txs{0};
+  for (auto const &block : blocks)
+  {
+    for (auto const &slice : block.slices)
+    {
+      for (auto const &tx_layout : slice)
+      {
+        ResourceID const   resource{tx_layout.digest()};
+        chain::Transaction tx;
+
+        if (tx_stores[resource.lane(log2_num_of_lanes)].Get(resource, tx))
+        {
+          labels.emplace(tx.digest(), BlockReplayer::ContractLabel(tx));
+          storage->AddTransaction(tx);
+        }
+        else
+        {
+          ++missing_txs;
+        }
+      }
+    }
+  }
+
+  if (missing_txs > 0)
+  {
+    std::cerr << "ERROR: " << missing_txs << " transactions required for the replay are missing"
+              << std::endl;
+    return -22;
+  }
+
+  std::cout << "Replaying blocks " << blocks.front().block_number << " to "
+            << blocks.back().block_number << " (" << storage->num_transactions()
+            << " transactions) on " << tx_stores.size() << " lanes" << std::endl;
+
+  BlockReplayer                      replayer{storage, log2_num_of_lanes, std::move(labels)};
+  std::vector<BlockReplayer::Report> reports;
+  for (auto const num_executors : config.executors)
+  {
+    reports.push_back(replayer.Run(parent, blocks, num_executors));
+    reports.back().Print(std::cout);
+
+    if (!reports.back().error.empty())
+    {
+      return -23;
+    }
+  }
+
+  if (reports.size() > 1)
+  {
+    std::cout << std::fixed << "Executors      tx/s   speedup" << std::endl;
+    for (auto const &report : reports)
+    {
+      std::cout << std::setw(9) << report.num_executors << std::setw(10) << report.rate()
+                << std::setw(10) << std::setprecision(2)
+                << (report.rate() / reports.front().rate()) << std::setprecision(1) << std::endl;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
+
 }  // namespace
 
 int main(int argc, char **argv)
@@ -891,6 +1039,10 @@ int main(int argc, char **argv)
   bool print_missing_txs{false};
   bool create_trimmed_tx_store{false};
   bool create_repaired_block_store{false};
+  bool replay{false};
+
+  ReplayConfig replay_config{};
+  std::string  replay_executors{};
 
   commandline::Params parser{};
   parser.description(
@@ -905,8 +1057,39 @@ int main(int argc, char **argv)
              "Create trimmed TX db store containing only such TXs which are required by "
              "block-chain & exist in original TX db store.",
              false);
+  parser.add(replay, "replay",
+             "Re-execute blocks of the heaviest chain against a copy of the node state, check the "
+             "resulting merkle roots & report the execution performance.",
+             false);
+  parser.add(replay_config.from, "replay-from", "Block index of the first block to replay.",
+             uint64_t{1});
+  parser.add(replay_config.count, "replay-count",
+             "Number of blocks to replay, 0 for all the blocks up to the chain head.", uint64_t{0});
+  parser.add(replay_executors, "replay-executors",
+             "Comma separated numbers of executors to replay the blocks with, e.g. \"1,2,4,8\". "
+             "The number of lanes is fixed by the recorded state.",
+             std::string{"1"});
   parser.Parse(argc, argv);
 
+  if (replay)
+  {
+    if (replay_config.from == 0)
+    {
+      std::cerr << "ERROR: The genesis block can not be replayed" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    try
+    {
+      replay_config.executors = ParseExecutorCounts(replay_executors);
+    }
+    catch (std::exception const &)
+    {
+      std::cerr << "ERROR: Invalid numbers of executors: " << replay_executors << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
   BlockStore block_store;
   block_store.Load("chain.db", "chain.index.db", false);
 
@@ -969,6 +1152,11 @@ int main(int argc, char **argv)
     return err;
   }
 
+  if (replay)
+  {
+    return ReplayChain(bch, heaviest_chain, tx_stores, replay_config);
+  }
+
   TxStoresPtr trimmed_tx_stores{};
   if (create_trimmed_tx_store)
   {
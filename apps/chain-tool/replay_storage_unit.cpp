@@ -0,0 +1,345 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "replay_storage_unit.hpp"
+
+#include "logging/logging.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+constexpr char const *LOGGING_NAME = "ReplayStorageUnit";
+
+constexpr char const *MERKLE_FILENAME_DOC   = "merkle_stack.db";
+constexpr char const *MERKLE_FILENAME_INDEX = "merkle_stack_index.db";
+
+/// The files which make up the state database of a lane (matches the lane service)
+constexpr char const *STATE_FILENAMES[] = {"state.db", "state_deltas.db", "state_index.db",
+                                           "state_index_deltas.db"};
+
+/// The history files have the bookmarks of each commit stored alongside them
+constexpr char const *HISTORY_FILENAMES[] = {"state_deltas.db", "state_index_deltas.db"};
+constexpr char const *HASH_HISTORY_PREFIX = "hash_history_";
+
+std::string GenerateLanePrefix(std::string const &prefix, std::size_t lane)
+{
+  std::ostringstream oss;
+  oss << prefix << "_lane" << std::setw(3) << std::setfill('0') << lane << "_";
+  return oss.str();
+}
+
+void CopyFile(std::string const &from, std::string const &to)
+{
+  std::ifstream source{from, std::ios::binary};
+  if (!source)
+  {
+    throw std::runtime_error("Unable to open " + from);
+  }
+
+  std::ofstream destination{to, std::ios::binary | std::ios::trunc};
+  destination << source.rdbuf();
+
+  if (!destination)
+  {
+    throw std::runtime_error("Unable to copy " + from + " to " + to);
+  }
+}
+
+}  // namespace
+
+/**
+ * Create a working copy of the state of a node
+ *
+ * @param log2_num_lanes The log2 of the number of lanes of the node
+ * @param source_prefix The storage prefix of the node, e.g. "node_storage"
+ * @param working_prefix The prefix of the working copies of the node files
+ */
+ReplayStorageUnit::ReplayStorageUnit(uint32_t log2_num_lanes, std::string const &source_prefix,
+                                     std::string const &working_prefix)
+  : log2_num_lanes_{log2_num_lanes}
+  , num_lanes_{std::size_t{1} << log2_num_lanes}
+  , current_merkle_{num_lanes_}
+{
+  for (std::size_t i = 0; i < num_lanes_; ++i)
+  {
+    std::string const source  = GenerateLanePrefix(source_prefix, i);
+    std::string const working = GenerateLanePrefix(working_prefix, i);
+
+    for (char const *filename : STATE_FILENAMES)
+    {
+      CopyFile(source + filename, working + filename);
+    }
+
+    for (char const *filename : HISTORY_FILENAMES)
+    {
+      CopyFile(HASH_HISTORY_PREFIX + source + filename, HASH_HISTORY_PREFIX + working + filename);
+    }
+
+    auto lane = std::make_unique<Lane>();
+    if (!lane->state.Load(working + "state.db", working + "state_deltas.db",
+                          working + "state_index.db", working + "state_index_deltas.db", false))
+    {
+      throw std::runtime_error("Unable to load the state of lane " + std::to_string(i));
+    }
+
+    lanes_.emplace_back(std::move(lane));
+  }
+
+  std::string const merkle_doc   = working_prefix + "_" + MERKLE_FILENAME_DOC;
+  std::string const merkle_index = working_prefix + "_" + MERKLE_FILENAME_INDEX;
+
+  CopyFile(MERKLE_FILENAME_DOC, merkle_doc);
+  CopyFile(MERKLE_FILENAME_INDEX, merkle_index);
+
+  merkle_stack_.Load(merkle_doc, merkle_index, false);
+
+  FETCH_LOG_INFO(LOGGING_NAME, "Loaded the state of ", num_lanes_,
+                 " lanes, size of merkle stack is: ", merkle_stack_.size());
+}
+
+ReplayStorageUnit::Document ReplayStorageUnit::Get(ResourceAddress const &key) const
+{
+  auto &lane = LookupLane(key);
+
+  FETCH_LOCK(lane.lock);
+  return lane.state.Get(key.as_resource_id());
+}
+
+ReplayStorageUnit::Document ReplayStorageUnit::GetOrCreate(ResourceAddress const &key)
+{
+  auto &lane = LookupLane(key);
+
+  FETCH_LOCK(lane.lock);
+  return lane.state.GetOrCreate(key.as_resource_id());
+}
+
+void ReplayStorageUnit::Set(ResourceAddress const &key, StateValue const &value)
+{
+  auto &lane = LookupLane(key);
+
+  FETCH_LOCK(lane.lock);
+  lane.state.Set(key.as_resource_id(), value);
+}
+
+// there are no other clients of the state, so the lanes never need to be locked
+bool ReplayStorageUnit::Lock(ShardIndex /*shard*/)
+{
+  return true;
+}
+
+bool ReplayStorageUnit::Unlock(ShardIndex /*shard*/)
+{
+  return true;
+}
+
+void ReplayStorageUnit::Reset()
+{
+  for (auto &lane : lanes_)
+  {
+    FETCH_LOCK(lane->lock);
+    lane->state.Reset();
+  }
+
+  FETCH_LOCK(merkle_lock_);
+  current_merkle_ = MerkleTree{num_lanes_};
+  while (merkle_stack_.size() != 0)
+  {
+    merkle_stack_.Pop();
+  }
+}
+
+void ReplayStorageUnit::AddTransaction(Transaction const &tx)
+{
+  FETCH_LOCK(tx_lock_);
+  txs_[tx.digest()] = std::make_shared<Transaction>(tx);
+}
+
+bool ReplayStorageUnit::GetTransaction(Digest const &digest, Transaction &tx)
+{
+  FETCH_LOCK(tx_lock_);
+
+  auto const it = txs_.find(digest);
+  if (it == txs_.end())
+  {
+    return false;
+  }
+
+  tx = *it->second;
+  return true;
+}
+
+ReplayStorageUnit::TransactionList ReplayStorageUnit::GetTransactions(DigestSet const &digests)
+{
+  TransactionList txs{};
+  txs.reserve(digests.size());
+
+  FETCH_LOCK(tx_lock_);
+  for (auto const &digest : digests)
+  {
+    auto const it = txs_.find(digest);
+    if (it != txs_.end())
+    {
+      txs.emplace_back(it->second);
+    }
+  }
+
+  return txs;
+}
+
+bool ReplayStorageUnit::HasTransaction(Digest const &digest)
+{
+  FETCH_LOCK(tx_lock_);
+  return txs_.find(digest) != txs_.end();
+}
+
+void ReplayStorageUnit::IssueCallForMissingTxs(DigestSet const & /*tx_set*/)
+{}
+
+ReplayStorageUnit::TxLayouts ReplayStorageUnit::PollRecentTx(uint32_t /*unused*/)
+{
+  return {};
+}
+
+ReplayStorageUnit::Hash ReplayStorageUnit::CurrentHash()
+{
+  MerkleTree tree{num_lanes_};
+
+  for (std::size_t i = 0; i < num_lanes_; ++i)
+  {
+    FETCH_LOCK(lanes_[i]->lock);
+    tree[i] = lanes_[i]->state.CurrentHash();
+  }
+
+  tree.CalculateRoot();
+
+  return tree.root();
+}
+
+ReplayStorageUnit::Hash ReplayStorageUnit::LastCommitHash()
+{
+  FETCH_LOCK(merkle_lock_);
+  return current_merkle_.root();
+}
+
+/**
+ * Revert the state of all the lanes to the one recorded in the merkle stack at a given index
+ *
+ * @param hash The expected merkle root at the index
+ * @param index The block number to revert to
+ * @return true if successful, otherwise false
+ */
+bool ReplayStorageUnit::RevertToHash(Hash const &hash, uint64_t index)
+{
+  FETCH_LOCK(merkle_lock_);
+
+  if (index >= merkle_stack_.size())
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Unable to revert to index ", index,
+                   " past the end of the merkle stack: ", merkle_stack_.size());
+    return false;
+  }
+
+  MerkleTree tree{num_lanes_};
+  if (!merkle_stack_.Get(index, tree) || (tree.root() != hash))
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Merkle stack at index ", index, " does not match: 0x",
+                   hash.ToHex());
+    return false;
+  }
+
+  for (std::size_t i = 0; i < num_lanes_; ++i)
+  {
+    FETCH_LOCK(lanes_[i]->lock);
+    if (!lanes_[i]->state.RevertToHash(tree[i]))
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Failed to revert lane ", i, " to 0x", tree[i].ToHex());
+      return false;
+    }
+  }
+
+  while (merkle_stack_.size() != index + 1)
+  {
+    merkle_stack_.Pop();
+  }
+
+  current_merkle_ = std::move(tree);
+
+  return true;
+}
+
+/**
+ * Commit the state of all the lanes and record it in the merkle stack
+ *
+ * @param commit_index The block number being committed
+ * @return The merkle root of the committed state
+ */
+ReplayStorageUnit::Hash ReplayStorageUnit::Commit(uint64_t commit_index)
+{
+  MerkleTree tree{num_lanes_};
+
+  for (std::size_t i = 0; i < num_lanes_; ++i)
+  {
+    FETCH_LOCK(lanes_[i]->lock);
+    tree[i] = lanes_[i]->state.Commit();
+  }
+
+  tree.CalculateRoot();
+
+  FETCH_LOCK(merkle_lock_);
+
+  while (merkle_stack_.size() != commit_index)
+  {
+    if (merkle_stack_.size() > commit_index)
+    {
+      merkle_stack_.Pop();
+    }
+    else
+    {
+      merkle_stack_.Push(MerkleTree{num_lanes_});
+    }
+  }
+
+  merkle_stack_.Push(tree);
+
+  current_merkle_ = std::move(tree);
+
+  return current_merkle_.root();
+}
+
+bool ReplayStorageUnit::HashExists(Hash const &hash, uint64_t index)
+{
+  FETCH_LOCK(merkle_lock_);
+
+  MerkleTree tree{num_lanes_};
+  return (index < merkle_stack_.size()) && merkle_stack_.Get(index, tree) && (tree.root() == hash);
+}
+
+std::size_t ReplayStorageUnit::num_transactions() const
+{
+  FETCH_LOCK(tx_lock_);
+  return txs_.size();
+}
+
+ReplayStorageUnit::Lane &ReplayStorageUnit::LookupLane(ResourceAddress const &key) const
+{
+  return *lanes_.at(key.lane(log2_num_lanes_));
+}
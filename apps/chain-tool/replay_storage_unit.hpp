@@ -0,0 +1,123 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "chain/transaction.hpp"
+#include "core/digest.hpp"
+#include "core/mutex.hpp"
+#include "crypto/merkle_tree.hpp"
+#include "ledger/storage_unit/storage_unit_interface.hpp"
+#include "storage/new_revertible_document_store.hpp"
+#include "storage/object_stack.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * An in process storage unit for replaying recorded blocks.
+ *
+ * The lane state databases and the merkle stack of a node are copied into a working set of files
+ * and served directly, without any lane services or RPC in between, so that a replay measures the
+ * execution of the blocks rather than the network. The merkle tree handling mirrors that of the
+ * storage unit client, so the state hashes produced can be checked against the recorded blocks.
+ *
+ * Transactions are held in memory and must be added before the blocks containing them are
+ * executed.
+ */
+class ReplayStorageUnit : public fetch::ledger::StorageUnitInterface
+{
+public:
+  using Transaction = fetch::chain::Transaction;
+  using Digest      = fetch::Digest;
+  using DigestSet   = fetch::DigestSet;
+
+  // Construction / Destruction
+  ReplayStorageUnit(uint32_t log2_num_lanes, std::string const &source_prefix,
+                    std::string const &working_prefix);
+  ReplayStorageUnit(ReplayStorageUnit const &) = delete;
+  ReplayStorageUnit(ReplayStorageUnit &&)      = delete;
+  ~ReplayStorageUnit() override                = default;
+
+  /// @name State Interface
+  /// @{
+  Document Get(ResourceAddress const &key) const override;
+  Document GetOrCreate(ResourceAddress const &key) override;
+  void     Set(ResourceAddress const &key, StateValue const &value) override;
+  bool     Lock(ShardIndex shard) override;
+  bool     Unlock(ShardIndex shard) override;
+  void     Reset() override;
+  /// @}
+
+  /// @name Transaction Interface
+  /// @{
+  void            AddTransaction(Transaction const &tx) override;
+  bool            GetTransaction(Digest const &digest, Transaction &tx) override;
+  TransactionList GetTransactions(DigestSet const &digests) override;
+  bool            HasTransaction(Digest const &digest) override;
+  void            IssueCallForMissingTxs(DigestSet const &tx_set) override;
+  /// @}
+
+  TxLayouts PollRecentTx(uint32_t /*unused*/) override;
+
+  /// @name Revertible Document Store Interface
+  /// @{
+  Hash CurrentHash() override;
+  Hash LastCommitHash() override;
+  bool RevertToHash(Hash const &hash, uint64_t index) override;
+  Hash Commit(uint64_t index) override;
+  bool HashExists(Hash const &hash, uint64_t index) override;
+  /// @}
+
+  std::size_t num_transactions() const;
+
+  // Operators
+  ReplayStorageUnit &operator=(ReplayStorageUnit const &) = delete;
+  ReplayStorageUnit &operator=(ReplayStorageUnit &&) = delete;
+
+private:
+  using MerkleTree   = fetch::crypto::MerkleTree;
+  using MerkleStack  = fetch::storage::ObjectStack<MerkleTree>;
+  using StateDb      = fetch::storage::NewRevertibleDocumentStore;
+  using Transactions = std::unordered_map<Digest, TransactionPtr>;
+
+  struct Lane
+  {
+    fetch::Mutex lock;
+    StateDb      state;
+  };
+
+  using LanePtr = std::unique_ptr<Lane>;
+  using Lanes   = std::vector<LanePtr>;
+
+  Lane &LookupLane(ResourceAddress const &key) const;
+
+  uint32_t const log2_num_lanes_;
+  std::size_t    num_lanes_;
+  Lanes          lanes_;
+
+  fetch::Mutex merkle_lock_;
+  MerkleTree   current_merkle_;
+  MerkleStack  merkle_stack_;
+
+  mutable fetch::Mutex tx_lock_;
+  Transactions         txs_;
+};
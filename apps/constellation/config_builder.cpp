@@ -81,6 +81,8 @@ Constellation::Config BuildConstellationConfig(Settings const &settings)
   cfg.network_mode          = GetNetworkMode(settings);
   cfg.features              = settings.experimental_features.value();
 
+  cfg.tx_trace_sample_interval = settings.tx_trace_sample_interval.value();
+
   return cfg;
 }
 
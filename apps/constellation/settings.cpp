@@ -79,6 +79,7 @@ Settings::Settings()
   , max_cabinet_size    {*this, "max-cabinet-size",      DEFAULT_CABINET_SIZE,       ""}
   , stake_delay_period    {*this, "stake-delay-period",      DEFAULT_STAKE_DELAY_PERIOD,   ""}
   , aeon_period           {*this, "aeon-period",             DEFAULT_AEON_PERIOD,          ""}
+  , tx_trace_sample_interval{*this, "tx-trace-sampling",     0,                            "Trace one in every N transactions through the pipeline, zero disables tracing"}
 {}
 // clang-format on
 
@@ -110,6 +110,11 @@ public:
   settings::Setting<uint64_t> aeon_period;
   /// @}
 
+  /// @name Diagnostics
+  /// @{
+  settings::Setting<uint32_t> tx_trace_sample_interval;
+  /// @}
+
   // Operators
   Settings &operator=(Settings const &) = delete;
   Settings &operator=(Settings &&) = delete;
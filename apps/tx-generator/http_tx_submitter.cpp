@@ -0,0 +1,105 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "http_tx_submitter.hpp"
+
+#include "chain/transaction_serializer.hpp"
+#include "core/byte_array/const_byte_array.hpp"
+#include "core/serializers/counter.hpp"
+#include "core/serializers/main_serializer.hpp"
+#include "http/method.hpp"
+#include "http/request.hpp"
+#include "http/response.hpp"
+#include "json/document.hpp"
+#include "logging/logging.hpp"
+
+#include <utility>
+#include <vector>
+
+using fetch::byte_array::ConstByteArray;
+using fetch::chain::TransactionSerializer;
+using fetch::http::HTTPRequest;
+using fetch::http::HTTPResponse;
+using fetch::http::Method;
+using fetch::serializers::MsgPackSerializer;
+using fetch::serializers::SizeCounter;
+
+namespace {
+
+constexpr char const *LOGGING_NAME = "HttpTxSubmitter";
+
+constexpr char const *SUBMIT_PATH       = "/api/contract/submit";
+constexpr char const *BULK_CONTENT_TYPE = "application/vnd.fetch-ai.transaction+bulk";
+
+}  // namespace
+
+HttpTxSubmitter::HttpTxSubmitter(std::string host, uint16_t port)
+  : host_{std::move(host)}
+  , port_{port}
+  , client_{std::make_unique<fetch::http::HttpClient>(host_, port_)}
+{}
+
+std::size_t HttpTxSubmitter::Submit(Batch::const_iterator begin, Batch::const_iterator end)
+{
+  // encode the transactions in the bulk format
+  std::vector<ConstByteArray> encoded_txs;
+  encoded_txs.reserve(static_cast<std::size_t>(end - begin));
+
+  TransactionSerializer serializer{};
+  for (auto it = begin; it != end; ++it)
+  {
+    serializer.Serialize(**it);
+    encoded_txs.emplace_back(serializer.data());
+  }
+
+  SizeCounter counter{};
+  counter << encoded_txs;
+
+  MsgPackSerializer buffer{};
+  buffer.Reserve(counter.size());
+  buffer << encoded_txs;
+
+  HTTPRequest request{};
+  request.SetMethod(Method::POST);
+  request.SetURI(SUBMIT_PATH);
+  request.AddHeader("Content-Type", BULK_CONTENT_TYPE);
+  request.SetBody(buffer.data());
+
+  HTTPResponse response{};
+  if (!client_->Request(request, response))
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Failed to submit batch of ", encoded_txs.size(), " txs");
+
+    // the connection may be broken, start afresh with the next batch
+    client_ = std::make_unique<fetch::http::HttpClient>(host_, port_);
+    return 0;
+  }
+
+  std::size_t submitted{0};
+  try
+  {
+    fetch::json::JSONDocument doc{response.body()};
+    submitted = doc["counts"]["submitted"].As<std::size_t>();
+  }
+  catch (std::exception const &ex)
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Unable to parse submission response: ", ex.what());
+  }
+
+  return submitted;
+}
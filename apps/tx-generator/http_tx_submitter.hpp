@@ -0,0 +1,56 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "http/http_client.hpp"
+#include "tx_submitter.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+/**
+ * Submits transactions to the contract HTTP interface of a node, in the bulk binary format. The
+ * underlying connection is kept open between batches, so every sending thread needs its own
+ * submitter.
+ */
+class HttpTxSubmitter : public TxSubmitter
+{
+public:
+  // Construction / Destruction
+  HttpTxSubmitter(std::string host, uint16_t port);
+  HttpTxSubmitter(HttpTxSubmitter const &) = delete;
+  HttpTxSubmitter(HttpTxSubmitter &&)      = delete;
+  ~HttpTxSubmitter() override              = default;
+
+  /// @name Submitter Interface
+  /// @{
+  std::size_t Submit(Batch::const_iterator begin, Batch::const_iterator end) override;
+  /// @}
+
+  // Operators
+  HttpTxSubmitter &operator=(HttpTxSubmitter const &) = delete;
+  HttpTxSubmitter &operator=(HttpTxSubmitter &&) = delete;
+
+private:
+  using ClientPtr = std::unique_ptr<fetch::http::HttpClient>;
+
+  std::string host_;
+  uint16_t    port_;
+  ClientPtr   client_;
+};
@@ -0,0 +1,100 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "key_selector.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+KeySelector::Distribution KeySelector::ParseDistribution(std::string const &name)
+{
+  if (name == "uniform")
+  {
+    return Distribution::UNIFORM;
+  }
+
+  if (name == "zipf")
+  {
+    return Distribution::ZIPF;
+  }
+
+  throw std::invalid_argument("Unknown key distribution: " + name);
+}
+
+KeySelector::KeySelector(Config const &config)
+  : config_{config}
+{
+  if (config_.num_keys == 0)
+  {
+    throw std::invalid_argument("At least one key is required");
+  }
+
+  if ((config_.hot_fraction < 0) || (config_.hot_fraction > 1))
+  {
+    throw std::invalid_argument("The hot spot fraction must be between 0 and 1");
+  }
+
+  config_.hot_keys = std::min(config_.hot_keys, config_.num_keys);
+
+  if (config_.distribution == Distribution::ZIPF)
+  {
+    cdf_.resize(config_.num_keys);
+
+    double total{0};
+    for (std::size_t i = 0; i < config_.num_keys; ++i)
+    {
+      total += 1.0 / std::pow(static_cast<double>(i + 1), config_.zipf_exponent);
+      cdf_[i] = total;
+    }
+
+    for (auto &value : cdf_)
+    {
+      value /= total;
+    }
+  }
+}
+
+/**
+ * Draw the index of the next key
+ *
+ * @param rng The random number generator of the calling thread
+ * @return The index of the key, smaller than the number of keys
+ */
+std::size_t KeySelector::Next(Rng &rng) const
+{
+  std::uniform_real_distribution<double> unit{0.0, 1.0};
+
+  if ((config_.hot_keys != 0) && (unit(rng) < config_.hot_fraction))
+  {
+    return std::uniform_int_distribution<std::size_t>{0, config_.hot_keys - 1}(rng);
+  }
+
+  if (config_.distribution == Distribution::ZIPF)
+  {
+    auto const it = std::upper_bound(cdf_.begin(), cdf_.end(), unit(rng));
+    return std::min(static_cast<std::size_t>(it - cdf_.begin()), config_.num_keys - 1);
+  }
+
+  return std::uniform_int_distribution<std::size_t>{0, config_.num_keys - 1}(rng);
+}
+
+std::size_t KeySelector::num_keys() const
+{
+  return config_.num_keys;
+}
@@ -0,0 +1,74 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Chooses which of the generated keys takes part in each transaction.
+ *
+ * Keys are drawn either uniformly or from a Zipf distribution, where key i is chosen with a
+ * probability proportional to 1 / (i + 1)^s. On top of either distribution a fraction of the
+ * draws can be redirected to a small set of hot keys, which reproduces the contention of a few
+ * very busy accounts.
+ */
+class KeySelector
+{
+public:
+  using Rng = std::mt19937_64;
+
+  enum class Distribution
+  {
+    UNIFORM,
+    ZIPF,
+  };
+
+  struct Config
+  {
+    std::size_t  num_keys{100};
+    Distribution distribution{Distribution::UNIFORM};
+    double       zipf_exponent{1.0};
+    std::size_t  hot_keys{0};      ///< The number of keys which are hot spots
+    double       hot_fraction{0};  ///< The fraction of draws which go to a hot spot
+  };
+
+  static Distribution ParseDistribution(std::string const &name);
+
+  // Construction / Destruction
+  explicit KeySelector(Config const &config);
+  KeySelector(KeySelector const &) = default;
+  KeySelector(KeySelector &&)      = default;
+  ~KeySelector()                   = default;
+
+  std::size_t Next(Rng &rng) const;
+
+  std::size_t num_keys() const;
+
+  // Operators
+  KeySelector &operator=(KeySelector const &) = default;
+  KeySelector &operator=(KeySelector &&) = default;
+
+private:
+  using Cdf = std::vector<double>;
+
+  Config config_;
+  Cdf    cdf_;  ///< Cumulative probabilities of the Zipf distribution
+};
@@ -0,0 +1,262 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "latency_tracker.hpp"
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "http/http_client_interface.hpp"
+#include "http/json_client.hpp"
+#include "variant/variant.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <numeric>
+#include <ostream>
+#include <utility>
+
+using fetch::byte_array::ConstByteArray;
+using fetch::http::JsonClient;
+using fetch::variant::Variant;
+
+namespace {
+
+using namespace std::chrono_literals;
+
+constexpr std::size_t HISTOGRAM_WIDTH = 50;
+
+/**
+ * Determine if the public status of a transaction is final, i.e. it has been executed, whether
+ * successfully or not
+ */
+bool IsFinal(std::string const &status)
+{
+  return !(status.empty() || (status == "Unknown") || (status == "Pending") ||
+           (status == "Mined") || (status == "Submitted"));
+}
+
+double Percentile(std::vector<double> const &ordered, double percent)
+{
+  auto const index =
+      static_cast<std::size_t>((static_cast<double>(ordered.size()) * percent) / 100.0);
+  return ordered[std::min(index, ordered.size() - 1)];
+}
+
+}  // namespace
+
+LatencyTracker::LatencyTracker(Config config)
+  : config_{std::move(config)}
+{
+  for (std::size_t i = 0; i < std::max<std::size_t>(config_.pollers, 1); ++i)
+  {
+    threads_.emplace_back(&LatencyTracker::Poll, this);
+  }
+}
+
+LatencyTracker::~LatencyTracker()
+{
+  running_ = false;
+
+  for (auto &thread : threads_)
+  {
+    thread.join();
+  }
+}
+
+/**
+ * Start tracking a transaction
+ *
+ * @param digest The digest of the transaction
+ * @param submitted The time at which the transaction was due to be submitted
+ */
+void LatencyTracker::Track(Digest const &digest, Timepoint submitted)
+{
+  std::lock_guard<std::mutex> guard(lock_);
+  pending_.push_back(Entry{digest, submitted, submitted + config_.poll_interval});
+}
+
+/**
+ * Wait until every tracked transaction has either reached a final status or timed out
+ *
+ * @param timeout The maximum time to wait
+ * @return true if nothing is pending any more, otherwise false
+ */
+bool LatencyTracker::WaitForCompletion(std::chrono::seconds timeout) const
+{
+  auto const deadline = Clock::now() + timeout;
+
+  while (pending() != 0)
+  {
+    if (Clock::now() >= deadline)
+    {
+      return false;
+    }
+
+    std::this_thread::sleep_for(100ms);
+  }
+
+  return true;
+}
+
+std::size_t LatencyTracker::completed() const
+{
+  std::lock_guard<std::mutex> guard(lock_);
+  return report_.latencies.size();
+}
+
+std::size_t LatencyTracker::pending() const
+{
+  std::lock_guard<std::mutex> guard(lock_);
+  return pending_.size() + in_flight_;
+}
+
+LatencyTracker::Report LatencyTracker::GetReport() const
+{
+  Report report{};
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    report         = report_;
+    report.pending = pending_.size() + in_flight_;
+  }
+
+  std::sort(report.latencies.begin(), report.latencies.end());
+
+  return report;
+}
+
+void LatencyTracker::Poll()
+{
+  JsonClient client{JsonClient::ConnectionMode::HTTP, config_.host, config_.port};
+
+  while (running_)
+  {
+    Entry entry{};
+    bool  available{false};
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      if (!pending_.empty())
+      {
+        entry = std::move(pending_.front());
+        pending_.pop_front();
+
+        ++in_flight_;
+        available = true;
+      }
+    }
+
+    if (!available)
+    {
+      std::this_thread::sleep_for(10ms);
+      continue;
+    }
+
+    // entries are appended in poll order, so the front one is always the next one due
+    std::this_thread::sleep_until(entry.next_poll);
+
+    ConstByteArray const endpoint{"/api/status/tx/" +
+                                  static_cast<std::string>(entry.digest.ToHex())};
+
+    std::string status{};
+    Variant     response{};
+    if (client.Get(endpoint, response))
+    {
+      if (response.IsObject() && response.Has("status") && response["status"].IsString())
+      {
+        status = response["status"].As<std::string>();
+      }
+    }
+    else
+    {
+      // the connection may be broken, start afresh with the next request
+      client = JsonClient{JsonClient::ConnectionMode::HTTP, config_.host, config_.port};
+    }
+
+    auto const now = Clock::now();
+
+    std::lock_guard<std::mutex> guard(lock_);
+    --in_flight_;
+
+    if (IsFinal(status))
+    {
+      report_.latencies.push_back(std::chrono::duration<double>(now - entry.submitted).count());
+      ++report_.statuses[status];
+    }
+    else if ((now - entry.submitted) >= config_.timeout)
+    {
+      ++report_.timed_out;
+    }
+    else
+    {
+      entry.next_poll = now + config_.poll_interval;
+      pending_.push_back(std::move(entry));
+    }
+  }
+}
+
+/**
+ * Print the latency percentiles along with a histogram with power of two buckets
+ *
+ * @param stream The output stream
+ */
+void LatencyTracker::Report::Print(std::ostream &stream) const
+{
+  stream << "Latency (due submission -> final status) of " << latencies.size()
+         << " transactions:\n";
+
+  if (!latencies.empty())
+  {
+    double const total = std::accumulate(latencies.begin(), latencies.end(), 0.0);
+    double const mean  = total / static_cast<double>(latencies.size());
+
+    stream << std::fixed << std::setprecision(1);
+    stream << "  mean: " << (mean * 1e3) << " ms  p50: " << (Percentile(latencies, 50) * 1e3)
+           << " ms  p90: " << (Percentile(latencies, 90) * 1e3)
+           << " ms  p99: " << (Percentile(latencies, 99) * 1e3)
+           << " ms  p99.9: " << (Percentile(latencies, 99.9) * 1e3)
+           << " ms  max: " << (latencies.back() * 1e3) << " ms\n";
+
+    // count the latencies into buckets of [2^(i-1), 2^i) milliseconds
+    std::vector<std::size_t> buckets;
+    for (double const latency : latencies)
+    {
+      std::size_t index{0};
+      for (double limit = 1e-3; latency >= limit; limit *= 2)
+      {
+        ++index;
+      }
+
+      buckets.resize(std::max(buckets.size(), index + 1));
+      ++buckets[index];
+    }
+
+    std::size_t const largest = *std::max_element(buckets.begin(), buckets.end());
+    for (std::size_t i = 0; i < buckets.size(); ++i)
+    {
+      std::size_t const bars = (buckets[i] * HISTOGRAM_WIDTH + largest - 1) / largest;
+
+      stream << "  < " << std::setw(8) << (uint64_t{1} << i) << " ms | " << std::setw(8)
+             << buckets[i] << " " << std::string(bars, '#') << '\n';
+    }
+  }
+
+  for (auto const &entry : statuses)
+  {
+    stream << "  " << entry.first << ": " << entry.second << '\n';
+  }
+
+  stream << "  Timed out: " << timed_out << "  Still pending: " << pending << std::endl;
+}
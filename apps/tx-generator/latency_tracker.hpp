@@ -0,0 +1,111 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/digest.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Measures the end to end latency of transactions, from the time they were due to be submitted
+ * until the node reports them as executed.
+ *
+ * Tracked transactions are polled through the transaction status HTTP interface of the node by a
+ * set of background threads, so the resolution of the measurements is the poll interval.
+ */
+class LatencyTracker
+{
+public:
+  using Clock     = std::chrono::steady_clock;
+  using Timepoint = Clock::time_point;
+  using Digest    = fetch::Digest;
+
+  struct Config
+  {
+    std::string               host{"127.0.0.1"};
+    uint16_t                  port{8000};
+    std::size_t               pollers{2};
+    std::chrono::milliseconds poll_interval{100};
+    std::chrono::seconds      timeout{60};
+  };
+
+  struct Report
+  {
+    using StatusCounts = std::map<std::string, std::size_t>;
+
+    std::vector<double> latencies;  ///< Seconds until a final status, ordered
+    StatusCounts        statuses;   ///< The number of transactions in each final status
+    std::size_t         timed_out{0};
+    std::size_t         pending{0};
+
+    void Print(std::ostream &stream) const;
+  };
+
+  // Construction / Destruction
+  explicit LatencyTracker(Config config);
+  LatencyTracker(LatencyTracker const &) = delete;
+  LatencyTracker(LatencyTracker &&)      = delete;
+  ~LatencyTracker();
+
+  void Track(Digest const &digest, Timepoint submitted);
+  bool WaitForCompletion(std::chrono::seconds timeout) const;
+
+  /// @name Accessors
+  /// @{
+  std::size_t completed() const;
+  std::size_t pending() const;
+  Report      GetReport() const;
+  /// @}
+
+  // Operators
+  LatencyTracker &operator=(LatencyTracker const &) = delete;
+  LatencyTracker &operator=(LatencyTracker &&) = delete;
+
+private:
+  struct Entry
+  {
+    Digest    digest;
+    Timepoint submitted;
+    Timepoint next_poll;
+  };
+
+  using Entries = std::deque<Entry>;
+  using Threads = std::vector<std::thread>;
+
+  void Poll();
+
+  Config const config_;
+
+  mutable std::mutex lock_;
+  Entries            pending_;
+  std::size_t        in_flight_{0};  ///< Entries taken by a poller which are not yet resolved
+  Report             report_;
+
+  std::atomic<bool> running_{true};
+  Threads           threads_;
+};
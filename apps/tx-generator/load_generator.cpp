@@ -0,0 +1,178 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "load_generator.hpp"
+
+#include "latency_tracker.hpp"
+#include "logging/logging.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using namespace std::chrono_literals;
+
+constexpr char const *LOGGING_NAME = "LoadGenerator";
+
+constexpr auto START_DELAY     = 100ms;
+constexpr auto REPORT_INTERVAL = 1s;
+
+using Seconds = std::chrono::duration<double>;
+
+}  // namespace
+
+double LoadGenerator::Result::rate() const
+{
+  return (elapsed > 0) ? static_cast<double>(sent) / elapsed : 0.0;
+}
+
+LoadGenerator::LoadGenerator(Config const &config, TxSubmitterFactory factory,
+                             LatencyTracker *tracker)
+  : config_{config}
+  , factory_{std::move(factory)}
+  , tracker_{tracker}
+{
+  if (config_.rate <= 0)
+  {
+    throw std::invalid_argument("The target rate must be positive");
+  }
+
+  config_.threads     = std::max<std::size_t>(config_.threads, 1);
+  config_.batch_size  = std::max<std::size_t>(config_.batch_size, 1);
+  config_.track_every = std::max<std::size_t>(config_.track_every, 1);
+}
+
+/**
+ * Submit a set of transactions at the configured rate
+ *
+ * @param txs The transactions, in the order they are due
+ * @return The statistics of the run
+ */
+LoadGenerator::Result LoadGenerator::Run(Batch const &txs)
+{
+  std::size_t const batch_size  = config_.batch_size;
+  std::size_t const num_batches = (txs.size() + batch_size - 1) / batch_size;
+  std::size_t const num_threads = std::max<std::size_t>(std::min(config_.threads, num_batches), 1);
+  Seconds const     interval{static_cast<double>(batch_size) / config_.rate};
+
+  // connect every sending thread before the clock starts
+  std::vector<TxSubmitterPtr> submitters;
+  for (std::size_t i = 0; i < num_threads; ++i)
+  {
+    submitters.emplace_back(factory_());
+  }
+
+  std::atomic<std::size_t> sent{0};
+  std::atomic<std::size_t> accepted{0};
+  std::atomic<std::size_t> running{num_threads};
+  std::vector<Duration>    lags(num_threads, Duration::zero());
+  auto const               start = Clock::now() + START_DELAY;
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&, t]() {
+      TxSubmitter &submitter = *submitters[t];
+
+      for (std::size_t b = t; b < num_batches; b += num_threads)
+      {
+        auto const due = start + std::chrono::duration_cast<Duration>(interval * b);
+        std::this_thread::sleep_until(due);
+
+        lags[t] = std::max<Duration>(lags[t], Clock::now() - due);
+
+        std::size_t const first = b * batch_size;
+        std::size_t const last  = std::min(first + batch_size, txs.size());
+
+        std::size_t count{0};
+        try
+        {
+          count = submitter.Submit(txs.begin() + static_cast<std::ptrdiff_t>(first),
+                                   txs.begin() + static_cast<std::ptrdiff_t>(last));
+        }
+        catch (std::exception const &ex)
+        {
+          FETCH_LOG_WARN(LOGGING_NAME, "Submission failed: ", ex.what());
+        }
+
+        sent += last - first;
+        accepted += count;
+
+        // partially rejected batches are not tracked since which ones failed is not known
+        if ((tracker_ != nullptr) && (count == (last - first)))
+        {
+          for (std::size_t i = first; i < last; ++i)
+          {
+            if ((i % config_.track_every) == 0)
+            {
+              tracker_->Track(txs[i]->digest(), due);
+            }
+          }
+        }
+      }
+
+      --running;
+    });
+  }
+
+  // report the progress of the run until all the batches have been sent
+  auto next_report = start + REPORT_INTERVAL;
+  while (running != 0)
+  {
+    std::this_thread::sleep_for(10ms);
+
+    auto const now = Clock::now();
+    if (now >= next_report)
+    {
+      double const elapsed = Seconds{now - start}.count();
+
+      std::cout << "[" << static_cast<std::size_t>(elapsed) << "s] sent: " << sent
+                << " accepted: " << accepted
+                << " rate: " << static_cast<std::size_t>(static_cast<double>(sent) / elapsed)
+                << " tx/s";
+
+      if (tracker_ != nullptr)
+      {
+        std::cout << " completed: " << tracker_->completed() << " pending: " << tracker_->pending();
+      }
+
+      std::cout << std::endl;
+
+      next_report += REPORT_INTERVAL;
+    }
+  }
+
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  Result result{};
+  result.sent     = sent;
+  result.accepted = accepted;
+  result.elapsed  = Seconds{Clock::now() - start}.count();
+  result.max_lag  = *std::max_element(lags.begin(), lags.end());
+
+  return result;
+}
@@ -0,0 +1,77 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "tx_submitter.hpp"
+
+#include <chrono>
+#include <cstddef>
+
+class LatencyTracker;
+
+/**
+ * Open loop load generator.
+ *
+ * Batches of transactions are due at fixed times derived from the target rate, independently of
+ * how quickly the node accepts them. The batches are spread round robin over a number of sending
+ * threads, so a slow submission only delays the batches of one thread. Latencies are measured
+ * from the time a batch was due rather than the time it was sent, so a node which falls behind
+ * shows up in the latencies instead of silently lowering the offered load.
+ */
+class LoadGenerator
+{
+public:
+  using Clock    = std::chrono::steady_clock;
+  using Duration = Clock::duration;
+  using Batch    = TxSubmitter::Batch;
+
+  struct Config
+  {
+    double      rate{1000};       ///< Transactions per second
+    std::size_t threads{4};       ///< Number of sending threads
+    std::size_t batch_size{10};   ///< Transactions per submission
+    std::size_t track_every{10};  ///< Track the latency of one in every N transactions
+  };
+
+  struct Result
+  {
+    std::size_t sent{0};
+    std::size_t accepted{0};
+    double      elapsed{0};  ///< Seconds from the first batch being due until the last was sent
+    Duration    max_lag{};   ///< Largest delay between a batch being due and being sent
+
+    double rate() const;
+  };
+
+  // Construction / Destruction
+  LoadGenerator(Config const &config, TxSubmitterFactory factory, LatencyTracker *tracker);
+  LoadGenerator(LoadGenerator const &) = delete;
+  LoadGenerator(LoadGenerator &&)      = delete;
+  ~LoadGenerator()                     = default;
+
+  Result Run(Batch const &txs);
+
+  // Operators
+  LoadGenerator &operator=(LoadGenerator const &) = delete;
+  LoadGenerator &operator=(LoadGenerator &&) = delete;
+
+private:
+  Config             config_;
+  TxSubmitterFactory factory_;
+  LatencyTracker *   tracker_;
+};
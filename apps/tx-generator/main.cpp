@@ -16,128 +16,109 @@
 //
 //------------------------------------------------------------------------------
 
-#include "chain/transaction.hpp"
-#include "chain/transaction_builder.hpp"
+#include "http_tx_submitter.hpp"
+#include "key_selector.hpp"
+#include "latency_tracker.hpp"
+#include "load_generator.hpp"
+#include "tx_factory.hpp"
+
 #include "chain/transaction_serializer.hpp"
-#include "core/byte_array/byte_array.hpp"
+#include "core/byte_array/const_byte_array.hpp"
 #include "core/commandline/params.hpp"
 #include "core/serializers/counter.hpp"
 #include "core/serializers/main_serializer.hpp"
-#include "crypto/ecdsa.hpp"
-#include "storage/resource_mapper.hpp"
-#include "vectorise/threading/pool.hpp"
+#include "logging/logging.hpp"
 
 #include <chrono>
+#include <cstdlib>
 #include <fstream>
+#include <iostream>
 #include <memory>
-#include <random>
+#include <string>
 #include <vector>
 
-using fetch::commandline::Params;
-using fetch::crypto::ECDSASigner;
-using fetch::threading::Pool;
 using fetch::byte_array::ConstByteArray;
-using fetch::chain::TransactionBuilder;
 using fetch::chain::TransactionSerializer;
-using fetch::chain::Address;
+using fetch::commandline::Params;
 using fetch::serializers::MsgPackSerializer;
 using fetch::serializers::SizeCounter;
-using fetch::BitVector;
-using fetch::storage::ResourceAddress;
 
-using KeyPtr       = std::unique_ptr<ECDSASigner>;
-using KeyArray     = std::vector<KeyPtr>;
-using AddressArray = std::vector<Address>;
-using Clock        = std::chrono::high_resolution_clock;
+namespace {
 
-constexpr std::size_t NUM_TRANSFERS = 1;
+constexpr char const *LOGGING_NAME = "TxGenerator";
 
-int main(int argc, char **argv)
+using Clock        = std::chrono::steady_clock;
+using Seconds      = std::chrono::duration<double>;
+using Transactions = TxFactory::Transactions;
+
+struct Settings
 {
+  // general
+  std::string mode{};
+  std::string host{};
+  uint16_t    port{0};
+  uint32_t    log2_lanes{0};
+
+  // load
+  double      rate{0};
+  double      duration{0};
+  std::size_t threads{0};
+  std::size_t batch{0};
   std::size_t count{0};
-  std::size_t key_count{0};
   std::string output{};
 
-  // build the parser
-  Params parser{};
-  parser.add(count, "count", "The number of tx to generate");
-  parser.add(key_count, "keys", "The number of tx to generate", std::size_t{100});
-  parser.add(output, "output", "The file being generated", std::string{"out.bin"});
-
-  // parse the command line
-  parser.Parse(argc, argv);
+  // keys
+  std::size_t num_keys{0};
+  std::string distribution{};
+  double      zipf_exponent{0};
+  std::size_t hot_keys{0};
+  double      hot_fraction{0};
+  uint32_t    fund{0};
 
-  KeyArray     keys(key_count);
-  AddressArray addresses(key_count);
+  // contract calls
+  double      contract_fraction{0};
+  std::string contract{};
+  std::string action{};
+  std::string data{};
 
-  // create all the keys
-  Pool pool{};
-
-  std::vector<ConstByteArray> encoded_txs(count);
+  // latency tracking
+  std::size_t track_every{0};
+  std::size_t pollers{0};
+  uint32_t    poll_interval_ms{0};
+  uint32_t    timeout_s{0};
+};
 
+Transactions Generate(TxFactory const &factory, std::size_t count)
+{
   std::cout << "Generating tx..." << std::endl;
   auto const started = Clock::now();
 
-  // create all the transactions
-  std::size_t const num_tx_per_thread = (count + pool.concurrency() - 1) / pool.concurrency();
-  for (std::size_t i = 0; i < pool.concurrency(); ++i)
-  {
-    // compute the range of data to be populated
-    std::size_t const start = num_tx_per_thread * i;
-    std::size_t const end   = std::min(count, start + num_tx_per_thread);
-
-    pool.Dispatch([start, end, &encoded_txs]() {
-      static constexpr std::size_t LOG2_VECTOR_SIZE = 7u;
-      static constexpr std::size_t VECTOR_SIZE      = 1u << LOG2_VECTOR_SIZE;
-
-      BitVector vector{VECTOR_SIZE};
-
-      TransactionSerializer serializer{};
-      for (std::size_t j = start; j < end; ++j)
-      {
-        // generate a new key for this transaction
-        ECDSASigner from;
-        Address     from_address{from.identity()};
-
-        // determine the resource
-        ResourceAddress const resource{"fetch.token.state." + from_address.display()};
-
-        // generate the correct shard mask
-        vector.SetAllZero();
-        vector.set(resource.lane(LOG2_VECTOR_SIZE), 1);  // set the lane for the tx
-
-        // form the transaction
-        TransactionBuilder builder{};
-        builder.ValidUntil(1000000u);
-        builder.ChargeLimit(NUM_TRANSFERS * 5u);
-        builder.ChargeRate(1u);
-        builder.TargetChainCode("fetch.token", vector);
-        builder.Action("wealth");
-        builder.Data(R"({"amount": 1000})");
-        builder.Signer(from.identity());
-        builder.From(from_address);
-
-        // finalise the transaction
-        auto tx = builder.Seal().Sign(from).Build();
-
-        // serialize the transaction
-        serializer.Serialize(*tx);
-        encoded_txs[j] = serializer.data();
-      }
-    });
-  }
-
-  pool.Wait();
-  auto const stopped = Clock::now();
+  auto txs = factory.Create(count);
 
-  auto const delta_ns = (stopped - started).count();
+  double const elapsed = Seconds{Clock::now() - started}.count();
+  std::cout << "Generating tx...complete (tx rate: " << (static_cast<double>(count) / elapsed)
+            << ")" << std::endl;
 
-  auto const tx_rate =
-      (static_cast<double>(encoded_txs.size()) * 1e9) / static_cast<double>(delta_ns);
-  std::cout << "Generating tx...complete (tx rate: " << tx_rate << ")" << std::endl;
+  return txs;
+}
 
+/**
+ * Write the transactions to a file in the bulk submission format
+ */
+int WriteToFile(Transactions const &txs, std::string const &output)
+{
   std::cout << "Generating contents..." << std::endl;
 
+  std::vector<ConstByteArray> encoded_txs;
+  encoded_txs.reserve(txs.size());
+
+  TransactionSerializer serializer{};
+  for (auto const &tx : txs)
+  {
+    serializer.Serialize(*tx);
+    encoded_txs.emplace_back(serializer.data());
+  }
+
   // determine the size
   SizeCounter counter{};
   counter << encoded_txs;
@@ -158,3 +139,184 @@ int main(int argc, char **argv)
 
   return EXIT_SUCCESS;
 }
+
+/**
+ * Credit every key with tokens and wait for the credits to be executed
+ */
+bool Fund(TxFactory const &factory, TxSubmitter &submitter, LatencyTracker::Config config)
+{
+  std::cout << "Funding keys..." << std::endl;
+
+  auto const txs = factory.CreateFunding();
+  if (submitter.Submit(txs.begin(), txs.end()) != txs.size())
+  {
+    std::cerr << "Unable to submit the funding transactions" << std::endl;
+    return false;
+  }
+
+  LatencyTracker tracker{config};
+
+  auto const now = Clock::now();
+  for (auto const &tx : txs)
+  {
+    tracker.Track(tx->digest(), now);
+  }
+
+  bool const success = tracker.WaitForCompletion(config.timeout);
+  std::cout << "Funding keys..." << (success ? "complete" : "timed out") << std::endl;
+
+  return success;
+}
+
+int RunLoad(Settings const &settings, TxFactory const &factory)
+{
+  // create the means of submitting transactions
+  TxSubmitterFactory submitters{};
+  if (settings.mode == "http")
+  {
+    submitters = [&settings]() {
+      return std::make_shared<HttpTxSubmitter>(settings.host, settings.port);
+    };
+  }
+  else
+  {
+    std::cerr << "Invalid mode: " << settings.mode << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  LatencyTracker::Config tracker_config{};
+  tracker_config.host          = settings.host;
+  tracker_config.port          = settings.port;
+  tracker_config.pollers       = settings.pollers;
+  tracker_config.poll_interval = std::chrono::milliseconds{settings.poll_interval_ms};
+  tracker_config.timeout       = std::chrono::seconds{settings.timeout_s};
+
+  if ((settings.fund != 0) && !Fund(factory, *submitters(), tracker_config))
+  {
+    return EXIT_FAILURE;
+  }
+
+  auto const count = static_cast<std::size_t>(settings.rate * settings.duration);
+  auto const txs   = Generate(factory, count);
+
+  std::unique_ptr<LatencyTracker> tracker;
+  if (settings.track_every != 0)
+  {
+    tracker = std::make_unique<LatencyTracker>(tracker_config);
+  }
+
+  LoadGenerator::Config config{};
+  config.rate        = settings.rate;
+  config.threads     = settings.threads;
+  config.batch_size  = settings.batch;
+  config.track_every = settings.track_every;
+
+  std::cout << "Submitting " << count << " tx at " << settings.rate << " tx/s..." << std::endl;
+
+  LoadGenerator generator{config, std::move(submitters), tracker.get()};
+  auto const    result = generator.Run(txs);
+
+  std::cout << "Submitting...complete (sent: " << result.sent << " accepted: " << result.accepted
+            << " rate: " << result.rate() << " tx/s max lag: "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(result.max_lag).count()
+            << " ms)" << std::endl;
+
+  if (tracker)
+  {
+    std::cout << "Waiting for execution..." << std::endl;
+    tracker->WaitForCompletion(tracker_config.timeout);
+    tracker->GetReport().Print(std::cout);
+  }
+
+  return (result.accepted == result.sent) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+  Settings settings{};
+
+  // build the parser
+  Params parser{};
+  parser.description("Open loop transaction load generator");
+
+  parser.add(settings.mode, "mode", "How the txs are delivered: http or file",
+             std::string{"http"});
+  parser.add(settings.host, "host", "The host of the node", std::string{"127.0.0.1"});
+  parser.add(settings.port, "port", "The HTTP port of the node", uint16_t{8000});
+  parser.add(settings.log2_lanes, "log2-lanes", "The log2 of the number of lanes", uint32_t{0});
+
+  parser.add(settings.rate, "rate", "The target rate in tx per second", 1000.0);
+  parser.add(settings.duration, "duration", "The duration of the run in seconds", 10.0);
+  parser.add(settings.threads, "threads", "The number of sending threads", std::size_t{4});
+  parser.add(settings.batch, "batch", "The number of tx per submission", std::size_t{10});
+  parser.add(settings.count, "count", "The number of tx to generate in file mode",
+             std::size_t{0});
+  parser.add(settings.output, "output", "The file generated in file mode",
+             std::string{"out.bin"});
+
+  parser.add(settings.num_keys, "keys", "The number of keys to generate", std::size_t{100});
+  parser.add(settings.distribution, "distribution", "How keys are chosen: uniform or zipf",
+             std::string{"uniform"});
+  parser.add(settings.zipf_exponent, "zipf-exponent", "The exponent of the zipf distribution",
+             1.0);
+  parser.add(settings.hot_keys, "hot-keys", "The number of hot spot keys", std::size_t{0});
+  parser.add(settings.hot_fraction, "hot-fraction", "The fraction of tx using a hot spot key",
+             0.0);
+  parser.add(settings.fund, "fund", "Credit every key with tokens before the run", uint32_t{1});
+
+  parser.add(settings.contract_fraction, "contract-fraction",
+             "The fraction of tx which call a smart contract", 0.0);
+  parser.add(settings.contract, "contract", "The address of the smart contract", std::string{});
+  parser.add(settings.action, "action", "The smart contract action to call", std::string{});
+  parser.add(settings.data, "data", "The JSON arguments of the action", std::string{"{}"});
+
+  parser.add(settings.track_every, "track-every",
+             "Track the latency of one in every N tx, zero disables tracking", std::size_t{10});
+  parser.add(settings.pollers, "pollers", "The number of tx status polling threads",
+             std::size_t{4});
+  parser.add(settings.poll_interval_ms, "poll-interval", "The tx status poll interval in ms",
+             uint32_t{100});
+  parser.add(settings.timeout_s, "timeout", "The time in seconds to wait for a tx to execute",
+             uint32_t{120});
+
+  // parse the command line
+  parser.Parse(argc, argv);
+
+  int exit_code = EXIT_FAILURE;
+
+  try
+  {
+    KeySelector::Config key_config{};
+    key_config.num_keys      = settings.num_keys;
+    key_config.distribution  = KeySelector::ParseDistribution(settings.distribution);
+    key_config.zipf_exponent = settings.zipf_exponent;
+    key_config.hot_keys      = settings.hot_keys;
+    key_config.hot_fraction  = settings.hot_fraction;
+
+    TxFactory::Config tx_config{};
+    tx_config.log2_num_lanes    = settings.log2_lanes;
+    tx_config.contract_fraction = settings.contract_fraction;
+    tx_config.contract          = settings.contract;
+    tx_config.action            = settings.action;
+    tx_config.data              = settings.data;
+
+    TxFactory const factory{KeySelector{key_config}, tx_config};
+
+    if (settings.mode == "file")
+    {
+      exit_code = WriteToFile(Generate(factory, settings.count), settings.output);
+    }
+    else
+    {
+      exit_code = RunLoad(settings, factory);
+    }
+  }
+  catch (std::exception const &ex)
+  {
+    FETCH_LOG_ERROR(LOGGING_NAME, "Fatal Error: ", ex.what());
+  }
+
+  return exit_code;
+}
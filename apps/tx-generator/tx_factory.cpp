@@ -0,0 +1,177 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "tx_factory.hpp"
+
+#include "chain/transaction.hpp"
+#include "core/bitvector.hpp"
+#include "storage/resource_mapper.hpp"
+#include "vectorise/threading/pool.hpp"
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+using fetch::BitVector;
+using fetch::chain::TransactionBuilder;
+using fetch::storage::ResourceAddress;
+using fetch::threading::Pool;
+
+namespace {
+
+constexpr uint64_t VALID_UNTIL = 1000000u;
+
+}  // namespace
+
+TxFactory::TxFactory(KeySelector selector, Config const &config)
+  : selector_{std::move(selector)}
+  , config_{config}
+{
+  if (config_.contract_fraction > 0)
+  {
+    if (!Address::Parse(config_.contract, contract_))
+    {
+      throw std::invalid_argument("Invalid contract address: " + config_.contract);
+    }
+
+    if (config_.action.empty())
+    {
+      throw std::invalid_argument("A contract action is required for contract calls");
+    }
+  }
+
+  keys_.reserve(selector_.num_keys());
+  addresses_.reserve(selector_.num_keys());
+  for (std::size_t i = 0; i < selector_.num_keys(); ++i)
+  {
+    keys_.emplace_back(std::make_unique<Signer>());
+    addresses_.emplace_back(keys_.back()->identity());
+  }
+}
+
+/**
+ * Create a transaction for every key which credits it with enough tokens for the run
+ *
+ * @return The funding transactions
+ */
+TxFactory::Transactions TxFactory::CreateFunding() const
+{
+  Transactions txs;
+  txs.reserve(keys_.size());
+
+  Rng rng{std::random_device{}()};
+  for (std::size_t i = 0; i < keys_.size(); ++i)
+  {
+    ResourceAddress const resource{"fetch.token.state." + addresses_[i].display()};
+
+    BitVector shard_mask{1u << config_.log2_num_lanes};
+    shard_mask.set(resource.lane(config_.log2_num_lanes), 1);
+
+    TransactionBuilder builder{};
+    builder.ValidUntil(VALID_UNTIL);
+    builder.Counter(rng());
+    builder.ChargeLimit(config_.charge_limit);
+    builder.ChargeRate(1u);
+    builder.TargetChainCode("fetch.token", shard_mask);
+    builder.Action("wealth");
+    builder.Data(R"({"amount": )" + std::to_string(config_.funding_amount) + "}");
+    builder.Signer(keys_[i]->identity());
+    builder.From(addresses_[i]);
+
+    txs.emplace_back(builder.Seal().Sign(*keys_[i]).Build());
+  }
+
+  return txs;
+}
+
+/**
+ * Create and sign a number of transactions, spreading the signing over all the cores
+ *
+ * @param count The number of transactions
+ * @return The signed transactions
+ */
+TxFactory::Transactions TxFactory::Create(std::size_t count) const
+{
+  Transactions txs(count);
+
+  Pool pool{};
+
+  std::size_t const num_tx_per_thread = (count + pool.concurrency() - 1) / pool.concurrency();
+  for (std::size_t i = 0; i < pool.concurrency(); ++i)
+  {
+    // compute the range of data to be populated
+    std::size_t const start = num_tx_per_thread * i;
+    std::size_t const end   = std::min(count, start + num_tx_per_thread);
+
+    pool.Dispatch([this, start, end, &txs]() {
+      Rng                         rng{std::random_device{}()};
+      std::bernoulli_distribution contract_call{config_.contract_fraction};
+
+      for (std::size_t j = start; j < end; ++j)
+      {
+        txs[j] = contract_call(rng) ? CreateContractCall(rng) : CreateTransfer(rng);
+      }
+    });
+  }
+
+  pool.Wait();
+
+  return txs;
+}
+
+TxFactory::TransactionPtr TxFactory::CreateTransfer(Rng &rng) const
+{
+  std::size_t const from = selector_.Next(rng);
+  std::size_t const to   = selector_.Next(rng);
+
+  return TransactionBuilder()
+      .From(addresses_[from])
+      .Transfer(addresses_[to], config_.transfer_amount)
+      .ValidUntil(VALID_UNTIL)
+      .Counter(rng())
+      .ChargeRate(1u)
+      .ChargeLimit(config_.charge_limit)
+      .Signer(keys_[from]->identity())
+      .Seal()
+      .Sign(*keys_[from])
+      .Build();
+}
+
+TxFactory::TransactionPtr TxFactory::CreateContractCall(Rng &rng) const
+{
+  std::size_t const from = selector_.Next(rng);
+
+  // the resources of the contract are not known up front, so the call spans every lane
+  BitVector shard_mask{1u << config_.log2_num_lanes};
+  shard_mask.SetAllOne();
+
+  return TransactionBuilder()
+      .From(addresses_[from])
+      .TargetSmartContract(contract_, shard_mask)
+      .Action(config_.action)
+      .Data(config_.data)
+      .ValidUntil(VALID_UNTIL)
+      .Counter(rng())
+      .ChargeRate(1u)
+      .ChargeLimit(config_.charge_limit)
+      .Signer(keys_[from]->identity())
+      .Seal()
+      .Sign(*keys_[from])
+      .Build();
+}
@@ -0,0 +1,82 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "chain/address.hpp"
+#include "chain/transaction_builder.hpp"
+#include "crypto/ecdsa.hpp"
+#include "key_selector.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Creates signed transactions between a fixed set of keys. Every transaction is either a token
+ * transfer or, for a configurable fraction, a call to an action of a smart contract.
+ */
+class TxFactory
+{
+public:
+  using TransactionPtr = fetch::chain::TransactionBuilder::TransactionPtr;
+  using Transactions   = std::vector<TransactionPtr>;
+  using Rng            = KeySelector::Rng;
+
+  struct Config
+  {
+    uint32_t    log2_num_lanes{0};
+    double      contract_fraction{0};  ///< The fraction of the transactions calling the contract
+    std::string contract{};            ///< The address of the smart contract
+    std::string action{};              ///< The action of the smart contract
+    std::string data{};                ///< The JSON encoded arguments of the action
+    uint64_t    transfer_amount{1};
+    uint64_t    funding_amount{1000000000};
+    uint64_t    charge_limit{5};
+  };
+
+  // Construction / Destruction
+  TxFactory(KeySelector selector, Config const &config);
+  TxFactory(TxFactory const &) = delete;
+  TxFactory(TxFactory &&)      = delete;
+  ~TxFactory()                 = default;
+
+  Transactions CreateFunding() const;
+  Transactions Create(std::size_t count) const;
+
+  // Operators
+  TxFactory &operator=(TxFactory const &) = delete;
+  TxFactory &operator=(TxFactory &&) = delete;
+
+private:
+  using Signer    = fetch::crypto::ECDSASigner;
+  using SignerPtr = std::unique_ptr<Signer>;
+  using Signers   = std::vector<SignerPtr>;
+  using Address   = fetch::chain::Address;
+  using Addresses = std::vector<Address>;
+
+  TransactionPtr CreateTransfer(Rng &rng) const;
+  TransactionPtr CreateContractCall(Rng &rng) const;
+
+  KeySelector selector_;
+  Config      config_;
+  Signers     keys_;
+  Addresses   addresses_;
+  Address     contract_;
+};
@@ -0,0 +1,57 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "chain/transaction.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * Delivers batches of transactions to a node
+ */
+class TxSubmitter
+{
+public:
+  using TransactionPtr = std::shared_ptr<fetch::chain::Transaction>;
+  using Batch          = std::vector<TransactionPtr>;
+
+  // Construction / Destruction
+  TxSubmitter()          = default;
+  virtual ~TxSubmitter() = default;
+
+  /// @name Submitter Interface
+  /// @{
+
+  /**
+   * Submit a batch of transactions
+   *
+   * @param begin The first transaction of the batch
+   * @param end The end of the batch
+   * @return The number of transactions accepted by the node
+   */
+  virtual std::size_t Submit(Batch::const_iterator begin, Batch::const_iterator end) = 0;
+  /// @}
+};
+
+using TxSubmitterPtr = std::shared_ptr<TxSubmitter>;
+
+/// Creates the submitter used by a single sending thread
+using TxSubmitterFactory = std::function<TxSubmitterPtr()>;
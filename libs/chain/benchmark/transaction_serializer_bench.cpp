@@ -0,0 +1,171 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "chain/address.hpp"
+#include "chain/transaction.hpp"
+#include "chain/transaction_builder.hpp"
+#include "chain/transaction_serializer.hpp"
+#include "chain/transaction_view.hpp"
+#include "core/bitvector.hpp"
+#include "core/byte_array/byte_array.hpp"
+#include "crypto/ecdsa.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using fetch::BitVector;
+using fetch::byte_array::ByteArray;
+using fetch::byte_array::ConstByteArray;
+using fetch::chain::Address;
+using fetch::chain::Transaction;
+using fetch::chain::TransactionBuilder;
+using fetch::chain::TransactionSerializer;
+using fetch::chain::TransactionView;
+using fetch::crypto::ECDSASigner;
+
+/**
+ * Build the wire format of a contract transaction, with the specified number of signatories and
+ * size of contract data
+ */
+ConstByteArray GenerateTransaction(std::size_t num_signatories, std::size_t data_size)
+{
+  std::vector<std::unique_ptr<ECDSASigner>> signers;
+  for (std::size_t i = 0; i < num_signatories; ++i)
+  {
+    signers.emplace_back(std::make_unique<ECDSASigner>());
+  }
+
+  ByteArray data;
+  data.Resize(data_size);
+  for (std::size_t i = 0; i < data_size; ++i)
+  {
+    data[i] = static_cast<uint8_t>(i);
+  }
+
+  BitVector shard_mask{64};
+  shard_mask.set(7, 1);
+
+  TransactionBuilder builder{};
+  builder.From(Address{signers.front()->identity()})
+      .ChargeRate(1)
+      .ChargeLimit(100000)
+      .TargetSmartContract(Address{ECDSASigner{}.identity()}, shard_mask)
+      .Action("transfer")
+      .Data(data);
+
+  for (auto const &signer : signers)
+  {
+    builder.Signer(signer->identity());
+  }
+
+  auto sealed_builder = builder.Seal();
+  for (auto const &signer : signers)
+  {
+    sealed_builder.Sign(*signer);
+  }
+
+  TransactionSerializer serializer{};
+  serializer << *sealed_builder.Build();
+
+  return serializer.data();
+}
+
+void TxSerializer_Deserialize(benchmark::State &state)
+{
+  auto const serial_data = GenerateTransaction(static_cast<std::size_t>(state.range(0)),
+                                               static_cast<std::size_t>(state.range(1)));
+
+  for (auto _ : state)
+  {
+    TransactionSerializer const serializer{serial_data};
+
+    Transaction tx{};
+    serializer.Deserialize(tx);
+
+    benchmark::DoNotOptimize(tx.digest());
+  }
+}
+
+void TxView_Parse(benchmark::State &state)
+{
+  auto const serial_data = GenerateTransaction(static_cast<std::size_t>(state.range(0)),
+                                               static_cast<std::size_t>(state.range(1)));
+
+  for (auto _ : state)
+  {
+    TransactionView view{};
+    benchmark::DoNotOptimize(view.Parse(serial_data));
+  }
+}
+
+void TxView_ParseAndDigest(benchmark::State &state)
+{
+  auto const serial_data = GenerateTransaction(static_cast<std::size_t>(state.range(0)),
+                                               static_cast<std::size_t>(state.range(1)));
+
+  for (auto _ : state)
+  {
+    TransactionView view{};
+    view.Parse(serial_data);
+
+    benchmark::DoNotOptimize(view.digest());
+  }
+}
+
+void TxView_ParseAndSignatories(benchmark::State &state)
+{
+  auto const serial_data = GenerateTransaction(static_cast<std::size_t>(state.range(0)),
+                                               static_cast<std::size_t>(state.range(1)));
+
+  for (auto _ : state)
+  {
+    TransactionView view{};
+    view.Parse(serial_data);
+
+    benchmark::DoNotOptimize(view.digest());
+
+    for (std::size_t i = 0; i < view.num_signatories(); ++i)
+    {
+      benchmark::DoNotOptimize(view.signatory_address(i));
+    }
+  }
+}
+
+void TxArguments(benchmark::internal::Benchmark *b)
+{
+  for (int64_t signatories : {1, 4, 16})
+  {
+    for (int64_t data_size : {64, 4096})
+    {
+      b->Args({signatories, data_size});
+    }
+  }
+}
+
+}  // namespace
+
+BENCHMARK(TxSerializer_Deserialize)->Apply(TxArguments);
+BENCHMARK(TxView_Parse)->Apply(TxArguments);
+BENCHMARK(TxView_ParseAndDigest)->Apply(TxArguments);
+BENCHMARK(TxView_ParseAndSignatories)->Apply(TxArguments);
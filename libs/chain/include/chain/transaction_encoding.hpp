@@ -22,12 +22,54 @@
 #include "meta/type_traits.hpp"
 #include "vectorise/platform.hpp"
 
+#include <cstdint>
 #include <stdexcept>
 
 namespace fetch {
 namespace chain {
 namespace detail {
 
+// Wire format constants
+constexpr uint8_t TX_MAGIC              = 0xA1;
+constexpr uint8_t TX_VERSION            = 3u;
+constexpr int8_t  TX_UNIT_MEGA          = -2;
+constexpr int8_t  TX_UNIT_KILO          = -1;
+constexpr int8_t  TX_UNIT_DEFAULT       = 0;
+constexpr int8_t  TX_UNIT_MILLI         = 1;
+constexpr int8_t  TX_UNIT_MICRO         = 2;
+constexpr int8_t  TX_UNIT_NANO          = 3;
+constexpr int8_t  TX_CONTRACT_PRESENT   = 1;
+constexpr int8_t  TX_CHAIN_CODE_PRESENT = 2;
+constexpr int8_t  TX_SYNERGETIC_PRESENT = 3;
+
+/**
+ * Convert a charge rate which has been signalled with a charge unit into the base unit
+ *
+ * @param charge_rate The encoded charge rate
+ * @param charge_unit The signalled charge unit
+ * @return The charge rate in the base unit
+ */
+inline uint64_t ApplyChargeUnit(uint64_t charge_rate, int8_t charge_unit)
+{
+  switch (charge_unit)
+  {
+  case TX_UNIT_MEGA:
+    return charge_rate * 10000000000000000ull;
+  case TX_UNIT_KILO:
+    return charge_rate * 10000000000000ull;
+  case TX_UNIT_DEFAULT:
+    return charge_rate * 10000000000ull;
+  case TX_UNIT_MILLI:
+    return charge_rate * 10000000ull;
+  case TX_UNIT_MICRO:
+    return charge_rate * 10000ull;
+  case TX_UNIT_NANO:
+    return charge_rate * 10ull;
+  default:
+    return charge_rate;
+  }
+}
+
 template <typename T>
 meta::IfIsUnsignedInteger<T, uint64_t> ToU64(T value)
 {
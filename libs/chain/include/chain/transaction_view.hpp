@@ -0,0 +1,162 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "chain/address.hpp"
+#include "chain/transaction.hpp"
+#include "core/bitvector.hpp"
+#include "core/byte_array/const_byte_array.hpp"
+#include "core/digest.hpp"
+#include "crypto/identity.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace fetch {
+namespace chain {
+
+/**
+ * A lazily decoded, read only view of a serialised transaction.
+ *
+ * Parsing makes a single pass over the wire format, recording the location of each of the fields
+ * without copying any of them. The fields are then decoded on demand, with the variable length
+ * fields being returned as sub-arrays of the original buffer. The digest is only computed the
+ * first time that it is requested.
+ *
+ * This is intended for the stages of the system which only need a handful of fields from a
+ * transaction, for example its digest, signatories or resources. When all of the fields are
+ * required the complete transaction can be built with ToTransaction().
+ */
+class TransactionView
+{
+public:
+  using ConstByteArray = byte_array::ConstByteArray;
+  using ContractMode   = Transaction::ContractMode;
+  using Transfer       = Transaction::Transfer;
+  using TokenAmount    = Transaction::TokenAmount;
+  using BlockIndex     = Transaction::BlockIndex;
+  using Counter        = Transaction::Counter;
+  using Identity       = crypto::Identity;
+
+  static constexpr char const *LOGGING_NAME = "TxView";
+
+  // Construction / Destruction
+  TransactionView()                        = default;
+  TransactionView(TransactionView const &) = default;
+  TransactionView(TransactionView &&)      = default;
+  ~TransactionView()                       = default;
+
+  bool Parse(ConstByteArray serial_data);
+
+  /// @name Wire Format
+  /// @{
+  ConstByteArray const &serial_data() const;
+  ConstByteArray        payload() const;
+  /// @}
+
+  /// @name Identification
+  /// @{
+  Digest const &digest() const;
+  Counter       counter() const;
+  /// @}
+
+  /// @name Transfer Accessors
+  /// @{
+  Address     from() const;
+  std::size_t num_transfers() const;
+  Transfer    transfer(std::size_t index) const;
+  /// @}
+
+  /// @name Validity Accessors
+  /// @{
+  BlockIndex valid_from() const;
+  BlockIndex valid_until() const;
+  /// @}
+
+  /// @name Charge Accessors
+  /// @{
+  TokenAmount charge_rate() const;
+  TokenAmount charge_limit() const;
+  /// @}
+
+  /// @name Contract Accessors
+  /// @{
+  ContractMode   contract_mode() const;
+  Address        contract_address() const;
+  ConstByteArray chain_code() const;
+  ConstByteArray action() const;
+  BitVector      shard_mask() const;
+  ConstByteArray data() const;
+  /// @}
+
+  /// @name Signatory Accessors
+  /// @{
+  std::size_t    num_signatories() const;
+  Identity       identity(std::size_t index) const;
+  Address        signatory_address(std::size_t index) const;
+  ConstByteArray signature(std::size_t index) const;
+  /// @}
+
+  bool ToTransaction(Transaction &tx) const;
+
+  // Operators
+  TransactionView &operator=(TransactionView const &) = default;
+  TransactionView &operator=(TransactionView &&) = default;
+
+private:
+  /// The location of a field within the serial data
+  struct Field
+  {
+    std::size_t offset{0};
+    std::size_t length{0};
+  };
+
+  struct TransferField
+  {
+    std::size_t offset{0};  ///< The offset of the destination address
+    TokenAmount amount{0};
+  };
+
+  using TransferFields = std::vector<TransferField>;
+  using Fields         = std::vector<Field>;
+
+  ConstByteArray Extract(Field const &field) const;
+
+  ConstByteArray serial_data_;           ///< The complete wire format of the transaction
+  std::size_t    payload_size_{0};       ///< The size of the signed payload
+  std::size_t    from_offset_{0};        ///< The offset of the from address
+  TransferFields transfers_;             ///< The transfers contained in the transaction
+  BlockIndex     valid_from_{0};         ///< The first block the transaction is valid for
+  BlockIndex     valid_until_{0};        ///< The last block the transaction is valid for
+  TokenAmount    charge_rate_{0};        ///< The charge rate in the base unit
+  TokenAmount    charge_limit_{0};       ///< The charge limit
+  ContractMode   contract_mode_{};       ///< The type of contract referenced
+  uint8_t        contract_header_{0};    ///< The header describing the shard mask
+  Field          shard_mask_;            ///< The location of an extended shard mask
+  Field          contract_;              ///< The contract address or chain code
+  Field          action_;                ///< The contract action
+  Field          data_;                  ///< The contract data
+  Counter        counter_{0};            ///< The transaction counter
+  std::size_t    identities_offset_{0};  ///< The offset of the first signatory identity
+  Fields         signatures_;            ///< The signature of each signatory
+  mutable Digest digest_;                ///< Cached digest, computed on first use
+};
+
+}  // namespace chain
+}  // namespace fetch
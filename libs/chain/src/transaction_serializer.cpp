@@ -47,17 +47,11 @@ using serializers::MsgPackSerializer;
 using TokenAmount  = Transaction::TokenAmount;
 using ContractMode = Transaction::ContractMode;
 
-const uint8_t MAGIC              = 0xA1;
-const uint8_t VERSION            = 3u;
-const int8_t  UNIT_MEGA          = -2;
-const int8_t  UNIT_KILO          = -1;
-const int8_t  UNIT_DEFAULT       = 0;
-const int8_t  UNIT_MILLI         = 1;
-const int8_t  UNIT_MICRO         = 2;
-const int8_t  UNIT_NANO          = 3;
-const int8_t  CONTRACT_PRESENT   = 1;
-const int8_t  CHAIN_CODE_PRESENT = 2;
-const int8_t  SYNERGETIC_PRESENT = 3;
+constexpr uint8_t MAGIC              = detail::TX_MAGIC;
+constexpr uint8_t VERSION            = detail::TX_VERSION;
+constexpr int8_t  CONTRACT_PRESENT   = detail::TX_CONTRACT_PRESENT;
+constexpr int8_t  CHAIN_CODE_PRESENT = detail::TX_CHAIN_CODE_PRESENT;
+constexpr int8_t  SYNERGETIC_PRESENT = detail::TX_SYNERGETIC_PRESENT;
 
 uint8_t Map(ContractMode mode)
 {
@@ -458,29 +452,7 @@ bool TransactionSerializer::Deserialize(Transaction &tx) const
     int8_t charge_unit{0};
     Decode(buffer, charge_unit);
 
-    switch (charge_unit)
-    {
-    case UNIT_MEGA:
-      tx.charge_rate_ *= 10000000000000000ull;
-      break;
-    case UNIT_KILO:
-      tx.charge_rate_ *= 10000000000000ull;
-      break;
-    case UNIT_DEFAULT:
-      tx.charge_rate_ *= 10000000000ull;
-      break;
-    case UNIT_MILLI:
-      tx.charge_rate_ *= 10000000ull;
-      break;
-    case UNIT_MICRO:
-      tx.charge_rate_ *= 10000ull;
-      break;
-    case UNIT_NANO:
-      tx.charge_rate_ *= 10ull;
-      break;
-    default:
-      break;
-    }
+    tx.charge_rate_ = detail::ApplyChargeUnit(tx.charge_rate_, charge_unit);
   }
 
   Decode(buffer, tx.charge_limit_);
@@ -0,0 +1,434 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "chain/transaction_encoding.hpp"
+#include "chain/transaction_serializer.hpp"
+#include "chain/transaction_view.hpp"
+#include "core/serializers/main_serializer.hpp"
+#include "crypto/sha256.hpp"
+#include "logging/logging.hpp"
+
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+namespace fetch {
+namespace chain {
+namespace {
+
+using serializers::MsgPackSerializer;
+
+constexpr uint8_t     IDENTITY_SCHEME = 0x04;
+constexpr std::size_t PUBLIC_KEY_SIZE = 64u;
+constexpr std::size_t IDENTITY_SIZE   = PUBLIC_KEY_SIZE + 1u;
+
+uint8_t ReadSingleByte(MsgPackSerializer &buffer)
+{
+  uint8_t value{0};
+  buffer.ReadByte(value);
+  return value;
+}
+
+/**
+ * Skip over a field in the buffer, returning the location at which it starts
+ *
+ * @param buffer The buffer being parsed
+ * @param length The length of the field in bytes
+ * @return The offset of the start of the field
+ */
+std::size_t SkipField(MsgPackSerializer &buffer, std::size_t length)
+{
+  std::size_t const offset = buffer.tell();
+
+  if (static_cast<int64_t>(length) > buffer.bytes_left())
+  {
+    throw std::runtime_error("Transaction field exceeds buffer size");
+  }
+
+  buffer.SkipBytes(length);
+
+  return offset;
+}
+
+}  // namespace
+
+/**
+ * Index the fields of the serialised transaction
+ *
+ * @param serial_data The wire format of the transaction
+ * @return true if the transaction was parsed successfully, otherwise false
+ */
+bool TransactionView::Parse(ConstByteArray serial_data)
+{
+  *this        = TransactionView{};
+  serial_data_ = std::move(serial_data);
+
+  try
+  {
+    MsgPackSerializer buffer{serial_data_};
+
+    if (ReadSingleByte(buffer) != detail::TX_MAGIC)
+    {
+      return false;
+    }
+
+    // header byte 1
+    uint8_t const header1                 = ReadSingleByte(buffer);
+    uint8_t const version                 = (header1 >> 5u) & 0x7u;
+    uint8_t const charge_unit_flag        = (header1 >> 3u) & 0x1u;
+    uint8_t const transfer_flag           = (header1 >> 2u) & 0x1u;
+    uint8_t const multiple_transfers_flag = (header1 >> 1u) & 0x1u;
+    uint8_t const valid_from_flag         = header1 & 0x1u;
+
+    if (version != detail::TX_VERSION)
+    {
+      FETCH_LOG_DEBUG(LOGGING_NAME, "Version mismatch");
+      return false;
+    }
+
+    // header byte 2
+    uint8_t const header2                = ReadSingleByte(buffer);
+    uint8_t const contract_type          = (header2 >> 6u) & 0x3u;
+    uint8_t const signature_count_minus1 = header2 & 0x3fu;
+
+    // header byte 3 (reserved)
+    ReadSingleByte(buffer);
+
+    from_offset_ = SkipField(buffer, Address::RAW_LENGTH);
+
+    if (transfer_flag != 0u)
+    {
+      std::size_t transfer_count = 1;
+
+      if (multiple_transfers_flag != 0u)
+      {
+        transfer_count = detail::DecodeInteger<std::size_t>(buffer) + 2u;
+      }
+
+      transfers_.resize(transfer_count);
+      for (auto &transfer : transfers_)
+      {
+        transfer.offset = SkipField(buffer, Address::RAW_LENGTH);
+        transfer.amount = detail::DecodeInteger<TokenAmount>(buffer);
+      }
+    }
+
+    if (valid_from_flag != 0u)
+    {
+      valid_from_ = detail::DecodeInteger<BlockIndex>(buffer);
+    }
+
+    valid_until_ = detail::DecodeInteger<BlockIndex>(buffer);
+    charge_rate_ = detail::DecodeInteger<TokenAmount>(buffer);
+
+    if (charge_unit_flag != 0u)
+    {
+      charge_rate_ = detail::ApplyChargeUnit(charge_rate_, detail::DecodeInteger<int8_t>(buffer));
+    }
+
+    charge_limit_ = detail::DecodeInteger<TokenAmount>(buffer);
+
+    if (contract_type != 0u)
+    {
+      contract_header_ = ReadSingleByte(buffer);
+
+      bool const wildcard_flag            = (contract_header_ & 0x80u) != 0u;
+      bool const extended_shard_mask_flag = (contract_header_ & 0x40u) != 0u;
+
+      if (!wildcard_flag && extended_shard_mask_flag)
+      {
+        std::size_t const shard_mask_length_bits =
+            1u << (static_cast<std::size_t>(contract_header_ & 0x3fu) + 3u);
+
+        shard_mask_.length = shard_mask_length_bits >> 3u;
+        shard_mask_.offset = SkipField(buffer, shard_mask_.length);
+      }
+
+      if (detail::TX_CHAIN_CODE_PRESENT == contract_type)
+      {
+        contract_mode_   = ContractMode::CHAIN_CODE;
+        contract_.length = detail::DecodeInteger<std::size_t>(buffer);
+      }
+      else
+      {
+        contract_mode_ = (detail::TX_SYNERGETIC_PRESENT == contract_type) ? ContractMode::SYNERGETIC
+                                                                           : ContractMode::PRESENT;
+        contract_.length = Address::RAW_LENGTH;
+      }
+
+      contract_.offset = SkipField(buffer, contract_.length);
+
+      action_.length = detail::DecodeInteger<std::size_t>(buffer);
+      action_.offset = SkipField(buffer, action_.length);
+
+      data_.length = detail::DecodeInteger<std::size_t>(buffer);
+      data_.offset = SkipField(buffer, data_.length);
+    }
+
+    // the counter is a fixed size big endian value
+    for (std::size_t i = 0; i < sizeof(Counter); ++i)
+    {
+      counter_ = (counter_ << 8u) | ReadSingleByte(buffer);
+    }
+
+    std::size_t num_signatures = signature_count_minus1 + 1u;
+    if (signature_count_minus1 == 0x3fu)
+    {
+      num_signatures += detail::DecodeInteger<std::size_t>(buffer);
+    }
+
+    // the identities are fixed size and laid out back to back
+    identities_offset_ = buffer.tell();
+    for (std::size_t i = 0; i < num_signatures; ++i)
+    {
+      if (ReadSingleByte(buffer) != IDENTITY_SCHEME)
+      {
+        FETCH_LOG_DEBUG(LOGGING_NAME, "Unsupported signature scheme");
+        return false;
+      }
+
+      SkipField(buffer, PUBLIC_KEY_SIZE);
+    }
+
+    // everything up to this point is signed by the signatories
+    payload_size_ = buffer.tell();
+
+    signatures_.resize(num_signatures);
+    for (auto &signature : signatures_)
+    {
+      signature.length = detail::DecodeInteger<std::size_t>(buffer);
+      signature.offset = SkipField(buffer, signature.length);
+    }
+  }
+  catch (std::exception const &ex)
+  {
+    FETCH_LOG_DEBUG(LOGGING_NAME, "Unable to parse transaction: ", ex.what());
+    return false;
+  }
+
+  return true;
+}
+
+TransactionView::ConstByteArray const &TransactionView::serial_data() const
+{
+  return serial_data_;
+}
+
+/**
+ * Get the signed portion of the transaction
+ *
+ * @return The payload of the transaction
+ */
+TransactionView::ConstByteArray TransactionView::payload() const
+{
+  return serial_data_.SubArray(0, payload_size_);
+}
+
+/**
+ * Get the digest of the transaction, this is computed on first use and cached thereafter. As a
+ * result this method is not thread safe.
+ *
+ * @return The transaction digest
+ */
+Digest const &TransactionView::digest() const
+{
+  if (digest_.empty() && (payload_size_ > 0))
+  {
+    crypto::SHA256 hash_function{};
+    hash_function.Update(payload());
+
+    digest_ = hash_function.Final();
+  }
+
+  return digest_;
+}
+
+TransactionView::Counter TransactionView::counter() const
+{
+  return counter_;
+}
+
+Address TransactionView::from() const
+{
+  return Address{serial_data_.SubArray(from_offset_, Address::RAW_LENGTH)};
+}
+
+std::size_t TransactionView::num_transfers() const
+{
+  return transfers_.size();
+}
+
+TransactionView::Transfer TransactionView::transfer(std::size_t index) const
+{
+  auto const &field = transfers_.at(index);
+
+  return {Address{serial_data_.SubArray(field.offset, Address::RAW_LENGTH)}, field.amount};
+}
+
+TransactionView::BlockIndex TransactionView::valid_from() const
+{
+  return valid_from_;
+}
+
+TransactionView::BlockIndex TransactionView::valid_until() const
+{
+  return valid_until_;
+}
+
+TransactionView::TokenAmount TransactionView::charge_rate() const
+{
+  return charge_rate_;
+}
+
+TransactionView::TokenAmount TransactionView::charge_limit() const
+{
+  return charge_limit_;
+}
+
+TransactionView::ContractMode TransactionView::contract_mode() const
+{
+  return contract_mode_;
+}
+
+Address TransactionView::contract_address() const
+{
+  if ((ContractMode::PRESENT != contract_mode_) && (ContractMode::SYNERGETIC != contract_mode_))
+  {
+    return {};
+  }
+
+  return Address{Extract(contract_)};
+}
+
+TransactionView::ConstByteArray TransactionView::chain_code() const
+{
+  if (ContractMode::CHAIN_CODE != contract_mode_)
+  {
+    return {};
+  }
+
+  return Extract(contract_);
+}
+
+TransactionView::ConstByteArray TransactionView::action() const
+{
+  return Extract(action_);
+}
+
+/**
+ * Decode the shard mask of the transaction
+ *
+ * @return The shard mask, which is empty in the case of a wildcard
+ */
+BitVector TransactionView::shard_mask() const
+{
+  BitVector mask{};
+
+  bool const wildcard_flag = (contract_header_ & 0x80u) != 0u;
+
+  if ((ContractMode::NOT_PRESENT == contract_mode_) || wildcard_flag)
+  {
+    return mask;
+  }
+
+  if ((contract_header_ & 0x40u) == 0u)
+  {
+    bool const shard_is_4bits = (contract_header_ & 0x10u) != 0u;
+
+    mask.Resize(shard_is_4bits ? 4u : 2u);
+
+    for (std::size_t bit = 0; bit < mask.size(); ++bit)
+    {
+      mask.set(bit, static_cast<uint64_t>((contract_header_ >> bit) & 0x1u));
+    }
+  }
+  else
+  {
+    mask.Resize(shard_mask_.length << 3u);
+
+    // the shard mask bytes are stored in the reverse order to the underlying blocks
+    auto *            raw_data   = reinterpret_cast<uint8_t *>(mask.data().pointer());
+    std::size_t const raw_length = mask.data().size() * sizeof(BitVector::Block);
+    std::size_t const offset     = (raw_length - shard_mask_.length) + 1;
+
+    uint8_t const *bytes = serial_data_.pointer() + shard_mask_.offset;
+    for (std::size_t i = 0, j = raw_length - offset; i < shard_mask_.length; ++i, --j)
+    {
+      raw_data[j] = bytes[i];
+    }
+  }
+
+  return mask;
+}
+
+TransactionView::ConstByteArray TransactionView::data() const
+{
+  return Extract(data_);
+}
+
+std::size_t TransactionView::num_signatories() const
+{
+  return signatures_.size();
+}
+
+TransactionView::Identity TransactionView::identity(std::size_t index) const
+{
+  if (index >= num_signatories())
+  {
+    throw std::out_of_range("Signatory index out of range");
+  }
+
+  std::size_t const offset = identities_offset_ + (index * IDENTITY_SIZE) + 1u;
+
+  return Identity{serial_data_.SubArray(offset, PUBLIC_KEY_SIZE)};
+}
+
+Address TransactionView::signatory_address(std::size_t index) const
+{
+  return Address{identity(index)};
+}
+
+TransactionView::ConstByteArray TransactionView::signature(std::size_t index) const
+{
+  return Extract(signatures_.at(index));
+}
+
+/**
+ * Fully decode the transaction
+ *
+ * @param tx The transaction to be populated
+ * @return true if successful, otherwise false
+ */
+bool TransactionView::ToTransaction(Transaction &tx) const
+{
+  TransactionSerializer const serializer{serial_data_};
+  return serializer.Deserialize(tx);
+}
+
+TransactionView::ConstByteArray TransactionView::Extract(Field const &field) const
+{
+  if (field.length == 0)
+  {
+    return {};
+  }
+
+  return serial_data_.SubArray(field.offset, field.length);
+}
+
+}  // namespace chain
+}  // namespace fetch
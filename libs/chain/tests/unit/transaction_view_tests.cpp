@@ -0,0 +1,242 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "chain/address.hpp"
+#include "chain/transaction.hpp"
+#include "chain/transaction_builder.hpp"
+#include "chain/transaction_serializer.hpp"
+#include "chain/transaction_view.hpp"
+#include "core/bitvector.hpp"
+#include "crypto/ecdsa.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace {
+
+using fetch::BitVector;
+using fetch::byte_array::ConstByteArray;
+using fetch::chain::Address;
+using fetch::chain::Transaction;
+using fetch::chain::TransactionBuilder;
+using fetch::chain::TransactionSerializer;
+using fetch::chain::TransactionView;
+using fetch::crypto::ECDSASigner;
+
+using SignerPtr = std::unique_ptr<ECDSASigner>;
+using Signers   = std::vector<SignerPtr>;
+
+class TransactionViewTests : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    for (std::size_t i = 0; i < 70; ++i)
+    {
+      signers_.emplace_back(std::make_unique<ECDSASigner>());
+    }
+  }
+
+  Address AddressOf(std::size_t index) const
+  {
+    return Address{signers_.at(index)->identity()};
+  }
+
+  static ConstByteArray Serialize(Transaction const &tx)
+  {
+    TransactionSerializer serializer{};
+    serializer << tx;
+    return serializer.data();
+  }
+
+  static void EnsureMatches(TransactionView const &view, Transaction const &tx)
+  {
+    EXPECT_EQ(view.digest(), tx.digest());
+    EXPECT_EQ(view.counter(), tx.counter());
+    EXPECT_EQ(view.from(), tx.from());
+
+    ASSERT_EQ(view.num_transfers(), tx.transfers().size());
+    for (std::size_t i = 0; i < view.num_transfers(); ++i)
+    {
+      EXPECT_EQ(view.transfer(i).to, tx.transfers()[i].to);
+      EXPECT_EQ(view.transfer(i).amount, tx.transfers()[i].amount);
+    }
+
+    EXPECT_EQ(view.valid_from(), tx.valid_from());
+    EXPECT_EQ(view.valid_until(), tx.valid_until());
+    EXPECT_EQ(view.charge_rate(), tx.charge_rate());
+    EXPECT_EQ(view.charge_limit(), tx.charge_limit());
+    EXPECT_EQ(view.contract_mode(), tx.contract_mode());
+    EXPECT_EQ(view.contract_address(), tx.contract_address());
+    EXPECT_EQ(view.chain_code(), tx.chain_code());
+    EXPECT_EQ(view.action(), tx.action());
+    EXPECT_EQ(view.shard_mask(), tx.shard_mask());
+    EXPECT_EQ(view.data(), tx.data());
+
+    ASSERT_EQ(view.num_signatories(), tx.signatories().size());
+    for (std::size_t i = 0; i < view.num_signatories(); ++i)
+    {
+      auto const &signatory = tx.signatories()[i];
+
+      EXPECT_EQ(view.identity(i), signatory.identity);
+      EXPECT_EQ(view.signatory_address(i), signatory.address);
+      EXPECT_EQ(view.signature(i), signatory.signature);
+    }
+  }
+
+  void CheckRoundTrip(Transaction const &tx)
+  {
+    auto const serial_data = Serialize(tx);
+
+    TransactionView view{};
+    ASSERT_TRUE(view.Parse(serial_data));
+
+    EnsureMatches(view, tx);
+
+    Transaction output{};
+    ASSERT_TRUE(view.ToTransaction(output));
+    EXPECT_EQ(output.digest(), tx.digest());
+    EXPECT_TRUE(output.Verify());
+  }
+
+  Signers signers_;
+};
+
+TEST_F(TransactionViewTests, CheckSimpleTransfer)
+{
+  auto tx = TransactionBuilder()
+                .From(AddressOf(0))
+                .Transfer(AddressOf(1), 256u)
+                .Signer(signers_[0]->identity())
+                .Seal()
+                .Sign(*signers_[0])
+                .Build();
+
+  CheckRoundTrip(*tx);
+}
+
+TEST_F(TransactionViewTests, CheckMultipleTransfersAndValidity)
+{
+  auto tx = TransactionBuilder()
+                .From(AddressOf(0))
+                .Transfer(AddressOf(1), 256u)
+                .Transfer(AddressOf(2), 512u)
+                .Transfer(AddressOf(3), 100000u)
+                .Signer(signers_[0]->identity())
+                .ChargeRate(1000)
+                .ChargeLimit(1000000)
+                .ValidFrom(100)
+                .ValidUntil(200)
+                .Counter(0x0102030405060708ull)
+                .Seal()
+                .Sign(*signers_[0])
+                .Build();
+
+  CheckRoundTrip(*tx);
+}
+
+TEST_F(TransactionViewTests, CheckChainCodeWithSmallShardMask)
+{
+  BitVector shard_mask{4};
+  shard_mask.set(3, 1);
+  shard_mask.set(0, 1);
+
+  auto tx = TransactionBuilder()
+                .From(AddressOf(0))
+                .Signer(signers_[0]->identity())
+                .ChargeRate(1000)
+                .ChargeLimit(1000000)
+                .TargetChainCode("foo.bar.baz", shard_mask)
+                .Action("launch")
+                .Data("go")
+                .Seal()
+                .Sign(*signers_[0])
+                .Build();
+
+  CheckRoundTrip(*tx);
+}
+
+TEST_F(TransactionViewTests, CheckSmartContractWithLargeShardMask)
+{
+  BitVector shard_mask{512};
+  shard_mask.set(1, 1);
+  shard_mask.set(63, 1);
+  shard_mask.set(64, 1);
+  shard_mask.set(511, 1);
+
+  auto tx = TransactionBuilder()
+                .From(AddressOf(0))
+                .Signer(signers_[0]->identity())
+                .ChargeRate(1000)
+                .ChargeLimit(1000000)
+                .TargetSmartContract(AddressOf(4), shard_mask)
+                .Action("launch")
+                .Data("some data for the contract")
+                .Seal()
+                .Sign(*signers_[0])
+                .Build();
+
+  CheckRoundTrip(*tx);
+}
+
+TEST_F(TransactionViewTests, CheckLargeNumberOfSignatories)
+{
+  TransactionBuilder builder{};
+  builder.From(AddressOf(0)).Transfer(AddressOf(1), 1000u);
+
+  for (auto const &signer : signers_)
+  {
+    builder.Signer(signer->identity());
+  }
+
+  auto sealed_builder = builder.Seal();
+
+  for (auto const &signer : signers_)
+  {
+    sealed_builder.Sign(*signer);
+  }
+
+  CheckRoundTrip(*sealed_builder.Build());
+}
+
+TEST_F(TransactionViewTests, CheckInvalidDataIsRejected)
+{
+  auto tx = TransactionBuilder()
+                .From(AddressOf(0))
+                .Transfer(AddressOf(1), 256u)
+                .Signer(signers_[0]->identity())
+                .Seal()
+                .Sign(*signers_[0])
+                .Build();
+
+  auto const serial_data = Serialize(*tx);
+
+  TransactionView view{};
+  EXPECT_FALSE(view.Parse(ConstByteArray{}));
+  EXPECT_FALSE(view.Parse(serial_data.SubArray(0, serial_data.size() - 10)));
+  EXPECT_FALSE(view.Parse(serial_data.SubArray(1, serial_data.size() - 1)));
+
+  // a view can be reused
+  EXPECT_TRUE(view.Parse(serial_data));
+  EXPECT_EQ(view.digest(), tx->digest());
+}
+
+}  // namespace
@@ -99,6 +99,7 @@ public:
     bool         proof_of_stake{false};
     NetworkMode  network_mode{NetworkMode::PUBLIC_NETWORK};
     FeatureFlags features{};
+    uint32_t     tx_trace_sample_interval{0};
 
     uint32_t num_lanes() const
     {
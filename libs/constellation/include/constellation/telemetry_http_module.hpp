@@ -19,6 +19,7 @@
 
 #include "http/json_response.hpp"
 #include "http/module.hpp"
+#include "ledger/transaction_tracer.hpp"
 #include "logging/logging.hpp"
 #include "telemetry/registry.hpp"
 
@@ -35,6 +36,9 @@ public:
         [](http::ViewParameters const &, http::HTTPRequest const &) {
           static auto const TXT_MIME_TYPE = http::mime_types::GetMimeTypeFromExtension(".txt");
 
+          // refresh the aggregated transaction trace latencies before they are exported
+          ledger::TransactionTracer::Instance().UpdateTelemetry();
+
           // collect up the generated metrics for the system
           std::ostringstream stream;
           telemetry::Registry::Instance().Collect(stream);
@@ -37,7 +37,9 @@
 #include "ledger/execution_manager.hpp"
 #include "ledger/storage_unit/lane_remote_control.hpp"
 #include "ledger/tx_query_http_interface.hpp"
+#include "ledger/transaction_tracer.hpp"
 #include "ledger/tx_status_http_interface.hpp"
+#include "ledger/tx_trace_http_interface.hpp"
 #include "ledger/upow/synergetic_execution_manager.hpp"
 #include "ledger/upow/synergetic_executor.hpp"
 #include "muddle/rpc/client.hpp"
@@ -346,6 +348,8 @@ Constellation::Constellation(CertificatePtr const &certificate, Config config)
                           main_chain_service_->GetWeakStateMachine(),
                           block_coordinator_.GetWeakStateMachine()}),
                   std::make_shared<ledger::TxStatusHttpInterface>(tx_status_cache_),
+                  std::make_shared<ledger::TxTraceHttpInterface>(
+                      ledger::TransactionTracer::Instance()),
                   std::make_shared<ledger::TxQueryHttpInterface>(*storage_),
                   std::make_shared<ledger::ContractHttpInterface>(*storage_, tx_processor_),
                   std::make_shared<LoggingHttpModule>(),
@@ -369,6 +373,8 @@ Constellation::Constellation(CertificatePtr const &certificate, Config config)
   chain::STAKE_WARM_UP_PERIOD   = cfg_.stake_delay_period;
   chain::STAKE_COOL_DOWN_PERIOD = cfg_.stake_delay_period;
 
+  ledger::TransactionTracer::Instance().SetSampleInterval(cfg_.tx_trace_sample_interval);
+
   if (cfg_.kademlia_routing)
   {
     muddle_->SetPeerSelectionMode(muddle::PeerSelectionMode::KADEMLIA);
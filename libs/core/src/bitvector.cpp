@@ -420,6 +420,30 @@ std::size_t BitVector::PopCount() const
   return std::min(ret, size_);
 }
 
+/**
+ * Determine if any of the bits set in this vector are also set in the other vector. Unlike
+ * computing `(a & b).PopCount()` this does not allocate a temporary vector, and the branch free
+ * inner loop is suitable for auto-vectorisation.
+ *
+ * @param other The other bit vector (must be the same size)
+ * @return true if there is at least one common set bit, otherwise false
+ */
+bool BitVector::Intersects(BitVector const &other) const
+{
+  assert(size_ == other.size_);
+
+  Block const *a = data_.pointer();
+  Block const *b = other.data_.pointer();
+
+  Block accumulator{0};
+  for (std::size_t i = 0; i < blocks_; ++i)
+  {
+    accumulator |= a[i] & b[i];
+  }
+
+  return accumulator != 0;
+}
+
 std::ostream &operator<<(std::ostream &s, BitVector const &b)
 {
 #if 1
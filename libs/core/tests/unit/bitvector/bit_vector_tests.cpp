@@ -418,3 +418,25 @@ TEST(BitVectorTests, IterateSetBits)
   EXPECT_EQ(itr, end);
   EXPECT_EQ(expected_index_itr, expected_indexes.end());
 }
+
+TEST(BitVectorTests, CheckIntersects)
+{
+  for (std::size_t size : {1u, 4u, 64u, 256u, 1024u})
+  {
+    BitVector a{size};
+    BitVector b{size};
+
+    EXPECT_FALSE(a.Intersects(b));
+
+    a.set(0, 1);
+    b.set(size - 1, 1);
+
+    EXPECT_EQ(a.Intersects(b), size == 1);
+    EXPECT_EQ(a.Intersects(b), (a & b).PopCount() != 0);
+
+    b.set(0, 1);
+
+    EXPECT_TRUE(a.Intersects(b));
+    EXPECT_TRUE(b.Intersects(a));
+  }
+}
@@ -20,6 +20,7 @@
 #include "core/byte_array/const_byte_array.hpp"
 #include "core/random/lcg.hpp"
 #include "crypto/ecdsa.hpp"
+#include "crypto/verifier_cache.hpp"
 
 #include "benchmark/benchmark.h"
 
@@ -27,6 +28,8 @@
 
 using fetch::crypto::ECDSASigner;
 using fetch::crypto::ECDSAVerifier;
+using fetch::crypto::Verifier;
+using fetch::crypto::VerifierCache;
 using fetch::byte_array::ConstByteArray;
 using fetch::byte_array::ByteArray;
 using fetch::random::LinearCongruentialGenerator;
@@ -80,6 +83,38 @@ void VerifySignature(benchmark::State &state)
   }
 }
 
+void VerifySignatureBuildingVerifier(benchmark::State &state)
+{
+  ConstByteArray msg = GenerateRandomData<2048>();
+
+  ECDSASigner signer;
+  auto const  identity  = signer.identity();
+  auto const  signature = signer.Sign(msg);
+
+  for (auto _ : state)
+  {
+    // decode the public key for every signature
+    Verifier::Build(identity)->Verify(msg, signature);
+  }
+}
+
+void VerifySignatureCachedVerifier(benchmark::State &state)
+{
+  ConstByteArray msg = GenerateRandomData<2048>();
+
+  ECDSASigner signer;
+  auto const  identity  = signer.identity();
+  auto const  signature = signer.Sign(msg);
+
+  VerifierCache cache;
+  for (auto _ : state)
+  {
+    cache.Verify(identity, msg, signature);
+  }
+}
+
 }  // namespace
 
 BENCHMARK(VerifySignature);
+BENCHMARK(VerifySignatureBuildingVerifier);
+BENCHMARK(VerifySignatureCachedVerifier);
@@ -0,0 +1,98 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/mutex.hpp"
+#include "crypto/identity.hpp"
+#include "crypto/verifier.hpp"
+#include "telemetry/telemetry.hpp"
+
+#include <array>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+namespace fetch {
+namespace crypto {
+
+/**
+ * A bounded cache of verifiers keyed by identity. Building a verifier decodes the identity into a
+ * curve point, which is repeated work when the same peers and wallets sign many messages. The cache
+ * is split into independently locked shards, each of which evicts its least recently used entry
+ * once full.
+ */
+class VerifierCache
+{
+public:
+  using VerifierPtr = std::shared_ptr<Verifier>;
+
+  static constexpr std::size_t DEFAULT_CAPACITY = 8192;
+  static constexpr std::size_t NUM_SHARDS       = 16;
+
+  static VerifierCache &Instance();
+
+  // Construction / Destruction
+  explicit VerifierCache(std::size_t capacity = DEFAULT_CAPACITY);
+  VerifierCache(VerifierCache const &) = delete;
+  VerifierCache(VerifierCache &&)      = delete;
+  ~VerifierCache()                     = default;
+
+  VerifierPtr Lookup(Identity const &identity);
+  bool        Verify(Identity const &identity, byte_array::ConstByteArray const &data,
+                     byte_array::ConstByteArray const &signature);
+  void        Clear();
+
+  /// @name Accessors
+  /// @{
+  std::size_t size() const;
+  std::size_t capacity() const;
+  uint64_t    hits() const;
+  uint64_t    misses() const;
+  uint64_t    evictions() const;
+  /// @}
+
+  // Operators
+  VerifierCache &operator=(VerifierCache const &) = delete;
+  VerifierCache &operator=(VerifierCache &&) = delete;
+
+private:
+  using LruList  = std::list<std::pair<Identity, VerifierPtr>>;
+  using EntryMap = std::unordered_map<Identity, LruList::iterator>;
+
+  struct Shard
+  {
+    mutable Mutex lock;
+    LruList       lru;  ///< Most recently used entries at the front
+    EntryMap      entries;
+  };
+
+  using Shards = std::array<Shard, NUM_SHARDS>;
+
+  Shard &LookupShard(Identity const &identity);
+
+  std::size_t const     shard_capacity_;
+  Shards                shards_;
+  telemetry::CounterPtr hits_;
+  telemetry::CounterPtr misses_;
+  telemetry::CounterPtr evictions_;
+};
+
+}  // namespace crypto
+}  // namespace fetch
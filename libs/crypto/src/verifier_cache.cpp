@@ -0,0 +1,189 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "crypto/verifier_cache.hpp"
+#include "telemetry/counter.hpp"
+#include "telemetry/registry.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace fetch {
+namespace crypto {
+
+constexpr std::size_t VerifierCache::DEFAULT_CAPACITY;
+constexpr std::size_t VerifierCache::NUM_SHARDS;
+
+/**
+ * Get the process wide verifier cache
+ *
+ * @return The reference to the cache
+ */
+VerifierCache &VerifierCache::Instance()
+{
+  static VerifierCache instance;
+  return instance;
+}
+
+/**
+ * Construct a verifier cache
+ *
+ * @param capacity The maximum number of verifiers held, spread evenly across the shards
+ */
+VerifierCache::VerifierCache(std::size_t capacity)
+  : shard_capacity_{std::max<std::size_t>(1, (capacity + NUM_SHARDS - 1) / NUM_SHARDS)}
+  , hits_{telemetry::Registry::Instance().CreateCounter(
+        "crypto_verifier_cache_hits_total",
+        "The number of signature verifications which reused a cached verifier")}
+  , misses_{telemetry::Registry::Instance().CreateCounter(
+        "crypto_verifier_cache_misses_total",
+        "The number of signature verifications which had to build a new verifier")}
+  , evictions_{telemetry::Registry::Instance().CreateCounter(
+        "crypto_verifier_cache_evictions_total",
+        "The number of verifiers evicted from the cache to make space for new entries")}
+{}
+
+/**
+ * Get the verifier for an identity, building and caching it if it is not already present
+ *
+ * Invalid identities are not cached, their verifiers reject all signatures.
+ *
+ * @param identity The identity to look up
+ * @return The verifier for the identity
+ */
+VerifierCache::VerifierPtr VerifierCache::Lookup(Identity const &identity)
+{
+  if (!identity)
+  {
+    return Verifier::Build(identity);
+  }
+
+  Shard &shard = LookupShard(identity);
+
+  {
+    FETCH_LOCK(shard.lock);
+
+    auto it = shard.entries.find(identity);
+    if (it != shard.entries.end())
+    {
+      // move the entry to the front of the list
+      shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+      hits_->increment();
+
+      return it->second->second;
+    }
+  }
+
+  // decoding the key is the expensive part, so do it without holding the lock
+  VerifierPtr verifier = Verifier::Build(identity);
+  misses_->increment();
+
+  FETCH_LOCK(shard.lock);
+
+  // another thread might have built the same verifier in the meantime
+  auto it = shard.entries.find(identity);
+  if (it != shard.entries.end())
+  {
+    return it->second->second;
+  }
+
+  if (shard.entries.size() >= shard_capacity_)
+  {
+    shard.entries.erase(shard.lru.back().first);
+    shard.lru.pop_back();
+    evictions_->increment();
+  }
+
+  shard.lru.emplace_front(identity, verifier);
+  shard.entries.emplace(identity, shard.lru.begin());
+
+  return verifier;
+}
+
+/**
+ * Verify a signature using the cached verifier for the identity
+ *
+ * @param identity The identity of the signer
+ * @param data The payload of the message
+ * @param signature The signature to verify
+ * @return true if the signature is valid for the payload, otherwise false
+ */
+bool VerifierCache::Verify(Identity const &identity, byte_array::ConstByteArray const &data,
+                           byte_array::ConstByteArray const &signature)
+{
+  return Lookup(identity)->Verify(data, signature);
+}
+
+/**
+ * Remove all the cached verifiers
+ */
+void VerifierCache::Clear()
+{
+  for (auto &shard : shards_)
+  {
+    FETCH_LOCK(shard.lock);
+    shard.entries.clear();
+    shard.lru.clear();
+  }
+}
+
+/**
+ * Get the number of cached verifiers
+ *
+ * @return The number of entries across all the shards
+ */
+std::size_t VerifierCache::size() const
+{
+  std::size_t total{0};
+
+  for (auto const &shard : shards_)
+  {
+    FETCH_LOCK(shard.lock);
+    total += shard.entries.size();
+  }
+
+  return total;
+}
+
+std::size_t VerifierCache::capacity() const
+{
+  return shard_capacity_ * NUM_SHARDS;
+}
+
+uint64_t VerifierCache::hits() const
+{
+  return hits_->count();
+}
+
+uint64_t VerifierCache::misses() const
+{
+  return misses_->count();
+}
+
+uint64_t VerifierCache::evictions() const
+{
+  return evictions_->count();
+}
+
+VerifierCache::Shard &VerifierCache::LookupShard(Identity const &identity)
+{
+  return shards_[std::hash<Identity>{}(identity) % NUM_SHARDS];
+}
+
+}  // namespace crypto
+}  // namespace fetch
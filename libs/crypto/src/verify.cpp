@@ -18,6 +18,7 @@
 
 #include "crypto/ecdsa.hpp"
 #include "crypto/verifier.hpp"
+#include "crypto/verifier_cache.hpp"
 
 namespace fetch {
 namespace crypto {
@@ -41,6 +42,9 @@ std::unique_ptr<Verifier> Verifier::Build(Identity const &identity)
 /**
  * Verify a specified signature from a data buffer and identity
  *
+ * The verifier for the identity is taken from the process wide cache so that repeated signers do
+ * not have their keys decoded for every message.
+ *
  * @param identity The identity of the signer
  * @param data The payload of the message
  * @param signature The signature to verify
@@ -49,11 +53,7 @@ std::unique_ptr<Verifier> Verifier::Build(Identity const &identity)
 bool Verifier::Verify(Identity const &identity, ConstByteArray const &data,
                       ConstByteArray const &signature)
 {
-  // build a compatible verifier
-  auto verifier = Build(identity);
-
-  // determine if the signature is valid
-  return verifier->Verify(data, signature);
+  return VerifierCache::Instance().Verify(identity, data, signature);
 }
 
 /**
@@ -0,0 +1,135 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "crypto/ecdsa.hpp"
+#include "crypto/verifier_cache.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace fetch {
+namespace crypto {
+
+namespace {
+
+using ConstByteArray = fetch::byte_array::ConstByteArray;
+
+ConstByteArray const TEST_DATA{"the quick brown fox jumps over the lazy dog"};
+
+TEST(VerifierCacheTest, check_verifiers_are_reused)
+{
+  VerifierCache cache{64};
+
+  ECDSASigner signer;
+  auto const  signature = signer.Sign(TEST_DATA);
+
+  EXPECT_TRUE(cache.Verify(signer.identity(), TEST_DATA, signature));
+  EXPECT_TRUE(cache.Verify(signer.identity(), TEST_DATA, signature));
+  EXPECT_FALSE(cache.Verify(signer.identity(), ConstByteArray{"other data"}, signature));
+
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_EQ(cache.misses(), 1u);
+  EXPECT_EQ(cache.hits(), 2u);
+  EXPECT_EQ(cache.Lookup(signer.identity()), cache.Lookup(signer.identity()));
+}
+
+TEST(VerifierCacheTest, check_invalid_identities_are_rejected_and_not_cached)
+{
+  VerifierCache cache{64};
+
+  ECDSASigner signer;
+  auto const  signature = signer.Sign(TEST_DATA);
+
+  EXPECT_FALSE(cache.Verify(Identity{}, TEST_DATA, signature));
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(VerifierCacheTest, check_cache_is_bounded)
+{
+  VerifierCache cache{VerifierCache::NUM_SHARDS};
+
+  std::vector<ECDSASigner> signers(4 * VerifierCache::NUM_SHARDS);
+  for (auto const &signer : signers)
+  {
+    EXPECT_TRUE(cache.Verify(signer.identity(), TEST_DATA, signer.Sign(TEST_DATA)));
+  }
+
+  EXPECT_LE(cache.size(), cache.capacity());
+  EXPECT_EQ(cache.misses(), signers.size());
+  EXPECT_EQ(cache.evictions(), signers.size() - cache.size());
+
+  // evicted verifiers are simply rebuilt
+  for (auto const &signer : signers)
+  {
+    EXPECT_TRUE(cache.Verify(signer.identity(), TEST_DATA, signer.Sign(TEST_DATA)));
+  }
+
+  cache.Clear();
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(VerifierCacheTest, check_concurrent_verification)
+{
+  static constexpr std::size_t NUM_THREADS    = 4;
+  static constexpr std::size_t NUM_ITERATIONS = 20;
+
+  VerifierCache cache{64};
+
+  std::vector<ECDSASigner>    signers(8);
+  std::vector<ConstByteArray> signatures;
+  for (auto const &signer : signers)
+  {
+    signatures.push_back(signer.Sign(TEST_DATA));
+  }
+
+  std::vector<std::thread> threads;
+  std::vector<std::size_t> failures(NUM_THREADS, 0);
+  for (std::size_t t = 0; t < NUM_THREADS; ++t)
+  {
+    threads.emplace_back([&, t]() {
+      for (std::size_t i = 0; i < NUM_ITERATIONS; ++i)
+      {
+        std::size_t const index = (i + t) % signers.size();
+        if (!cache.Verify(signers[index].identity(), TEST_DATA, signatures[index]))
+        {
+          ++failures[t];
+        }
+      }
+    });
+  }
+
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  for (auto const &count : failures)
+  {
+    EXPECT_EQ(count, 0u);
+  }
+  EXPECT_EQ(cache.size(), signers.size());
+  EXPECT_EQ(cache.hits() + cache.misses(), NUM_THREADS * NUM_ITERATIONS);
+}
+
+}  // namespace
+
+}  // namespace crypto
+}  // namespace fetch
@@ -0,0 +1,96 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/random/lcg.hpp"
+#include "ledger/miner/optimisation/binary_annealer.hpp"
+#include "ledger/miner/optimisation/parallel_tempering_annealer.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+using fetch::optimisers::BinaryAnnealer;
+using fetch::optimisers::ParallelTemperingAnnealer;
+
+constexpr std::size_t NUM_SWEEPS = 100;
+
+/**
+ * Program a block packing style problem: each transaction has a (negative) fee as its field and
+ * conflicting transactions are penalised by a uniform coupling
+ */
+template <typename Annealer>
+void ProgramPackingProblem(Annealer &annealer, std::size_t num_transactions,
+                           double conflict_probability)
+{
+  fetch::random::LinearCongruentialGenerator rng{};
+
+  annealer.Resize(num_transactions);
+
+  for (std::size_t i = 0; i < num_transactions; ++i)
+  {
+    annealer.Insert(i, i, -(1.0 + static_cast<double>(rng() % 100)));
+
+    for (std::size_t j = i + 1; j < num_transactions; ++j)
+    {
+      if (rng.AsDouble() < conflict_probability)
+      {
+        annealer.Insert(i, j, 200.0);
+      }
+    }
+  }
+
+  annealer.Normalise();
+}
+
+void Annealer_Binary(benchmark::State &state)
+{
+  BinaryAnnealer annealer{};
+  ProgramPackingProblem(annealer, static_cast<std::size_t>(state.range(0)), 0.05);
+  annealer.SetSweeps(NUM_SWEEPS);
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(annealer.FindMinimum());
+  }
+}
+
+void Annealer_ParallelTempering(benchmark::State &state)
+{
+  ParallelTemperingAnnealer annealer{};
+  ProgramPackingProblem(annealer, static_cast<std::size_t>(state.range(0)), 0.05);
+  annealer.SetNumReplicas(static_cast<std::size_t>(state.range(1)));
+  annealer.SetSweeps(NUM_SWEEPS);
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(annealer.FindMinimum());
+  }
+}
+
+}  // namespace
+
+BENCHMARK(Annealer_Binary)->Arg(500)->Arg(2000)->Unit(benchmark::kMillisecond);
+BENCHMARK(Annealer_ParallelTempering)
+    ->Args({500, 1})
+    ->Args({500, 8})
+    ->Args({2000, 1})
+    ->Args({2000, 8})
+    ->Unit(benchmark::kMillisecond);
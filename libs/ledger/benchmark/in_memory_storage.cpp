@@ -20,10 +20,11 @@
 
 #include <stdexcept>
 
-using Document  = InMemoryStorageUnit::Document;
-using Keys      = InMemoryStorageUnit::Keys;
-using TxLayouts = InMemoryStorageUnit::TxLayouts;
-using Hash      = InMemoryStorageUnit::Hash;
+using Document        = InMemoryStorageUnit::Document;
+using Keys            = InMemoryStorageUnit::Keys;
+using TxLayouts       = InMemoryStorageUnit::TxLayouts;
+using TransactionList = InMemoryStorageUnit::TransactionList;
+using Hash            = InMemoryStorageUnit::Hash;
 
 Document InMemoryStorageUnit::Get(ResourceAddress const &key) const
 {
@@ -120,6 +121,23 @@ bool InMemoryStorageUnit::GetTransaction(Digest const &digest, Transaction &tx)
   return success;
 }
 
+TransactionList InMemoryStorageUnit::GetTransactions(DigestSet const &digests)
+{
+  TransactionList txs;
+  txs.reserve(digests.size());
+
+  for (auto const &digest : digests)
+  {
+    auto it = tx_store_.find(digest);
+    if (it != tx_store_.end())
+    {
+      txs.emplace_back(it->second);
+    }
+  }
+
+  return txs;
+}
+
 bool InMemoryStorageUnit::HasTransaction(Digest const &digest)
 {
   return tx_store_.find(digest) != tx_store_.end();
@@ -135,9 +135,45 @@ void MainChain_Persistent_AddBlocksOutOfOrder(benchmark::State &state)
   }
 }
 
+void MainChain_Persistent_ColdStart(benchmark::State &state)
+{
+  static constexpr std::size_t NUM_LANES  = 1;
+  static constexpr std::size_t NUM_SLICES = 2;
+
+  fetch::crypto::mcl::details::MCLInitialiser();
+
+  auto const num_blocks = static_cast<std::size_t>(state.range(0));
+
+  // populate the chain files on disk, once for each chain length
+  {
+    BlockGenerator gen{NUM_LANES, NUM_SLICES};
+    MainChain      chain{MainChain::Mode::CREATE_PERSISTENT_DB};
+
+    auto previous = gen.Generate();
+    for (std::size_t i = 0; i < num_blocks; ++i)
+    {
+      previous = gen.Generate(previous);
+      chain.AddBlock(*previous);
+    }
+  }
+
+  for (auto _ : state)
+  {
+    MainChain chain{MainChain::Mode::LOAD_PERSISTENT_DB};
+    benchmark::DoNotOptimize(chain.GetHeaviestBlockHash());
+  }
+}
+
 }  // namespace
 
 BENCHMARK(MainChain_InMemory_AddBlocksSequentially);
 BENCHMARK(MainChain_Persistent_AddBlocksSequentially);
 BENCHMARK(MainChain_InMemory_AddBlocksOutOfOrder);
 BENCHMARK(MainChain_Persistent_AddBlocksOutOfOrder);
+BENCHMARK(MainChain_Persistent_ColdStart)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(3);
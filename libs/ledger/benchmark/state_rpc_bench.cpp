@@ -0,0 +1,262 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "crypto/ecdsa.hpp"
+#include "ledger/shard_config.hpp"
+#include "ledger/storage_unit/cached_storage_adapter.hpp"
+#include "ledger/storage_unit/storage_unit_bundled_service.hpp"
+#include "ledger/storage_unit/storage_unit_client.hpp"
+#include "muddle/muddle_interface.hpp"
+#include "network/management/network_manager.hpp"
+#include "storage/resource_mapper.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace {
+
+using fetch::crypto::ECDSASigner;
+using fetch::ledger::CachedStorageAdapter;
+using fetch::ledger::LaneService;
+using fetch::ledger::ShardConfigs;
+using fetch::ledger::StorageInterface;
+using fetch::ledger::StorageUnitBundledService;
+using fetch::ledger::StorageUnitClient;
+using fetch::muddle::MuddlePtr;
+using fetch::muddle::NetworkId;
+using fetch::network::NetworkManager;
+using fetch::storage::ResourceAddress;
+
+using StateValue        = StorageInterface::StateValue;
+using ResourceAddresses = StorageInterface::ResourceAddresses;
+using KeyValues         = StorageInterface::KeyValues;
+
+/**
+ * A complete set of lane services running locally, connected to a storage unit client over the
+ * internal muddle network. This is the same arrangement as used by a multi-lane node.
+ */
+class LocalLaneNetwork
+{
+public:
+  static constexpr uint32_t LOG2_NUM_LANES = 2;
+  static constexpr uint32_t NUM_LANES      = 1u << LOG2_NUM_LANES;
+  static constexpr uint16_t BASE_PORT      = 18300;
+
+  LocalLaneNetwork()
+  {
+    network_manager_.Start();
+
+    ShardConfigs configs(NUM_LANES);
+
+    uint16_t port = BASE_PORT;
+    for (uint32_t i = 0; i < NUM_LANES; ++i)
+    {
+      auto &shard = configs[i];
+
+      shard.lane_id             = i;
+      shard.num_lanes           = NUM_LANES;
+      shard.storage_path        = "state_rpc_bench";
+      shard.external_name       = "127.0.0.1";
+      shard.external_identity   = std::make_shared<ECDSASigner>();
+      shard.external_port       = port++;
+      shard.external_network_id = NetworkId{(i & 0xFFFFFFu) | (uint32_t{'L'} << 24u)};
+      shard.internal_name       = "127.0.0.1";
+      shard.internal_identity   = std::make_shared<ECDSASigner>();
+      shard.internal_port       = port++;
+      shard.internal_network_id = NetworkId{"ISRD"};
+    }
+
+    lanes_.Setup(network_manager_, configs, LaneService::Mode::CREATE_DATABASE);
+    lanes_.Start();
+
+    muddle_ = fetch::muddle::CreateMuddle("ISRD", std::make_shared<ECDSASigner>(),
+                                          network_manager_, "127.0.0.1");
+
+    fetch::muddle::MuddleInterface::Peers peers{};
+    for (auto const &shard : configs)
+    {
+      peers.emplace("tcp://127.0.0.1:" + std::to_string(shard.internal_port));
+    }
+
+    muddle_->Start(peers, {});
+
+    // wait for the connections to all the lanes to be established
+    for (std::size_t i = 0; muddle_->GetNumDirectlyConnectedPeers() < NUM_LANES; ++i)
+    {
+      if (i >= 100)
+      {
+        throw std::runtime_error("Unable to connect to the local lane services");
+      }
+
+      std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    }
+
+    client_ = std::make_unique<StorageUnitClient>(muddle_->GetEndpoint(), configs, LOG2_NUM_LANES);
+  }
+
+  ~LocalLaneNetwork()
+  {
+    client_.reset();
+    muddle_->Stop();
+    lanes_.Stop();
+    network_manager_.Stop();
+  }
+
+  StorageUnitClient &client()
+  {
+    return *client_;
+  }
+
+private:
+  NetworkManager                     network_manager_{"NetMgr", 4};
+  StorageUnitBundledService          lanes_{};
+  MuddlePtr                          muddle_{};
+  std::unique_ptr<StorageUnitClient> client_{};
+};
+
+LocalLaneNetwork &GetLocalLaneNetwork()
+{
+  static LocalLaneNetwork network{};
+  return network;
+}
+
+ResourceAddresses GenerateKeys(std::size_t count)
+{
+  ResourceAddresses keys{};
+  keys.reserve(count);
+
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    keys.emplace_back("fetch.token.state.account" + std::to_string(i));
+  }
+
+  return keys;
+}
+
+KeyValues GenerateEntries(std::size_t count)
+{
+  StateValue const value{"a moderately sized state value, about the size of a token balance"};
+
+  KeyValues entries{};
+  entries.reserve(count);
+
+  for (auto &key : GenerateKeys(count))
+  {
+    entries.emplace_back(std::move(key), value);
+  }
+
+  return entries;
+}
+
+void LaneState_SetIndividual(benchmark::State &state)
+{
+  auto &client  = GetLocalLaneNetwork().client();
+  auto  entries = GenerateEntries(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state)
+  {
+    for (auto const &entry : entries)
+    {
+      client.Set(entry.first, entry.second);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void LaneState_SetMany(benchmark::State &state)
+{
+  auto &client  = GetLocalLaneNetwork().client();
+  auto  entries = GenerateEntries(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state)
+  {
+    client.SetMany(entries);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void LaneState_GetIndividual(benchmark::State &state)
+{
+  auto &client  = GetLocalLaneNetwork().client();
+  auto  entries = GenerateEntries(static_cast<std::size_t>(state.range(0)));
+  client.SetMany(entries);
+
+  for (auto _ : state)
+  {
+    for (auto const &entry : entries)
+    {
+      benchmark::DoNotOptimize(client.Get(entry.first));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void LaneState_GetMany(benchmark::State &state)
+{
+  auto &client = GetLocalLaneNetwork().client();
+  client.SetMany(GenerateEntries(static_cast<std::size_t>(state.range(0))));
+
+  auto const keys = GenerateKeys(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(client.GetMany(keys));
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void LaneState_CachedAdapterFlush(benchmark::State &state)
+{
+  auto &client  = GetLocalLaneNetwork().client();
+  auto  entries = GenerateEntries(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    CachedStorageAdapter adapter{client};
+    for (auto const &entry : entries)
+    {
+      adapter.Set(entry.first, entry.second);
+    }
+    state.ResumeTiming();
+
+    adapter.Flush();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(LaneState_SetIndividual)->Range(64, 4096)->Unit(benchmark::kMillisecond);
+BENCHMARK(LaneState_SetMany)->Range(64, 65536)->Unit(benchmark::kMillisecond);
+BENCHMARK(LaneState_GetIndividual)->Range(64, 4096)->Unit(benchmark::kMillisecond);
+BENCHMARK(LaneState_GetMany)->Range(64, 65536)->Unit(benchmark::kMillisecond);
+BENCHMARK(LaneState_CachedAdapterFlush)->Range(64, 65536)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,106 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "chain/constants.hpp"
+#include "core/digest.hpp"
+#include "ledger/chain/block.hpp"
+#include "storage/random_access_stack.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace fetch {
+namespace ledger {
+
+/**
+ * Append-only, height indexed log of the finalised main chain.
+ *
+ * Blocks are stored in two files:
+ *
+ *  - the block log, a flat file of serialised blocks laid out in height order, so that a range of
+ *    heights can be served with a single sequential read
+ *  - the header file, a fixed size record per height holding the block and previous hashes along
+ *    with the location of the block in the log. Lookups by height are O(1) and verifying the
+ *    continuity of the chain is a linear scan of this (small) file.
+ *
+ * The log only ever holds a single unbroken chain from genesis. Appending a block at a height
+ * which is already occupied by a different block discards that block and everything above it,
+ * which is how reorganisations of the file head are handled.
+ */
+class BlockLog
+{
+public:
+  using BlockHash = Digest;
+  using Blocks    = std::vector<Block>;
+
+  struct Header
+  {
+    uint8_t  hash[chain::HASH_SIZE];
+    uint8_t  previous_hash[chain::HASH_SIZE];
+    uint64_t block_number;
+    uint64_t offset;
+    uint64_t length;
+  };
+
+  // Construction / Destruction
+  BlockLog()                    = default;
+  BlockLog(BlockLog const &rhs) = delete;
+  BlockLog(BlockLog &&rhs)      = delete;
+  ~BlockLog();
+
+  void New(std::string const &log_file, std::string const &header_file);
+  void Load(std::string const &log_file, std::string const &header_file);
+
+  /// @name Writing
+  /// @{
+  bool Append(Block const &block);
+  void Truncate(uint64_t height);
+  void Flush();
+  /// @}
+
+  /// @name Reading
+  /// @{
+  uint64_t size() const;
+  bool     empty() const;
+  bool     Contains(BlockHash const &hash, uint64_t block_number);
+  bool     GetHeader(uint64_t block_number, Header &header);
+  bool     GetBlock(uint64_t block_number, Block &block);
+  bool     GetBlocks(uint64_t first, uint64_t count, Blocks &blocks);
+  uint64_t Verify();
+  /// @}
+
+  // Operators
+  BlockLog &operator=(BlockLog const &rhs) = delete;
+  BlockLog &operator=(BlockLog &&rhs) = delete;
+
+private:
+  using HeaderStore = storage::RandomAccessStack<Header>;
+
+  uint64_t LogSize();
+  uint64_t LogEnd();
+
+  std::string  header_file_;  ///< Path of the header file, used when resetting
+  HeaderStore  headers_;      ///< Fixed size header per height
+  std::fstream log_;          ///< Serialised blocks in height order
+};
+
+}  // namespace ledger
+}  // namespace fetch
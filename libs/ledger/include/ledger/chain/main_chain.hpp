@@ -26,6 +26,7 @@
 #include "core/mutex.hpp"
 #include "crypto/fnv.hpp"
 #include "ledger/chain/block.hpp"
+#include "ledger/chain/block_log.hpp"
 #include "meta/type_util.hpp"
 #include "network/generics/milli_timer.hpp"
 #include "storage/object_store.hpp"
@@ -174,6 +175,7 @@ public:
   BlockHash  GetHeaviestBlockHash() const;
   Blocks     GetHeaviestChain(uint64_t limit = UPPER_BOUND) const;
   Blocks     GetChainPreceding(BlockHash start, uint64_t limit = UPPER_BOUND) const;
+  BlockPtr   GetBlockByNumber(uint64_t block_number) const;
   Travelogue TimeTravel(BlockHash current_hash) const;
   bool       GetPathToCommonAncestor(
             Blocks &blocks, BlockHash tip_hash, BlockHash node_hash, uint64_t limit = UPPER_BOUND,
@@ -212,6 +214,7 @@ public:
   using LooseBlockMap = std::unordered_map<BlockHash, BlockHashList>;
   using BlockStore    = fetch::storage::ObjectStore<DbRecord>;
   using BlockStorePtr = std::unique_ptr<BlockStore>;
+  using BlockLogPtr   = std::unique_ptr<BlockLog>;
   using RMutex        = std::recursive_mutex;
   using RLock         = std::unique_lock<RMutex>;
 
@@ -253,6 +256,8 @@ public:
   void WriteToFile();
   void TrimCache();
   void FlushBlock(IntBlockPtr const &block);
+  void RebuildBlockLog(BlockHashes const &hashes);
+  bool ReadBlockLog(uint64_t first, uint64_t count, Blocks &blocks) const;
   /// @}
 
   /// @name Loose Blocks
@@ -283,6 +288,7 @@ public:
   BlockMap::size_type UncacheBlock(BlockHash const &hash) const;
   void                KeepBlock(IntBlockPtr const &block) const;
   bool LoadBlock(BlockHash const &hash, Block &block, BlockHash *next_hash = nullptr) const;
+  void RecordLoadedBlock(Block const &block, BlockHash const &next_hash) const;
   /// @}
 
   /// @name Tip Management
@@ -306,6 +312,7 @@ public:
 
   Mode          mode_{Mode::IN_MEMORY_DB};
   BlockStorePtr block_store_;  ///< Long term storage and backup
+  BlockLogPtr   block_log_;    ///< Height indexed log of the finalised chain
   std::fstream  head_store_;
 
   mutable RMutex   lock_;         ///< Mutex protecting block_chain_, tips_ & heaviest_
@@ -21,7 +21,11 @@
 #include "crypto/identity.hpp"
 #include "logging/logging.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace fetch {
@@ -33,6 +37,17 @@ namespace ledger {
  *
  * Conceptually this object represents a stake information for a single point of time, however, in
  * general the stake snapshots will be reused for the entire period of a stake period.
+ *
+ * The records are held in a persistent (immutable, structurally shared) treap ordered by identity.
+ * Copying a snapshot is therefore constant time and an update only copies the path to the record
+ * that changed, so a long history of snapshots shares almost all of its nodes. Every node
+ * aggregates the stake of its subtree, which allows stake weighted selection in logarithmic time.
+ *
+ * The serialised form is that of the previous list based representation, where the records are
+ * listed in the order they were added alongside an identity index whose (hash table) order depends
+ * on the full history of additions and removals. Every record therefore remembers when it was
+ * added, and the snapshot keeps the last materialised identity index together with a short shared
+ * log of the additions and removals since, which are replayed when the snapshot is written.
  */
 class StakeSnapshot
 {
@@ -77,13 +92,61 @@ public:
   StakeSnapshot &operator=(StakeSnapshot &&) = default;
 
 private:
-  using RecordPtr     = std::shared_ptr<Record>;
-  using IdentityIndex = std::unordered_map<Identity, RecordPtr>;
-  using StakeIndex    = std::vector<RecordPtr>;
+  struct Node;
+  struct IndexEvent;
+
+  using NodePtr          = std::shared_ptr<Node const>;
+  using RecordPtr        = std::shared_ptr<Record>;
+  using IdentityIndex    = std::unordered_map<Identity, RecordPtr>;
+  using IdentityIndexPtr = std::shared_ptr<IdentityIndex const>;
+  using StakeIndex       = std::vector<RecordPtr>;
+  using IndexEventPtr    = std::shared_ptr<IndexEvent const>;
+  using Nodes            = std::vector<Node const *>;
+  using SequenceNumber   = uint64_t;
+
+  static constexpr std::size_t MAX_INDEX_EVENTS = 1024;
+
+  struct Node
+  {
+    Record         record;
+    uint64_t       priority;       ///< Heap priority, derived from the identity
+    SequenceNumber sequence;       ///< The order in which the record was added
+    NodePtr        left;           ///< Records with smaller identities
+    NodePtr        right;          ///< Records with larger identities
+    uint64_t       subtree_stake;  ///< Total stake of this node and its children
+    std::size_t    subtree_size;   ///< Number of records in this node and its children
+  };
+
+  struct IndexEvent
+  {
+    Identity      identity;
+    bool          added;     ///< Otherwise removed
+    IndexEventPtr previous;  ///< The preceding event, if any
+  };
 
-  IdentityIndex identity_index_{};  ///< Map of Identity to Record
-  StakeIndex    stake_index_;       ///< Array of Records
-  uint64_t      total_stake_{0};    ///< Total stake cache
+  void          Insert(Record const &record, SequenceNumber sequence);
+  void          RecordIndexEvent(Identity const &identity, bool added);
+  IdentityIndex BuildIdentityIndex() const;
+  StakeIndex    BuildStakeIndex() const;
+  Nodes         ListNodes() const;
+
+  static NodePtr     MakeNode(Record const &record, uint64_t priority, SequenceNumber sequence,
+                              NodePtr left, NodePtr right);
+  static NodePtr     WithChildren(Node const &node, NodePtr left, NodePtr right);
+  static NodePtr     Merge(NodePtr const &left, NodePtr const &right);
+  static void        Split(NodePtr const &node, Identity const &identity, NodePtr &less,
+                           NodePtr &greater_or_equal);
+  static NodePtr     Erase(NodePtr const &node, Identity const &identity);
+  static NodePtr     Replace(NodePtr const &node, Record const &record);
+  static Node const *Find(Node const *node, Identity const &identity);
+  static Node const *SelectByStake(Node const *node, uint64_t offset);
+  static Node const *SelectByIndex(Node const *node, std::size_t index);
+
+  NodePtr          root_{};               ///< Root of the record tree
+  SequenceNumber   next_sequence_{0};     ///< The sequence number of the next record added
+  IdentityIndexPtr index_base_{};         ///< Last materialised identity index, if any
+  IndexEventPtr    index_events_{};       ///< Latest change to the index since its base
+  std::size_t      num_index_events_{0};  ///< The number of changes since the base
 
   template <typename T, typename D>
   friend struct serializers::MapSerializer;
@@ -96,7 +159,7 @@ private:
  */
 inline uint64_t StakeSnapshot::total_stake() const
 {
-  return total_stake_;
+  return root_ ? root_->subtree_stake : 0;
 }
 
 /**
@@ -106,11 +169,11 @@ inline uint64_t StakeSnapshot::total_stake() const
  */
 inline std::size_t StakeSnapshot::size() const
 {
-  return identity_index_.size();
+  return root_ ? root_->subtree_size : 0;
 }
 
 /**
- * Iterate over the contents of the snapshot
+ * Iterate over the contents of the snapshot, in identity order
  *
  * @tparam Functor The type of the functor
  * @param functor The reference to the functor
@@ -118,9 +181,23 @@ inline std::size_t StakeSnapshot::size() const
 template <typename Functor>
 void StakeSnapshot::IterateOver(Functor &&functor) const
 {
-  for (auto const &element : identity_index_)
+  Nodes stack{};
+
+  Node const *node = root_.get();
+  while ((node != nullptr) || !stack.empty())
   {
-    functor(element.first, element.second->stake);
+    while (node != nullptr)
+    {
+      stack.push_back(node);
+      node = node->left.get();
+    }
+
+    node = stack.back();
+    stack.pop_back();
+
+    functor(node->record.identity, node->record.stake);
+
+    node = node->right.get();
   }
 }
 
@@ -165,21 +242,38 @@ public:
   static uint8_t const STAKE_INDEX    = 2;
   static uint8_t const TOTAL_STAKE    = 3;
 
+  // The wire format predates the tree representation, the snapshot is still exchanged as the
+  // identity index and the list of records of the previous representation
   template <typename Constructor>
   static void Serialize(Constructor &map_constructor, Type const &snapshot)
   {
     auto map = map_constructor(3);
-    map.Append(IDENTITY_INDEX, snapshot.identity_index_);
-    map.Append(STAKE_INDEX, snapshot.stake_index_);
-    map.Append(TOTAL_STAKE, snapshot.total_stake_);
+    map.Append(IDENTITY_INDEX, snapshot.BuildIdentityIndex());
+    map.Append(STAKE_INDEX, snapshot.BuildStakeIndex());
+    map.Append(TOTAL_STAKE, snapshot.total_stake());
   }
 
   template <typename MapDeserializer>
   static void Deserialize(MapDeserializer &map, Type &record)
   {
-    map.ExpectKeyGetValue(IDENTITY_INDEX, record.identity_index_);
-    map.ExpectKeyGetValue(STAKE_INDEX, record.stake_index_);
-    map.ExpectKeyGetValue(TOTAL_STAKE, record.total_stake_);
+    typename Type::IdentityIndex identity_index{};
+    typename Type::StakeIndex    stake_index{};
+    uint64_t                     total_stake{0};
+
+    map.ExpectKeyGetValue(IDENTITY_INDEX, identity_index);
+    map.ExpectKeyGetValue(STAKE_INDEX, stake_index);
+    map.ExpectKeyGetValue(TOTAL_STAKE, total_stake);
+
+    // the total stake is recomputed by the tree as the records are added
+    record = Type{};
+    for (auto const &element : stake_index)
+    {
+      record.Insert(*element, record.next_sequence_++);
+    }
+
+    // the loaded index is kept as is, since its order depends on how it was loaded
+    record.index_base_ = std::make_shared<typename Type::IdentityIndex const>(
+        std::move(identity_index));
   }
 };
 
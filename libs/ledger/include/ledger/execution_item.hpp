@@ -33,11 +33,12 @@ namespace ledger {
 class ExecutionItem
 {
 public:
-  using LaneIndex  = uint32_t;
-  using BlockIndex = ExecutorInterface::BlockIndex;
-  using SliceIndex = ExecutorInterface::SliceIndex;
-  using Status     = ExecutorInterface::Status;
-  using Result     = ExecutorInterface::Result;
+  using LaneIndex      = uint32_t;
+  using BlockIndex     = ExecutorInterface::BlockIndex;
+  using SliceIndex     = ExecutorInterface::SliceIndex;
+  using Status         = ExecutorInterface::Status;
+  using Result         = ExecutorInterface::Result;
+  using TransactionPtr = ExecutorInterface::TransactionPtr;
 
   static constexpr char const *LOGGING_NAME = "ExecutionItem";
 
@@ -55,7 +56,7 @@ public:
   TokenAmount      fee() const;
   /// @}
 
-  void Execute(ExecutorInterface &executor);
+  void Execute(ExecutorInterface &executor, TransactionPtr const &tx = TransactionPtr{});
   void AggregateStakeUpdates(StakeUpdateEvents &events);
 
   // Operators
@@ -101,11 +102,25 @@ inline uint64_t ExecutionItem::fee() const
   return fee_;
 }
 
-inline void ExecutionItem::Execute(ExecutorInterface &executor)
+/**
+ * Execute the item on the specified executor
+ *
+ * @param executor The executor to be used
+ * @param tx The prefetched transaction if available, otherwise the executor will retrieve it
+ */
+inline void ExecutionItem::Execute(ExecutorInterface &executor, TransactionPtr const &tx)
 {
   try
   {
-    result_ = executor.Execute(digest_, block_, slice_, shards_);
+    if (tx)
+    {
+      result_ = executor.ExecuteTransaction(tx, block_, slice_, shards_);
+    }
+    else
+    {
+      result_ = executor.Execute(digest_, block_, slice_, shards_);
+    }
+
     fee_ += result_.fee;
   }
   catch (std::exception const &ex)
@@ -47,6 +47,10 @@ namespace ledger {
 /**
  * The Execution Manager is the object which orchestrates the execution of a
  * specified block across a series of executors and lanes.
+ *
+ * While the slices of a block are being executed, the transactions of the block are prefetched
+ * from the storage unit in batches and handed directly to the executors, so that retrieving a
+ * transaction is (in the common case) not on the critical path of its execution.
  */
 class ExecutionManager : public ExecutionManagerInterface,
                          public std::enable_shared_from_this<ExecutionManager>
@@ -79,6 +83,9 @@ public:
     return completed_executions_;
   }
 
+  std::size_t completed_prefetches() const;
+  std::size_t prefetch_hits() const;
+
 private:
   struct Counters
   {
@@ -103,6 +110,9 @@ private:
   using CounterPtr        = telemetry::CounterPtr;
   using HistogramPtr      = telemetry::HistogramPtr;
   using BlockIndex        = uint64_t;
+  using TransactionPtr    = ExecutorInterface::TransactionPtr;
+  using TransactionCache  = DigestMap<TransactionPtr>;
+  using PrefetchPlan      = std::vector<DigestSet>;
 
   struct Summary
   {
@@ -131,12 +141,17 @@ private:
   Mutex        idle_executors_lock_;  ///< guards `idle_executors`
   ExecutorList idle_executors_;
 
+  Mutex            prefetch_lock_;  ///< guards `prefetch_cache_` and `prefetch_generation_`
+  TransactionCache prefetch_cache_;
+  uint64_t         prefetch_generation_{0};
+
   Counter completed_executions_{0};
   Counter num_slices_{0};
 
   Waitable<Counters> counters_{};
 
   ThreadPool thread_pool_;
+  ThreadPool prefetch_pool_;
   ThreadPtr  monitor_thread_;
 
   TransactionStatusCache::ShrdPtr tx_status_cache_;  ///< Ref to the tx status cache
@@ -145,12 +160,22 @@ private:
   CounterPtr   slices_executed_count_;
   CounterPtr   fees_settled_count_;
   CounterPtr   blocks_completed_count_;
+  CounterPtr   tx_prefetch_hit_count_;
+  CounterPtr   tx_prefetch_miss_count_;
   HistogramPtr execution_duration_;
+  HistogramPtr prefetch_duration_;
 
   void MonitorThreadEntrypoint();
 
   bool PlanExecution(Block const &block);
   void DispatchExecution(ExecutionItem &item);
+
+  /// @name Transaction Prefetch
+  /// @{
+  void           SchedulePrefetch(Block const &block);
+  void           Prefetch(uint64_t generation, PrefetchPlan const &plan);
+  TransactionPtr LookupPrefetched(Digest const &digest);
+  /// @}
 };
 
 }  // namespace ledger
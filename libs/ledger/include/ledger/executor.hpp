@@ -59,18 +59,21 @@ public:
   /// @{
   Result Execute(Digest const &digest, BlockIndex block, SliceIndex slice,
                  BitVector const &shards) override;
+  Result ExecuteTransaction(TransactionPtr const &tx, BlockIndex block, SliceIndex slice,
+                            BitVector const &shards) override;
   void   SettleFees(chain::Address const &miner, BlockIndex block, TokenAmount amount,
                     uint32_t log2_num_lanes, StakeUpdateEvents const &stake_updates) override;
   /// @}
 
 private:
-  using TransactionPtr          = std::shared_ptr<chain::Transaction>;
   using CachedStorageAdapterPtr = std::shared_ptr<CachedStorageAdapter>;
 
-  bool RetrieveTransaction(Digest const &digest);
-  bool ValidationChecks(Result &result);
-  bool ExecuteTransactionContract(Result &result);
-  bool ProcessTransfers(Result &result);
+  Result ExecuteCurrentTransaction(bool retrieved, BlockIndex block, SliceIndex slice,
+                                   BitVector const &shards);
+  bool   RetrieveTransaction(Digest const &digest);
+  bool   ValidationChecks(Result &result);
+  bool   ExecuteTransactionContract(Result &result);
+  bool   ProcessTransfers(Result &result);
 
   /// @name Resources
   /// @{
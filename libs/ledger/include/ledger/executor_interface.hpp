@@ -21,6 +21,8 @@
 #include "ledger/consensus/stake_update_event.hpp"
 #include "ledger/execution_result.hpp"
 
+#include <memory>
+
 namespace fetch {
 
 class BitVector;
@@ -28,6 +30,7 @@ class BitVector;
 namespace chain {
 
 class Address;
+class Transaction;
 
 }  // namespace chain
 
@@ -36,12 +39,13 @@ namespace ledger {
 class ExecutorInterface
 {
 public:
-  using BlockIndex  = uint64_t;
-  using SliceIndex  = uint64_t;
-  using LaneIndex   = uint32_t;
-  using TokenAmount = uint64_t;
-  using Status      = ContractExecutionStatus;
-  using Result      = ContractExecutionResult;
+  using BlockIndex     = uint64_t;
+  using SliceIndex     = uint64_t;
+  using LaneIndex      = uint32_t;
+  using TokenAmount    = uint64_t;
+  using Status         = ContractExecutionStatus;
+  using Result         = ContractExecutionResult;
+  using TransactionPtr = std::shared_ptr<chain::Transaction>;
 
   // Construction / Destruction
   ExecutorInterface()          = default;
@@ -51,6 +55,8 @@ public:
   /// @{
   virtual Result Execute(Digest const &digest, BlockIndex block, SliceIndex slice,
                          BitVector const &shards)                                            = 0;
+  virtual Result ExecuteTransaction(TransactionPtr const &tx, BlockIndex block, SliceIndex slice,
+                                    BitVector const &shards)                                 = 0;
   virtual void   SettleFees(chain::Address const &miner, BlockIndex block, TokenAmount amount,
                             uint32_t log2_num_lanes, StakeUpdateEvents const &stake_updates) = 0;
   /// @}
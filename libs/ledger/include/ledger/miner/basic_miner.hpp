@@ -18,6 +18,7 @@
 //------------------------------------------------------------------------------
 
 #include "chain/transaction_layout.hpp"
+#include "core/bitvector.hpp"
 #include "core/digest.hpp"
 #include "core/mutex.hpp"
 #include "ledger/block_packer_interface.hpp"
@@ -25,22 +26,27 @@
 #include "ledger/miner/transaction_layout_queue.hpp"
 #include "meta/log2.hpp"
 #include "telemetry/telemetry.hpp"
-#include "vectorise/threading/pool.hpp"
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 namespace fetch {
 namespace ledger {
 
 /**
- * Simplistic greedy search algorithm for generating / packing blocks. Has rudimentary support to
- * parallelize the packing over a number of threads.
+ * Greedy, fee prioritised search algorithm for generating / packing blocks.
  *
  * Internally the miner maintains 2 queues. One which is the pending queue which is populated when
- * a new transaction is added to the miner. When block generation begins, this pending queue is
- * transferred to the main queue when it is evaluated in order to generate new blocks. During this
- * operation the main queue is locked.
+ * a new transaction is added to the miner. When block generation begins, the pending queue is
+ * sorted by fee and merged into the main queue, which is therefore always kept in fee order
+ * without needing to be completely re-sorted for each block. During this operation the main queue
+ * is locked.
+ *
+ * Packing is a single pass over the main queue, placing each transaction into the first slice in
+ * which none of its lanes are already used. Packing stops once all the slices are full or the
+ * configured time budget has been exhausted.
  */
 class BasicMiner : public ledger::BlockPackerInterface
 {
@@ -50,9 +56,12 @@ public:
   using Block             = ledger::Block;
   using MainChain         = ledger::MainChain;
   using TransactionLayout = chain::TransactionLayout;
+  using Duration          = std::chrono::milliseconds;
+
+  static constexpr Duration DEFAULT_PACKING_BUDGET{500};
 
   // Construction / Destruction
-  explicit BasicMiner(uint32_t log2_num_lanes);
+  explicit BasicMiner(uint32_t log2_num_lanes, Duration packing_budget = DEFAULT_PACKING_BUDGET);
   BasicMiner(BasicMiner const &) = delete;
   BasicMiner(BasicMiner &&)      = delete;
   ~BasicMiner() override         = default;
@@ -71,23 +80,21 @@ public:
   BasicMiner &operator=(BasicMiner &&) = delete;
 
 private:
-  using ThreadPool = threading::Pool;
   using Queue      = TransactionLayoutQueue;
+  using SliceState = std::vector<BitVector>;
+  using Timepoint  = std::chrono::steady_clock::time_point;
 
   /// @name Packing Operations
   /// @{
-  static void GenerateSlices(Queue &transactions, Block &block, std::size_t offset,
-                             std::size_t interval, std::size_t num_lanes);
-  static void GenerateSlice(Queue &transactions, Block::Slice &slice, std::size_t slice_index,
-                            std::size_t num_lanes);
+  static bool GenerateSlices(Queue &transactions, Block &block, std::size_t num_lanes,
+                             Timepoint const &deadline);
   static bool SortByFee(TransactionLayout const &a, TransactionLayout const &b);
   /// @}
 
   /// @name Configuration
   /// @{
-  uint32_t       log2_num_lanes_;   ///< The log2 of the number of lanes
-  uint32_t const max_num_threads_;  ///< The configured maximum number of threads
-  ThreadPool     thread_pool_;      ///< The thread pool used to dispatch work
+  uint32_t       log2_num_lanes_;  ///< The log2 of the number of lanes
+  Duration const packing_budget_;  ///< The maximum time to spend packing a block
   /// @}
 
   /// @name Pending Queue
@@ -109,6 +116,9 @@ private:
   telemetry::GaugePtr<uint64_t> max_pending_pool_size_;
   telemetry::CounterPtr         duplicate_count_;
   telemetry::CounterPtr         duplicate_filtered_count_;
+  telemetry::CounterPtr         invalid_filtered_count_;
+  telemetry::CounterPtr         budget_exceeded_count_;
+  telemetry::HistogramPtr       packing_duration_;
   /// @}
 };
 
@@ -0,0 +1,189 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/random/lcg.hpp"
+#include "vectorise/threading/pool.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace fetch {
+namespace optimisers {
+
+/**
+ * Parallel tempering (replica exchange) solver for binary quadratic problems of the form:
+ *
+ *   E(s) = sum_i h_i s_i + sum_{i < j} J_ij s_i s_j,  s_i in {0, 1}
+ *
+ * A number of replicas are simulated concurrently on a thread pool, each at a fixed inverse
+ * temperature on a geometric ladder between the configured start and end betas. After each round
+ * of sweeps neighbouring replicas attempt to exchange temperatures, which lets the low temperature
+ * replicas escape local minima far more readily than a single annealing schedule.
+ *
+ * Each replica maintains the local field (h_i + sum_j J_ij s_j) of every site, so evaluating a
+ * flip is O(1) and accepting one only requires updating the neighbours of the site. The couplings
+ * are stored either as dense rows, for which the update is a contiguous loop that the compiler can
+ * vectorise, or in compressed sparse row (CSR) form for sparsely coupled problems.
+ *
+ * The programming interface (Resize / Insert / Normalise / FindMinimum) matches BinaryAnnealer so
+ * that the two can be used interchangeably.
+ */
+class ParallelTemperingAnnealer
+{
+public:
+  using SpinType  = int16_t;
+  using StateType = std::vector<SpinType>;
+  using CostType  = double;
+  using Duration  = std::chrono::milliseconds;
+
+  enum class Layout
+  {
+    AUTOMATIC,  ///< Select the layout based on the density of the couplings
+    DENSE,
+    SPARSE
+  };
+
+  static constexpr char const *LOGGING_NAME = "ParallelTemperingAnnealer";
+
+  static constexpr std::size_t DEFAULT_NUM_REPLICAS       = 8;
+  static constexpr std::size_t DEFAULT_SWEEPS_PER_ROUND   = 4;
+  static constexpr double      DENSE_LAYOUT_MIN_OCCUPANCY = 0.1;
+
+  // Construction / Destruction
+  explicit ParallelTemperingAnnealer(std::size_t num_threads = 0);
+  ParallelTemperingAnnealer(ParallelTemperingAnnealer const &) = delete;
+  ParallelTemperingAnnealer(ParallelTemperingAnnealer &&)      = delete;
+  ~ParallelTemperingAnnealer()                                 = default;
+
+  /// @name Problem Definition
+  /// @{
+  void        Resize(std::size_t n, std::size_t max_connectivity = std::size_t(-1));
+  void        Insert(std::size_t i, std::size_t j, CostType const &value);
+  void        Normalise();
+  void        Reset();
+  std::size_t size() const;
+  /// @}
+
+  /// @name Configuration
+  /// @{
+  void SetSweeps(std::size_t sweeps);
+  void SetBetaStart(double const &beta);
+  void SetBetaEnd(double const &beta);
+  void SetNumReplicas(std::size_t num_replicas);
+  void SetSweepsPerRound(std::size_t sweeps);
+  void SetTimeBudget(Duration const &budget);
+  void SetLayout(Layout layout);
+  void Seed(uint64_t seed);
+
+  std::size_t sweeps() const;
+  std::size_t num_replicas() const;
+  /// @}
+
+  /// @name Solving
+  /// @{
+  CostType    FindMinimum();
+  CostType    FindMinimum(StateType &state, bool binary = true);
+  CostType    Energy() const;
+  CostType    Energy(StateType const &state) const;
+  std::size_t sweeps_completed() const;
+  bool        is_dense() const;
+  /// @}
+
+  // Operators
+  ParallelTemperingAnnealer &operator=(ParallelTemperingAnnealer const &) = delete;
+  ParallelTemperingAnnealer &operator=(ParallelTemperingAnnealer &&) = delete;
+
+private:
+  using Rng        = random::LinearCongruentialGenerator;
+  using ThreadPool = threading::Pool;
+  using PoolPtr    = std::unique_ptr<ThreadPool>;
+  using Spins      = std::vector<uint8_t>;
+  using Costs      = std::vector<CostType>;
+  using Indices    = std::vector<uint32_t>;
+  using Clock      = std::chrono::steady_clock;
+
+  struct Replica
+  {
+    Spins    spins;   ///< The current state of each of the sites
+    Costs    fields;  ///< The local field of each of the sites
+    CostType energy{0};
+    Rng      rng;
+  };
+
+  using Couplings = std::unordered_map<uint64_t, CostType>;  ///< Keyed by (i << 32) | j, i < j
+  using Replicas  = std::vector<Replica>;
+  using Order     = std::vector<std::size_t>;
+
+  void     Prepare();
+  void     Anneal();
+  void     Initialise(Replica &replica) const;
+  void     Sweep(Replica &replica, double beta, std::size_t num_sweeps) const;
+  void     Flip(Replica &replica, std::size_t site) const;
+  void     Exchange(std::size_t round);
+  void     UpdateBest();
+  CostType Evaluate(Spins const &spins) const;
+
+  /// @name Problem
+  /// @{
+  std::size_t size_{0};
+  Costs       local_fields_;  ///< The h_i terms
+  Couplings   couplings_;     ///< The J_ij terms
+  CostType    normalisation_constant_{1.0};
+  bool        prepared_{false};
+  /// @}
+
+  /// @name Coupling Layout
+  /// @{
+  Layout  layout_{Layout::AUTOMATIC};
+  bool    dense_{false};
+  Costs   dense_couplings_;  ///< Row major n x n matrix
+  Indices row_offsets_;      ///< CSR row offsets
+  Indices columns_;          ///< CSR column indices
+  Costs   values_;           ///< CSR coupling values
+  /// @}
+
+  /// @name Configuration
+  /// @{
+  std::size_t sweeps_{10};
+  std::size_t sweeps_per_round_{DEFAULT_SWEEPS_PER_ROUND};
+  std::size_t num_replicas_{DEFAULT_NUM_REPLICAS};
+  double      beta0_{0.1};
+  double      beta1_{3.0};
+  Duration    time_budget_{Duration::zero()};
+  Rng         rng_;
+  PoolPtr     pool_;
+  /// @}
+
+  /// @name Solution State
+  /// @{
+  Replicas    replicas_;
+  Order       order_;  ///< Maps the temperature index to the replica index
+  Costs       betas_;  ///< The inverse temperature ladder
+  Spins       best_spins_;
+  CostType    best_energy_{0};
+  std::size_t sweeps_completed_{0};
+  /// @}
+};
+
+}  // namespace optimisers
+}  // namespace fetch
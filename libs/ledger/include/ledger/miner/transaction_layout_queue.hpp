@@ -23,11 +23,20 @@
 #include <cstddef>
 #include <cstdint>
 #include <list>
+#include <unordered_set>
 #include <utility>
 
 namespace fetch {
 namespace ledger {
 
+/**
+ * An ordered queue of transaction layouts.
+ *
+ * In addition to the list of layouts, the queue maintains an index from the transaction digest to
+ * its position in the list. This means that duplicates can be detected and individual transactions
+ * (for example those which have already been included in another block) can be removed in
+ * constant time, without searching the list.
+ */
 class TransactionLayoutQueue
 {
 public:
@@ -45,16 +54,16 @@ public:
 
   /// @name Iteration
   /// @{
-  ConstIterator    cbegin() const;
-  ConstIterator    begin() const;
-  Iterator         begin();
-  ConstIterator    cend() const;
-  ConstIterator    end() const;
-  Iterator         end();
-  std::size_t      size() const;
-  bool             empty() const;
-  DigestSet const &digests() const;
-  TxLayoutSet      TxLayouts() const;
+  ConstIterator cbegin() const;
+  ConstIterator begin() const;
+  Iterator      begin();
+  ConstIterator cend() const;
+  ConstIterator end() const;
+  Iterator      end();
+  std::size_t   size() const;
+  bool          empty() const;
+  bool          Contains(Digest const &digest) const;
+  TxLayoutSet   TxLayouts() const;
   /// @}
 
   /// @name Basic Operations
@@ -66,8 +75,14 @@ public:
   void        Splice(TransactionLayoutQueue &other, Iterator start, Iterator end);
   Iterator    Erase(Iterator const &iterator);
 
+  template <typename Predicate>
+  std::size_t RemoveIf(Predicate &&predicate);
+
   template <typename SortPredicate>
   void Sort(SortPredicate &&predicate);
+
+  template <typename SortPredicate>
+  void Merge(TransactionLayoutQueue &other, SortPredicate &&predicate);
   /// @}
 
   // Operators
@@ -75,15 +90,73 @@ public:
   TransactionLayoutQueue &operator=(TransactionLayoutQueue &&) = delete;
 
 private:
-  DigestSet      digests_;  ///< Set of digests stored within the list
-  UnderlyingList list_;     ///< The list of transaction layouts
+  using Index = DigestMap<Iterator>;
+
+  void RemoveDuplicates(TransactionLayoutQueue &other);
+
+  Index          index_;  ///< Map of digest to the position of the layout in the list
+  UnderlyingList list_;   ///< The list of transaction layouts
 };
 
+/**
+ * Remove all the transaction layouts which satisfy the specified predicate
+ *
+ * @tparam Predicate The type of the predicate
+ * @param predicate The predicate, returning true for layouts which should be removed
+ * @return The number of transaction layouts removed from the queue
+ */
+template <typename Predicate>
+std::size_t TransactionLayoutQueue::RemoveIf(Predicate &&predicate)
+{
+  std::size_t count{0};
+
+  for (auto it = list_.begin(); it != list_.end();)
+  {
+    if (predicate(*it))
+    {
+      it = Erase(it);
+      ++count;
+    }
+    else
+    {
+      ++it;
+    }
+  }
+
+  return count;
+}
+
 template <typename SortPredicate>
 void TransactionLayoutQueue::Sort(SortPredicate &&predicate)
 {
   list_.sort(std::forward<SortPredicate>(predicate));
 }
 
+/**
+ * Merge the contents of the specified queue into the current queue, preserving the ordering. Both
+ * queues must already be sorted by the same predicate. Duplicate entries in the other queue are
+ * discarded.
+ *
+ * After the operation the input queue will be empty
+ *
+ * @tparam SortPredicate The type of the sort predicate
+ * @param other The queue to be merged into this one
+ * @param predicate The predicate by which both of the queues are sorted
+ */
+template <typename SortPredicate>
+void TransactionLayoutQueue::Merge(TransactionLayoutQueue &other, SortPredicate &&predicate)
+{
+  RemoveDuplicates(other);
+
+  // list iterators remain valid after a merge, so they can simply be moved between the indices
+  for (auto &entry : other.index_)
+  {
+    index_.emplace(entry.first, entry.second);
+  }
+  other.index_.clear();
+
+  list_.merge(other.list_, std::forward<SortPredicate>(predicate));
+}
+
 }  // namespace ledger
 }  // namespace fetch
@@ -50,10 +50,11 @@ public:
 
   /// @name Transaction Interface
   /// @{
-  void AddTransaction(Transaction const &tx) override;
-  bool GetTransaction(Digest const &digest, Transaction &tx) override;
-  bool HasTransaction(Digest const &digest) override;
-  void IssueCallForMissingTxs(DigestSet const &digests) override;
+  void            AddTransaction(Transaction const &tx) override;
+  bool            GetTransaction(Digest const &digest, Transaction &tx) override;
+  TransactionList GetTransactions(DigestSet const &digests) override;
+  bool            HasTransaction(Digest const &digest) override;
+  void            IssueCallForMissingTxs(DigestSet const &digests) override;
   /// @}
 
   /// @name Transaction History Poll
@@ -64,15 +64,18 @@ public:
 
   /// @name Storage Unit Interface
   /// @{
-  void      AddTransaction(chain::Transaction const &tx) override;
-  bool      GetTransaction(ConstByteArray const &digest, chain::Transaction &tx) override;
-  bool      HasTransaction(ConstByteArray const &digest) override;
-  void      IssueCallForMissingTxs(DigestSet const &digest_set) override;
-  TxLayouts PollRecentTx(uint32_t max_to_poll) override;
-
-  Document GetOrCreate(ResourceAddress const &key) override;
-  Document Get(ResourceAddress const &key) const override;
-  void     Set(ResourceAddress const &key, StateValue const &value) override;
+  void            AddTransaction(chain::Transaction const &tx) override;
+  bool            GetTransaction(ConstByteArray const &digest, chain::Transaction &tx) override;
+  TransactionList GetTransactions(DigestSet const &digests) override;
+  bool            HasTransaction(ConstByteArray const &digest) override;
+  void            IssueCallForMissingTxs(DigestSet const &digest_set) override;
+  TxLayouts       PollRecentTx(uint32_t max_to_poll) override;
+
+  Document  GetOrCreate(ResourceAddress const &key) override;
+  Document  Get(ResourceAddress const &key) const override;
+  void      Set(ResourceAddress const &key, StateValue const &value) override;
+  Documents GetMany(ResourceAddresses const &keys) const override;
+  void      SetMany(KeyValues const &entries) override;
 
   void Reset() override;
 
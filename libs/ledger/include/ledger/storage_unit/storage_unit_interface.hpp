@@ -23,6 +23,8 @@
 #include "storage/document.hpp"
 #include "storage/resource_mapper.hpp"
 
+#include <memory>
+#include <utility>
 #include <vector>
 
 namespace fetch {
@@ -38,11 +40,15 @@ namespace ledger {
 class StorageInterface
 {
 public:
-  using Document        = storage::Document;
-  using ResourceAddress = storage::ResourceAddress;
-  using StateValue      = byte_array::ConstByteArray;
-  using ShardIndex      = uint32_t;
-  using Keys            = std::vector<storage::ResourceID>;
+  using Document          = storage::Document;
+  using ResourceAddress   = storage::ResourceAddress;
+  using StateValue        = byte_array::ConstByteArray;
+  using ShardIndex        = uint32_t;
+  using Keys              = std::vector<storage::ResourceID>;
+  using ResourceAddresses = std::vector<ResourceAddress>;
+  using Documents         = std::vector<Document>;
+  using KeyValue          = std::pair<ResourceAddress, StateValue>;
+  using KeyValues         = std::vector<KeyValue>;
 
   // Construction / Destruction
   StorageInterface()          = default;
@@ -57,14 +63,56 @@ public:
   virtual bool     Unlock(ShardIndex shard)                                 = 0;
   virtual void     Reset()                                                  = 0;
   /// @}
+
+  /// @name Batched State Interface
+  /// @{
+  virtual Documents GetMany(ResourceAddresses const &keys) const;
+  virtual void      SetMany(KeyValues const &entries);
+  /// @}
 };
 
+/**
+ * Lookup a series of documents from the storage engine. By default this is a series of individual
+ * lookups, implementations should override this when they can service the request more efficiently
+ *
+ * @param keys The keys to be looked up
+ * @return The documents corresponding (in order) to each of the keys
+ */
+inline StorageInterface::Documents StorageInterface::GetMany(ResourceAddresses const &keys) const
+{
+  Documents docs{};
+  docs.reserve(keys.size());
+
+  for (auto const &key : keys)
+  {
+    docs.emplace_back(Get(key));
+  }
+
+  return docs;
+}
+
+/**
+ * Set a series of values on the storage engine. By default this is a series of individual sets,
+ * implementations should override this when they can service the request more efficiently
+ *
+ * @param entries The key value pairs to be stored
+ */
+inline void StorageInterface::SetMany(KeyValues const &entries)
+{
+  for (auto const &entry : entries)
+  {
+    Set(entry.first, entry.second);
+  }
+}
+
 class StorageUnitInterface : public StorageInterface
 {
 public:
-  using Hash           = byte_array::ConstByteArray;
-  using ConstByteArray = byte_array::ConstByteArray;
-  using TxLayouts      = std::vector<chain::TransactionLayout>;
+  using Hash            = byte_array::ConstByteArray;
+  using ConstByteArray  = byte_array::ConstByteArray;
+  using TxLayouts       = std::vector<chain::TransactionLayout>;
+  using TransactionPtr  = std::shared_ptr<chain::Transaction>;
+  using TransactionList = std::vector<TransactionPtr>;
 
   // Construction / Destruction
   StorageUnitInterface()           = default;
@@ -72,10 +120,11 @@ public:
 
   /// @name Transaction Interface
   /// @{
-  virtual void AddTransaction(chain::Transaction const &tx)                 = 0;
-  virtual bool GetTransaction(Digest const &digest, chain::Transaction &tx) = 0;
-  virtual bool HasTransaction(Digest const &digest)                         = 0;
-  virtual void IssueCallForMissingTxs(DigestSet const &tx_set)              = 0;
+  virtual void            AddTransaction(chain::Transaction const &tx)                 = 0;
+  virtual bool            GetTransaction(Digest const &digest, chain::Transaction &tx) = 0;
+  virtual TransactionList GetTransactions(DigestSet const &digests)                    = 0;
+  virtual bool            HasTransaction(Digest const &digest)                         = 0;
+  virtual void            IssueCallForMissingTxs(DigestSet const &tx_set)              = 0;
   /// @}
 
   virtual TxLayouts PollRecentTx(uint32_t) = 0;
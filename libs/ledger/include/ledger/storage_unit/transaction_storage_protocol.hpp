@@ -19,6 +19,7 @@
 
 #include "chain/transaction.hpp"
 #include "chain/transaction_layout.hpp"
+#include "core/digest.hpp"
 #include "network/service/protocol.hpp"
 #include "telemetry/telemetry.hpp"
 
@@ -37,6 +38,7 @@ class TransactionStorageProtocol : public service::Protocol
 {
 public:
   using TxLayouts = std::vector<chain::TransactionLayout>;
+  using TxArray   = std::vector<chain::Transaction>;
 
   enum
   {
@@ -44,7 +46,8 @@ public:
     HAS,
     GET,
     GET_COUNT,
-    GET_RECENT
+    GET_RECENT,
+    GET_MANY
   };
 
   TransactionStorageProtocol(TransactionStorageEngineInterface &storage, uint32_t lane);
@@ -59,6 +62,7 @@ private:
   void               Add(chain::Transaction const &tx);
   bool               Has(Digest const &tx_digest);
   chain::Transaction Get(Digest const &tx_digest);
+  TxArray            GetMany(DigestSet const &tx_digests);
   uint64_t           GetCount();
   TxLayouts          GetRecent(uint32_t max_to_poll);
 
@@ -72,11 +76,13 @@ private:
   telemetry::CounterPtr   get_total_;
   telemetry::CounterPtr   get_count_total_;
   telemetry::CounterPtr   get_recent_total_;
+  telemetry::CounterPtr   get_many_total_;
   telemetry::HistogramPtr add_durations_;
   telemetry::HistogramPtr has_durations_;
   telemetry::HistogramPtr get_durations_;
   telemetry::HistogramPtr get_count_durations_;
   telemetry::HistogramPtr get_recent_durations_;
+  telemetry::HistogramPtr get_many_durations_;
 };
 
 }  // namespace ledger
@@ -0,0 +1,148 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/digest.hpp"
+#include "telemetry/telemetry.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace fetch {
+namespace ledger {
+
+/**
+ * Traces sampled transactions through the processing pipeline.
+ *
+ * Every time a sampled transaction crosses the boundary between two stages (verification, storage,
+ * mining, execution...) a timestamped event is written into a fixed size lock free ring buffer.
+ * Whether a transaction is sampled is derived from its digest, so all stages agree without any
+ * coordination. When sampling is disabled recording costs a single relaxed atomic load.
+ *
+ * The events are grouped back into per transaction traces on demand, from which the latency of
+ * each stage is aggregated into percentile gauges in the telemetry registry whenever the telemetry
+ * is exported. Recording never aggregates, so it stays constant time.
+ */
+class TransactionTracer
+{
+public:
+  using Clock     = std::chrono::steady_clock;
+  using Timepoint = Clock::time_point;
+
+  enum class Stage : uint8_t
+  {
+    RECEIVED = 0,  ///< Submitted to the transaction verifier
+    VERIFIED,      ///< Signatures have been verified
+    STORED,        ///< Added to the storage engine of a lane
+    QUEUED,        ///< Added to the pending pool of the miner
+    SCHEDULED,     ///< Part of a block scheduled for execution
+    EXECUTED,      ///< Executed by an executor
+  };
+
+  static constexpr std::size_t NUM_STAGES = 6;
+  static constexpr std::size_t CAPACITY   = 1u << 14;  ///< Number of events kept, power of 2
+
+  struct Span
+  {
+    Stage     stage;
+    Timepoint timestamp;
+  };
+
+  struct Trace
+  {
+    Digest            digest;
+    std::vector<Span> spans;  ///< Ordered by time
+  };
+
+  using Traces = std::vector<Trace>;
+
+  static TransactionTracer &Instance();
+
+  // Construction / Destruction
+  TransactionTracer();
+  TransactionTracer(TransactionTracer const &) = delete;
+  TransactionTracer(TransactionTracer &&)      = delete;
+  ~TransactionTracer();
+
+  /// @name Sampling
+  /// @{
+  void     SetSampleInterval(uint32_t interval);
+  uint32_t sample_interval() const;
+  bool     IsSampled(Digest const &digest) const;
+  /// @}
+
+  void Record(Digest const &digest, Stage stage);
+
+  /// @name Export
+  /// @{
+  Traces Collect() const;
+  Trace  Collect(Digest const &digest) const;
+  void   UpdateTelemetry();
+  /// @}
+
+  // Operators
+  TransactionTracer &operator=(TransactionTracer const &) = delete;
+  TransactionTracer &operator=(TransactionTracer &&) = delete;
+
+private:
+  static constexpr std::size_t DIGEST_WORDS = 4;
+
+  struct Slot;
+  struct Event;
+
+  using GaugePtr = telemetry::GaugePtr<double>;
+  using Gauges   = std::array<GaugePtr, NUM_STAGES>;
+
+  static bool IsSampled(Digest const &digest, uint32_t interval);
+
+  void   RecordSampled(Digest const &digest, Stage stage);
+  Traces Collect(Digest const *filter) const;
+
+  std::unique_ptr<Slot[]> slots_;
+  std::atomic<uint64_t>   next_{0};
+  std::atomic<uint32_t>   sample_interval_{0};  ///< Trace 1 in N transactions, 0 disables tracing
+
+  Gauges p50_;
+  Gauges p99_;
+};
+
+char const *ToString(TransactionTracer::Stage stage);
+
+/**
+ * Record that a transaction has reached a stage, if it is sampled
+ *
+ * @param digest The digest of the transaction
+ * @param stage The stage it has reached
+ */
+inline void TransactionTracer::Record(Digest const &digest, Stage stage)
+{
+  uint32_t const interval = sample_interval_.load(std::memory_order_relaxed);
+
+  if ((interval != 0) && IsSampled(digest, interval))
+  {
+    RecordSampled(digest, stage);
+  }
+}
+
+}  // namespace ledger
+}  // namespace fetch
@@ -0,0 +1,48 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "http/module.hpp"
+
+namespace fetch {
+namespace ledger {
+
+class TransactionTracer;
+
+/**
+ * Exports the traces of sampled transactions and controls the sampling interval
+ */
+class TxTraceHttpInterface : public http::HTTPModule
+{
+public:
+  // Construction / Destruction
+  explicit TxTraceHttpInterface(TransactionTracer &tracer);
+  TxTraceHttpInterface(TxTraceHttpInterface const &) = delete;
+  TxTraceHttpInterface(TxTraceHttpInterface &&)      = delete;
+  ~TxTraceHttpInterface() override                   = default;
+
+  // Operators
+  TxTraceHttpInterface &operator=(TxTraceHttpInterface const &) = delete;
+  TxTraceHttpInterface &operator=(TxTraceHttpInterface &&) = delete;
+
+private:
+  TransactionTracer &tracer_;
+};
+
+}  // namespace ledger
+}  // namespace fetch
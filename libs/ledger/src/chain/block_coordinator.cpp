@@ -32,6 +32,7 @@
 #include "ledger/execution_manager_interface.hpp"
 #include "ledger/storage_unit/storage_unit_interface.hpp"
 #include "ledger/transaction_status_cache.hpp"
+#include "ledger/transaction_tracer.hpp"
 #include "ledger/upow/synergetic_execution_manager.hpp"
 #include "ledger/upow/synergetic_executor.hpp"
 #include "telemetry/counter.hpp"
@@ -1147,6 +1148,18 @@ bool BlockCoordinator::ScheduleBlock(Block const &block)
   {
     // signal success
     success = true;
+
+    auto &tracer = TransactionTracer::Instance();
+    if (tracer.sample_interval() != 0)
+    {
+      for (auto const &slice : block.slices)
+      {
+        for (auto const &layout : slice)
+        {
+          tracer.Record(layout.digest(), TransactionTracer::Stage::SCHEDULED);
+        }
+      }
+    }
   }
   else
   {
@@ -0,0 +1,426 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "core/serializers/main_serializer.hpp"
+#include "ledger/chain/block_log.hpp"
+#include "logging/logging.hpp"
+#include "storage/storage_exception.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+
+namespace fetch {
+namespace ledger {
+namespace {
+
+constexpr char const *LOGGING_NAME      = "BlockLog";
+constexpr uint64_t    VERIFY_BATCH_SIZE = 4096;  ///< Headers read per chunk during verification
+
+using HashArray = uint8_t[chain::HASH_SIZE];
+
+bool CopyHash(Digest const &hash, HashArray &output)
+{
+  if (hash.size() != chain::HASH_SIZE)
+  {
+    return false;
+  }
+
+  std::memcpy(output, hash.pointer(), chain::HASH_SIZE);
+  return true;
+}
+
+bool IsSameHash(HashArray const &lhs, HashArray const &rhs)
+{
+  return std::memcmp(lhs, rhs, chain::HASH_SIZE) == 0;
+}
+
+bool IsSameHash(HashArray const &lhs, Digest const &rhs)
+{
+  return (rhs.size() == chain::HASH_SIZE) &&
+         (std::memcmp(lhs, rhs.pointer(), chain::HASH_SIZE) == 0);
+}
+
+}  // namespace
+
+BlockLog::~BlockLog()
+{
+  Flush();
+}
+
+/**
+ * Create a new (empty) block log, discarding the contents of any existing files
+ *
+ * @param log_file The path to the serialised block file
+ * @param header_file The path to the header file
+ */
+void BlockLog::New(std::string const &log_file, std::string const &header_file)
+{
+  header_file_ = header_file;
+  headers_.New(header_file_);
+
+  log_.close();
+  log_.open(log_file, std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
+}
+
+/**
+ * Load an existing block log, creating it if it is not present. The log is verified on loading
+ * and any trailing entries which do not form a continuous chain are discarded.
+ *
+ * @param log_file The path to the serialised block file
+ * @param header_file The path to the header file
+ */
+void BlockLog::Load(std::string const &log_file, std::string const &header_file)
+{
+  header_file_ = header_file;
+
+  log_.close();
+  log_.open(log_file, std::ios::binary | std::ios::in | std::ios::out);
+
+  if (!log_.is_open())
+  {
+    // the log file is not present, there is nothing to recover
+    New(log_file, header_file);
+    return;
+  }
+
+  try
+  {
+    headers_.Load(header_file_, true);
+  }
+  catch (storage::StorageException const &e)
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Unable to load block log headers: ", e.what(), ". Resetting.");
+    New(log_file, header_file);
+    return;
+  }
+
+  Verify();
+}
+
+/**
+ * Append a block to the log
+ *
+ * The block must either extend the current top of the log or replace an existing entry, in which
+ * case the entry at that height and all entries above it are discarded. Appending a block which
+ * is already present at its height is a no-op.
+ *
+ * @param block The block to be appended
+ * @return true if the log now contains the block, otherwise false
+ */
+bool BlockLog::Append(Block const &block)
+{
+  uint64_t const height = block.block_number;
+
+  Header header{};
+  if (!CopyHash(block.hash, header.hash))
+  {
+    return false;
+  }
+
+  if (height < size())
+  {
+    if (Contains(block.hash, height))
+    {
+      return true;
+    }
+
+    // the log is being reorganised, forget everything from this height upwards
+    Truncate(height);
+  }
+
+  // the log only holds unbroken chains
+  if (height != size())
+  {
+    return false;
+  }
+
+  if (height > 0)
+  {
+    Header parent{};
+    headers_.Get(height - 1, parent);
+
+    if (!IsSameHash(parent.hash, block.previous_hash))
+    {
+      return false;
+    }
+  }
+
+  CopyHash(block.previous_hash, header.previous_hash);
+
+  serializers::MsgPackSerializer buffer;
+  buffer << block;
+
+  header.block_number = height;
+  header.offset       = LogEnd();
+  header.length       = buffer.data().size();
+
+  log_.seekp(static_cast<std::streamoff>(header.offset));
+  log_.write(buffer.data().char_pointer(), static_cast<std::streamsize>(header.length));
+
+  if (!log_)
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Failed to write block ", height, " to the block log");
+    log_.clear();
+    return false;
+  }
+
+  headers_.Push(header);
+
+  return true;
+}
+
+/**
+ * Discard all the entries in the log at or above the specified height
+ *
+ * @param height The first height to be discarded
+ */
+void BlockLog::Truncate(uint64_t height)
+{
+  if (height == 0)
+  {
+    headers_.New(header_file_);
+    return;
+  }
+
+  while (size() > height)
+  {
+    headers_.Pop();
+  }
+
+  // the block data beyond the new top of the log is simply overwritten by subsequent appends
+}
+
+void BlockLog::Flush()
+{
+  if (headers_.is_open())
+  {
+    headers_.Flush();
+  }
+
+  if (log_.is_open())
+  {
+    log_.flush();
+  }
+}
+
+/**
+ * Get the number of blocks in the log, which is also the height of the next block to be appended
+ *
+ * @return The number of blocks
+ */
+uint64_t BlockLog::size() const
+{
+  return headers_.is_open() ? headers_.size() : 0;
+}
+
+bool BlockLog::empty() const
+{
+  return size() == 0;
+}
+
+/**
+ * Determine if the specified block is stored in the log
+ *
+ * @param hash The hash of the block
+ * @param block_number The height of the block
+ * @return true if the block is in the log, otherwise false
+ */
+bool BlockLog::Contains(BlockHash const &hash, uint64_t block_number)
+{
+  Header header{};
+  return GetHeader(block_number, header) && IsSameHash(header.hash, hash);
+}
+
+/**
+ * Lookup the header for a given height
+ *
+ * @param block_number The height of the block
+ * @param header The output header to be populated
+ * @return true if successful, otherwise false
+ */
+bool BlockLog::GetHeader(uint64_t block_number, Header &header)
+{
+  if (block_number >= size())
+  {
+    return false;
+  }
+
+  headers_.Get(block_number, header);
+  return true;
+}
+
+/**
+ * Read a single block from the log
+ *
+ * @param block_number The height of the block
+ * @param block The output block to be populated
+ * @return true if successful, otherwise false
+ */
+bool BlockLog::GetBlock(uint64_t block_number, Block &block)
+{
+  Blocks blocks;
+  if (!GetBlocks(block_number, 1, blocks))
+  {
+    return false;
+  }
+
+  block = std::move(blocks.front());
+  return true;
+}
+
+/**
+ * Read a range of blocks from the log with a single sequential read. The range is clipped to the
+ * top of the log.
+ *
+ * @param first The height of the first block to be read
+ * @param count The maximum number of blocks to be read
+ * @param blocks The output array to which the blocks are appended, in ascending height order
+ * @return true if at least one block was read, otherwise false
+ */
+bool BlockLog::GetBlocks(uint64_t first, uint64_t count, Blocks &blocks)
+{
+  if (first >= size())
+  {
+    return false;
+  }
+
+  count = std::min(count, size() - first);
+  if (count == 0)
+  {
+    return false;
+  }
+
+  std::vector<Header> headers(count);
+  headers_.GetBulk(first, count, headers.data());
+
+  uint64_t const start = headers.front().offset;
+  uint64_t const end   = headers.back().offset + headers.back().length;
+
+  byte_array::ByteArray contents;
+  contents.Resize(end - start);
+
+  log_.seekg(static_cast<std::streamoff>(start));
+  log_.read(contents.char_pointer(), static_cast<std::streamsize>(contents.size()));
+
+  if (!log_)
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Failed to read blocks ", first, " to ", first + count - 1,
+                   " from the block log");
+    log_.clear();
+    return false;
+  }
+
+  std::size_t const previous_size = blocks.size();
+  blocks.reserve(previous_size + count);
+
+  try
+  {
+    for (auto const &header : headers)
+    {
+      serializers::MsgPackSerializer buffer{
+          byte_array::ConstByteArray{contents, header.offset - start, header.length}};
+
+      blocks.emplace_back();
+      buffer >> blocks.back();
+    }
+  }
+  catch (std::exception const &e)
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Unable to deserialise block from the block log: ", e.what());
+    blocks.resize(previous_size);
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Scan the header file checking that each entry follows on from the previous one and is backed by
+ * data in the block log. The log is truncated at the first invalid entry.
+ *
+ * @return The number of valid blocks in the log
+ */
+uint64_t BlockLog::Verify()
+{
+  uint64_t const total    = size();
+  uint64_t const log_size = LogSize();
+
+  std::vector<Header> batch(std::min(total, VERIFY_BATCH_SIZE));
+
+  Header   previous{};
+  uint64_t height{0};
+  bool     valid{true};
+
+  while (valid && (height < total))
+  {
+    uint64_t const count = std::min(VERIFY_BATCH_SIZE, total - height);
+    headers_.GetBulk(height, count, batch.data());
+
+    for (uint64_t i = 0; i < count; ++i)
+    {
+      auto const &header = batch[i];
+
+      uint64_t const expected_offset = (height == 0) ? 0 : previous.offset + previous.length;
+
+      bool const linked = (height == 0) || IsSameHash(header.previous_hash, previous.hash);
+
+      if ((header.block_number != height) || !linked || (header.offset != expected_offset) ||
+          (header.offset + header.length > log_size))
+      {
+        FETCH_LOG_WARN(LOGGING_NAME, "Block log discontinuity at height: ", height,
+                       ". Truncating.");
+        valid = false;
+        break;
+      }
+
+      previous = header;
+      ++height;
+    }
+  }
+
+  if (height < total)
+  {
+    Truncate(height);
+  }
+
+  return height;
+}
+
+uint64_t BlockLog::LogSize()
+{
+  log_.seekg(0, std::ios::end);
+  auto const file_size = log_.tellg();
+
+  return (file_size > 0) ? static_cast<uint64_t>(file_size) : 0;
+}
+
+uint64_t BlockLog::LogEnd()
+{
+  if (empty())
+  {
+    return 0;
+  }
+
+  Header const top = headers_.Top();
+  return top.offset + top.length;
+}
+
+}  // namespace ledger
+}  // namespace fetch
@@ -48,6 +48,11 @@ namespace ledger {
 
 namespace {
 constexpr char const *BLOOM_FILTER_STORE = "chain.bloom.db";
+constexpr char const *BLOCK_LOG_STORE    = "chain.log.db";
+constexpr char const *BLOCK_HEADER_STORE = "chain.headers.db";
+
+/// The maximum number of blocks read from the block log at once
+constexpr uint64_t BLOCK_LOG_PAGE_SIZE = 256;
 }
 
 /**
@@ -75,6 +80,7 @@ MainChain::MainChain(Mode mode)
   {
     // create the block store
     block_store_ = std::make_unique<BlockStore>();
+    block_log_   = std::make_unique<BlockLog>();
 
     RecoverFromFile(mode);
   }
@@ -108,6 +114,7 @@ void MainChain::Reset()
   if (block_store_)
   {
     block_store_->New("chain.db", "chain.index.db");
+    block_log_->New(BLOCK_LOG_STORE, BLOCK_HEADER_STORE);
     head_store_.close();
     head_store_.open("chain.head.db",
                      std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
@@ -365,20 +372,11 @@ bool MainChain::LoadBlock(BlockHash const &hash, Block &block, BlockHash *next_h
   if (block_store_->Get(storage::ResourceID(hash), record))
   {
     block = record.block;
-    AddBlockToBloomFilter(block);
+    RecordLoadedBlock(block, record.next_hash);
     if (next_hash != nullptr)
     {
       *next_hash = record.next_hash;
     }
-    // update references assuming those from storage are unique
-    if (!block.IsGenesis())
-    {
-      CacheReference(block.previous_hash, hash, true);
-    }
-    if (!record.next_hash.empty())
-    {
-      CacheReference(hash, record.next_hash, true);
-    }
 
     return true;
   }
@@ -386,6 +384,28 @@ bool MainChain::LoadBlock(BlockHash const &hash, Block &block, BlockHash *next_h
   return false;
 }
 
+/**
+ * Internal: update the bloom filter and the forward references for a block which has been read
+ * from the permanent store or the block log
+ *
+ * @param block The block which has been read
+ * @param next_hash The hash of the next block on the chain, if known
+ */
+void MainChain::RecordLoadedBlock(Block const &block, BlockHash const &next_hash) const
+{
+  AddBlockToBloomFilter(block);
+
+  // update references assuming those from storage are unique
+  if (!block.IsGenesis())
+  {
+    CacheReference(block.previous_hash, block.hash, true);
+  }
+  if (!next_hash.empty())
+  {
+    CacheReference(block.hash, next_hash, true);
+  }
+}
+
 void MainChain::AddBlockToBloomFilter(Block const &block) const
 {
   for (auto const &slice : block.slices)
@@ -620,6 +640,26 @@ MainChain::Blocks MainChain::GetChainPreceding(BlockHash start, uint64_t limit)
        // exit once we have gathered enough blocks or reached genesis
        not_at_genesis && result.size() < static_cast<Blocks::size_type>(limit);)
   {
+    // once the walk reaches the finalised chain, the remainder is served by a sequential read of
+    // the block log
+    if (block_log_ && !result.empty())
+    {
+      uint64_t const block_number = result.back()->block_number - 1;
+
+      if (block_log_->Contains(current_hash, block_number))
+      {
+        uint64_t const remaining = limit - static_cast<uint64_t>(result.size());
+        uint64_t const count     = std::min(remaining, block_number + 1);
+
+        Blocks logged;
+        if (ReadBlockLog(block_number + 1 - count, count, logged))
+        {
+          result.insert(result.end(), logged.rbegin(), logged.rend());
+          break;
+        }
+      }
+    }
+
     // look up the block
     auto block = GetBlock(current_hash);
     if (!block)
@@ -640,6 +680,44 @@ MainChain::Blocks MainChain::GetChainPreceding(BlockHash start, uint64_t limit)
   return result;
 }
 
+/**
+ * Look up a block on the heaviest chain by its block number. Finalised blocks are read directly
+ * from the block log, the remainder are found by walking down from the heaviest tip.
+ *
+ * @param block_number The block number of the block
+ * @return The block if found, otherwise nullptr
+ */
+MainChain::BlockPtr MainChain::GetBlockByNumber(uint64_t block_number) const
+{
+  FETCH_LOCK(lock_);
+
+  IntBlockPtr block = LookupBlock(heaviest_.Hash());
+
+  // walk down towards the requested block until it is found or the finalised chain is reached
+  while (block && (block->block_number > block_number))
+  {
+    if (block_log_ && block_log_->Contains(block->hash, block->block_number))
+    {
+      Blocks logged;
+      if (ReadBlockLog(block_number, 1, logged))
+      {
+        return logged.front();
+      }
+
+      return {};
+    }
+
+    block = LookupBlock(block->previous_hash);
+  }
+
+  if (block && (block->block_number == block_number))
+  {
+    return block;
+  }
+
+  return {};
+}
+
 /**
  * Walk the chain forward collecting at most UPPER_LIMIT blocks, until either tip reached,
  * or next block is ambiguous, which can happen off-heaviest chain.
@@ -674,6 +752,32 @@ MainChain::Travelogue MainChain::TimeTravel(BlockHash current_hash) const
     }
   }
 
+  // the finalised section of the chain is served by a sequential read of the block log
+  if (block_log_)
+  {
+    bool     logged{false};
+    uint64_t first{0};
+
+    if (current_hash.empty())
+    {
+      logged = block_log_->Contains(chain::GENESIS_DIGEST, 0);
+    }
+    else
+    {
+      logged = block_log_->Contains(current_hash, block->block_number);
+      first  = block->block_number + 1;
+    }
+
+    if (logged && ReadBlockLog(first, UPPER_BOUND, result))
+    {
+      // carry on walking forwards from the last block in the log
+      if (!LookupBlock(result.back()->hash, block, &next_hash))
+      {
+        next_hash = BlockHash{};
+      }
+    }
+  }
+
   bool not_done = true;
   for (current_hash = std::move(next_hash);
        // stop once we have gathered enough blocks or passed the tip
@@ -953,6 +1057,7 @@ void MainChain::RecoverFromFile(Mode mode)
   if (Mode::CREATE_PERSISTENT_DB == mode)
   {
     block_store_->New("chain.db", "chain.index.db");
+    block_log_->New(BLOCK_LOG_STORE, BLOCK_HEADER_STORE);
     head_store_.open("chain.head.db",
                      std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
 
@@ -967,6 +1072,7 @@ void MainChain::RecoverFromFile(Mode mode)
     using namespace fetch::serializers;
 
     block_store_->Load("chain.db", "chain.index.db");
+    block_log_->Load(BLOCK_LOG_STORE, BLOCK_HEADER_STORE);
     head_store_.open("chain.head.db", std::ios::binary | std::ios::in | std::ios::out);
 
     std::ifstream in(BLOOM_FILTER_STORE, std::ios::binary | std::ios::in);
@@ -1001,20 +1107,48 @@ void MainChain::RecoverFromFile(Mode mode)
   {
     auto block_index = head->block_number;
 
-    // Copy head block so as to walk down the chain
-    IntBlockPtr next = std::make_shared<Block>(*head);
+    // The block log has already been verified to form an unbroken chain from genesis while
+    // loading, so if it contains the head there is no need to walk the object store
+    if (block_log_->Contains(head_block_hash, head->block_number))
+    {
+      FETCH_LOG_INFO(LOGGING_NAME, "Recovered main chain headers from block log");
 
-    while (LoadBlock(next->previous_hash, *next))
+      // discard anything logged after the head was last persisted
+      block_log_->Truncate(head->block_number + 1);
+      block_index = 0;
+    }
+    else
     {
-      if (next->block_number != block_index - 1)
+      // Copy head block so as to walk down the chain
+      IntBlockPtr next = std::make_shared<Block>(*head);
+      BlockHashes walked{head_block_hash};
+
+      for (BlockHash hash = head->previous_hash; LoadBlock(hash, *next); hash = next->previous_hash)
       {
-        FETCH_LOG_WARN(LOGGING_NAME,
-                       "Discontinuity found when walking main chain during recovery. Current: ",
-                       block_index, " prev: ", next->block_number, " Resetting");
-        break;
+        if (next->block_number != block_index - 1)
+        {
+          FETCH_LOG_WARN(LOGGING_NAME,
+                         "Discontinuity found when walking main chain during recovery. Current: ",
+                         block_index, " prev: ", next->block_number, " Resetting");
+          break;
+        }
+
+        block_index = next->block_number;
+
+        // the remainder of the chain is already present in the block log
+        if (block_log_->Contains(hash, block_index))
+        {
+          block_index = 0;
+          break;
+        }
+
+        walked.push_back(hash);
       }
 
-      block_index = next->block_number;
+      if (block_index == 0)
+      {
+        RebuildBlockLog(walked);
+      }
     }
 
     if (block_index != 0)
@@ -1063,6 +1197,7 @@ void MainChain::RecoverFromFile(Mode mode)
   if (!recovery_complete)
   {
     block_store_->New("chain.db", "chain.index.db");
+    block_log_->New(BLOCK_LOG_STORE, BLOCK_HEADER_STORE);
 
     // reopen the file and clear the contents
     head_store_.close();
@@ -1115,6 +1250,7 @@ void MainChain::WriteToFile()
       FETCH_LOG_DEBUG(LOGGING_NAME, "Writing genesis. ");
 
       KeepBlock(block);
+      block_log_->Append(*block);
       SetHeadHash(block->hash);
     }
     else
@@ -1127,12 +1263,16 @@ void MainChain::WriteToFile()
 
       LoadBlock(GetHeadHash(), *current_file_head);
 
+      // The blocks written, from the new head down to the common ancestor with the old head
+      std::vector<IntBlockPtr> written{};
+
       // Now keep adding the block and its prev to the file until we are certain the file contains
       // an unbroken chain. Assuming that the current_file_head is unbroken we can write until we
       // touch it or it's root.
       for (;;)
       {
         KeepBlock(block);
+        written.push_back(block);
 
         // Keep the current_file_head one block behind
         while (current_file_head->block_number > block->block_number - 1)
@@ -1150,6 +1290,17 @@ void MainChain::WriteToFile()
         LookupBlock(block->previous_hash, block);
       }
 
+      // Mirror the new section of the chain into the block log, replacing any orphaned blocks
+      for (auto it = written.rbegin(); it != written.rend(); ++it)
+      {
+        if (!block_log_->Append(**it))
+        {
+          FETCH_LOG_WARN(LOGGING_NAME, "Unable to append block ", (*it)->block_number,
+                         " to block log. Log size: ", block_log_->size());
+          break;
+        }
+      }
+
       // Success - we kept a copy of the new head to write
       SetHeadHash(block_head->hash);
     }
@@ -1165,6 +1316,89 @@ void MainChain::WriteToFile()
   }
 }
 
+/**
+ * Internal: Bring the block log up to date with the chain in the object store
+ *
+ * @param hashes The hashes of the stored blocks missing from the log, in descending order
+ */
+void MainChain::RebuildBlockLog(BlockHashes const &hashes)
+{
+  MilliTimer myTimer("MainChain::RebuildBlockLog", 1000);
+
+  FETCH_LOG_INFO(LOGGING_NAME, "Rebuilding block log with ", hashes.size(), " blocks");
+
+  DbRecord record;
+  for (auto it = hashes.rbegin(); it != hashes.rend(); ++it)
+  {
+    if (!block_store_->Get(storage::ResourceID(*it), record) || !block_log_->Append(record.block))
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Failed to rebuild block log. Log size: ", block_log_->size());
+      break;
+    }
+  }
+
+  block_log_->Flush();
+}
+
+/**
+ * Internal: Read a contiguous range of blocks from the block log. The range is read a page at a
+ * time, and the blocks which are not cached are recorded in the same way as those loaded from the
+ * permanent store.
+ *
+ * @param first The height of the first block to be read
+ * @param count The maximum number of blocks to be read
+ * @param blocks The output array to which the blocks are appended, in ascending height order
+ * @return true if at least one block was read, otherwise false
+ */
+bool MainChain::ReadBlockLog(uint64_t first, uint64_t count, Blocks &blocks) const
+{
+  FETCH_LOCK(lock_);
+
+  if (!block_log_)
+  {
+    return false;
+  }
+
+  bool             success{false};
+  BlockLog::Blocks logged;
+  for (uint64_t offset = 0; offset < count; offset += BLOCK_LOG_PAGE_SIZE)
+  {
+    uint64_t const page_size = std::min(BLOCK_LOG_PAGE_SIZE, count - offset);
+
+    logged.clear();
+    if (!block_log_->GetBlocks(first + offset, page_size, logged))
+    {
+      break;
+    }
+
+    success = true;
+    blocks.reserve(blocks.size() + logged.size());
+    for (std::size_t i = 0; i < logged.size(); ++i)
+    {
+      auto &block = logged[i];
+
+      // prefer the cached copy since it also carries the metadata which is not serialised
+      auto const it = block_chain_.find(block.hash);
+      if (it != block_chain_.end())
+      {
+        blocks.push_back(it->second);
+        continue;
+      }
+
+      // the reference from the last block of a page is cached by the first block of the next
+      RecordLoadedBlock(block, (i + 1 < logged.size()) ? logged[i + 1].hash : BlockHash{});
+      blocks.push_back(std::make_shared<Block>(std::move(block)));
+    }
+
+    if (logged.size() < page_size)
+    {
+      break;  // reached the top of the log
+    }
+  }
+
+  return success;
+}
+
 /**
  * Trim the in memory cache
  *
@@ -1966,6 +2200,7 @@ void MainChain::FlushToDisk()
   if (block_store_)
   {
     block_store_->Flush(false);
+    block_log_->Flush();
   }
 
   if (mode_ != Mode::IN_MEMORY_DB)
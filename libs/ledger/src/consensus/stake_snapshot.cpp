@@ -21,82 +21,86 @@
 #include "ledger/consensus/stake_snapshot.hpp"
 
 #include <algorithm>
-#include <unordered_set>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
 
 namespace fetch {
 namespace ledger {
 
-using Identity    = crypto::Identity;
-using IdentitySet = std::unordered_set<Identity>;
-using DRNG        = random::LinearCongruentialGenerator;
+using Identity = crypto::Identity;
+using DRNG     = random::LinearCongruentialGenerator;
+
+constexpr std::size_t StakeSnapshot::MAX_INDEX_EVENTS;
+
+namespace {
+
+/**
+ * The treap priority of a record. It only depends on the identity, so every node builds a tree of
+ * exactly the same shape from the same set of records.
+ *
+ * @param identity The identity of the record
+ * @return The priority
+ */
+uint64_t PriorityOf(Identity const &identity)
+{
+  return static_cast<uint64_t>(std::hash<Identity>{}(identity));
+}
+
+}  // namespace
 
 /**
  * Given the source of entropy, generate a selection of stakes identities based on proportional
  * probability against stakes.
  *
+ * Each member is drawn with a probability proportional to its stake from the identities not yet
+ * selected. Since the draws only depend on the entropy and the (identity ordered) contents of the
+ * snapshot, the result is deterministic. Each draw costs O(log n). When the whole pool is selected
+ * the members are listed in the order they were added.
+ *
  * @param entropy The seed source of entropy
  * @param count The size of the selection
  * @return The selection of identities
  */
 StakeSnapshot::CabinetPtr StakeSnapshot::BuildCabinet(uint64_t entropy, std::size_t count) const
 {
-  FETCH_LOG_DEBUG(LOGGING_NAME, "Building cabinet from pool of: ", stake_index_.size());
+  FETCH_LOG_DEBUG(LOGGING_NAME, "Building cabinet from pool of: ", size());
 
   CabinetPtr cabinet = std::make_shared<Cabinet>();
-  cabinet->reserve(count);
-  auto stake_index = stake_index_;  // Since build cabinet is const
 
-  if (count >= identity_index_.size())
+  if (count >= size())
   {
-    for (auto const &record : stake_index)
+    cabinet->reserve(size());
+    for (Node const *node : ListNodes())
     {
-      cabinet->emplace_back(record->identity);
+      cabinet->emplace_back(node->record.identity);
     }
   }
   else
   {
-    IdentitySet chosen_identities;
-    DRNG        rng(entropy);
+    DRNG rng(entropy);
 
-    // ensure the stake list is reset to a deterministic state
-    std::sort(stake_index.begin(), stake_index.end(),
-              [](RecordPtr const &a, RecordPtr const &b) { return a->identity < b->identity; });
+    cabinet->reserve(count);
 
+    // selected members are removed from a private version of the tree, the snapshot is unchanged
+    NodePtr remaining = root_;
     for (std::size_t i = 0; i < count; ++i)
     {
-      // shuffle the array
-      std::shuffle(stake_index.begin(), stake_index.end(), rng);
-
-      // make the selection
-      uint64_t selection = rng() % total_stake_;
-
-      std::size_t index{0};
-      for (auto const &record : stake_index)
+      Node const *selected{nullptr};
+      if (remaining->subtree_stake > 0)
       {
-        if (record->stake >= selection)
-        {
-          // TODO(issue 1247): This ensures in the case of a collision, the next item in the list is
-          //                   picked. However, there is an edge case here when this selection is at
-          //                   the  end of the stake_index array. In this case the output will
-          //                   contain fewer items.
-          selection = 0;
-
-          if (chosen_identities.find(record->identity) == chosen_identities.end())
-          {
-            cabinet->emplace_back(record->identity);
-            chosen_identities.emplace(record->identity);
-
-            // exit from the search loop
-            break;
-          }
-        }
-        else  // (record->stake < selection)
-        {
-          selection -= record->stake;
-        }
-
-        ++index;
+        selected = SelectByStake(remaining.get(), rng() % remaining->subtree_stake);
       }
+      else
+      {
+        // only identities without stake remain, choose between them uniformly
+        selected = SelectByIndex(remaining.get(), rng() % remaining->subtree_size);
+      }
+
+      cabinet->emplace_back(selected->record.identity);
+      remaining = Erase(remaining, cabinet->back());
     }
   }
 
@@ -111,15 +115,8 @@ StakeSnapshot::CabinetPtr StakeSnapshot::BuildCabinet(uint64_t entropy, std::siz
  */
 uint64_t StakeSnapshot::LookupStake(Identity const &identity) const
 {
-  uint64_t stake{0};
-
-  auto const it = identity_index_.find(identity);
-  if (it != identity_index_.end())
-  {
-    stake = it->second->stake;
-  }
-
-  return stake;
+  Node const *node = Find(root_.get(), identity);
+  return (node != nullptr) ? node->record.stake : 0;
 }
 
 /**
@@ -132,59 +129,348 @@ uint64_t StakeSnapshot::LookupStake(Identity const &identity) const
  */
 void StakeSnapshot::UpdateStake(Identity const &identity, uint64_t stake)
 {
-  auto it = identity_index_.find(identity);
-  if (it == identity_index_.end())
+  Node const *node = Find(root_.get(), identity);
+  if (node == nullptr)
   {
     // new stake
-    auto record = std::make_shared<Record>(Record{identity, stake});
+    Insert(Record{identity, stake}, next_sequence_++);
+    RecordIndexEvent(identity, true);
+  }
+  else if (stake == node->record.stake)
+  {
+    // special case - no change in stake
+  }
+  else if (stake == 0)
+  {
+    // special case - removed from staking pool
+    root_ = Erase(root_, identity);
+    RecordIndexEvent(identity, false);
+  }
+  else
+  {
+    // normal change in stake
+    root_ = Replace(root_, Record{identity, stake});
+  }
+}
+
+/**
+ * Internal: Add a record which is not yet present in the tree
+ *
+ * @param record The record to be added
+ * @param sequence The sequence number of the record
+ */
+void StakeSnapshot::Insert(Record const &record, SequenceNumber sequence)
+{
+  NodePtr less{};
+  NodePtr greater{};
+  Split(root_, record.identity, less, greater);
+
+  auto inserted = MakeNode(record, PriorityOf(record.identity), sequence, {}, {});
+  root_         = Merge(Merge(less, inserted), greater);
+}
+
+/**
+ * Internal: Log an addition to or removal from the identity index of the serialised form. Once the
+ * log has grown long enough it is folded into a new base index, so that replaying it stays cheap.
+ *
+ * @param identity The identity which was added or removed
+ * @param added Whether the identity was added, otherwise it was removed
+ */
+void StakeSnapshot::RecordIndexEvent(Identity const &identity, bool added)
+{
+  index_events_ = std::make_shared<IndexEvent const>(IndexEvent{identity, added, index_events_});
+  ++num_index_events_;
+
+  if (num_index_events_ >= MAX_INDEX_EVENTS)
+  {
+    index_base_ = std::make_shared<IdentityIndex const>(BuildIdentityIndex());
+    index_events_.reset();
+    num_index_events_ = 0;
+  }
+}
+
+/**
+ * Internal: Build the identity index of the serialised form. The order of a hash table depends on
+ * its history (including the entries which have since been removed), so the additions and removals
+ * are replayed on top of the last base index in the order they were made.
+ *
+ * @return The identity index
+ */
+StakeSnapshot::IdentityIndex StakeSnapshot::BuildIdentityIndex() const
+{
+  // copying a hash table preserves its bucket count and iteration order
+  IdentityIndex index = index_base_ ? *index_base_ : IdentityIndex{};
+
+  std::vector<IndexEvent const *> events{};
+  events.reserve(num_index_events_);
+  for (auto const *event = index_events_.get(); event != nullptr; event = event->previous.get())
+  {
+    events.push_back(event);
+  }
+
+  for (auto it = events.rbegin(); it != events.rend(); ++it)
+  {
+    IndexEvent const &event = **it;
+
+    if (event.added)
+    {
+      index[event.identity] = RecordPtr{};
+    }
+    else
+    {
+      index.erase(event.identity);
+    }
+  }
+
+  // the records themselves are taken from the tree, since changes in stake are not logged
+  for (auto &element : index)
+  {
+    element.second = std::make_shared<Record>(Record{element.first, LookupStake(element.first)});
+  }
+
+  return index;
+}
+
+/**
+ * Internal: Build the list of records of the serialised form, in the order they were added
+ *
+ * @return The list of records
+ */
+StakeSnapshot::StakeIndex StakeSnapshot::BuildStakeIndex() const
+{
+  StakeIndex stake_index{};
+  stake_index.reserve(size());
+
+  for (Node const *node : ListNodes())
+  {
+    stake_index.emplace_back(std::make_shared<Record>(node->record));
+  }
+
+  return stake_index;
+}
+
+/**
+ * Internal: List the nodes of the tree in the order their records were added
+ *
+ * @return The ordered nodes, which remain owned by the tree
+ */
+StakeSnapshot::Nodes StakeSnapshot::ListNodes() const
+{
+  Nodes nodes{};
+  nodes.reserve(size());
+
+  Nodes pending{};
+  if (root_)
+  {
+    pending.push_back(root_.get());
+  }
+
+  while (!pending.empty())
+  {
+    Node const *node = pending.back();
+    pending.pop_back();
+
+    nodes.push_back(node);
+    if (node->left)
+    {
+      pending.push_back(node->left.get());
+    }
+    if (node->right)
+    {
+      pending.push_back(node->right.get());
+    }
+  }
+
+  std::sort(nodes.begin(), nodes.end(),
+            [](Node const *a, Node const *b) { return a->sequence < b->sequence; });
 
-    // update all the indexes
-    identity_index_[identity] = record;
-    stake_index_.emplace_back(std::move(record));
-    total_stake_ += stake;
+  return nodes;
+}
+
+/**
+ * Internal: Copy a node with a different set of children
+ */
+StakeSnapshot::NodePtr StakeSnapshot::WithChildren(Node const &node, NodePtr left, NodePtr right)
+{
+  return MakeNode(node.record, node.priority, node.sequence, std::move(left), std::move(right));
+}
+
+StakeSnapshot::NodePtr StakeSnapshot::MakeNode(Record const &record, uint64_t priority,
+                                               SequenceNumber sequence, NodePtr left, NodePtr right)
+{
+  uint64_t    subtree_stake = record.stake;
+  std::size_t subtree_size  = 1;
+
+  if (left)
+  {
+    subtree_stake += left->subtree_stake;
+    subtree_size += left->subtree_size;
+  }
+
+  if (right)
+  {
+    subtree_stake += right->subtree_stake;
+    subtree_size += right->subtree_size;
+  }
+
+  return std::make_shared<Node>(
+      Node{record, priority, sequence, std::move(left), std::move(right), subtree_stake,
+           subtree_size});
+}
+
+/**
+ * Join two trees where every identity in the left one is smaller than those in the right one
+ */
+StakeSnapshot::NodePtr StakeSnapshot::Merge(NodePtr const &left, NodePtr const &right)
+{
+  if (!left)
+  {
+    return right;
+  }
+
+  if (!right)
+  {
+    return left;
+  }
+
+  if (left->priority >= right->priority)
+  {
+    return WithChildren(*left, left->left, Merge(left->right, right));
+  }
+
+  return WithChildren(*right, Merge(left, right->left), right->right);
+}
+
+/**
+ * Divide a tree into the identities smaller than the specified one and the remainder
+ */
+void StakeSnapshot::Split(NodePtr const &node, Identity const &identity, NodePtr &less,
+                          NodePtr &greater_or_equal)
+{
+  if (!node)
+  {
+    less.reset();
+    greater_or_equal.reset();
+    return;
+  }
+
+  if (node->record.identity < identity)
+  {
+    NodePtr right_less{};
+    Split(node->right, identity, right_less, greater_or_equal);
+    less = WithChildren(*node, node->left, std::move(right_less));
   }
   else
   {
-    // change in stake
+    NodePtr left_greater{};
+    Split(node->left, identity, less, left_greater);
+    greater_or_equal = WithChildren(*node, std::move(left_greater), node->right);
+  }
+}
+
+StakeSnapshot::NodePtr StakeSnapshot::Erase(NodePtr const &node, Identity const &identity)
+{
+  if (!node)
+  {
+    return node;
+  }
+
+  if (identity < node->record.identity)
+  {
+    return WithChildren(*node, Erase(node->left, identity), node->right);
+  }
+
+  if (node->record.identity < identity)
+  {
+    return WithChildren(*node, node->left, Erase(node->right, identity));
+  }
+
+  return Merge(node->left, node->right);
+}
+
+StakeSnapshot::NodePtr StakeSnapshot::Replace(NodePtr const &node, Record const &record)
+{
+  if (record.identity < node->record.identity)
+  {
+    return WithChildren(*node, Replace(node->left, record), node->right);
+  }
+
+  if (node->record.identity < record.identity)
+  {
+    return WithChildren(*node, node->left, Replace(node->right, record));
+  }
 
-    if (stake == it->second->stake)
+  return MakeNode(record, node->priority, node->sequence, node->left, node->right);
+}
+
+StakeSnapshot::Node const *StakeSnapshot::Find(Node const *node, Identity const &identity)
+{
+  while (node != nullptr)
+  {
+    if (identity < node->record.identity)
+    {
+      node = node->left.get();
+    }
+    else if (node->record.identity < identity)
     {
-      // special case - no change in stake
-      return;
+      node = node->right.get();
     }
-    if (stake == 0)
+    else
     {
-      // special case - removed from staking pool
+      break;
+    }
+  }
 
-      // update the total stake
-      total_stake_ -= it->second->stake;
+  return node;
+}
 
-      // remove the from identity index
-      identity_index_.erase(it);
+/**
+ * Locate the record covering the specified offset when the stakes of all records are laid out
+ * in identity order
+ */
+StakeSnapshot::Node const *StakeSnapshot::SelectByStake(Node const *node, uint64_t offset)
+{
+  for (;;)
+  {
+    uint64_t const left_stake = node->left ? node->left->subtree_stake : 0;
 
-      // remove from the stake index
-      auto const last = std::remove_if(
-          stake_index_.begin(), stake_index_.end(),
-          [&identity](RecordPtr const &record) { return identity == record->identity; });
-      stake_index_.erase(last, stake_index_.end());
+    if (offset < left_stake)
+    {
+      node = node->left.get();
+    }
+    else if (offset - left_stake < node->record.stake)
+    {
+      return node;
     }
     else
     {
-      // normal change in stake
+      offset -= left_stake + node->record.stake;
+      node = node->right.get();
+    }
+  }
+}
 
-      if (stake >= it->second->stake)
-      {
-        // increase in stake
-        total_stake_ += (stake - it->second->stake);
-      }
-      else
-      {
-        // decrease in stake
-        total_stake_ -= (it->second->stake - stake);
-      }
+/**
+ * Locate the record at the specified position in identity order
+ */
+StakeSnapshot::Node const *StakeSnapshot::SelectByIndex(Node const *node, std::size_t index)
+{
+  for (;;)
+  {
+    std::size_t const left_size = node->left ? node->left->subtree_size : 0;
 
-      // now update the stake
-      it->second->stake = stake;
+    if (index < left_size)
+    {
+      node = node->left.get();
+    }
+    else if (index == left_size)
+    {
+      return node;
+    }
+    else
+    {
+      index -= left_size + 1;
+      node = node->right.get();
     }
   }
 }
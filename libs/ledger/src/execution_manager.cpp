@@ -43,6 +43,7 @@
 static constexpr char const *LOGGING_NAME              = "ExecutionManager";
 static constexpr std::size_t MAX_STARTUP_ITERATIONS    = 20;
 static constexpr std::size_t STARTUP_ITERATION_TIME_MS = 100;
+static constexpr std::size_t PREFETCH_BATCH_SIZE       = 512;
 
 namespace fetch {
 namespace ledger {
@@ -60,6 +61,7 @@ ExecutionManager::ExecutionManager(std::size_t num_executors, uint32_t log2_num_
   : log2_num_lanes_{log2_num_lanes}
   , storage_{std::move(storage)}
   , thread_pool_{network::MakeThreadPool(num_executors, "Executor")}
+  , prefetch_pool_{network::MakeThreadPool(1, "TxPrefetch")}
   , tx_status_cache_{std::move(tx_status_cache)}
   , tx_executed_count_(Registry::Instance().CreateCounter(
         "ledger_exec_mgr_tx_executed_total", "The total number of executed transactions"))
@@ -69,12 +71,25 @@ ExecutionManager::ExecutionManager(std::size_t num_executors, uint32_t log2_num_
         "ledger_exec_mgr_fees_settled_total", "The total number of settle fees rounds"))
   , blocks_completed_count_(Registry::Instance().CreateCounter(
         "ledger_exec_mgr_blocks_completed_total", "The total number of settle fees rounds"))
+  , tx_prefetch_hit_count_(Registry::Instance().CreateCounter(
+        "ledger_exec_mgr_tx_prefetch_hit_total",
+        "The total number of transactions executed from the prefetch cache"))
+  , tx_prefetch_miss_count_(Registry::Instance().CreateCounter(
+        "ledger_exec_mgr_tx_prefetch_miss_total",
+        "The total number of transactions which had to be retrieved by the executor"))
   , execution_duration_(Registry::Instance().CreateHistogram(
         {0.000001, 0.000002, 0.000003, 0.000004, 0.000005, 0.000006, 0.000007, 0.000008, 0.000009,
          0.00001,  0.00002,  0.00003,  0.00004,  0.00005,  0.00006,  0.00007,  0.00008,  0.00009,
          0.0001,   0.0002,   0.0003,   0.0004,   0.0005,   0.0006,   0.0007,   0.0008,   0.0009,
          0.001,    0.01,     0.1,      1,        10.,      100.},
         "ledger_exec_mgr_block_duration", "The execution duration in seconds for blocks"))
+  , prefetch_duration_(Registry::Instance().CreateHistogram(
+        {0.000001, 0.000002, 0.000003, 0.000004, 0.000005, 0.000006, 0.000007, 0.000008, 0.000009,
+         0.00001,  0.00002,  0.00003,  0.00004,  0.00005,  0.00006,  0.00007,  0.00008,  0.00009,
+         0.0001,   0.0002,   0.0003,   0.0004,   0.0005,   0.0006,   0.0007,   0.0008,   0.0009,
+         0.001,    0.01,     0.1,      1,        10.,      100.},
+        "ledger_exec_mgr_tx_prefetch_duration",
+        "The duration in seconds for prefetching the transactions of a block"))
 {
   // create all the executor metrics
   Registry::Instance().CreateHistogram(
@@ -174,6 +189,9 @@ ExecutionManager::ScheduleStatus ExecutionManager::Execute(Block const &block)
     return ScheduleStatus::UNABLE_TO_PLAN;
   }
 
+  // start retrieving the transactions of the block in the background
+  SchedulePrefetch(block);
+
   // update the last block hash
   state_.ApplyVoid([&block](Summary &summary) {
     summary.last_block_hash   = block.hash;
@@ -230,6 +248,116 @@ bool ExecutionManager::PlanExecution(Block const &block)
   return true;
 }
 
+/**
+ * Schedule the retrieval of all the transactions in the block from the storage unit
+ *
+ * Transactions are requested in batches made up of whole slices, in slice order, so that the
+ * transactions for the earlier slices become available first. Any previously prefetched (and
+ * unused) transactions are discarded.
+ *
+ * @param block The block whose transactions should be prefetched
+ */
+void ExecutionManager::SchedulePrefetch(Block const &block)
+{
+  PrefetchPlan plan{};
+  for (auto const &slice : block.slices)
+  {
+    if (plan.empty() || (plan.back().size() >= PREFETCH_BATCH_SIZE))
+    {
+      plan.emplace_back();
+    }
+
+    for (auto const &tx : slice)
+    {
+      plan.back().insert(tx.digest());
+    }
+  }
+
+  uint64_t generation{0};
+  {
+    FETCH_LOCK(prefetch_lock_);
+    prefetch_cache_.clear();
+    generation = ++prefetch_generation_;
+  }
+
+  auto self = shared_from_this();
+  prefetch_pool_->Post([self, generation, plan]() { self->Prefetch(generation, plan); });
+}
+
+/**
+ * Retrieve the batches of transactions from the storage unit and populate the prefetch cache
+ *
+ * This function should be called from the context of the prefetch thread pool
+ *
+ * @param generation The prefetch generation at the point the plan was created
+ * @param plan The batches of transactions to be retrieved
+ */
+void ExecutionManager::Prefetch(uint64_t generation, PrefetchPlan const &plan)
+{
+  telemetry::FunctionTimer const timer{*prefetch_duration_};
+
+  for (auto const &batch : plan)
+  {
+    StorageUnitInterface::TransactionList txs{};
+
+    try
+    {
+      txs = storage_->GetTransactions(batch);
+    }
+    catch (std::exception const &ex)
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Exception caught when prefetching txs: ", ex.what());
+      break;
+    }
+
+    FETCH_LOCK(prefetch_lock_);
+
+    // if another block has been scheduled in the meantime these transactions are no longer useful
+    if (generation != prefetch_generation_)
+    {
+      break;
+    }
+
+    for (auto &tx : txs)
+    {
+      prefetch_cache_.emplace(tx->digest(), std::move(tx));
+    }
+  }
+}
+
+/**
+ * Lookup (and remove) a transaction from the prefetch cache
+ *
+ * @param digest The digest of the transaction
+ * @return The transaction if it has been prefetched, otherwise an empty pointer
+ */
+ExecutionManager::TransactionPtr ExecutionManager::LookupPrefetched(Digest const &digest)
+{
+  TransactionPtr tx{};
+
+  {
+    FETCH_LOCK(prefetch_lock_);
+
+    auto it = prefetch_cache_.find(digest);
+    if (it != prefetch_cache_.end())
+    {
+      tx = std::move(it->second);
+      prefetch_cache_.erase(it);
+    }
+  }
+
+  if (tx)
+  {
+    tx_prefetch_hit_count_->increment();
+  }
+  else
+  {
+    tx_prefetch_miss_count_->increment();
+  }
+
+  return tx;
+}
+
 /**
  * Dispatches an execution item to the next available executor
  *
@@ -260,8 +388,8 @@ void ExecutionManager::DispatchExecution(ExecutionItem &item)
     // increment the active counters
     counters_.ApplyVoid([](auto &counters) { ++counters.active; });
 
-    // execute the item
-    item.Execute(*executor);
+    // execute the item, handing over the transaction if it has already been retrieved
+    item.Execute(*executor, LookupPrefetched(item.digest()));
     auto const &result{item.result()};
 
     // determine what the status is
@@ -316,8 +444,9 @@ void ExecutionManager::Start()
     throw std::runtime_error("Failed waiting for the monitor to start");
   }
 
-  // fire up the main worker thread pool
+  // fire up the main worker and prefetch thread pools
   thread_pool_->Start();
+  prefetch_pool_->Start();
 }
 
 /**
@@ -342,7 +471,8 @@ void ExecutionManager::Stop()
     monitor_thread_.reset();
   }
 
-  // tear down the thread pool
+  // tear down the thread pools
+  prefetch_pool_->Stop();
   thread_pool_->Stop();
 }
 
@@ -361,6 +491,22 @@ ExecutionManager::State ExecutionManager::GetState()
   return state_.Apply([](Summary const &summary) { return summary.state; });
 }
 
+/**
+ * @return The number of blocks whose transactions have been prefetched
+ */
+std::size_t ExecutionManager::completed_prefetches() const
+{
+  return static_cast<std::size_t>(prefetch_duration_->count());
+}
+
+/**
+ * @return The number of transactions executed from the prefetch cache
+ */
+std::size_t ExecutionManager::prefetch_hits() const
+{
+  return static_cast<std::size_t>(tx_prefetch_hit_count_->count());
+}
+
 bool ExecutionManager::Abort()
 {
   // TODO(private issue 533): Implement user execution abort
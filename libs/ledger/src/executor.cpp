@@ -29,6 +29,7 @@
 #include "ledger/fees/storage_fee.hpp"
 #include "ledger/state_sentinel_adapter.hpp"
 #include "ledger/storage_unit/cached_storage_adapter.hpp"
+#include "ledger/transaction_tracer.hpp"
 #include "telemetry/histogram.hpp"
 #include "telemetry/registry.hpp"
 #include "telemetry/utils/timer.hpp"
@@ -86,6 +87,43 @@ Executor::Result Executor::Execute(Digest const &digest, BlockIndex block, Slice
 
   FETCH_LOG_DEBUG(LOGGING_NAME, "Executing tx ", byte_array::ToBase64(digest));
 
+  // attempt to retrieve the transaction from the storage
+  bool const retrieved = RetrieveTransaction(digest);
+
+  auto const result = ExecuteCurrentTransaction(retrieved, block, slice, shards);
+  TransactionTracer::Instance().Record(digest, TransactionTracer::Stage::EXECUTED);
+
+  return result;
+}
+
+/**
+ * Executes a transaction which has already been retrieved from the storage, for example by the
+ * execution manager prefetching the contents of the block
+ *
+ * @param tx The transaction to be executed
+ * @param block The current block index
+ * @param slice The current slice index
+ * @param shards The bit vector outlining the shards in use by this transaction
+ * @return The status code for the operation
+ */
+Executor::Result Executor::ExecuteTransaction(TransactionPtr const &tx, BlockIndex block,
+                                              SliceIndex slice, BitVector const &shards)
+{
+  telemetry::FunctionTimer const timer{*overall_duration_};
+
+  FETCH_LOG_DEBUG(LOGGING_NAME, "Executing prefetched tx ", byte_array::ToBase64(tx->digest()));
+
+  current_tx_ = tx;
+
+  auto const result = ExecuteCurrentTransaction(true, block, slice, shards);
+  TransactionTracer::Instance().Record(tx->digest(), TransactionTracer::Stage::EXECUTED);
+
+  return result;
+}
+
+Executor::Result Executor::ExecuteCurrentTransaction(bool retrieved, BlockIndex block,
+                                                     SliceIndex slice, BitVector const &shards)
+{
   Result result{Status::INEXPLICABLE_FAILURE};
 
   // cache the state for the current transaction
@@ -94,8 +132,7 @@ Executor::Result Executor::Execute(Digest const &digest, BlockIndex block, Slice
   allowed_shards_ = shards;
   log2_num_lanes_ = shards.log2_size();
 
-  // attempt to retrieve the transaction from the storage
-  if (!RetrieveTransaction(digest))
+  if (!retrieved)
   {
     // signal that the contract failed to be executed
     result.status = Status::TX_LOOKUP_FAILURE;
@@ -19,53 +19,47 @@
 #include "chain/address.hpp"
 #include "chain/transaction.hpp"
 #include "chain/transaction_validity_period.hpp"
+#include "core/bitvector.hpp"
 #include "ledger/chain/block.hpp"
 #include "ledger/chain/main_chain.hpp"
 #include "ledger/miner/basic_miner.hpp"
+#include "ledger/transaction_tracer.hpp"
 #include "logging/logging.hpp"
 #include "telemetry/counter.hpp"
 #include "telemetry/gauge.hpp"
+#include "telemetry/histogram.hpp"
 #include "telemetry/registry.hpp"
+#include "telemetry/utils/timer.hpp"
 
-#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
-#include <thread>
 #include <vector>
 
 namespace fetch {
 namespace ledger {
 namespace {
 
-/**
- * Clip the specified to the bounds: [min_value, max_value]
- *
- * @tparam T The type of the value
- * @param value The input value to be clipped
- * @param min_value The minimum (inclusive) value
- * @param max_value The maximum (inclusive) value
- * @return The clipped value
- */
-template <typename T>
-T Clip3(T value, T min_value, T max_value)
-{
-  return std::min(std::max(value, min_value), max_value);
-}
+using Clock = std::chrono::steady_clock;
+
+// The number of transactions evaluated between checks of the packing deadline
+constexpr std::size_t DEADLINE_CHECK_INTERVAL = 64;
 
 }  // namespace
 
+constexpr BasicMiner::Duration BasicMiner::DEFAULT_PACKING_BUDGET;
+
 /**
  * Construct the BasicMiner
  *
  * @param log2_num_lanes Log2 of the number of lanes
- * @param num_slices The number of slices
+ * @param packing_budget The maximum time to spend generating a block
  */
-BasicMiner::BasicMiner(uint32_t log2_num_lanes)
+BasicMiner::BasicMiner(uint32_t log2_num_lanes, Duration packing_budget)
   : log2_num_lanes_{log2_num_lanes}
-  , max_num_threads_{std::thread::hardware_concurrency()}
-  , thread_pool_{max_num_threads_, "Miner"}
+  , packing_budget_{packing_budget}
   , mining_pool_size_{telemetry::Registry::Instance().CreateGauge<uint64_t>(
         "ledger_miner_mining_pool_size", "The current size of the mining pool")}
   , max_mining_pool_size_{telemetry::Registry::Instance().CreateGauge<uint64_t>(
@@ -77,6 +71,15 @@ BasicMiner::BasicMiner(uint32_t log2_num_lanes)
   , duplicate_filtered_count_{telemetry::Registry::Instance().CreateCounter(
         "ledger_miner_duplicate_filtered_total",
         "The number of duplicate txs on the backend of the queue")}
+  , invalid_filtered_count_{telemetry::Registry::Instance().CreateCounter(
+        "ledger_miner_invalid_filtered_total",
+        "The number of txs removed from the queue because their validity period has expired")}
+  , budget_exceeded_count_{telemetry::Registry::Instance().CreateCounter(
+        "ledger_miner_packing_budget_exceeded_total",
+        "The number of blocks for which packing was stopped by the time budget")}
+  , packing_duration_{telemetry::Registry::Instance().CreateHistogram(
+        {0.00001, 0.00005, 0.0001, 0.0005, 0.001, 0.005, 0.01, 0.05, 0.1, 0.5, 1, 5, 10},
+        "ledger_miner_packing_duration", "The duration in seconds to generate a block")}
 {}
 
 /**
@@ -110,6 +113,7 @@ void BasicMiner::EnqueueTransaction(chain::TransactionLayout const &layout)
   if (pending_.Add(layout))
   {
     max_pending_pool_size_->max(pending_.size());
+    TransactionTracer::Instance().Record(layout.digest(), TransactionTracer::Stage::QUEUED);
     FETCH_LOG_DEBUG(LOGGING_NAME, "Enqueued Transaction (added) 0x", layout.digest().ToHex());
   }
   else
@@ -129,20 +133,32 @@ void BasicMiner::EnqueueTransaction(chain::TransactionLayout const &layout)
 void BasicMiner::GenerateBlock(Block &block, std::size_t num_lanes, std::size_t num_slices,
                                MainChain const &chain)
 {
+  telemetry::FunctionTimer const timer{*packing_duration_};
+  Timepoint const                deadline = Clock::now() + packing_budget_;
+
   FETCH_LOCK(mining_pool_lock_);
   assert(num_lanes == (1u << log2_num_lanes_));
 
-  // splice the contents of the pending queue into the main mining pool
+  // sort the newly arrived transactions and merge them into the (already sorted) mining pool
   {
-    FETCH_LOCK(pending_lock_);
-    mining_pool_.Splice(pending_);
+    Queue incoming{};
+
+    {
+      FETCH_LOCK(pending_lock_);
+      incoming.Splice(pending_);
+    }
+
+    incoming.Sort(SortByFee);
+    mining_pool_.Merge(incoming, SortByFee);
   }
 
-  std::remove_if(mining_pool_.begin(), mining_pool_.end(), [&block](auto const &tx_layout) {
-    return fetch::chain::GetValidity(tx_layout, block.block_number) !=
-           chain::Transaction::Validity::VALID;
+  // remove the transactions which can no longer be included in any block
+  auto const num_invalid = mining_pool_.RemoveIf([&block](TransactionLayout const &layout) {
+    return chain::GetValidity(layout, block.block_number) == chain::Transaction::Validity::INVALID;
   });
 
+  invalid_filtered_count_->add(num_invalid);
+
   // detect the transactions which have already been incorporated into previous blocks
   auto const duplicates =
       chain.DetectDuplicateTransactions(block.previous_hash, mining_pool_.TxLayouts());
@@ -160,52 +176,14 @@ void BasicMiner::GenerateBlock(Block &block, std::size_t num_lanes, std::size_t
 
   FETCH_LOG_INFO(LOGGING_NAME, "Starting block packing. Pool Size: ", pool_size_before);
 
-  // determine how many of the threads should be used in this block generation
-  auto const num_threads = Clip3<std::size_t>(mining_pool_.size() / 1000u, 1u, max_num_threads_);
-
   // prepare the basic formatting for the block
   block.slices.resize(num_slices);
 
-  // skip thread generation in the simple case
-  if (num_threads == 1)
-  {
-    GenerateSlices(mining_pool_, block, 0, 1, num_lanes);
-  }
-  else if (num_threads > 1)
+  if (!GenerateSlices(mining_pool_, block, num_lanes, deadline))
   {
-    // split the main queue into a series of smaller queues that can be executed in parallel
-    std::vector<Queue> transaction_lists(num_threads);
-
-    std::size_t const num_tx_per_thread = mining_pool_.size() / num_threads;
-
-    for (std::size_t i = 0; i < num_threads; ++i)
-    {
-      Queue &txs = transaction_lists[i];
-
-      auto start = mining_pool_.begin();
-      auto end   = start;
-      std::advance(end, static_cast<int32_t>(std::min(num_tx_per_thread, mining_pool_.size())));
-
-      // TODO(private issue XXX): While this efficiently breaks up the transaction queue into even
-      //  chunks it assumes that the fees of the transactions are roughly the same. This algorithm
-      //  should be updated to maximise collected fees for the miner.
-
-      // splice in the contents of the array
-      txs.Splice(mining_pool_, start, end);
-
-      thread_pool_.Dispatch([&txs, &block, i, num_threads, num_lanes]() {
-        GenerateSlices(txs, block, i, num_threads, num_lanes);
-      });
-    }
+    budget_exceeded_count_->increment();
 
-    // wait for all the threads to complete
-    thread_pool_.Wait();
-
-    // return all the transactions to the main queue
-    for (std::size_t i = 0; i < num_threads; ++i)
-    {
-      mining_pool_.Splice(transaction_lists[i]);
-    }
+    FETCH_LOG_WARN(LOGGING_NAME, "Block packing stopped early, time budget exceeded");
   }
 
   block.UpdateTimestamp();
@@ -229,74 +207,77 @@ uint64_t BasicMiner::GetBacklog() const
 }
 
 /**
- * Internal: Generate a selection of slices
+ * Internal: Populate the slices of the block from the (fee ordered) transaction queue
  *
- * @param transactions The transaction queue to be used when generating the selection of slices
+ * Each transaction is placed in the first slice in which none of its lanes are in use. This
+ * single pass produces the same result as greedily filling each of the slices in turn, but only
+ * needs to visit each transaction once.
+ *
+ * @param transactions The transaction queue, sorted by fee
  * @param block The reference to the block to populate
- * @param offset The slice index offset to start from
- * @param interval The slice index interval to be used when selecting the next slice to populate
  * @param num_lanes The number of lanes of the block
+ * @param deadline The time after which packing should be stopped
+ * @return true if packing completed, false if it was stopped by the deadline
  */
-void BasicMiner::GenerateSlices(Queue &transactions, Block &block, std::size_t offset,
-                                std::size_t interval, std::size_t num_lanes)
+bool BasicMiner::GenerateSlices(Queue &transactions, Block &block, std::size_t num_lanes,
+                                Timepoint const &deadline)
 {
-  // sort by fees
-  transactions.Sort(SortByFee);
+  std::size_t const num_slices = block.slices.size();
 
-  for (std::size_t slice_idx = offset; slice_idx < block.slices.size(); slice_idx += interval)
-  {
-    auto &slice = block.slices[slice_idx];
+  SliceState slice_state(num_slices, BitVector{num_lanes});
 
-    // generate the slice
-    GenerateSlice(transactions, slice, slice_idx, num_lanes);
-  }
-}
-
-/**
- * Internal: Generate a slice
- *
- * @param transactions The transaction queue to be used when generating the slice
- * @param slice The slice to be populated
- * @param slice_index The slice number
- * @param num_lanes The number of lanes for the block
- */
-void BasicMiner::GenerateSlice(Queue &transactions, Block::Slice &      slice,
-                               std::size_t /*slice_index*/, std::size_t num_lanes)
-{
-  BitVector slice_state{num_lanes};
+  std::size_t first_open_slice{0};  // all the slices before this one are full
+  std::size_t num_evaluated{0};
 
   auto it = transactions.begin();
-  while (it != transactions.end())
+  while ((it != transactions.end()) && (first_open_slice < num_slices))
   {
-    // exit the search loop once the slice is full
-    if (slice_state.PopCount() == num_lanes)
+    // periodically check that we have not exceeded the time budget
+    if (((++num_evaluated % DEADLINE_CHECK_INTERVAL) == 0) && (Clock::now() >= deadline))
     {
-      break;
+      return false;
     }
 
-    BitVector const &mask = it->mask();
+    // transactions which are not yet valid are left in the queue for a future block
+    if (chain::GetValidity(*it, block.block_number) != chain::Transaction::Validity::VALID)
+    {
+      ++it;
+      continue;
+    }
 
-    // calculate the collisions for this
-    BitVector const collisions = slice_state & mask;
+    BitVector const &mask = it->mask();
 
-    // determine if there are collisions
-    if (collisions.PopCount() == 0)
+    bool packed{false};
+    for (std::size_t slice_idx = first_open_slice; slice_idx < num_slices; ++slice_idx)
     {
-      // update the slice state
-      slice_state |= mask;
+      auto &state = slice_state[slice_idx];
 
-      // insert the transaction into the slice
-      slice.push_back(*it);
+      // determine if there are collisions with the transactions already in this slice
+      if (!state.Intersects(mask))
+      {
+        // update the slice state
+        state |= mask;
 
-      // remove the transaction from the main queue
-      it = transactions.Erase(it);
+        // insert the transaction into the slice
+        block.slices[slice_idx].push_back(*it);
+
+        packed = true;
+        break;
+      }
     }
-    else
+
+    // skip over the slices which have become full
+    while ((first_open_slice < num_slices) &&
+           (slice_state[first_open_slice].PopCount() == num_lanes))
     {
-      // advance to the next iterator
-      ++it;
+      ++first_open_slice;
     }
+
+    // remove the transaction from the main queue once it has been packed
+    it = packed ? transactions.Erase(it) : std::next(it);
   }
+
+  return true;
 }
 
 /**
@@ -0,0 +1,651 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "ledger/miner/optimisation/parallel_tempering_annealer.hpp"
+#include "logging/logging.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <future>
+#include <numeric>
+#include <thread>
+#include <utility>
+
+namespace fetch {
+namespace optimisers {
+namespace {
+
+constexpr uint64_t CouplingKey(std::size_t i, std::size_t j)
+{
+  return (static_cast<uint64_t>(i) << 32u) | static_cast<uint64_t>(j);
+}
+
+constexpr std::size_t CouplingRow(uint64_t key)
+{
+  return static_cast<std::size_t>(key >> 32u);
+}
+
+constexpr std::size_t CouplingColumn(uint64_t key)
+{
+  return static_cast<std::size_t>(key & 0xFFFFFFFFull);
+}
+
+}  // namespace
+
+constexpr std::size_t ParallelTemperingAnnealer::DEFAULT_NUM_REPLICAS;
+constexpr std::size_t ParallelTemperingAnnealer::DEFAULT_SWEEPS_PER_ROUND;
+constexpr double      ParallelTemperingAnnealer::DENSE_LAYOUT_MIN_OCCUPANCY;
+
+/**
+ * Construct the annealer
+ *
+ * @param num_threads The number of threads used to simulate the replicas. Zero selects the number
+ * of hardware threads, one simulates all the replicas on the calling thread
+ */
+ParallelTemperingAnnealer::ParallelTemperingAnnealer(std::size_t num_threads)
+{
+  if (num_threads == 0)
+  {
+    num_threads = std::thread::hardware_concurrency();
+  }
+
+  if (num_threads > 1)
+  {
+    pool_ = std::make_unique<ThreadPool>(num_threads, "Annealer");
+  }
+}
+
+/**
+ * Resize the problem, clearing all the existing terms
+ *
+ * @param n The number of sites
+ */
+void ParallelTemperingAnnealer::Resize(std::size_t n, std::size_t /*max_connectivity*/)
+{
+  Reset();
+
+  size_ = n;
+  local_fields_.assign(n, 0);
+}
+
+/**
+ * Set a term of the problem. Diagonal entries set the field of a site, off diagonal entries set
+ * the (symmetric) coupling between two sites. Setting a term a second time replaces it.
+ *
+ * @param i The first site
+ * @param j The second site
+ * @param value The value of the term
+ */
+void ParallelTemperingAnnealer::Insert(std::size_t i, std::size_t j, CostType const &value)
+{
+  assert(i < size_);
+  assert(j < size_);
+
+  if (i == j)
+  {
+    local_fields_[i] = value;
+  }
+  else
+  {
+    couplings_[CouplingKey(std::min(i, j), std::max(i, j))] = value;
+  }
+
+  prepared_ = false;
+}
+
+/**
+ * Scale the problem so that the largest term has a magnitude of one. Energies continue to be
+ * reported in the original units.
+ */
+void ParallelTemperingAnnealer::Normalise()
+{
+  CostType magnitude{0};
+
+  for (auto const &field : local_fields_)
+  {
+    magnitude = std::max(magnitude, std::abs(field));
+  }
+
+  for (auto const &coupling : couplings_)
+  {
+    magnitude = std::max(magnitude, std::abs(coupling.second));
+  }
+
+  if ((magnitude == 0.0) || (magnitude == 1.0))
+  {
+    return;
+  }
+
+  for (auto &field : local_fields_)
+  {
+    field /= magnitude;
+  }
+
+  for (auto &coupling : couplings_)
+  {
+    coupling.second /= magnitude;
+  }
+
+  normalisation_constant_ *= magnitude;
+  prepared_ = false;
+}
+
+void ParallelTemperingAnnealer::Reset()
+{
+  size_ = 0;
+  local_fields_.clear();
+  couplings_.clear();
+  normalisation_constant_ = 1.0;
+  prepared_               = false;
+
+  dense_couplings_.clear();
+  row_offsets_.clear();
+  columns_.clear();
+  values_.clear();
+
+  replicas_.clear();
+  order_.clear();
+  betas_.clear();
+  best_spins_.clear();
+  best_energy_      = 0;
+  sweeps_completed_ = 0;
+}
+
+std::size_t ParallelTemperingAnnealer::size() const
+{
+  return size_;
+}
+
+void ParallelTemperingAnnealer::SetSweeps(std::size_t sweeps)
+{
+  sweeps_ = sweeps;
+}
+
+void ParallelTemperingAnnealer::SetBetaStart(double const &beta)
+{
+  beta0_ = beta;
+}
+
+void ParallelTemperingAnnealer::SetBetaEnd(double const &beta)
+{
+  beta1_ = beta;
+}
+
+void ParallelTemperingAnnealer::SetNumReplicas(std::size_t num_replicas)
+{
+  num_replicas_ = std::max<std::size_t>(num_replicas, 1);
+}
+
+/**
+ * Set the number of sweeps each replica makes between replica exchanges. Larger values reduce the
+ * synchronisation overhead of the thread pool, smaller values allow more exchanges.
+ *
+ * @param sweeps The number of sweeps per round
+ */
+void ParallelTemperingAnnealer::SetSweepsPerRound(std::size_t sweeps)
+{
+  sweeps_per_round_ = std::max<std::size_t>(sweeps, 1);
+}
+
+/**
+ * Set the maximum time to spend in FindMinimum. Annealing stops at the end of the first round
+ * after the budget has been exhausted, regardless of the configured number of sweeps.
+ *
+ * @param budget The time budget, zero for no limit
+ */
+void ParallelTemperingAnnealer::SetTimeBudget(Duration const &budget)
+{
+  time_budget_ = budget;
+}
+
+void ParallelTemperingAnnealer::SetLayout(Layout layout)
+{
+  layout_   = layout;
+  prepared_ = false;
+}
+
+void ParallelTemperingAnnealer::Seed(uint64_t seed)
+{
+  rng_.Seed(seed);
+}
+
+std::size_t ParallelTemperingAnnealer::sweeps() const
+{
+  return sweeps_;
+}
+
+std::size_t ParallelTemperingAnnealer::num_replicas() const
+{
+  return num_replicas_;
+}
+
+ParallelTemperingAnnealer::CostType ParallelTemperingAnnealer::FindMinimum()
+{
+  StateType state;
+  return FindMinimum(state);
+}
+
+/**
+ * Search for the lowest energy state of the problem
+ *
+ * @param state The output best state found
+ * @param binary When true the state is reported as {0, 1}, otherwise as {-1, 1}
+ * @return The energy of the best state
+ */
+ParallelTemperingAnnealer::CostType ParallelTemperingAnnealer::FindMinimum(StateType &state,
+                                                                           bool       binary)
+{
+  Anneal();
+
+  state.resize(best_spins_.size());
+  for (std::size_t i = 0; i < best_spins_.size(); ++i)
+  {
+    auto const spin = static_cast<SpinType>(best_spins_[i]);
+    state[i]        = binary ? spin : static_cast<SpinType>((2 * spin) - 1);
+  }
+
+  return Energy();
+}
+
+/**
+ * Get the energy of the best state found by the last call to FindMinimum
+ *
+ * @return The energy of the best state
+ */
+ParallelTemperingAnnealer::CostType ParallelTemperingAnnealer::Energy() const
+{
+  return best_energy_ * normalisation_constant_;
+}
+
+/**
+ * Evaluate the energy of a specified (binary) state
+ *
+ * @param state The state to evaluate
+ * @return The energy of the state
+ */
+ParallelTemperingAnnealer::CostType ParallelTemperingAnnealer::Energy(StateType const &state) const
+{
+  assert(state.size() == size_);
+
+  Spins spins(size_);
+  for (std::size_t i = 0; i < size_; ++i)
+  {
+    spins[i] = static_cast<uint8_t>(state[i] > 0 ? 1 : 0);
+  }
+
+  return Evaluate(spins) * normalisation_constant_;
+}
+
+/**
+ * Get the number of sweeps completed by the last call to FindMinimum. This can be less than the
+ * configured number of sweeps when the time budget is exhausted.
+ *
+ * @return The number of sweeps
+ */
+std::size_t ParallelTemperingAnnealer::sweeps_completed() const
+{
+  return sweeps_completed_;
+}
+
+bool ParallelTemperingAnnealer::is_dense() const
+{
+  return dense_;
+}
+
+/**
+ * Internal: Build the coupling layout used during the sweeps
+ */
+void ParallelTemperingAnnealer::Prepare()
+{
+  if (prepared_)
+  {
+    return;
+  }
+
+  // each coupling is stored in both rows of the matrix
+  double const occupancy = (size_ == 0) ? 0.0
+                                        : static_cast<double>(2 * couplings_.size()) /
+                                              static_cast<double>(size_ * size_);
+
+  dense_ = (Layout::DENSE == layout_) ||
+           ((Layout::AUTOMATIC == layout_) && (occupancy >= DENSE_LAYOUT_MIN_OCCUPANCY));
+
+  dense_couplings_.clear();
+  row_offsets_.clear();
+  columns_.clear();
+  values_.clear();
+
+  if (dense_)
+  {
+    dense_couplings_.assign(size_ * size_, 0);
+
+    for (auto const &coupling : couplings_)
+    {
+      std::size_t const i = CouplingRow(coupling.first);
+      std::size_t const j = CouplingColumn(coupling.first);
+
+      dense_couplings_[(i * size_) + j] = coupling.second;
+      dense_couplings_[(j * size_) + i] = coupling.second;
+    }
+  }
+  else
+  {
+    // count the number of entries in each row
+    row_offsets_.assign(size_ + 1, 0);
+    for (auto const &coupling : couplings_)
+    {
+      ++row_offsets_[CouplingRow(coupling.first) + 1];
+      ++row_offsets_[CouplingColumn(coupling.first) + 1];
+    }
+
+    std::partial_sum(row_offsets_.begin(), row_offsets_.end(), row_offsets_.begin());
+
+    // populate the rows
+    columns_.resize(row_offsets_.back());
+    values_.resize(row_offsets_.back());
+
+    Indices position(row_offsets_.begin(), row_offsets_.end() - 1);
+    for (auto const &coupling : couplings_)
+    {
+      auto const i = static_cast<uint32_t>(CouplingRow(coupling.first));
+      auto const j = static_cast<uint32_t>(CouplingColumn(coupling.first));
+
+      columns_[position[i]] = j;
+      values_[position[i]]  = coupling.second;
+      ++position[i];
+
+      columns_[position[j]] = i;
+      values_[position[j]]  = coupling.second;
+      ++position[j];
+    }
+  }
+
+  prepared_ = true;
+}
+
+/**
+ * Internal: Run the replicas for the configured number of sweeps or until the time budget has been
+ * exhausted
+ */
+void ParallelTemperingAnnealer::Anneal()
+{
+  Prepare();
+
+  sweeps_completed_ = 0;
+
+  // build the inverse temperature ladder
+  betas_.resize(num_replicas_);
+  if (num_replicas_ == 1)
+  {
+    betas_[0] = beta1_;
+  }
+  else
+  {
+    bool const geometric = (beta0_ > 0) && (beta1_ > 0);
+
+    for (std::size_t t = 0; t < num_replicas_; ++t)
+    {
+      double const fraction = static_cast<double>(t) / static_cast<double>(num_replicas_ - 1);
+
+      betas_[t] = geometric ? beta0_ * std::pow(beta1_ / beta0_, fraction)
+                            : beta0_ + ((beta1_ - beta0_) * fraction);
+    }
+  }
+
+  // create the replicas from random initial states
+  replicas_.resize(num_replicas_);
+  order_.resize(num_replicas_);
+  for (std::size_t r = 0; r < num_replicas_; ++r)
+  {
+    replicas_[r].rng.Seed(rng_());
+    Initialise(replicas_[r]);
+
+    order_[r] = r;
+  }
+
+  best_spins_  = replicas_.front().spins;
+  best_energy_ = replicas_.front().energy;
+  UpdateBest();
+
+  if (size_ == 0)
+  {
+    return;
+  }
+
+  bool const              has_budget = time_budget_ > Duration::zero();
+  Clock::time_point const deadline   = Clock::now() + time_budget_;
+
+  std::vector<std::future<void>> pending{};
+  for (std::size_t round = 0; sweeps_completed_ < sweeps_; ++round)
+  {
+    std::size_t const num_sweeps = std::min(sweeps_per_round_, sweeps_ - sweeps_completed_);
+
+    if (pool_ && (num_replicas_ > 1))
+    {
+      // simulate each of the replicas concurrently
+      pending.clear();
+      for (std::size_t t = 0; t < num_replicas_; ++t)
+      {
+        pending.emplace_back(pool_->Dispatch([this, t, num_sweeps]() {
+          Sweep(replicas_[order_[t]], betas_[t], num_sweeps);
+        }));
+      }
+
+      for (auto &result : pending)
+      {
+        result.get();
+      }
+    }
+    else
+    {
+      for (std::size_t t = 0; t < num_replicas_; ++t)
+      {
+        Sweep(replicas_[order_[t]], betas_[t], num_sweeps);
+      }
+    }
+
+    sweeps_completed_ += num_sweeps;
+
+    UpdateBest();
+    Exchange(round);
+
+    if (has_budget && (Clock::now() >= deadline))
+    {
+      FETCH_LOG_DEBUG(LOGGING_NAME, "Time budget exhausted after ", sweeps_completed_, " of ",
+                      sweeps_, " sweeps");
+      break;
+    }
+  }
+
+  // remove any accumulated rounding error from the incrementally updated energy
+  best_energy_ = Evaluate(best_spins_);
+}
+
+/**
+ * Internal: Set the replica to a random state and compute its local fields and energy
+ *
+ * @param replica The replica to initialise
+ */
+void ParallelTemperingAnnealer::Initialise(Replica &replica) const
+{
+  replica.spins.resize(size_);
+  replica.fields = local_fields_;
+
+  for (std::size_t i = 0; i < size_; ++i)
+  {
+    // use the high bit since the low bits of the LCG are poorly distributed
+    replica.spins[i] = static_cast<uint8_t>(replica.rng() >> 63u);
+  }
+
+  for (std::size_t i = 0; i < size_; ++i)
+  {
+    if (replica.spins[i] == 0)
+    {
+      continue;
+    }
+
+    if (dense_)
+    {
+      CostType const *row    = dense_couplings_.data() + (i * size_);
+      CostType *      fields = replica.fields.data();
+
+      for (std::size_t j = 0; j < size_; ++j)
+      {
+        fields[j] += row[j];
+      }
+    }
+    else
+    {
+      for (uint32_t k = row_offsets_[i]; k < row_offsets_[i + 1]; ++k)
+      {
+        replica.fields[columns_[k]] += values_[k];
+      }
+    }
+  }
+
+  replica.energy = Evaluate(replica.spins);
+}
+
+/**
+ * Internal: Perform a number of Metropolis sweeps over all of the sites of a replica
+ *
+ * @param replica The replica to update
+ * @param beta The inverse temperature of the replica
+ * @param num_sweeps The number of sweeps to perform
+ */
+void ParallelTemperingAnnealer::Sweep(Replica &replica, double beta, std::size_t num_sweeps) const
+{
+  for (std::size_t sweep = 0; sweep < num_sweeps; ++sweep)
+  {
+    for (std::size_t i = 0; i < size_; ++i)
+    {
+      CostType const field = replica.fields[i];
+      CostType const delta = (replica.spins[i] != 0) ? -field : field;
+
+      if ((delta <= 0) || (replica.rng.AsDouble() < std::exp(-beta * delta)))
+      {
+        Flip(replica, i);
+      }
+    }
+  }
+}
+
+/**
+ * Internal: Flip a site of a replica, updating the local fields of its neighbours
+ *
+ * @param replica The replica to update
+ * @param site The site to flip
+ */
+void ParallelTemperingAnnealer::Flip(Replica &replica, std::size_t site) const
+{
+  bool const     was_set = replica.spins[site] != 0;
+  CostType const field   = replica.fields[site];
+  CostType const sign    = was_set ? -1.0 : 1.0;
+
+  replica.energy += sign * field;
+  replica.spins[site] = static_cast<uint8_t>(was_set ? 0 : 1);
+
+  if (dense_)
+  {
+    // contiguous update of the whole row, suitable for auto-vectorisation
+    CostType const *row    = dense_couplings_.data() + (site * size_);
+    CostType *      fields = replica.fields.data();
+
+    for (std::size_t j = 0; j < size_; ++j)
+    {
+      fields[j] += sign * row[j];
+    }
+  }
+  else
+  {
+    for (uint32_t k = row_offsets_[site]; k < row_offsets_[site + 1]; ++k)
+    {
+      replica.fields[columns_[k]] += sign * values_[k];
+    }
+  }
+}
+
+/**
+ * Internal: Attempt to exchange the temperatures of neighbouring replicas. Alternating rounds
+ * consider the even and odd pairs of the ladder.
+ *
+ * @param round The current round number
+ */
+void ParallelTemperingAnnealer::Exchange(std::size_t round)
+{
+  for (std::size_t t = round % 2; (t + 1) < num_replicas_; t += 2)
+  {
+    Replica const &colder = replicas_[order_[t + 1]];
+    Replica const &hotter = replicas_[order_[t]];
+
+    double const exponent = (betas_[t] - betas_[t + 1]) * (hotter.energy - colder.energy);
+
+    if ((exponent >= 0) || (rng_.AsDouble() < std::exp(exponent)))
+    {
+      std::swap(order_[t], order_[t + 1]);
+    }
+  }
+}
+
+/**
+ * Internal: Record the state of the lowest energy replica if it improves on the best so far
+ */
+void ParallelTemperingAnnealer::UpdateBest()
+{
+  for (auto const &replica : replicas_)
+  {
+    if (replica.energy < best_energy_)
+    {
+      best_energy_ = replica.energy;
+      best_spins_  = replica.spins;
+    }
+  }
+}
+
+/**
+ * Internal: Compute the (normalised) energy of a state from scratch
+ *
+ * @param spins The state to evaluate
+ * @return The energy of the state
+ */
+ParallelTemperingAnnealer::CostType ParallelTemperingAnnealer::Evaluate(Spins const &spins) const
+{
+  CostType energy{0};
+
+  for (std::size_t i = 0; i < size_; ++i)
+  {
+    if (spins[i] != 0)
+    {
+      energy += local_fields_[i];
+    }
+  }
+
+  for (auto const &coupling : couplings_)
+  {
+    if ((spins[CouplingRow(coupling.first)] != 0) && (spins[CouplingColumn(coupling.first)] != 0))
+    {
+      energy += coupling.second;
+    }
+  }
+
+  return energy;
+}
+
+}  // namespace optimisers
+}  // namespace fetch
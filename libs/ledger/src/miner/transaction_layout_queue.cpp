@@ -18,8 +18,6 @@
 
 #include "ledger/miner/transaction_layout_queue.hpp"
 
-#include <algorithm>
-#include <unordered_set>
 #include <utility>
 
 namespace fetch {
@@ -38,11 +36,11 @@ bool TransactionLayoutQueue::Add(TransactionLayout const &item)
   auto const &digest = item.digest();
 
   // ensure that this isn't already a duplicate transaction layout
-  if (digests_.find(digest) == digests_.end())
+  if (index_.find(digest) == index_.end())
   {
-    // update the digest set and list
-    list_.emplace_back(item);
-    digests_.insert(digest);
+    // update the list and the index
+    auto const it = list_.emplace(list_.end(), item);
+    index_.emplace(digest, it);
 
     success = true;
   }
@@ -60,16 +58,14 @@ bool TransactionLayoutQueue::Remove(Digest const &digest)
 {
   bool success{false};
 
-  // attempt to find the target digest
-  auto const it = std::find_if(
-      list_.begin(), list_.end(),
-      [&digest](TransactionLayout const &layout) { return layout.digest() == digest; });
+  // lookup the position of the target digest
+  auto const it = index_.find(digest);
 
-  // if we found the target element then remove the list entry and the digest from the set
-  if (list_.end() != it)
+  // if we found the target element then remove the list entry and the index entry
+  if (index_.end() != it)
   {
-    list_.erase(it);
-    digests_.erase(digest);
+    list_.erase(it->second);
+    index_.erase(it);
 
     success = true;
   }
@@ -87,23 +83,12 @@ std::size_t TransactionLayoutQueue::Remove(DigestSet const &digests)
 {
   std::size_t count{0};
 
-  if (!digests.empty())
+  for (auto const &digest : digests)
   {
-    list_.remove_if([this, &digests, &count](TransactionLayout const &layout) {
-      auto const &digest = layout.digest();
-
-      // determine if we should remove this element
-      bool const remove = digests.find(digest) != digests.end();
-
-      // also update the digests set too
-      if (remove)
-      {
-        digests_.erase(digest);
-        ++count;
-      }
-
-      return remove;
-    });
+    if (Remove(digest))
+    {
+      ++count;
+    }
   }
 
   return count;
@@ -118,95 +103,59 @@ std::size_t TransactionLayoutQueue::Remove(DigestSet const &digests)
  */
 void TransactionLayoutQueue::Splice(TransactionLayoutQueue &other)
 {
-  // extract the queue from other queue
-  UnderlyingList input = std::move(other.list_);
-  other.digests_.clear();
+  RemoveDuplicates(other);
 
-  // loop through the queue and filter out the duplicate entries from the main queue
-  for (auto it = input.begin(); it != input.end();)
+  // list iterators remain valid after a splice, so they can simply be moved between the indices
+  for (auto &entry : other.index_)
   {
-    bool const new_entry = digests_.find(it->digest()) == digests_.end();
-
-    if (new_entry)
-    {
-      // update this queues digest set (in anticipation for new transaction objects)
-      digests_.insert(it->digest());
-
-      // advance on to the next entry
-      ++it;
-    }
-    else
-    {
-      // remove the entry from the list
-      it = other.list_.erase(it);
-    }
+    index_.emplace(entry.first, entry.second);
   }
+  other.index_.clear();
 
-  // splice the contents
-  list_.splice(list_.end(), std::move(input));
+  list_.splice(list_.end(), other.list_);
 }
 
+/**
+ * Splice a range of the specified queue onto the end of the current queue
+ *
+ * Entries in the range which are already present in this queue are discarded
+ *
+ * @param other The queue from which the range is taken
+ * @param start The start of the range
+ * @param end The end of the range (exclusive)
+ */
 void TransactionLayoutQueue::Splice(TransactionLayoutQueue &other, Iterator start, Iterator end)
 {
-  // Step 1. Determine the first in the subset which is a non-duplicate
   Iterator current{start};
   while (current != end)
   {
     auto const &digest = current->digest();
 
-    if (digests_.find(digest) == digests_.end())
-    {
-      break;
-    }
-
-    // duplicate - remove the element from the "other" list
-    other.digests_.erase(digest);
-    current = other.list_.erase(current);
-  }
-
-  // if all the elements are duplicate exit early
-  if (current == end)
-  {
-    return;
-  }
-
-  // Step 2. We now have at least one element in the range which must be copied
-  Iterator const begin{current};
-
-  // loop through the queue and filter out the duplicate entries from the main queue
-  while (current != end)
-  {
-    auto const &digest = current->digest();
-
-    // remove the digest item from the "other" queue
-    other.digests_.erase(digest);
+    // remove the digest from the "other" queue
+    other.index_.erase(digest);
 
     // determine if this is a new entry or not
-    bool const new_entry = digests_.find(digest) == digests_.end();
-
-    if (new_entry)
+    if (index_.find(digest) == index_.end())
     {
-      // update this queues digest set (in anticipation for new transaction objects)
-      digests_.insert(digest);
+      index_.emplace(digest, current);
 
-      // advance on to the next entry
-      ++current;
+      // move the entry on to the end of this queue
+      auto const next = std::next(current);
+      list_.splice(list_.end(), other.list_, current);
+      current = next;
     }
     else
     {
-      // remove the entry from the list
+      // duplicate - remove the element from the "other" list
       current = other.list_.erase(current);
     }
   }
-
-  // splice the contents of the new range into the
-  list_.splice(list_.end(), other.list_, begin, end);
 }
 
 TransactionLayoutQueue::Iterator TransactionLayoutQueue::Erase(Iterator const &iterator)
 {
-  // remove the associated digest from the set
-  digests_.erase(iterator->digest());
+  // remove the associated index entry
+  index_.erase(iterator->digest());
 
   // remove the list element
   return list_.erase(iterator);
@@ -244,17 +193,23 @@ TransactionLayoutQueue::Iterator TransactionLayoutQueue::end()
 
 std::size_t TransactionLayoutQueue::size() const
 {
-  return digests_.size();
+  return index_.size();
 }
 
 bool TransactionLayoutQueue::empty() const
 {
-  return digests_.empty();
+  return index_.empty();
 }
 
-DigestSet const &TransactionLayoutQueue::digests() const
+/**
+ * Determine if a transaction is present in the queue
+ *
+ * @param digest The digest of the transaction
+ * @return true if present, otherwise false
+ */
+bool TransactionLayoutQueue::Contains(Digest const &digest) const
 {
-  return digests_;
+  return index_.find(digest) != index_.end();
 }
 
 TransactionLayoutQueue::TxLayoutSet TransactionLayoutQueue::TxLayouts() const
@@ -262,5 +217,26 @@ TransactionLayoutQueue::TxLayoutSet TransactionLayoutQueue::TxLayouts() const
   return {list_.cbegin(), list_.cend()};
 }
 
+/**
+ * Internal: Remove all the entries from the other queue which are already present in this queue
+ *
+ * @param other The other queue to be filtered
+ */
+void TransactionLayoutQueue::RemoveDuplicates(TransactionLayoutQueue &other)
+{
+  for (auto it = other.index_.begin(); it != other.index_.end();)
+  {
+    if (index_.find(it->first) == index_.end())
+    {
+      ++it;
+    }
+    else
+    {
+      other.list_.erase(it->second);
+      it = other.index_.erase(it);
+    }
+  }
+}
+
 }  // namespace ledger
 }  // namespace fetch
@@ -19,6 +19,8 @@
 #include "ledger/storage_unit/cached_storage_adapter.hpp"
 
 #include <cassert>
+#include <cstddef>
+#include <vector>
 
 namespace fetch {
 namespace ledger {
@@ -39,21 +41,31 @@ CachedStorageAdapter::~CachedStorageAdapter() = default;
 
 /**
  * Trigger a flush of the cached entries to the storage engine
+ *
+ * All the modified entries are written in a single batch, allowing the storage engine to group
+ * the writes rather than handling each of them individually.
  */
 void CachedStorageAdapter::Flush()
 {
   cache_.ApplyVoid([this](auto &cache) {
+    KeyValues entries{};
+
     for (auto &entry : cache)
     {
       if (!entry.second.flushed)
       {
-        // set the value on the storage engine
-        storage_.Set(entry.first, entry.second.value);
+        entries.emplace_back(entry.first, entry.second.value);
 
         // signal the entry as flushed
         entry.second.flushed = true;
       }
     }
+
+    if (!entries.empty())
+    {
+      // set the values on the storage engine
+      storage_.SetMany(entries);
+    }
   });
 }
 
@@ -139,6 +151,57 @@ void CachedStorageAdapter::Set(ResourceAddress const &key, StateValue const &val
   AddCacheEntry(key, value);
 }
 
+/**
+ * Get a series of resources from the storage engine or cache. All the resources which are not
+ * in the cache are retrieved from the storage engine as a single batch.
+ *
+ * @param keys The keys to be accessed
+ * @return The documents corresponding (in order) to each of the keys
+ */
+CachedStorageAdapter::Documents CachedStorageAdapter::GetMany(ResourceAddresses const &keys) const
+{
+  Documents                docs(keys.size());
+  ResourceAddresses        missing_keys{};
+  std::vector<std::size_t> missing_indices{};
+
+  // serve as many of the documents as possible from the cache
+  cache_.ApplyVoid([&](auto const &cache) {
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+      auto it = cache.find(keys[i]);
+      if (it != cache.end())
+      {
+        docs[i].document = it->second.value;
+      }
+      else
+      {
+        missing_keys.emplace_back(keys[i]);
+        missing_indices.emplace_back(i);
+      }
+    }
+  });
+
+  if (!missing_keys.empty())
+  {
+    // not in the cache need to retrieve
+    auto retrieved = storage_.GetMany(missing_keys);
+    assert(retrieved.size() == missing_keys.size());
+
+    for (std::size_t i = 0; i < retrieved.size(); ++i)
+    {
+      if (!retrieved[i].failed)
+      {
+        // update the result
+        AddCacheEntry(missing_keys[i], retrieved[i].document);
+      }
+
+      docs[missing_indices[i]] = std::move(retrieved[i]);
+    }
+  }
+
+  return docs;
+}
+
 /**
  * Lock a resource on the storage engine
  *
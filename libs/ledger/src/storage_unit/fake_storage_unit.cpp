@@ -109,6 +109,25 @@ bool FakeStorageUnit::GetTransaction(ConstByteArray const &digest, Transaction &
   return success;
 }
 
+FakeStorageUnit::TransactionList FakeStorageUnit::GetTransactions(DigestSet const &digests)
+{
+  FETCH_LOCK(lock_);
+
+  TransactionList txs;
+  txs.reserve(digests.size());
+
+  for (auto const &digest : digests)
+  {
+    auto it = transaction_store_.find(digest);
+    if (it != transaction_store_.end())
+    {
+      txs.emplace_back(std::make_shared<Transaction>(it->second));
+    }
+  }
+
+  return txs;
+}
+
 bool FakeStorageUnit::HasTransaction(ConstByteArray const &digest)
 {
   FETCH_LOCK(lock_);
@@ -35,6 +35,7 @@
 using fetch::storage::ResourceID;
 using fetch::storage::RevertibleDocumentStoreProtocol;
 using fetch::service::Promise;
+using fetch::service::Promises;
 
 namespace fetch {
 namespace ledger {
@@ -58,6 +59,38 @@ AddressList GenerateAddressList(ShardConfigs const &shards)
 constexpr char const *MERKLE_FILENAME_DOC   = "merkle_stack.db";
 constexpr char const *MERKLE_FILENAME_INDEX = "merkle_stack_index.db";
 
+/**
+ * Wait for a set of lane requests to be resolved
+ *
+ * The requests are waited on together against the single deadline of the combined promise, rather
+ * than each lane being waited on in turn. Once this returns successfully the results of the
+ * individual promises can be read without blocking.
+ *
+ * @param promises The set of outstanding lane requests
+ * @return true if all the requests were successful, otherwise false
+ */
+bool WaitForAll(Promises const &promises)
+{
+  return service::WhenAll(promises)->Wait(false);
+}
+
+/**
+ * Log the lanes whose requests did not succeed
+ *
+ * @param promises The set of lane requests, in lane order
+ * @param operation The name of the operation for the log
+ */
+void LogFailedLanes(Promises const &promises, char const *operation)
+{
+  for (std::size_t lane = 0; lane < promises.size(); ++lane)
+  {
+    if (!promises[lane]->IsSuccessful())
+    {
+      FETCH_LOG_WARN(StorageUnitClient::LOGGING_NAME, "Failed to ", operation, " on lane: ", lane);
+    }
+  }
+}
+
 }  // namespace
 
 StorageUnitClient::StorageUnitClient(MuddleEndpoint &muddle, ShardConfigs const &shards,
@@ -80,8 +113,8 @@ StorageUnitClient::StorageUnitClient(MuddleEndpoint &muddle, ShardConfigs const
 // Get the current hash of the world state (merkle tree root)
 byte_array::ConstByteArray StorageUnitClient::CurrentHash()
 {
-  MerkleTree                    tree{num_lanes()};
-  std::vector<service::Promise> promises;
+  MerkleTree tree{num_lanes()};
+  Promises   promises;
 
   for (uint32_t i = 0; i < num_lanes(); ++i)
   {
@@ -91,6 +124,12 @@ byte_array::ConstByteArray StorageUnitClient::CurrentHash()
     promises.push_back(promise);
   }
 
+  if (!WaitForAll(promises))
+  {
+    LogFailedLanes(promises, "get the current hash");
+    return {};
+  }
+
   std::size_t index = 0;
   for (auto &p : promises)
   {
@@ -188,7 +227,7 @@ bool StorageUnitClient::RevertToHash(Hash const &hash, uint64_t index)
   }  // End set merkle stack
 
   // Note: we shouldn't be touching the lanes at this point from other threads
-  std::vector<service::Promise> promises;
+  Promises promises;
   promises.reserve(num_lanes());
 
   // Now perform the revert
@@ -208,12 +247,17 @@ bool StorageUnitClient::RevertToHash(Hash const &hash, uint64_t index)
     promises.emplace_back(std::move(promise));
   }
 
+  bool all_success = WaitForAll(promises);
+  if (!all_success)
+  {
+    LogFailedLanes(promises, "revert");
+  }
+
   lane_index = 0;
-  bool all_success{true};
   for (auto &p : promises)
   {
     bool success{false};
-    if (!(p->GetResult(success) && success))
+    if (p->IsSuccessful() && !(p->GetResult(success) && success))
     {
       FETCH_LOG_WARN(LOGGING_NAME, "Failed to revert shard ", lane_index, " to 0x",
                      tree[lane_index].ToHex());
@@ -246,7 +290,7 @@ byte_array::ConstByteArray StorageUnitClient::Commit(uint64_t const commit_index
 
   MerkleTree tree{num_lanes()};
 
-  std::vector<service::Promise> promises;
+  Promises promises;
   promises.reserve(num_lanes());
 
   for (uint32_t lane_idx = 0; lane_idx < num_lanes(); ++lane_idx)
@@ -259,6 +303,12 @@ byte_array::ConstByteArray StorageUnitClient::Commit(uint64_t const commit_index
     promises.push_back(promise);
   }
 
+  if (!WaitForAll(promises))
+  {
+    LogFailedLanes(promises, "commit");
+    return {};
+  }
+
   std::size_t index = 0;
   for (auto &p : promises)
   {
@@ -438,6 +488,59 @@ bool StorageUnitClient::GetTransaction(byte_array::ConstByteArray const &digest,
   return success;
 }
 
+/**
+ * Retrieve a batch of transactions from the lanes in which they are stored
+ *
+ * The digests are grouped by lane so that a single request is made to each lane. All the requests
+ * are issued before any of the responses are waited on, so the lanes are queried in parallel.
+ *
+ * @param digests The set of transaction digests to be retrieved
+ * @return The transactions which were found, missing transactions are omitted
+ */
+StorageUnitClient::TransactionList StorageUnitClient::GetTransactions(DigestSet const &digests)
+{
+  using TxArray = TransactionStorageProtocol::TxArray;
+
+  std::map<Address, DigestSet> lanes_of_interest;
+  for (auto const &digest : digests)
+  {
+    ResourceID const resource{digest};
+    lanes_of_interest[LookupAddress(resource)].insert(digest);
+  }
+
+  std::vector<service::Promise> promises;
+  promises.reserve(lanes_of_interest.size());
+
+  for (auto const &lane_resources : lanes_of_interest)
+  {
+    promises.push_back(rpc_client_->CallSpecificAddress(lane_resources.first, RPC_TX_STORE,
+                                                        TransactionStorageProtocol::GET_MANY,
+                                                        lane_resources.second));
+  }
+
+  TransactionList txs;
+  txs.reserve(digests.size());
+
+  for (auto const &promise : promises)
+  {
+    TxArray lane_txs{};
+
+    if (promise->GetResult(lane_txs))
+    {
+      for (auto &tx : lane_txs)
+      {
+        txs.emplace_back(std::make_shared<chain::Transaction>(std::move(tx)));
+      }
+    }
+    else
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Failed to resolve GET_MANY on TX store!");
+    }
+  }
+
+  return txs;
+}
+
 bool StorageUnitClient::HasTransaction(ConstByteArray const &digest)
 {
   ResourceID resource{digest};
@@ -528,6 +631,117 @@ void StorageUnitClient::Set(ResourceAddress const &key, StateValue const &value)
   }
 }
 
+/**
+ * Lookup a series of documents from the lanes in which they are stored
+ *
+ * A single request is made to each of the lanes involved. All the requests are issued before any
+ * of the responses are waited on, so the lanes are queried in parallel.
+ *
+ * @param keys The keys to be looked up
+ * @return The documents corresponding (in order) to each of the keys
+ */
+StorageUnitClient::Documents StorageUnitClient::GetMany(ResourceAddresses const &keys) const
+{
+  using Protocol = RevertibleDocumentStoreProtocol;
+
+  struct LaneRequest
+  {
+    Protocol::Keys           keys;
+    std::vector<std::size_t> indices;
+  };
+
+  // group the requested keys by lane, remembering where each document belongs in the output
+  std::map<Address, LaneRequest> lanes_of_interest;
+  for (std::size_t i = 0; i < keys.size(); ++i)
+  {
+    auto &request = lanes_of_interest[LookupAddress(keys[i])];
+
+    request.keys.emplace_back(keys[i].as_resource_id());
+    request.indices.emplace_back(i);
+  }
+
+  std::vector<service::Promise> promises;
+  promises.reserve(lanes_of_interest.size());
+
+  for (auto const &lane_request : lanes_of_interest)
+  {
+    promises.push_back(rpc_client_->CallSpecificAddress(lane_request.first, RPC_STATE,
+                                                        Protocol::GET_MANY,
+                                                        lane_request.second.keys));
+  }
+
+  Documents docs(keys.size());
+
+  auto promise_it = promises.begin();
+  for (auto const &lane_request : lanes_of_interest)
+  {
+    auto const &indices = lane_request.second.indices;
+
+    Documents lane_docs{};
+    if ((*promise_it)->GetResult(lane_docs) && (lane_docs.size() == indices.size()))
+    {
+      for (std::size_t i = 0; i < indices.size(); ++i)
+      {
+        docs[indices[i]] = std::move(lane_docs[i]);
+      }
+    }
+    else
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Failed to call GET_MANY (get documents)");
+
+      for (auto const index : indices)
+      {
+        docs[index].failed = true;
+      }
+    }
+
+    ++promise_it;
+  }
+
+  return docs;
+}
+
+/**
+ * Set a series of values on the lanes in which they are stored
+ *
+ * The values are grouped so that a single message is sent to each of the lanes involved. All the
+ * messages are sent before any of the responses are waited on.
+ *
+ * @param entries The key value pairs to be stored
+ */
+void StorageUnitClient::SetMany(KeyValues const &entries)
+{
+  using Protocol = RevertibleDocumentStoreProtocol;
+
+  std::map<Address, Protocol::KeyValues> lanes_of_interest;
+  for (auto const &entry : entries)
+  {
+    lanes_of_interest[LookupAddress(entry.first)].emplace_back(entry.first.as_resource_id(),
+                                                               entry.second);
+  }
+
+  try
+  {
+    std::vector<service::Promise> promises;
+    promises.reserve(lanes_of_interest.size());
+
+    for (auto const &lane_entries : lanes_of_interest)
+    {
+      promises.push_back(rpc_client_->CallSpecificAddress(lane_entries.first, RPC_STATE,
+                                                          Protocol::SET_MANY, lane_entries.second));
+    }
+
+    for (auto const &promise : promises)
+    {
+      promise->Wait();
+    }
+  }
+  catch (std::exception const &e)
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Failed to call SET_MANY (store documents), because: ", e.what());
+  }
+}
+
 bool StorageUnitClient::Lock(ShardIndex index)
 {
   bool success{false};
@@ -18,6 +18,7 @@
 
 #include "core/reactor.hpp"
 #include "ledger/storage_unit/transaction_storage_engine.hpp"
+#include "ledger/transaction_tracer.hpp"
 
 namespace fetch {
 namespace ledger {
@@ -95,6 +96,8 @@ void TransactionStorageEngine::Add(chain::Transaction const &tx, bool is_recent)
   // add the transaction to the store
   store_.Add(tx);
 
+  TransactionTracer::Instance().Record(tx.digest(), TransactionTracer::Stage::STORED);
+
   // add to the recent cache if that is the case
   if (is_recent)
   {
@@ -53,17 +53,20 @@ TransactionStorageProtocol::TransactionStorageProtocol(TransactionStorageEngineI
   , get_total_{CreateCounter("get")}
   , get_count_total_{CreateCounter("get_count")}
   , get_recent_total_{CreateCounter("get_recent")}
+  , get_many_total_{CreateCounter("get_many")}
   , add_durations_{CreateHistogram("add")}
   , has_durations_{CreateHistogram("has")}
   , get_durations_{CreateHistogram("get")}
   , get_count_durations_{CreateHistogram("get_count")}
   , get_recent_durations_{CreateHistogram("get_recent")}
+  , get_many_durations_{CreateHistogram("get_many")}
 {
   Expose(ADD, this, &TransactionStorageProtocol::Add);
   Expose(HAS, this, &TransactionStorageProtocol::Has);
   Expose(GET, this, &TransactionStorageProtocol::Get);
   Expose(GET_COUNT, this, &TransactionStorageProtocol::GetCount);
   Expose(GET_RECENT, this, &TransactionStorageProtocol::GetRecent);
+  Expose(GET_MANY, this, &TransactionStorageProtocol::GetMany);
 }
 
 /**
@@ -156,6 +159,44 @@ chain::Transaction TransactionStorageProtocol::Get(Digest const &tx_digest)
   return tx;
 }
 
+/**
+ * Retrieve a batch of transactions from the storage engine
+ *
+ * Unlike `Get` a missing transaction is not an error, it is simply omitted from the output. This
+ * allows callers to prefetch speculatively and fall back to individual lookups.
+ *
+ * @param tx_digests The set of transaction digests being queried
+ * @return The transactions which were found in the storage engine
+ */
+TransactionStorageProtocol::TxArray TransactionStorageProtocol::GetMany(
+    DigestSet const &tx_digests)
+{
+  get_many_total_->increment();
+
+  FunctionTimer timer{*get_many_durations_};
+  TxArray       txs{};
+  txs.reserve(tx_digests.size());
+
+  for (auto const &tx_digest : tx_digests)
+  {
+    chain::Transaction tx{};
+
+    if (storage_.Get(tx_digest, tx))
+    {
+      // as with single lookups, retrieved transactions must be persisted to disk
+      storage_.Confirm(tx_digest);
+
+      txs.emplace_back(std::move(tx));
+    }
+    else
+    {
+      FETCH_LOG_DEBUG(LOGGING_NAME, "Unable to lookup transaction 0x", tx_digest.ToHex());
+    }
+  }
+
+  return txs;
+}
+
 /**
  * Get the total number of stored transactions in this storage engine
  *
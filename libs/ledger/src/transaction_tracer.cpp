@@ -0,0 +1,352 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "ledger/transaction_tracer.hpp"
+#include "telemetry/gauge.hpp"
+#include "telemetry/registry.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace fetch {
+namespace ledger {
+
+constexpr std::size_t TransactionTracer::NUM_STAGES;
+constexpr std::size_t TransactionTracer::CAPACITY;
+constexpr std::size_t TransactionTracer::DIGEST_WORDS;
+
+/**
+ * A single event in the ring buffer. The sequence number is odd while the slot is being written
+ * and allows readers to discard slots which changed while they were being copied.
+ */
+struct TransactionTracer::Slot
+{
+  std::atomic<uint64_t>                            sequence;
+  std::atomic<uint64_t>                            timestamp;
+  std::atomic<uint32_t>                            stage;
+  std::array<std::atomic<uint64_t>, DIGEST_WORDS> digest;
+};
+
+struct TransactionTracer::Event
+{
+  std::array<uint64_t, DIGEST_WORDS> digest;
+  Stage                              stage;
+  Timepoint                          timestamp;
+};
+
+namespace {
+
+using telemetry::Registry;
+
+constexpr std::size_t DIGEST_SIZE = 32;
+constexpr std::size_t SLOT_MASK   = TransactionTracer::CAPACITY - 1;
+
+static_assert((TransactionTracer::CAPACITY & SLOT_MASK) == 0, "Capacity must be a power of 2");
+
+std::string ToMetricName(TransactionTracer::Stage stage)
+{
+  std::string name{ToString(stage)};
+  std::transform(name.begin(), name.end(), name.begin(),
+                 [](char c) { return static_cast<char>(std::tolower(c)); });
+  return name;
+}
+
+telemetry::GaugePtr<double> CreateGauge(TransactionTracer::Stage stage, char const *percentile)
+{
+  std::string const stage_name = ToMetricName(stage);
+
+  return Registry::Instance().CreateGauge<double>(
+      "ledger_tx_trace_" + stage_name + "_" + percentile + "_seconds",
+      std::string{"The "} + percentile + " of the time sampled transactions take to become " +
+          stage_name + ", since their previous stage");
+}
+
+double Percentile(std::vector<double> &values, std::size_t percent)
+{
+  auto const index = std::min(values.size() - 1, (values.size() * percent) / 100);
+  std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index),
+                   values.end());
+  return values[index];
+}
+
+}  // namespace
+
+/**
+ * Get the tracer shared by all the stages of the pipeline
+ *
+ * @return The reference to the tracer
+ */
+TransactionTracer &TransactionTracer::Instance()
+{
+  static TransactionTracer instance;
+  return instance;
+}
+
+TransactionTracer::TransactionTracer()
+  : slots_{new Slot[CAPACITY]()}
+{
+  for (std::size_t i = 0; i < NUM_STAGES; ++i)
+  {
+    auto const stage = static_cast<Stage>(i);
+
+    p50_[i] = CreateGauge(stage, "p50");
+    p99_[i] = CreateGauge(stage, "p99");
+  }
+}
+
+TransactionTracer::~TransactionTracer() = default;
+
+/**
+ * Update how many transactions are traced
+ *
+ * @param interval Trace one in every interval transactions, zero disables tracing
+ */
+void TransactionTracer::SetSampleInterval(uint32_t interval)
+{
+  sample_interval_.store(interval, std::memory_order_relaxed);
+}
+
+uint32_t TransactionTracer::sample_interval() const
+{
+  return sample_interval_.load(std::memory_order_relaxed);
+}
+
+bool TransactionTracer::IsSampled(Digest const &digest) const
+{
+  uint32_t const interval = sample_interval_.load(std::memory_order_relaxed);
+  return (interval != 0) && IsSampled(digest, interval);
+}
+
+/**
+ * Decide whether a transaction is sampled. The digest is already a uniformly distributed hash, so
+ * its leading bytes are used directly.
+ */
+bool TransactionTracer::IsSampled(Digest const &digest, uint32_t interval)
+{
+  uint64_t value{0};
+  std::memcpy(&value, digest.pointer(), std::min(digest.size(), sizeof(value)));
+
+  return (value % interval) == 0;
+}
+
+void TransactionTracer::RecordSampled(Digest const &digest, Stage stage)
+{
+  std::array<uint64_t, DIGEST_WORDS> words{};
+  std::memcpy(words.data(), digest.pointer(), std::min(digest.size(), DIGEST_SIZE));
+
+  auto const timestamp =
+      static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                Clock::now().time_since_epoch())
+                                .count());
+
+  // claim the next slot, overwriting the oldest event
+  uint64_t const index = next_.fetch_add(1, std::memory_order_relaxed);
+  Slot &         slot  = slots_[index & SLOT_MASK];
+
+  slot.sequence.store((index * 2) + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  slot.timestamp.store(timestamp, std::memory_order_relaxed);
+  slot.stage.store(static_cast<uint32_t>(stage), std::memory_order_relaxed);
+  for (std::size_t i = 0; i < DIGEST_WORDS; ++i)
+  {
+    slot.digest[i].store(words[i], std::memory_order_relaxed);
+  }
+
+  slot.sequence.store((index * 2) + 2, std::memory_order_release);
+}
+
+/**
+ * Group the events currently in the ring buffer into traces, oldest first
+ *
+ * @return The traces of the sampled transactions
+ */
+TransactionTracer::Traces TransactionTracer::Collect() const
+{
+  return Collect(nullptr);
+}
+
+/**
+ * Look up the trace of a single transaction
+ *
+ * @param digest The digest of the transaction
+ * @return The trace, without any spans if the transaction has not been traced
+ */
+TransactionTracer::Trace TransactionTracer::Collect(Digest const &digest) const
+{
+  auto traces = Collect(&digest);
+  if (traces.empty())
+  {
+    return Trace{digest, {}};
+  }
+
+  return std::move(traces.front());
+}
+
+TransactionTracer::Traces TransactionTracer::Collect(Digest const *filter) const
+{
+  std::array<uint64_t, DIGEST_WORDS> filter_words{};
+  if (filter != nullptr)
+  {
+    std::memcpy(filter_words.data(), filter->pointer(), std::min(filter->size(), DIGEST_SIZE));
+  }
+
+  // take a consistent copy of every completed slot
+  std::vector<std::pair<uint64_t, Event>> events;
+  for (std::size_t i = 0; i < CAPACITY; ++i)
+  {
+    Slot const &slot = slots_[i];
+
+    uint64_t const sequence = slot.sequence.load(std::memory_order_acquire);
+    if ((sequence == 0) || ((sequence & 1u) != 0))
+    {
+      continue;
+    }
+
+    Event event{};
+    event.stage     = static_cast<Stage>(slot.stage.load(std::memory_order_relaxed));
+    event.timestamp = Timepoint{std::chrono::duration_cast<Clock::duration>(
+        std::chrono::nanoseconds{slot.timestamp.load(std::memory_order_relaxed)})};
+    for (std::size_t j = 0; j < DIGEST_WORDS; ++j)
+    {
+      event.digest[j] = slot.digest[j].load(std::memory_order_relaxed);
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.sequence.load(std::memory_order_relaxed) != sequence)
+    {
+      continue;
+    }
+
+    if ((filter == nullptr) || (event.digest == filter_words))
+    {
+      events.emplace_back(sequence, event);
+    }
+  }
+
+  std::sort(events.begin(), events.end(),
+            [](auto const &a, auto const &b) { return a.first < b.first; });
+
+  // group the events by transaction, in the order the transactions were first seen
+  struct DigestHash
+  {
+    std::size_t operator()(std::array<uint64_t, DIGEST_WORDS> const &words) const
+    {
+      return static_cast<std::size_t>(words[0]);
+    }
+  };
+
+  Traces                                                                          traces;
+  std::unordered_map<std::array<uint64_t, DIGEST_WORDS>, std::size_t, DigestHash> index;
+  for (auto const &entry : events)
+  {
+    Event const &event = entry.second;
+
+    auto it = index.find(event.digest);
+    if (it == index.end())
+    {
+      byte_array::ByteArray digest;
+      digest.Resize(DIGEST_SIZE);
+      std::memcpy(digest.pointer(), event.digest.data(), DIGEST_SIZE);
+
+      it = index.emplace(event.digest, traces.size()).first;
+      traces.push_back(Trace{digest, {}});
+    }
+
+    traces[it->second].spans.push_back(Span{event.stage, event.timestamp});
+  }
+
+  for (auto &trace : traces)
+  {
+    std::stable_sort(trace.spans.begin(), trace.spans.end(),
+                     [](Span const &a, Span const &b) { return a.timestamp < b.timestamp; });
+  }
+
+  return traces;
+}
+
+/**
+ * Aggregate the time sampled transactions spend before reaching each stage into the percentile
+ * gauges of the telemetry registry. This scans the whole ring buffer, so it is called when the
+ * telemetry is exported rather than when events are recorded.
+ */
+void TransactionTracer::UpdateTelemetry()
+{
+  std::array<std::vector<double>, NUM_STAGES> latencies;
+
+  for (auto const &trace : Collect())
+  {
+    for (std::size_t i = 1; i < trace.spans.size(); ++i)
+    {
+      auto const &span     = trace.spans[i];
+      auto const  duration = span.timestamp - trace.spans[i - 1].timestamp;
+
+      latencies[static_cast<std::size_t>(span.stage)].push_back(
+          std::chrono::duration<double>(duration).count());
+    }
+  }
+
+  for (std::size_t i = 0; i < NUM_STAGES; ++i)
+  {
+    if (latencies[i].empty())
+    {
+      continue;
+    }
+
+    if (p50_[i])
+    {
+      p50_[i]->set(Percentile(latencies[i], 50));
+    }
+
+    if (p99_[i])
+    {
+      p99_[i]->set(Percentile(latencies[i], 99));
+    }
+  }
+}
+
+char const *ToString(TransactionTracer::Stage stage)
+{
+  using Stage = TransactionTracer::Stage;
+
+  switch (stage)
+  {
+  case Stage::RECEIVED:
+    return "Received";
+  case Stage::VERIFIED:
+    return "Verified";
+  case Stage::STORED:
+    return "Stored";
+  case Stage::QUEUED:
+    return "Queued";
+  case Stage::SCHEDULED:
+    return "Scheduled";
+  case Stage::EXECUTED:
+    return "Executed";
+  }
+
+  return "Unknown";
+}
+
+}  // namespace ledger
+}  // namespace fetch
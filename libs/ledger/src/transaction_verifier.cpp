@@ -20,6 +20,7 @@
 #include "core/set_thread_name.hpp"
 #include "core/string/to_lower.hpp"
 #include "ledger/storage_unit/transaction_sinks.hpp"
+#include "ledger/transaction_tracer.hpp"
 #include "ledger/transaction_verifier.hpp"
 #include "logging/logging.hpp"
 #include "network/generics/milli_timer.hpp"
@@ -162,6 +163,8 @@ void TransactionVerifier::Stop()
  */
 void TransactionVerifier::AddTransaction(TransactionPtr const &tx)
 {
+  TransactionTracer::Instance().Record(tx->digest(), TransactionTracer::Stage::RECEIVED);
+
   unverified_queue_.Push(tx);
   unverified_queue_length_->increment();
   unverified_tx_total_->increment();
@@ -174,6 +177,8 @@ void TransactionVerifier::AddTransaction(TransactionPtr const &tx)
  */
 void TransactionVerifier::AddTransaction(TransactionPtr &&tx)
 {
+  TransactionTracer::Instance().Record(tx->digest(), TransactionTracer::Stage::RECEIVED);
+
   unverified_queue_.Push(std::move(tx));
   unverified_queue_length_->increment();
   unverified_tx_total_->increment();
@@ -201,6 +206,7 @@ void TransactionVerifier::Verifier()
         if (tx->Verify())
         {
           FETCH_LOG_DEBUG(LOGGING_NAME, "TX Verify Complete: 0x", tx->digest().ToHex());
+          TransactionTracer::Instance().Record(tx->digest(), TransactionTracer::Stage::VERIFIED);
 
           verified_queue_.Push(std::move(tx));
           verified_queue_length_->increment();
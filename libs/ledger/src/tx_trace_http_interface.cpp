@@ -0,0 +1,136 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/decoders.hpp"
+#include "core/macros.hpp"
+#include "http/json_response.hpp"
+#include "json/document.hpp"
+#include "ledger/transaction_tracer.hpp"
+#include "ledger/tx_trace_http_interface.hpp"
+#include "variant/variant.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+
+namespace fetch {
+namespace ledger {
+
+namespace {
+
+using fetch::byte_array::FromHex;
+using fetch::variant::Variant;
+
+/**
+ * Convert a trace into JSON. Every span reports the time since the transaction was first seen and
+ * the time since its previous stage, both in microseconds.
+ */
+Variant ToVariant(TransactionTracer::Trace const &trace)
+{
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+
+  auto retval{Variant::Object()};
+  retval["tx"] = trace.digest.ToHex();
+
+  auto &spans = retval["stages"] = Variant::Array(trace.spans.size());
+  for (std::size_t i = 0; i < trace.spans.size(); ++i)
+  {
+    auto const &span     = trace.spans[i];
+    auto const &first    = trace.spans.front();
+    auto const &previous = trace.spans[(i == 0) ? 0 : i - 1];
+
+    auto &entry       = spans[i] = Variant::Object();
+    entry["stage"]    = ToString(span.stage);
+    entry["since_us"] = duration_cast<microseconds>(span.timestamp - first.timestamp).count();
+    entry["delta_us"] = duration_cast<microseconds>(span.timestamp - previous.timestamp).count();
+  }
+
+  return retval;
+}
+
+}  // namespace
+
+TxTraceHttpInterface::TxTraceHttpInterface(TransactionTracer &tracer)
+  : tracer_{tracer}
+{
+  Get("/api/trace/tx", "Retrieves the traces of all recently sampled transactions.",
+      [this](http::ViewParameters const &, http::HTTPRequest const &) {
+        tracer_.UpdateTelemetry();
+
+        auto const traces = tracer_.Collect();
+
+        auto response{Variant::Object()};
+        response["sample_interval"] = tracer_.sample_interval();
+
+        auto &array = response["traces"] = Variant::Array(traces.size());
+        for (std::size_t i = 0; i < traces.size(); ++i)
+        {
+          array[i] = ToVariant(traces[i]);
+        }
+
+        return http::CreateJsonResponse(response);
+      });
+
+  Get("/api/trace/tx/(digest=[a-fA-F0-9]{64})", "Retrieves the trace of a sampled transaction.",
+      {
+          {"digest", "The transaction hash.", http::validators::StringValue()},
+      },
+      [this](http::ViewParameters const &params, http::HTTPRequest const &request) {
+        FETCH_UNUSED(request);
+
+        if (params.Has("digest"))
+        {
+          auto const digest = FromHex(params["digest"]);
+
+          return http::CreateJsonResponse(ToVariant(tracer_.Collect(digest)));
+        }
+
+        return http::CreateJsonResponse("{}", http::Status::CLIENT_ERROR_BAD_REQUEST);
+      });
+
+  Patch("/api/trace/sampling",
+        "Sets the tracing interval, one in every interval transactions is traced, zero disables "
+        "tracing.",
+        [this](http::ViewParameters const &, http::HTTPRequest const &request) {
+          try
+          {
+            json::JSONDocument doc{request.body()};
+            auto const &       interval = doc.root()["interval"];
+
+            if (interval.IsInteger() && (interval.As<int64_t>() >= 0) &&
+                (interval.As<int64_t>() <= std::numeric_limits<uint32_t>::max()))
+            {
+              tracer_.SetSampleInterval(interval.As<uint32_t>());
+
+              return http::CreateJsonResponse("{}");
+            }
+          }
+          catch (std::exception const &)
+          {
+            // fall through to the error response
+          }
+
+          return http::CreateJsonResponse(
+              R"({"error": "Expected a non negative integer interval"})",
+              http::Status::CLIENT_ERROR_BAD_REQUEST);
+        });
+}
+
+}  // namespace ledger
+}  // namespace fetch
@@ -0,0 +1,223 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "ledger/chain/block.hpp"
+#include "ledger/chain/block_log.hpp"
+#include "ledger/testing/block_generator.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+namespace {
+
+using fetch::ledger::Block;
+using fetch::ledger::BlockLog;
+using fetch::ledger::testing::BlockGenerator;
+
+using BlockPtr     = BlockGenerator::BlockPtr;
+using BlockArray   = std::vector<BlockPtr>;
+using BlockLogPtr  = std::unique_ptr<BlockLog>;
+using GeneratorPtr = std::unique_ptr<BlockGenerator>;
+
+constexpr char const *LOG_FILE    = "block_log_tests.log.db";
+constexpr char const *HEADER_FILE = "block_log_tests.headers.db";
+
+class BlockLogTests : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    fetch::crypto::mcl::details::MCLInitialiser();
+
+    static constexpr std::size_t NUM_LANES  = 1;
+    static constexpr std::size_t NUM_SLICES = 2;
+
+    log_       = std::make_unique<BlockLog>();
+    generator_ = std::make_unique<BlockGenerator>(NUM_LANES, NUM_SLICES);
+
+    log_->New(LOG_FILE, HEADER_FILE);
+  }
+
+  BlockArray Generate(BlockPtr previous, std::size_t count)
+  {
+    BlockArray blocks;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      previous = generator_->Generate(previous);
+      blocks.push_back(previous);
+    }
+    return blocks;
+  }
+
+  BlockArray GenerateChain(std::size_t count)
+  {
+    BlockArray chain{generator_->Generate()};
+    auto const rest = Generate(chain.front(), count - 1);
+    chain.insert(chain.end(), rest.begin(), rest.end());
+    return chain;
+  }
+
+  void AppendAll(BlockArray const &blocks)
+  {
+    for (auto const &block : blocks)
+    {
+      ASSERT_TRUE(log_->Append(*block));
+    }
+  }
+
+  BlockLogPtr  log_;
+  GeneratorPtr generator_;
+};
+
+TEST_F(BlockLogTests, CheckSequentialAppendAndRead)
+{
+  auto const chain = GenerateChain(20);
+  AppendAll(chain);
+
+  ASSERT_EQ(log_->size(), chain.size());
+
+  for (auto const &block : chain)
+  {
+    EXPECT_TRUE(log_->Contains(block->hash, block->block_number));
+
+    Block retrieved;
+    ASSERT_TRUE(log_->GetBlock(block->block_number, retrieved));
+    EXPECT_EQ(retrieved.hash, block->hash);
+    EXPECT_EQ(retrieved.previous_hash, block->previous_hash);
+    EXPECT_EQ(retrieved.block_number, block->block_number);
+  }
+
+  BlockLog::Blocks range;
+  ASSERT_TRUE(log_->GetBlocks(5, 10, range));
+  ASSERT_EQ(range.size(), 10u);
+  for (std::size_t i = 0; i < range.size(); ++i)
+  {
+    EXPECT_EQ(range[i].hash, chain[i + 5]->hash);
+  }
+
+  // ranges are clipped to the top of the log
+  range.clear();
+  ASSERT_TRUE(log_->GetBlocks(15, 100, range));
+  EXPECT_EQ(range.size(), 5u);
+
+  range.clear();
+  EXPECT_FALSE(log_->GetBlocks(20, 1, range));
+  EXPECT_TRUE(range.empty());
+}
+
+TEST_F(BlockLogTests, CheckOnlyUnbrokenChainsAreAccepted)
+{
+  auto const chain = GenerateChain(5);
+  auto const ahead = Generate(chain.back(), 2);
+
+  AppendAll(chain);
+
+  // appending an existing block is a no-op
+  EXPECT_TRUE(log_->Append(*chain[3]));
+  EXPECT_EQ(log_->size(), chain.size());
+
+  // gaps are not permitted
+  EXPECT_FALSE(log_->Append(*ahead.back()));
+  EXPECT_EQ(log_->size(), chain.size());
+
+  // neither are blocks which do not follow on from the top of the log
+  auto const unrelated = GenerateChain(7);
+  EXPECT_FALSE(log_->Append(*unrelated.back()));
+  EXPECT_EQ(log_->size(), chain.size());
+
+  EXPECT_TRUE(log_->Append(*ahead.front()));
+  EXPECT_EQ(log_->size(), chain.size() + 1);
+}
+
+TEST_F(BlockLogTests, CheckReorganisationReplacesOrphanedBlocks)
+{
+  auto const chain = GenerateChain(10);
+  auto const fork  = Generate(chain[4], 8);
+
+  AppendAll(chain);
+  AppendAll(fork);
+
+  ASSERT_EQ(log_->size(), 5 + fork.size());
+
+  for (std::size_t i = 0; i < 5; ++i)
+  {
+    EXPECT_TRUE(log_->Contains(chain[i]->hash, i));
+  }
+  for (std::size_t i = 5; i < chain.size(); ++i)
+  {
+    EXPECT_FALSE(log_->Contains(chain[i]->hash, i));
+  }
+  for (auto const &block : fork)
+  {
+    EXPECT_TRUE(log_->Contains(block->hash, block->block_number));
+  }
+
+  Block retrieved;
+  ASSERT_TRUE(log_->GetBlock(fork.back()->block_number, retrieved));
+  EXPECT_EQ(retrieved.hash, fork.back()->hash);
+}
+
+TEST_F(BlockLogTests, CheckRecoveryFromFile)
+{
+  auto const chain = GenerateChain(30);
+  AppendAll(chain);
+  log_.reset();
+
+  log_ = std::make_unique<BlockLog>();
+  log_->Load(LOG_FILE, HEADER_FILE);
+
+  ASSERT_EQ(log_->Verify(), chain.size());
+  ASSERT_EQ(log_->size(), chain.size());
+
+  BlockLog::Blocks range;
+  ASSERT_TRUE(log_->GetBlocks(0, chain.size(), range));
+  ASSERT_EQ(range.size(), chain.size());
+  for (std::size_t i = 0; i < range.size(); ++i)
+  {
+    EXPECT_EQ(range[i].hash, chain[i]->hash);
+  }
+
+  // the log can be extended after recovery
+  auto const next = Generate(chain.back(), 1);
+  EXPECT_TRUE(log_->Append(*next.front()));
+  EXPECT_EQ(log_->size(), chain.size() + 1);
+}
+
+TEST_F(BlockLogTests, CheckRecoveryDiscardsMissingData)
+{
+  auto const chain = GenerateChain(10);
+  AppendAll(chain);
+  log_.reset();
+
+  // lose the block data while keeping the headers
+  {
+    std::ofstream truncate(LOG_FILE, std::ios::binary | std::ios::out | std::ios::trunc);
+  }
+
+  log_ = std::make_unique<BlockLog>();
+  log_->Load(LOG_FILE, HEADER_FILE);
+
+  EXPECT_EQ(log_->size(), 0u);
+  EXPECT_TRUE(log_->Append(*chain.front()));
+}
+
+}  // namespace
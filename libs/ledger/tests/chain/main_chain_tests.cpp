@@ -797,6 +797,48 @@ TEST_P(MainChainTests, CheckLongChainWrite)
   }
 }
 
+TEST_P(MainChainTests, CheckBlockLookupByNumber)
+{
+  static constexpr std::size_t NUM_BLOCKS = 30;
+
+  auto const genesis = generator_->Generate();
+  auto const blocks  = Generate(generator_, genesis, NUM_BLOCKS);
+
+  for (auto const &block : blocks)
+  {
+    ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*block));
+  }
+
+  auto const retrieved_genesis = chain_->GetBlockByNumber(0);
+  ASSERT_TRUE(retrieved_genesis);
+  EXPECT_EQ(retrieved_genesis->hash, genesis->hash);
+
+  for (auto const &block : blocks)
+  {
+    auto const retrieved_block = chain_->GetBlockByNumber(block->block_number);
+    ASSERT_TRUE(retrieved_block);
+    EXPECT_EQ(retrieved_block->hash, block->hash);
+  }
+
+  EXPECT_FALSE(chain_->GetBlockByNumber(NUM_BLOCKS + 1));
+
+  // switch to a heavier fork, blocks must be looked up on the new heaviest chain
+  auto const fork = Generate(generator_, blocks[24], 10);
+  for (auto const &block : fork)
+  {
+    ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*block));
+  }
+  ASSERT_EQ(chain_->GetHeaviestBlockHash(), fork.back()->hash);
+
+  for (auto const &block : fork)
+  {
+    auto const retrieved_block = chain_->GetBlockByNumber(block->block_number);
+    ASSERT_TRUE(retrieved_block);
+    EXPECT_EQ(retrieved_block->hash, block->hash);
+  }
+  EXPECT_EQ(chain_->GetBlockByNumber(10)->hash, blocks[9]->hash);
+}
+
 TEST_P(MainChainTests, CheckInOrderWeights)
 {
   auto genesis = generator_->Generate();
@@ -925,6 +967,48 @@ TEST_P(MainChainTests, CheckHeaviestChain)
   }
 }
 
+TEST(MainChainRecoveryTests, CheckRecoveryFromBlockLog)
+{
+  static constexpr std::size_t NUM_BLOCKS = 40;
+
+  fetch::crypto::mcl::details::MCLInitialiser();
+
+  auto generator = std::make_unique<BlockGenerator>(1, 2);
+
+  auto const genesis = generator->Generate();
+  auto const blocks  = Generate(generator, genesis, NUM_BLOCKS);
+
+  {
+    MainChain chain{MainChain::Mode::CREATE_PERSISTENT_DB};
+    for (auto const &block : blocks)
+    {
+      ASSERT_EQ(BlockStatus::ADDED, chain.AddBlock(*block));
+    }
+  }
+
+  MainChain chain{MainChain::Mode::LOAD_PERSISTENT_DB};
+
+  // only the finalised blocks are persisted
+  auto const &head = blocks[NUM_BLOCKS - chain::FINALITY_PERIOD - 1];
+  ASSERT_EQ(chain.GetHeaviestBlockHash(), head->hash);
+
+  auto const preceding = chain.GetChainPreceding(head->hash);
+  ASSERT_EQ(preceding.size(), head->block_number + 1);
+  for (std::size_t i = 0; i < preceding.size(); ++i)
+  {
+    EXPECT_EQ(preceding[i]->block_number, head->block_number - i);
+  }
+  EXPECT_EQ(preceding.back()->hash, genesis->hash);
+
+  auto const logue = chain.TimeTravel(genesis->hash);
+  ASSERT_EQ(logue.blocks.size(), head->block_number);
+  EXPECT_EQ(logue.blocks.back()->hash, head->hash);
+
+  auto const retrieved_block = chain.GetBlockByNumber(7);
+  ASSERT_TRUE(retrieved_block);
+  EXPECT_EQ(retrieved_block->hash, blocks[6]->hash);
+}
+
 INSTANTIATE_TEST_CASE_P(ParamBased, MainChainTests,
                         ::testing::Values(MainChain::Mode::CREATE_PERSISTENT_DB,
                                           MainChain::Mode::IN_MEMORY_DB), );
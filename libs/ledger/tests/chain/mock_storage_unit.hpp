@@ -44,6 +44,8 @@ public:
         .WillByDefault(Invoke(&fake, &FakeStorageUnit::AddTransaction));
     ON_CALL(*this, GetTransaction(_, _))
         .WillByDefault(Invoke(&fake, &FakeStorageUnit::GetTransaction));
+    ON_CALL(*this, GetTransactions(_))
+        .WillByDefault(Invoke(&fake, &FakeStorageUnit::GetTransactions));
     ON_CALL(*this, HasTransaction(_))
         .WillByDefault(Invoke(&fake, &FakeStorageUnit::HasTransaction));
 
@@ -64,6 +66,7 @@ public:
 
   MOCK_METHOD1(AddTransaction, void(Transaction const &));
   MOCK_METHOD2(GetTransaction, bool(Digest const &, Transaction &));
+  MOCK_METHOD1(GetTransactions, TransactionList(DigestSet const &));
   MOCK_METHOD1(HasTransaction, bool(Digest const &));
   MOCK_METHOD1(IssueCallForMissingTxs, void(DigestSet const &));
 
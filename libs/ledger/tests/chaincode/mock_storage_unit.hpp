@@ -49,6 +49,8 @@ public:
         .WillByDefault(Invoke(&fake_, &FakeStorageUnit::AddTransaction));
     ON_CALL(*this, GetTransaction(_, _))
         .WillByDefault(Invoke(&fake_, &FakeStorageUnit::GetTransaction));
+    ON_CALL(*this, GetTransactions(_))
+        .WillByDefault(Invoke(&fake_, &FakeStorageUnit::GetTransactions));
     ON_CALL(*this, PollRecentTx(_)).WillByDefault(Invoke(&fake_, &FakeStorageUnit::PollRecentTx));
   }
 
@@ -66,6 +68,7 @@ public:
 
   MOCK_METHOD1(AddTransaction, void(fetch::chain::Transaction const &));
   MOCK_METHOD2(GetTransaction, bool(fetch::Digest const &, fetch::chain::Transaction &));
+  MOCK_METHOD1(GetTransactions, TransactionList(fetch::DigestSet const &));
   MOCK_METHOD1(HasTransaction, bool(fetch::byte_array::ConstByteArray const &));
   MOCK_METHOD1(IssueCallForMissingTxs, void(fetch::DigestSet const &));
 
@@ -17,6 +17,8 @@
 //------------------------------------------------------------------------------
 
 #include "block_configs.hpp"
+#include "chain/transaction_builder.hpp"
+#include "crypto/ecdsa.hpp"
 #include "ledger/chaincode/contract_context.hpp"
 #include "ledger/execution_manager.hpp"
 #include "ledger/transaction_status_cache.hpp"
@@ -29,7 +31,9 @@
 #include <algorithm>
 #include <chrono>
 #include <memory>
+#include <mutex>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace {
@@ -186,6 +190,106 @@ TEST_P(ExecutionManagerTests, DISABLED_CheckIncrementalExecution)
   manager_->Stop();
 }
 
+TEST_P(ExecutionManagerTests, CheckBlockTransactionsArePrefetched)
+{
+  using ::testing::_;
+  using ::testing::AtLeast;
+  using ::testing::Invoke;
+  using fetch::chain::TransactionBuilder;
+  using fetch::chain::TransactionLayout;
+  using TransactionPtr  = MockStorageUnit::TransactionPtr;
+  using TransactionList = MockStorageUnit::TransactionList;
+
+  BlockConfig const &config = GetParam();
+
+  // generate a block with the desired lane and slice configuration
+  auto block = TestBlock::Generate(config.log2_lanes, config.slices, __LINE__);
+
+  // replace the generated digests with those of real transactions, so that the storage unit can
+  // serve them
+  fetch::crypto::ECDSASigner const signer{};
+  fetch::chain::Address const      address{signer.identity()};
+
+  std::unordered_map<fetch::Digest, TransactionPtr> transactions{};
+  std::size_t                                       later_slice_transactions{0};
+  for (std::size_t slice_index = 0; slice_index < block.block.slices.size(); ++slice_index)
+  {
+    for (auto &layout : block.block.slices[slice_index])
+    {
+      auto tx = TransactionBuilder()
+                    .From(address)
+                    .ValidUntil(100)
+                    .Counter(transactions.size())
+                    .Signer(signer.identity())
+                    .Seal()
+                    .Sign(signer)
+                    .Build();
+
+      layout = TransactionLayout{tx->digest(), layout.mask(), layout.charge_rate(),
+                                 layout.valid_from(), layout.valid_until()};
+      transactions.emplace(tx->digest(), std::move(tx));
+
+      if (slice_index > 0)
+      {
+        ++later_slice_transactions;
+      }
+    }
+  }
+
+  // serve the transactions requested from the storage unit, recording the requests
+  std::mutex       requested_lock;
+  fetch::DigestSet requested{};
+  EXPECT_CALL(*mock_storage_, GetTransactions(_))
+      .Times(AtLeast(1))
+      .WillRepeatedly(Invoke(
+          [&requested_lock, &requested, &transactions](fetch::DigestSet const &digests) {
+            std::lock_guard<std::mutex> lock(requested_lock);
+            requested.insert(digests.begin(), digests.end());
+
+            TransactionList txs{};
+            for (auto const &digest : digests)
+            {
+              txs.emplace_back(transactions.at(digest));
+            }
+
+            return txs;
+          }));
+
+  // an executor retrieving a transaction itself waits for the prefetch to have completed, so that
+  // every slice after the first one is dispatched with a populated cache
+  auto *manager = manager_.get();
+  for (auto &executor : executors_)
+  {
+    executor->SetRetrievalHook([manager](fetch::Digest const &) {
+      for (std::size_t i = 0; (i < 500) && (manager->completed_prefetches() == 0); ++i)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+      }
+    });
+  }
+
+  manager_->Start();
+
+  ASSERT_EQ(manager_->Execute(block.block), ExecutionManager::ScheduleStatus::SCHEDULED);
+  ASSERT_TRUE(WaitUntilExecutionComplete(static_cast<std::size_t>(block.num_transactions)));
+  ASSERT_EQ(GetNumExecutedTransaction(), block.num_transactions);
+
+  manager_->Stop();
+
+  EXPECT_EQ(manager_->completed_prefetches(), 1);
+  EXPECT_EQ(requested.size(), transactions.size());
+
+  std::size_t prefetched_executions{0};
+  for (auto const &executor : executors_)
+  {
+    prefetched_executions += executor->GetNumPrefetchedExecutions();
+  }
+
+  // every transaction handed to an executor was counted as a hit
+  EXPECT_GE(prefetched_executions, later_slice_transactions);
+  EXPECT_EQ(manager_->prefetch_hits(), prefetched_executions);
+}
+
 INSTANTIATE_TEST_CASE_P(Param, ExecutionManagerTests,
                         ::testing::ValuesIn(BlockConfig::REDUCED_SET), );
 
@@ -17,12 +17,15 @@
 //
 //------------------------------------------------------------------------------
 
+#include "chain/transaction.hpp"
 #include "core/digest.hpp"
 #include "ledger/executor_interface.hpp"
 #include "ledger/storage_unit/storage_unit_interface.hpp"
 #include "storage/resource_mapper.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <functional>
 #include <sstream>
 #include <thread>
 #include <utility>
@@ -45,23 +48,29 @@ public:
     SliceIndex slice;
     BitVector  shards;
     Timepoint  timestamp;
+    bool       prefetched;  ///< Whether the transaction was handed to the executor
   };
 
   using HistoryElementCache = std::vector<HistoryElement>;
   using StorageInterface    = fetch::ledger::StorageInterface;
+  using RetrievalHook       = std::function<void(Digest const &)>;
 
   Result Execute(Digest const &digest, BlockIndex block, SliceIndex slice,
                  BitVector const &shards) override
   {
-    history_.emplace_back(HistoryElement{digest, block, slice, shards, Clock::now()});
-
-    // if we have a state then make some changes to it
-    if (state_ != nullptr)
+    // stands in for the transaction lookup made by a real executor
+    if (retrieval_hook_)
     {
-      state_->Set(fetch::storage::ResourceAddress{digest}, "executed");
+      retrieval_hook_(digest);
     }
 
-    return {Status::SUCCESS};
+    return Record(digest, block, slice, shards, false);
+  }
+
+  Result ExecuteTransaction(TransactionPtr const &tx, BlockIndex block, SliceIndex slice,
+                            BitVector const &shards) override
+  {
+    return Record(tx->digest(), block, slice, shards, true);
   }
 
   void SettleFees(Address const &miner, BlockIndex block, TokenAmount amount,
@@ -79,6 +88,13 @@ public:
     return history_.size();
   }
 
+  std::size_t GetNumPrefetchedExecutions() const
+  {
+    return static_cast<std::size_t>(
+        std::count_if(history_.begin(), history_.end(),
+                      [](HistoryElement const &element) { return element.prefetched; }));
+  }
+
   void CollectHistory(HistoryElementCache &history)
   {
     history_.reserve(history.size() + history_.size());  // do the allocation
@@ -95,7 +111,27 @@ public:
     state_ = nullptr;
   }
 
+  void SetRetrievalHook(RetrievalHook hook)
+  {
+    retrieval_hook_ = std::move(hook);
+  }
+
 private:
+  Result Record(Digest const &digest, BlockIndex block, SliceIndex slice, BitVector const &shards,
+                bool prefetched)
+  {
+    history_.emplace_back(HistoryElement{digest, block, slice, shards, Clock::now(), prefetched});
+
+    // if we have a state then make some changes to it
+    if (state_ != nullptr)
+    {
+      state_->Set(fetch::storage::ResourceAddress{digest}, "executed");
+    }
+
+    return {Status::SUCCESS};
+  }
+
   StorageInterface *  state_ = nullptr;
   HistoryElementCache history_;
+  RetrievalHook       retrieval_hook_;
 };
@@ -36,11 +36,15 @@ public:
     using ::testing::Invoke;
 
     ON_CALL(*this, Execute(_, _, _, _)).WillByDefault(Invoke(&fake_, &FakeExecutor::Execute));
+    ON_CALL(*this, ExecuteTransaction(_, _, _, _))
+        .WillByDefault(Invoke(&fake_, &FakeExecutor::ExecuteTransaction));
     ON_CALL(*this, SettleFees(_, _, _, _, _))
         .WillByDefault(Invoke(&fake_, &FakeExecutor::SettleFees));
   }
 
   MOCK_METHOD4(Execute, Result(Digest const &, BlockIndex, SliceIndex, BitVector const &));
+  MOCK_METHOD4(ExecuteTransaction,
+               Result(TransactionPtr const &, BlockIndex, SliceIndex, BitVector const &));
   MOCK_METHOD5(SettleFees,
                void(Address const &, BlockIndex, TokenAmount, uint32_t, StakeUpdateEvents const &));
 
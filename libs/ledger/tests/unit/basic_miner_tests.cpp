@@ -31,6 +31,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <random>
 
@@ -111,6 +112,7 @@ TEST_P(BasicMinerTests, SimpleExample)
   MainChain dummy{MainChain::Mode::IN_MEMORY_DB};
 
   block.previous_hash = dummy.GetHeaviestBlockHash();
+  block.block_number  = 1;
 
   miner_->GenerateBlock(block, NUM_LANES, NUM_SLICES, dummy);
 
@@ -149,6 +151,7 @@ TEST_P(BasicMinerTests, RejectReplayedTransactions)
     Block block;
 
     block.previous_hash = chain.GetHeaviestBlockHash();
+    block.block_number  = chain.GetHeaviestBlock()->block_number + 1;
 
     miner_->GenerateBlock(block, NUM_LANES, NUM_SLICES, chain);
 
@@ -195,6 +198,7 @@ TEST_P(BasicMinerTests, RejectReplayedTransactions)
     Block block;
 
     block.previous_hash = chain.GetHeaviestBlockHash();
+    block.block_number  = chain.GetHeaviestBlock()->block_number + 1;
 
     miner_->GenerateBlock(block, NUM_LANES, NUM_SLICES, chain);
 
@@ -233,4 +237,72 @@ TEST_P(BasicMinerTests, RejectReplayedTransactions)
   }
 }
 
+TEST_P(BasicMinerTests, PacksHighestFeesFirst)
+{
+  std::size_t const num_tx = GetParam() + (2 * NUM_SLICES);
+
+  // every transaction uses all the lanes, so only one of them will fit in each slice
+  BitVector mask{NUM_LANES};
+  mask.SetAllOne();
+
+  for (std::size_t i = 0; i < num_tx; ++i)
+  {
+    auto const tx = generator_(0);
+
+    // alternate between low and high fees so that arrival order does not match fee order
+    uint64_t const charge_rate = ((i % 2) == 0) ? i : (1000 + i);
+
+    miner_->EnqueueTransaction(
+        TransactionLayout{tx.digest(), mask, charge_rate, tx.valid_from(), tx.valid_until()});
+  }
+
+  MainChain chain{MainChain::Mode::IN_MEMORY_DB};
+
+  Block block;
+  block.previous_hash = chain.GetHeaviestBlockHash();
+  block.block_number  = 1;
+
+  miner_->GenerateBlock(block, NUM_LANES, NUM_SLICES, chain);
+
+  ASSERT_EQ(block.slices.size(), std::size_t{NUM_SLICES});
+  EXPECT_EQ(miner_->GetBacklog(), num_tx - NUM_SLICES);
+
+  uint64_t previous_charge_rate = std::numeric_limits<uint64_t>::max();
+  for (auto const &slice : block.slices)
+  {
+    ASSERT_EQ(slice.size(), 1u);
+
+    // the slices are filled in decreasing order of fee
+    auto const charge_rate = slice.front().charge_rate();
+    EXPECT_LT(charge_rate, previous_charge_rate);
+    previous_charge_rate = charge_rate;
+  }
+
+  // all of the packed transactions are high fee ones
+  EXPECT_GE(previous_charge_rate, 1000u);
+}
+
+TEST_P(BasicMinerTests, PendingTransactionsAreRetained)
+{
+  std::size_t const num_tx = GetParam();
+
+  PopulateWithTransactions(num_tx);
+
+  MainChain chain{MainChain::Mode::IN_MEMORY_DB};
+
+  // none of the generated transactions are valid until block 1
+  Block block;
+  block.previous_hash = chain.GetHeaviestBlockHash();
+  block.block_number  = 0;
+
+  miner_->GenerateBlock(block, NUM_LANES, NUM_SLICES, chain);
+
+  for (auto const &slice : block.slices)
+  {
+    EXPECT_TRUE(slice.empty());
+  }
+
+  EXPECT_EQ(miner_->GetBacklog(), num_tx);
+}
+
 INSTANTIATE_TEST_CASE_P(ParamBased, BasicMinerTests, ::testing::Values(10, 20), );
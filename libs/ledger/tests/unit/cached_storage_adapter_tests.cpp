@@ -29,7 +29,15 @@ using fetch::ledger::StorageInterface;
 using fetch::storage::ResourceAddress;
 using fetch::storage::Document;
 
+using testing::ElementsAre;
+using testing::Pair;
 using testing::Return;
+using testing::UnorderedElementsAre;
+using testing::_;
+
+using Documents         = StorageInterface::Documents;
+using KeyValues         = StorageInterface::KeyValues;
+using ResourceAddresses = StorageInterface::ResourceAddresses;
 
 class MockStorage : public StorageInterface
 {
@@ -40,6 +48,8 @@ public:
   MOCK_METHOD1(Lock, bool(ShardIndex));
   MOCK_METHOD1(Unlock, bool(ShardIndex));
   MOCK_METHOD0(Reset, void());
+  MOCK_CONST_METHOD1(GetMany, Documents(ResourceAddresses const &));
+  MOCK_METHOD1(SetMany, void(KeyValues const &));
 };
 
 class CachedStorageAdapterTests : public testing::Test
@@ -99,4 +109,53 @@ TEST_F(CachedStorageAdapterTests, Get_does_not_cache_result_if_retrieval_from_st
   cached_storage_adapter.Get(key);
 }
 
+TEST_F(CachedStorageAdapterTests, Flush_writes_all_modified_entries_in_a_single_batch)
+{
+  ResourceAddress const other_key{"other key"};
+
+  EXPECT_CALL(mock_storage, Set(_, _)).Times(0);
+  EXPECT_CALL(mock_storage,
+              SetMany(UnorderedElementsAre(Pair(key, "value"), Pair(other_key, "other value"))))
+      .Times(1);
+
+  cached_storage_adapter.Set(key, "value");
+  cached_storage_adapter.Set(other_key, "other value");
+  cached_storage_adapter.Flush();
+
+  // nothing has been modified since the last flush
+  cached_storage_adapter.Flush();
+}
+
+TEST_F(CachedStorageAdapterTests, GetMany_only_retrieves_uncached_entries_from_storage)
+{
+  ResourceAddress const cached_key{"cached key"};
+  ResourceAddress const missing_key{"missing key"};
+
+  Document doc;
+  doc.document = "stored";
+
+  Document missing_doc;
+  missing_doc.failed = true;
+
+  EXPECT_CALL(mock_storage, GetMany(ElementsAre(key, missing_key)))
+      .WillOnce(Return(Documents{doc, missing_doc}));
+
+  cached_storage_adapter.Set(cached_key, "cached");
+
+  auto const docs = cached_storage_adapter.GetMany({key, cached_key, missing_key});
+  ASSERT_EQ(docs.size(), 3u);
+
+  EXPECT_FALSE(docs[0].failed);
+  EXPECT_EQ(docs[0].document, "stored");
+  EXPECT_FALSE(docs[1].failed);
+  EXPECT_EQ(docs[1].document, "cached");
+  EXPECT_TRUE(docs[2].failed);
+
+  // the successfully retrieved entry is now cached, the failed one is not
+  EXPECT_CALL(mock_storage, GetMany(ElementsAre(missing_key)))
+      .WillOnce(Return(Documents{missing_doc}));
+
+  cached_storage_adapter.GetMany({key, missing_key});
+}
+
 }  // namespace
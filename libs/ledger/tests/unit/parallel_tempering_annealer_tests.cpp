@@ -0,0 +1,201 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/random/lcg.hpp"
+#include "ledger/miner/optimisation/parallel_tempering_annealer.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace {
+
+using fetch::optimisers::ParallelTemperingAnnealer;
+using Layout    = ParallelTemperingAnnealer::Layout;
+using StateType = ParallelTemperingAnnealer::StateType;
+using CostType  = ParallelTemperingAnnealer::CostType;
+using Rng       = fetch::random::LinearCongruentialGenerator;
+
+struct Term
+{
+  std::size_t i;
+  std::size_t j;
+  CostType    value;
+};
+
+using Terms = std::vector<Term>;
+
+class ParallelTemperingAnnealerTests : public ::testing::TestWithParam<Layout>
+{
+protected:
+  /**
+   * Generate a random problem with a mixture of positive and negative terms
+   */
+  static Terms GenerateProblem(std::size_t size, double coupling_probability)
+  {
+    Rng   rng{};
+    Terms terms{};
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      terms.push_back({i, i, (rng.AsDouble() * 2.0) - 1.0});
+
+      for (std::size_t j = i + 1; j < size; ++j)
+      {
+        if (rng.AsDouble() < coupling_probability)
+        {
+          terms.push_back({i, j, (rng.AsDouble() * 2.0) - 1.0});
+        }
+      }
+    }
+
+    return terms;
+  }
+
+  static void Program(ParallelTemperingAnnealer &annealer, std::size_t size, Terms const &terms)
+  {
+    annealer.Resize(size);
+
+    for (auto const &term : terms)
+    {
+      annealer.Insert(term.i, term.j, term.value);
+    }
+  }
+
+  static CostType Evaluate(Terms const &terms, uint64_t state)
+  {
+    CostType energy{0};
+
+    for (auto const &term : terms)
+    {
+      if (((state >> term.i) & 1u) && ((state >> term.j) & 1u))
+      {
+        energy += term.value;
+      }
+    }
+
+    return energy;
+  }
+
+  static CostType BruteForceMinimum(Terms const &terms, std::size_t size)
+  {
+    CostType minimum = std::numeric_limits<CostType>::max();
+
+    for (uint64_t state = 0; state < (1ull << size); ++state)
+    {
+      minimum = std::min(minimum, Evaluate(terms, state));
+    }
+
+    return minimum;
+  }
+};
+
+TEST_P(ParallelTemperingAnnealerTests, FindsGroundStateOfSmallProblem)
+{
+  static constexpr std::size_t SIZE = 14;
+
+  auto const terms = GenerateProblem(SIZE, 0.5);
+
+  ParallelTemperingAnnealer annealer{4};
+  Program(annealer, SIZE, terms);
+  annealer.SetLayout(GetParam());
+  annealer.SetSweeps(200);
+
+  StateType  state;
+  auto const energy = annealer.FindMinimum(state);
+
+  EXPECT_EQ(annealer.is_dense(), Layout::DENSE == GetParam());
+  EXPECT_NEAR(energy, BruteForceMinimum(terms, SIZE), 1e-9);
+
+  // the reported energy must match the reported state
+  ASSERT_EQ(state.size(), SIZE);
+  EXPECT_NEAR(annealer.Energy(state), energy, 1e-9);
+}
+
+TEST_P(ParallelTemperingAnnealerTests, NormalisationPreservesEnergies)
+{
+  static constexpr std::size_t SIZE = 10;
+
+  auto terms = GenerateProblem(SIZE, 0.3);
+  for (auto &term : terms)
+  {
+    term.value *= 1000.0;
+  }
+
+  ParallelTemperingAnnealer annealer{1};
+  Program(annealer, SIZE, terms);
+  annealer.Normalise();
+  annealer.SetLayout(GetParam());
+  annealer.SetSweeps(200);
+
+  StateType  state;
+  auto const energy = annealer.FindMinimum(state);
+
+  EXPECT_NEAR(energy, BruteForceMinimum(terms, SIZE), 1e-6);
+
+  uint64_t packed_state{0};
+  for (std::size_t i = 0; i < SIZE; ++i)
+  {
+    packed_state |= static_cast<uint64_t>(state[i]) << i;
+  }
+
+  EXPECT_NEAR(Evaluate(terms, packed_state), energy, 1e-6);
+}
+
+TEST_P(ParallelTemperingAnnealerTests, ReinsertingTermReplacesIt)
+{
+  ParallelTemperingAnnealer annealer{1};
+  annealer.Resize(2);
+  annealer.SetLayout(GetParam());
+
+  annealer.Insert(0, 0, -1.0);
+  annealer.Insert(1, 1, -1.0);
+  annealer.Insert(0, 1, 5.0);
+  annealer.Insert(1, 0, 1.5);
+
+  EXPECT_DOUBLE_EQ(annealer.Energy(StateType{1, 1}), -0.5);
+  EXPECT_DOUBLE_EQ(annealer.FindMinimum(), -1.0);
+}
+
+TEST_P(ParallelTemperingAnnealerTests, StopsWhenTimeBudgetIsExhausted)
+{
+  static constexpr std::size_t SIZE = 500;
+
+  ParallelTemperingAnnealer annealer{};
+  Program(annealer, SIZE, GenerateProblem(SIZE, 0.2));
+  annealer.SetLayout(GetParam());
+  annealer.SetSweeps(std::numeric_limits<std::size_t>::max() / 2);
+  annealer.SetTimeBudget(std::chrono::milliseconds{20});
+
+  auto const start = std::chrono::steady_clock::now();
+  annealer.FindMinimum();
+  auto const duration = std::chrono::steady_clock::now() - start;
+
+  EXPECT_LT(annealer.sweeps_completed(), annealer.sweeps());
+  EXPECT_LT(duration, std::chrono::seconds{5});
+}
+
+INSTANTIATE_TEST_CASE_P(Layouts, ParallelTemperingAnnealerTests,
+                        ::testing::Values(Layout::DENSE, Layout::SPARSE), );
+
+}  // namespace
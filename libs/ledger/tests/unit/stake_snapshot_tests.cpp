@@ -17,26 +17,117 @@
 //------------------------------------------------------------------------------
 
 #include "core/random/lcg.hpp"
+#include "core/serializers/main_serializer.hpp"
 #include "crypto/identity.hpp"
 #include "ledger/consensus/stake_snapshot.hpp"
 #include "random_address.hpp"
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 namespace {
 
 using fetch::ledger::StakeSnapshot;
 using fetch::crypto::Identity;
+using fetch::serializers::MsgPackSerializer;
 
 using RNG              = fetch::random::LinearCongruentialGenerator;
 using StakeSnapshotPtr = std::unique_ptr<StakeSnapshot>;
 using StakeMap         = std::unordered_map<Identity, uint64_t>;
 using IdentitySet      = std::unordered_set<Identity>;
 
+/**
+ * The list based snapshot representation which the serialised form was defined by
+ */
+struct ListSnapshot
+{
+  using RecordPtr = std::shared_ptr<StakeSnapshot::Record>;
+
+  void UpdateStake(Identity const &identity, uint64_t stake)
+  {
+    auto it = identity_index.find(identity);
+    if (it == identity_index.end())
+    {
+      auto record = std::make_shared<StakeSnapshot::Record>(StakeSnapshot::Record{identity, stake});
+      identity_index[identity] = record;
+      stake_index.emplace_back(std::move(record));
+      total_stake += stake;
+    }
+    else if (stake == it->second->stake)
+    {
+      // no change in stake
+    }
+    else if (stake == 0)
+    {
+      total_stake -= it->second->stake;
+      identity_index.erase(it);
+      stake_index.erase(std::remove_if(stake_index.begin(), stake_index.end(),
+                                       [&identity](RecordPtr const &record) {
+                                         return record->identity == identity;
+                                       }),
+                        stake_index.end());
+    }
+    else
+    {
+      total_stake = total_stake - it->second->stake + stake;
+      it->second->stake = stake;
+    }
+  }
+
+  std::unordered_map<Identity, RecordPtr> identity_index;
+  std::vector<RecordPtr>                  stake_index;
+  uint64_t                                total_stake{0};
+};
+
+}  // namespace
+
+namespace fetch {
+namespace serializers {
+
+template <typename D>
+struct MapSerializer<ListSnapshot, D>
+{
+public:
+  using Type       = ListSnapshot;
+  using DriverType = D;
+
+  template <typename Constructor>
+  static void Serialize(Constructor &map_constructor, Type const &snapshot)
+  {
+    auto map = map_constructor(3);
+    map.Append(1, snapshot.identity_index);
+    map.Append(2, snapshot.stake_index);
+    map.Append(3, snapshot.total_stake);
+  }
+
+  template <typename MapDeserializer>
+  static void Deserialize(MapDeserializer &map, Type &snapshot)
+  {
+    map.ExpectKeyGetValue(1, snapshot.identity_index);
+    map.ExpectKeyGetValue(2, snapshot.stake_index);
+    map.ExpectKeyGetValue(3, snapshot.total_stake);
+  }
+};
+
+}  // namespace serializers
+}  // namespace fetch
+
+namespace {
+
+template <typename T>
+fetch::byte_array::ConstByteArray Serialise(T const &value)
+{
+  MsgPackSerializer serializer{};
+  serializer << value;
+  return serializer.data();
+}
+
 class StakeSnapshotTests : public ::testing::Test
 {
 protected:
@@ -166,4 +257,182 @@ TEST_F(StakeSnapshotTests, TooSmallSampleSize)
   ASSERT_EQ(pool.size(), sample->size());
 }
 
+TEST_F(StakeSnapshotTests, CopiesAreIndependent)
+{
+  auto const pool = GenerateRandomStakePool(100);
+  ASSERT_EQ(100, pool.size());
+
+  StakeSnapshot const copy{*snapshot_};
+
+  auto const &updated = pool.begin()->first;
+  snapshot_->UpdateStake(updated, pool.begin()->second + 1000);
+  snapshot_->UpdateStake(GenerateRandomIdentity(rng_), 42);
+
+  EXPECT_EQ(100, copy.size());
+  EXPECT_EQ(101, snapshot_->size());
+  EXPECT_EQ(pool.begin()->second, copy.LookupStake(updated));
+  EXPECT_EQ(pool.begin()->second + 1000, snapshot_->LookupStake(updated));
+  EXPECT_EQ(copy.total_stake() + 1042, snapshot_->total_stake());
+}
+
+TEST_F(StakeSnapshotTests, CabinetIndependentOfUpdateOrder)
+{
+  auto const pool = GenerateRandomStakePool(200);
+  ASSERT_EQ(200, pool.size());
+
+  // rebuild the same stakes through a different sequence of updates
+  std::vector<std::pair<Identity, uint64_t>> const updates{pool.begin(), pool.end()};
+
+  StakeSnapshot other{};
+  auto const    transient = GenerateRandomIdentity(rng_);
+  other.UpdateStake(transient, 1000);
+  for (auto it = updates.rbegin(); it != updates.rend(); ++it)
+  {
+    other.UpdateStake(it->first, it->second);
+  }
+  other.UpdateStake(transient, 0);
+
+  ASSERT_EQ(snapshot_->total_stake(), other.total_stake());
+
+  for (uint64_t entropy = 0; entropy < 10; ++entropy)
+  {
+    auto const reference = snapshot_->BuildCabinet(entropy, 30);
+    auto const cabinet   = other.BuildCabinet(entropy, 30);
+
+    ASSERT_EQ(30, reference->size());
+    EXPECT_EQ(*reference, *cabinet);
+  }
+}
+
+TEST_F(StakeSnapshotTests, CabinetExcludesIdentitiesWithoutStake)
+{
+  auto const staker1 = GenerateRandomIdentity(rng_);
+  auto const staker2 = GenerateRandomIdentity(rng_);
+  auto const idle1   = GenerateRandomIdentity(rng_);
+  auto const idle2   = GenerateRandomIdentity(rng_);
+
+  snapshot_->UpdateStake(idle1, 0);
+  snapshot_->UpdateStake(staker1, 100);
+  snapshot_->UpdateStake(idle2, 0);
+  snapshot_->UpdateStake(staker2, 300);
+  ASSERT_EQ(4, snapshot_->size());
+
+  for (uint64_t entropy = 0; entropy < 20; ++entropy)
+  {
+    auto const cabinet = snapshot_->BuildCabinet(entropy, 2);
+    ASSERT_EQ(2, cabinet->size());
+
+    IdentitySet const members{cabinet->begin(), cabinet->end()};
+    EXPECT_EQ(1, members.count(staker1));
+    EXPECT_EQ(1, members.count(staker2));
+  }
+}
+
+TEST_F(StakeSnapshotTests, WholePoolCabinetIsInInsertionOrder)
+{
+  auto const pool = GenerateRandomStakePool(10);
+  ASSERT_EQ(10, pool.size());
+
+  std::vector<Identity> identities{};
+  snapshot_->IterateOver([&identities](Identity const &identity, uint64_t /*stake*/) {
+    identities.emplace_back(identity);
+  });
+
+  // rebuild the snapshot in an order which differs from the identity order
+  std::reverse(identities.begin(), identities.end());
+  std::swap(identities[0], identities[4]);
+  snapshot_ = std::make_unique<StakeSnapshot>();
+  for (auto const &identity : identities)
+  {
+    snapshot_->UpdateStake(identity, 100 + pool.at(identity));
+  }
+
+  // changing a stake keeps its position, removing and adding it again moves it to the end
+  snapshot_->UpdateStake(identities[2], 10);
+  snapshot_->UpdateStake(identities[5], 0);
+  snapshot_->UpdateStake(identities[5], 50);
+  std::rotate(identities.begin() + 5, identities.begin() + 6, identities.end());
+
+  auto const cabinet = snapshot_->BuildCabinet(42, identities.size());
+  EXPECT_EQ(identities, *cabinet);
+}
+
+TEST_F(StakeSnapshotTests, SerialisedFormMatchesRecordLists)
+{
+  // enough additions and removals that the logged index changes are folded into a new base
+  ListSnapshot reference{};
+  for (std::size_t i = 0; i < 1500; ++i)
+  {
+    auto const     identity = GenerateRandomIdentity(rng_);
+    uint64_t const stake    = rng_() % MAXIMUM_SINGLE_STAKE;
+
+    snapshot_->UpdateStake(identity, stake);
+    reference.UpdateStake(identity, stake);
+
+    if (i % 5 == 4)
+    {
+      auto const removed = reference.stake_index[i % reference.stake_index.size()]->identity;
+
+      snapshot_->UpdateStake(removed, 0);
+      reference.UpdateStake(removed, 0);
+    }
+  }
+
+  // change and remove some of the stakes
+  for (std::size_t i = 0; i < 20; ++i)
+  {
+    auto const &   record   = reference.stake_index[(i * 7) % reference.stake_index.size()];
+    auto const     identity = record->identity;
+    uint64_t const stake    = (i % 4 == 0) ? 0 : rng_() % MAXIMUM_SINGLE_STAKE;
+
+    snapshot_->UpdateStake(identity, stake);
+    reference.UpdateStake(identity, stake);
+  }
+
+  EXPECT_EQ(Serialise(reference), Serialise(*snapshot_));
+}
+
+TEST_F(StakeSnapshotTests, LoadedSnapshotSerialisesAsRecordLists)
+{
+  ListSnapshot reference{};
+  for (std::size_t i = 0; i < 100; ++i)
+  {
+    auto const     identity = GenerateRandomIdentity(rng_);
+    uint64_t const stake    = rng_() % MAXIMUM_SINGLE_STAKE;
+
+    snapshot_->UpdateStake(identity, stake);
+    reference.UpdateStake(identity, stake);
+  }
+
+  // both are loaded from the same bytes, which rebuilds the identity index in the written order
+  auto const    bytes = Serialise(reference);
+  StakeSnapshot loaded{};
+  ListSnapshot  loaded_reference{};
+  {
+    MsgPackSerializer serializer{bytes};
+    serializer >> loaded;
+  }
+  {
+    MsgPackSerializer serializer{bytes};
+    serializer >> loaded_reference;
+  }
+
+  EXPECT_EQ(snapshot_->total_stake(), loaded.total_stake());
+  EXPECT_EQ(Serialise(loaded_reference), Serialise(loaded));
+
+  // and they continue to agree as stakers join and leave (the loaded record lists hold separate
+  // copies of each record, so changes to existing stakes are not compared)
+  for (std::size_t i = 0; i < 20; ++i)
+  {
+    auto const &   source   = loaded_reference.stake_index[i];
+    auto const     identity = (i % 2 == 0) ? GenerateRandomIdentity(rng_) : source->identity;
+    uint64_t const stake    = (i % 2 == 0) ? (rng_() % MAXIMUM_SINGLE_STAKE) + 1 : 0;
+
+    loaded.UpdateStake(identity, stake);
+    loaded_reference.UpdateStake(identity, stake);
+  }
+
+  EXPECT_EQ(Serialise(loaded_reference), Serialise(loaded));
+}
+
 }  // namespace
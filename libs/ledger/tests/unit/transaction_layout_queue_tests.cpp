@@ -367,4 +367,89 @@ TEST_F(TransactionLayoutQueueTests, CheckDuplicateSubSplicing)
   EXPECT_TRUE(IsIn(other, tx4));
 }
 
+TEST_F(TransactionLayoutQueueTests, CheckRemovalAfterSplice)
+{
+  auto const tx1 = generator_(2);
+  auto const tx2 = generator_(2);
+  auto const tx3 = generator_(2);
+
+  TransactionLayoutQueue other;
+  EXPECT_TRUE(other.Add(tx1));
+  EXPECT_TRUE(other.Add(tx2));
+  EXPECT_TRUE(queue_->Add(tx3));
+
+  queue_->Splice(other);
+
+  // the spliced entries must be removable from the destination queue only
+  EXPECT_FALSE(other.Remove(tx1.digest()));
+  EXPECT_TRUE(queue_->Remove(tx1.digest()));
+  EXPECT_FALSE(queue_->Remove(tx1.digest()));
+  EXPECT_TRUE(queue_->Contains(tx2.digest()));
+  EXPECT_TRUE(queue_->Contains(tx3.digest()));
+
+  EXPECT_EQ(queue_->size(), 2u);
+  EXPECT_EQ(std::distance(queue_->begin(), queue_->end()), 2);
+}
+
+TEST_F(TransactionLayoutQueueTests, CheckRemoveIf)
+{
+  auto const tx1 = generator_(2);
+  auto const tx2 = generator_(2);
+  auto const tx3 = generator_(2);
+
+  EXPECT_TRUE(queue_->Add(tx1));
+  EXPECT_TRUE(queue_->Add(tx2));
+  EXPECT_TRUE(queue_->Add(tx3));
+
+  auto const removed = queue_->RemoveIf(
+      [&tx2](auto const &layout) { return layout.charge_rate() <= tx2.charge_rate(); });
+
+  EXPECT_EQ(removed, 2u);
+  ASSERT_EQ(queue_->size(), 1u);
+  EXPECT_FALSE(queue_->Contains(tx1.digest()));
+  EXPECT_FALSE(queue_->Contains(tx2.digest()));
+  EXPECT_TRUE(IsIn(*queue_, tx3));
+
+  // the removed transactions can be added again
+  EXPECT_TRUE(queue_->Add(tx1));
+}
+
+TEST_F(TransactionLayoutQueueTests, CheckSortedMerge)
+{
+  auto const by_fee = [](auto const &a, auto const &b) { return a.charge_rate() > b.charge_rate(); };
+
+  auto const tx1 = generator_(2);
+  auto const tx2 = generator_(2);
+  auto const tx3 = generator_(2);
+  auto const tx4 = generator_(2);
+  auto const tx5 = generator_(2);
+
+  EXPECT_TRUE(queue_->Add(tx4));
+  EXPECT_TRUE(queue_->Add(tx2));
+
+  TransactionLayoutQueue other;
+  EXPECT_TRUE(other.Add(tx1));
+  EXPECT_TRUE(other.Add(tx2));
+  EXPECT_TRUE(other.Add(tx3));
+  EXPECT_TRUE(other.Add(tx5));
+  other.Sort(by_fee);
+
+  queue_->Merge(other, by_fee);
+
+  EXPECT_TRUE(other.empty());
+  ASSERT_EQ(queue_->size(), 5u);
+
+  auto it = queue_->cbegin();
+  EXPECT_EQ((it++)->digest(), tx5.digest());
+  EXPECT_EQ((it++)->digest(), tx4.digest());
+  EXPECT_EQ((it++)->digest(), tx3.digest());
+  EXPECT_EQ((it++)->digest(), tx2.digest());
+  EXPECT_EQ((it++)->digest(), tx1.digest());
+  EXPECT_EQ(it, queue_->cend());
+
+  // all the merged entries are indexed
+  EXPECT_TRUE(queue_->Remove(tx3.digest()));
+  EXPECT_EQ(queue_->size(), 4u);
+}
+
 }  // namespace
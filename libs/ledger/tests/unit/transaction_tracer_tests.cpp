@@ -0,0 +1,164 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "ledger/transaction_tracer.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using fetch::Digest;
+using fetch::ledger::TransactionTracer;
+
+using Stage     = TransactionTracer::Stage;
+using TracerPtr = std::unique_ptr<TransactionTracer>;
+
+/// Build a digest whose leading word, which decides the sampling, is the given value
+Digest CreateDigest(uint64_t value)
+{
+  fetch::byte_array::ByteArray digest;
+  digest.Resize(32);
+  for (std::size_t i = 0; i < digest.size(); ++i)
+  {
+    digest[i] = static_cast<uint8_t>(i);
+  }
+  std::memcpy(digest.pointer(), &value, sizeof(value));
+  return digest;
+}
+
+class TransactionTracerTests : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    tracer_ = std::make_unique<TransactionTracer>();
+  }
+
+  TracerPtr tracer_;
+};
+
+TEST_F(TransactionTracerTests, NothingIsRecordedWhenSamplingIsDisabled)
+{
+  EXPECT_EQ(tracer_->sample_interval(), 0u);
+
+  tracer_->Record(CreateDigest(0), Stage::RECEIVED);
+
+  EXPECT_TRUE(tracer_->Collect().empty());
+}
+
+TEST_F(TransactionTracerTests, EventsAreGroupedIntoOrderedTraces)
+{
+  tracer_->SetSampleInterval(1);
+
+  auto const first  = CreateDigest(1);
+  auto const second = CreateDigest(2);
+
+  tracer_->Record(first, Stage::RECEIVED);
+  tracer_->Record(second, Stage::RECEIVED);
+  tracer_->Record(first, Stage::VERIFIED);
+  tracer_->Record(second, Stage::VERIFIED);
+  tracer_->Record(first, Stage::EXECUTED);
+
+  auto const traces = tracer_->Collect();
+  ASSERT_EQ(traces.size(), 2u);
+
+  EXPECT_EQ(traces[0].digest, first);
+  ASSERT_EQ(traces[0].spans.size(), 3u);
+  EXPECT_EQ(traces[0].spans[0].stage, Stage::RECEIVED);
+  EXPECT_EQ(traces[0].spans[1].stage, Stage::VERIFIED);
+  EXPECT_EQ(traces[0].spans[2].stage, Stage::EXECUTED);
+  EXPECT_LE(traces[0].spans[0].timestamp, traces[0].spans[2].timestamp);
+
+  EXPECT_EQ(traces[1].digest, second);
+  EXPECT_EQ(traces[1].spans.size(), 2u);
+
+  auto const trace = tracer_->Collect(second);
+  EXPECT_EQ(trace.digest, second);
+  EXPECT_EQ(trace.spans.size(), 2u);
+
+  EXPECT_TRUE(tracer_->Collect(CreateDigest(3)).spans.empty());
+}
+
+TEST_F(TransactionTracerTests, OnlySampledTransactionsAreRecorded)
+{
+  tracer_->SetSampleInterval(4);
+
+  for (uint64_t i = 0; i < 16; ++i)
+  {
+    tracer_->Record(CreateDigest(i), Stage::STORED);
+  }
+
+  auto const traces = tracer_->Collect();
+  ASSERT_EQ(traces.size(), 4u);
+  for (auto const &trace : traces)
+  {
+    EXPECT_TRUE(tracer_->IsSampled(trace.digest));
+  }
+
+  EXPECT_FALSE(tracer_->IsSampled(CreateDigest(5)));
+}
+
+TEST_F(TransactionTracerTests, OldestEventsAreOverwritten)
+{
+  tracer_->SetSampleInterval(1);
+
+  std::size_t const extra = 100;
+  for (uint64_t i = 0; i < TransactionTracer::CAPACITY + extra; ++i)
+  {
+    tracer_->Record(CreateDigest(i), Stage::QUEUED);
+  }
+
+  auto const traces = tracer_->Collect();
+  ASSERT_EQ(traces.size(), TransactionTracer::CAPACITY);
+  EXPECT_EQ(traces.front().digest, CreateDigest(extra));
+  EXPECT_EQ(traces.back().digest, CreateDigest(TransactionTracer::CAPACITY + extra - 1));
+}
+
+TEST_F(TransactionTracerTests, ConcurrentRecordingKeepsEveryEvent)
+{
+  tracer_->SetSampleInterval(1);
+
+  std::size_t const        num_threads = 4;
+  std::size_t const        per_thread  = 1000;
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([this, t]() {
+      for (uint64_t i = 0; i < per_thread; ++i)
+      {
+        tracer_->Record(CreateDigest((t * per_thread) + i), Stage::SCHEDULED);
+      }
+    });
+  }
+
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  EXPECT_EQ(tracer_->Collect().size(), num_threads * per_thread);
+}
+
+}  // namespace
@@ -0,0 +1,174 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/random/lcg.hpp"
+#include "math/clustering/hnsw_index.hpp"
+#include "math/clustering/knn.hpp"
+#include "math/distance/euclidean.hpp"
+#include "math/tensor.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+namespace {
+
+using ArrayType = fetch::math::Tensor<float>;
+using SizeType  = fetch::math::SizeType;
+using Index     = fetch::math::clustering::HNSWIndex<ArrayType>;
+
+constexpr SizeType DIMENSIONS    = 32;
+constexpr SizeType K             = 10;
+constexpr SizeType NUM_QUERIES   = 64;
+constexpr SizeType RECALL_SAMPLE = 32;
+
+/**
+ * Clustered data, which is closer to real embeddings than uniform noise. The cluster centres are
+ * shared between seeds so that queries follow the distribution of the data
+ */
+ArrayType GenerateData(SizeType num_points, uint64_t seed)
+{
+  static constexpr SizeType NUM_CLUSTERS = 20;
+
+  fetch::random::LinearCongruentialGenerator rng;
+
+  std::vector<float> centres(NUM_CLUSTERS * DIMENSIONS);
+  for (auto &value : centres)
+  {
+    value = static_cast<float>(rng.AsDouble() * 10.0);
+  }
+
+  rng.Seed(seed);
+
+  ArrayType data({num_points, DIMENSIONS});
+  for (SizeType i = 0; i < num_points; ++i)
+  {
+    SizeType const cluster = rng() % NUM_CLUSTERS;
+    for (SizeType d = 0; d < DIMENSIONS; ++d)
+    {
+      data.At(i, d) =
+          centres[(cluster * DIMENSIONS) + d] + static_cast<float>(rng.AsDouble() - 0.5);
+    }
+  }
+
+  return data;
+}
+
+std::vector<ArrayType> Rows(ArrayType const &data)
+{
+  std::vector<ArrayType> rows;
+  for (SizeType i = 0; i < data.shape().at(0); ++i)
+  {
+    ArrayType row({1, DIMENSIONS});
+    for (SizeType d = 0; d < DIMENSIONS; ++d)
+    {
+      row.At(0, d) = data.At(i, d);
+    }
+    rows.push_back(std::move(row));
+  }
+
+  return rows;
+}
+
+void BM_KNN_BruteForce(benchmark::State &state)
+{
+  auto const data    = GenerateData(static_cast<SizeType>(state.range(0)), 1);
+  auto const queries = Rows(GenerateData(NUM_QUERIES, 2));
+
+  SizeType q = 0;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(
+        fetch::math::clustering::KNN<ArrayType, fetch::math::distance::Euclidean>(
+            data, queries[q++ % NUM_QUERIES], K));
+  }
+
+  state.counters["QPS"] = benchmark::Counter(static_cast<double>(state.iterations()),
+                                             benchmark::Counter::kIsRate);
+}
+
+void BM_KNN_HNSW(benchmark::State &state)
+{
+  auto const data    = GenerateData(static_cast<SizeType>(state.range(0)), 1);
+  auto const queries = Rows(GenerateData(NUM_QUERIES, 2));
+  auto const ef      = static_cast<SizeType>(state.range(1));
+
+  Index index{DIMENSIONS};
+  index.InsertRows(data);
+  index.SetEfSearch(ef);
+
+  SizeType q = 0;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(fetch::math::clustering::KNN(index, queries[q++ % NUM_QUERIES], K));
+  }
+
+  // recall against the exact neighbours of a sample of the queries
+  SizeType found = 0;
+  for (SizeType i = 0; i < RECALL_SAMPLE; ++i)
+  {
+    std::set<SizeType> expected;
+    for (auto const &neighbour :
+         fetch::math::clustering::KNN<ArrayType, fetch::math::distance::Euclidean>(
+             data, queries[i], K))
+    {
+      expected.insert(neighbour.first);
+    }
+
+    for (auto const &neighbour : index.Search(queries[i], K))
+    {
+      found += expected.count(neighbour.first);
+    }
+  }
+
+  state.counters["QPS"] = benchmark::Counter(static_cast<double>(state.iterations()),
+                                             benchmark::Counter::kIsRate);
+  state.counters["Recall"] =
+      static_cast<double>(found) / static_cast<double>(RECALL_SAMPLE * K);
+}
+
+void BM_HNSW_Insert(benchmark::State &state)
+{
+  auto const data = GenerateData(static_cast<SizeType>(state.range(0)), 1);
+
+  for (auto _ : state)
+  {
+    Index index{DIMENSIONS};
+    index.InsertRows(data);
+    benchmark::DoNotOptimize(index.size());
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_KNN_BruteForce)->Arg(1000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_KNN_HNSW)
+    ->Args({1000, 10})
+    ->Args({1000, 50})
+    ->Args({10000, 10})
+    ->Args({10000, 50})
+    ->Args({10000, 200})
+    ->Args({50000, 10})
+    ->Args({50000, 50})
+    ->Args({50000, 200})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_HNSW_Insert)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -18,6 +18,7 @@
 //------------------------------------------------------------------------------
 
 #include "math/fundamental_operators.hpp"
+#include "math/meta/math_type_traits.hpp"
 #include "math/standard_functions/exp.hpp"
 
 namespace fetch {
@@ -30,7 +31,60 @@ namespace math {
  * @param ret
  */
 template <typename ArrayType>
-void Sigmoid(ArrayType const &t, ArrayType &ret)
+meta::IfIsMathFixedPointArray<ArrayType, void> Sigmoid(ArrayType const &t, ArrayType &ret)
+{
+  using Type = typename ArrayType::Type;
+
+  if (&t == &ret)
+  {
+    ArrayType const input = t.Copy();
+    Sigmoid(input, ret);
+    return;
+  }
+
+  Type zero{0};
+  Type one{1};
+  Type min_one{-1};
+
+  // the exponentials are evaluated for the whole array at once, which vectorises them
+  auto array_it = t.cbegin();
+  auto rit      = ret.begin();
+  while (array_it.is_valid())
+  {
+    if (*array_it >= zero)
+    {
+      Multiply(min_one, *array_it, *rit);
+    }
+    else
+    {
+      *rit = *array_it;
+    }
+    ++array_it;
+    ++rit;
+  }
+
+  Exp(ret, ret);
+
+  array_it = t.cbegin();
+  rit      = ret.begin();
+  while (array_it.is_valid())
+  {
+    if (*array_it >= zero)
+    {
+      Add(*rit, one, *rit);
+      Divide(one, *rit, *rit);
+    }
+    else
+    {
+      Divide(*rit, *rit + one, *rit);
+    }
+    ++array_it;
+    ++rit;
+  }
+}
+
+template <typename ArrayType>
+meta::IfIsMathNonFixedPointArray<ArrayType, void> Sigmoid(ArrayType const &t, ArrayType &ret)
 {
   using Type = typename ArrayType::Type;
 
@@ -47,15 +47,24 @@ void Softmax1DImplementation(ArrayType1 const &array, ArrayType2 &ret)
 
   auto it1 = array.begin();
   auto it2 = ret.begin();
-  auto sum = Type(0);
   while (it1.is_valid())
   {
-    *it2 = Exp(*it1 - array_max);
-    sum += *it2;
+    *it2 = *it1 - array_max;
     ++it2;
     ++it1;
   }
 
+  // exponentiate the whole array at once, which vectorises fixed point exponentials
+  Exp(ret, ret);
+
+  auto sum    = Type(0);
+  auto sum_it = ret.cbegin();
+  while (sum_it.is_valid())
+  {
+    sum += *sum_it;
+    ++sum_it;
+  }
+
   auto it3 = ret.begin();  // TODO (private 855): Fix implicitly deleted copy const. for iterator
   while (it3.is_valid())
   {
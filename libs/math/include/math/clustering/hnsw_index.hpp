@@ -0,0 +1,775 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/mutex.hpp"
+#include "core/random/lcg.hpp"
+#include "core/serializers/group_definitions.hpp"
+#include "math/base_types.hpp"
+#include "math/standard_functions/sqrt.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <shared_mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace fetch {
+namespace math {
+namespace clustering {
+
+/**
+ * Approximate nearest neighbour index over the rows of a tensor, based on hierarchical navigable
+ * small world graphs, see: https://arxiv.org/abs/1603.09320
+ *
+ * Every vector is a node in a stack of proximity graphs. The upper layers hold exponentially fewer
+ * nodes and are used to quickly descend towards the region of the query, where a best first search
+ * of the bottom layer finds the nearest neighbours. Queries take O(log N) distance evaluations
+ * instead of the O(N) of a brute force scan.
+ *
+ * Vectors can be inserted at any time and are identified by the order in which they were inserted.
+ * Removed vectors are tombstoned: they remain in the graph to keep it navigable but are never
+ * returned. Any number of queries can run concurrently with each other, insertions and removals
+ * take an exclusive lock.
+ *
+ * @tparam ArrayType the tensor type of the vectors
+ */
+template <typename ArrayType>
+class HNSWIndex
+{
+public:
+  using DataType   = typename ArrayType::Type;
+  using SizeType   = fetch::math::SizeType;
+  using Neighbour  = std::pair<SizeType, DataType>;
+  using Neighbours = std::vector<Neighbour>;
+
+  enum class Metric : uint8_t
+  {
+    EUCLIDEAN,  ///< Euclidean distance, as distance::Euclidean
+    COSINE      ///< One minus the cosine similarity, as distance::Cosine
+  };
+
+  static constexpr SizeType DEFAULT_MAX_CONNECTIONS = 16;
+  static constexpr SizeType DEFAULT_EF_CONSTRUCTION = 100;
+  static constexpr SizeType DEFAULT_EF_SEARCH       = 50;
+
+  HNSWIndex() = default;
+
+  /**
+   * @param dimensions number of features of every vector
+   * @param metric the distance between vectors
+   * @param max_connections number of neighbours of a node in the upper layers, twice as many are
+   * kept in the bottom layer. Higher values improve recall at the cost of memory and insert time
+   * @param ef_construction size of the candidate list used to find the neighbours of new nodes
+   */
+  explicit HNSWIndex(SizeType dimensions, Metric metric = Metric::EUCLIDEAN,
+                     SizeType max_connections = DEFAULT_MAX_CONNECTIONS,
+                     SizeType ef_construction = DEFAULT_EF_CONSTRUCTION)
+    : dimensions_(dimensions)
+    , metric_(metric)
+    , max_connections_(max_connections)
+    , ef_construction_(ef_construction)
+  {
+    if ((dimensions == 0) || (max_connections < 2))
+    {
+      throw std::invalid_argument("HNSWIndex requires at least one dimension and two connections");
+    }
+  }
+
+  HNSWIndex(HNSWIndex const &) = delete;
+  HNSWIndex &operator=(HNSWIndex const &) = delete;
+
+  SizeType Insert(ArrayType const &vector);
+  void     InsertRows(ArrayType const &array);
+  void     Remove(SizeType id);
+
+  Neighbours Search(ArrayType const &query, SizeType k) const;
+  Neighbours Search(ArrayType const &query, SizeType k, SizeType ef) const;
+
+  bool IsRemoved(SizeType id) const;
+
+  /**
+   * Sets the default size of the candidate list of queries, which trades speed for recall
+   */
+  void SetEfSearch(SizeType ef_search)
+  {
+    ef_search_ = ef_search;
+  }
+
+  /**
+   * @return the number of vectors which have been inserted and not removed
+   */
+  SizeType size() const
+  {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    return levels_.size() - num_removed_;
+  }
+
+  SizeType dimensions() const
+  {
+    return dimensions_;
+  }
+
+  Metric metric() const
+  {
+    return metric_;
+  }
+
+  template <typename T, typename D>
+  friend struct serializers::MapSerializer;
+
+private:
+  static constexpr SizeType NONE = std::numeric_limits<SizeType>::max();
+
+  using Candidate    = std::pair<DataType, SizeType>;
+  using MaxHeap      = std::priority_queue<Candidate>;
+  using MinHeap      = std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>>;
+  using Links        = std::vector<SizeType>;
+  using LayerLinks   = std::vector<Links>;
+  using VisitedMarks = std::vector<uint32_t>;
+
+  /**
+   * Marks the nodes visited by a search. Marks are tagged with the generation of the search so
+   * that the list does not have to be cleared between searches
+   */
+  struct VisitedList
+  {
+    VisitedMarks marks;
+    uint32_t     generation{0};
+  };
+
+  using VisitedListPtr = std::unique_ptr<VisitedList>;
+
+  DataType const *Vector(SizeType id) const
+  {
+    return vectors_.data() + (id * dimensions_);
+  }
+
+  /**
+   * Euclidean distances are kept squared until they are reported, cosine distances are computed
+   * on normalised vectors
+   */
+  DataType Distance(DataType const *a, DataType const *b) const
+  {
+    DataType sum{0};
+    if (Metric::COSINE == metric_)
+    {
+      for (SizeType d{0}; d < dimensions_; ++d)
+      {
+        sum += a[d] * b[d];
+      }
+
+      return DataType{1} - sum;
+    }
+
+    for (SizeType d{0}; d < dimensions_; ++d)
+    {
+      DataType const diff = a[d] - b[d];
+      sum += diff * diff;
+    }
+
+    return sum;
+  }
+
+  DataType ReportedDistance(DataType const &distance) const
+  {
+    return (Metric::EUCLIDEAN == metric_) ? fetch::math::Sqrt(distance) : distance;
+  }
+
+  template <typename Iterable>
+  std::vector<DataType> Prepare(Iterable const &vector) const;
+
+  SizeType RandomLevel();
+
+  SizeType MaxConnections(SizeType level) const
+  {
+    return (level == 0) ? (max_connections_ * 2) : max_connections_;
+  }
+
+  VisitedListPtr AcquireVisitedList() const;
+  void           ReleaseVisitedList(VisitedListPtr visited) const;
+
+  SizeType GreedySearch(DataType const *query, SizeType entry_point, SizeType level) const;
+  MaxHeap  SearchLayer(DataType const *query, std::vector<SizeType> const &entry_points,
+                       SizeType ef, SizeType level, bool skip_removed) const;
+
+  Links SelectNeighbours(MaxHeap candidates, SizeType max_neighbours) const;
+  void  Connect(SizeType id, SizeType level, Links const &neighbours);
+  void  InsertVector(std::vector<DataType> vector);
+
+  SizeType                dimensions_{0};
+  Metric                  metric_{Metric::EUCLIDEAN};
+  SizeType                max_connections_{DEFAULT_MAX_CONNECTIONS};
+  SizeType                ef_construction_{DEFAULT_EF_CONSTRUCTION};
+  SizeType                ef_search_{DEFAULT_EF_SEARCH};
+  std::vector<DataType>   vectors_;  ///< [num_nodes x dimensions] row major vectors
+  std::vector<SizeType>   levels_;   ///< The top layer of each node
+  std::vector<LayerLinks> links_;    ///< [num_nodes x (level + 1)] neighbours of each node
+  std::vector<uint8_t>    removed_;  ///< Tombstones of removed nodes
+  SizeType                num_removed_{0};
+  SizeType                entry_point_{NONE};
+  SizeType                max_level_{0};
+
+  fetch::random::LinearCongruentialGenerator rng_;
+
+  mutable std::shared_timed_mutex     mutex_;
+  mutable Mutex                       visited_lists_mutex_;
+  mutable std::vector<VisitedListPtr> visited_lists_;
+};
+
+/**
+ * Inserts a vector into the index
+ * @param vector tensor holding dimensions() values, e.g. a row of a data set
+ * @return the id of the vector, which is the number of vectors inserted before it
+ */
+template <typename ArrayType>
+typename HNSWIndex<ArrayType>::SizeType HNSWIndex<ArrayType>::Insert(ArrayType const &vector)
+{
+  if (vector.size() != dimensions_)
+  {
+    throw std::invalid_argument("HNSWIndex vector size does not match the index dimensions");
+  }
+
+  auto prepared = Prepare(vector);
+
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  InsertVector(std::move(prepared));
+
+  return levels_.size() - 1;
+}
+
+/**
+ * Inserts every row of an array in order
+ * @param array array of shape # data points X # feature dimensions
+ */
+template <typename ArrayType>
+void HNSWIndex<ArrayType>::InsertRows(ArrayType const &array)
+{
+  if ((array.shape().size() != 2) || (array.shape().at(1) != dimensions_))
+  {
+    throw std::invalid_argument("HNSWIndex array shape does not match the index dimensions");
+  }
+
+  std::vector<DataType> row(dimensions_);
+
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  for (SizeType i{0}; i < array.shape().at(0); ++i)
+  {
+    for (SizeType d{0}; d < dimensions_; ++d)
+    {
+      row[d] = array.At(i, d);
+    }
+
+    InsertVector(Prepare(row));
+  }
+}
+
+/**
+ * Removes a vector, which will no longer be returned by queries
+ * @param id the id returned when the vector was inserted
+ */
+template <typename ArrayType>
+void HNSWIndex<ArrayType>::Remove(SizeType id)
+{
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+
+  if (id >= removed_.size())
+  {
+    throw std::out_of_range("HNSWIndex can not remove unknown vector");
+  }
+
+  if (removed_[id] == 0)
+  {
+    removed_[id] = 1;
+    ++num_removed_;
+  }
+}
+
+template <typename ArrayType>
+bool HNSWIndex<ArrayType>::IsRemoved(SizeType id) const
+{
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  return (id >= removed_.size()) || (removed_[id] != 0);
+}
+
+/**
+ * Finds the approximate k nearest neighbours of a vector
+ * @param query tensor holding dimensions() values
+ * @param k number of neighbours to find
+ * @return pairs of (id, distance) of the neighbours, nearest first
+ */
+template <typename ArrayType>
+typename HNSWIndex<ArrayType>::Neighbours HNSWIndex<ArrayType>::Search(ArrayType const &query,
+                                                                       SizeType         k) const
+{
+  return Search(query, k, ef_search_);
+}
+
+/**
+ * Finds the approximate k nearest neighbours of a vector
+ * @param query tensor holding dimensions() values
+ * @param k number of neighbours to find
+ * @param ef size of the candidate list, larger values give better recall for slower queries
+ * @return pairs of (id, distance) of the neighbours, nearest first
+ */
+template <typename ArrayType>
+typename HNSWIndex<ArrayType>::Neighbours HNSWIndex<ArrayType>::Search(ArrayType const &query,
+                                                                       SizeType         k,
+                                                                       SizeType         ef) const
+{
+  if (query.size() != dimensions_)
+  {
+    throw std::invalid_argument("HNSWIndex query size does not match the index dimensions");
+  }
+
+  auto const prepared = Prepare(query);
+
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+  Neighbours neighbours;
+  if ((NONE == entry_point_) || (k == 0))
+  {
+    return neighbours;
+  }
+
+  SizeType entry_point = entry_point_;
+  for (SizeType level = max_level_; level > 0; --level)
+  {
+    entry_point = GreedySearch(prepared.data(), entry_point, level);
+  }
+
+  MaxHeap results = SearchLayer(prepared.data(), {entry_point}, std::max(ef, k), 0, true);
+  while (results.size() > k)
+  {
+    results.pop();
+  }
+
+  neighbours.resize(results.size());
+  for (SizeType i = results.size(); i > 0; --i)
+  {
+    neighbours[i - 1] = {results.top().second, ReportedDistance(results.top().first)};
+    results.pop();
+  }
+
+  return neighbours;
+}
+
+/**
+ * Copies a vector, normalising it if the cosine metric is used
+ */
+template <typename ArrayType>
+template <typename Iterable>
+std::vector<typename HNSWIndex<ArrayType>::DataType> HNSWIndex<ArrayType>::Prepare(
+    Iterable const &vector) const
+{
+  std::vector<DataType> prepared;
+  prepared.reserve(dimensions_);
+  for (auto const &value : vector)
+  {
+    prepared.push_back(value);
+  }
+
+  if (Metric::COSINE == metric_)
+  {
+    DataType norm{0};
+    for (auto const &value : prepared)
+    {
+      norm += value * value;
+    }
+
+    if (norm > DataType{0})
+    {
+      norm = fetch::math::Sqrt(norm);
+      for (auto &value : prepared)
+      {
+        value /= norm;
+      }
+    }
+  }
+
+  return prepared;
+}
+
+/**
+ * Draws the top layer of a new node from an exponentially decaying distribution
+ */
+template <typename ArrayType>
+typename HNSWIndex<ArrayType>::SizeType HNSWIndex<ArrayType>::RandomLevel()
+{
+  double const level_multiplier = 1.0 / std::log(static_cast<double>(max_connections_));
+  double const uniform          = std::max(rng_.AsDouble(), std::numeric_limits<double>::min());
+
+  return static_cast<SizeType>(-std::log(uniform) * level_multiplier);
+}
+
+template <typename ArrayType>
+typename HNSWIndex<ArrayType>::VisitedListPtr HNSWIndex<ArrayType>::AcquireVisitedList() const
+{
+  VisitedListPtr visited;
+  {
+    FETCH_LOCK(visited_lists_mutex_);
+    if (!visited_lists_.empty())
+    {
+      visited = std::move(visited_lists_.back());
+      visited_lists_.pop_back();
+    }
+  }
+
+  if (!visited)
+  {
+    visited = std::make_unique<VisitedList>();
+  }
+
+  if (visited->marks.size() < levels_.size())
+  {
+    visited->marks.resize(levels_.size(), visited->generation);
+  }
+
+  // on wrap around the stale marks have to be cleared
+  ++visited->generation;
+  if (visited->generation == 0)
+  {
+    std::fill(visited->marks.begin(), visited->marks.end(), 0);
+    visited->generation = 1;
+  }
+
+  return visited;
+}
+
+template <typename ArrayType>
+void HNSWIndex<ArrayType>::ReleaseVisitedList(VisitedListPtr visited) const
+{
+  FETCH_LOCK(visited_lists_mutex_);
+  visited_lists_.push_back(std::move(visited));
+}
+
+/**
+ * Walks a layer towards the query, moving to the closest neighbour until there is no improvement
+ * @return the node closest to the query which was found
+ */
+template <typename ArrayType>
+typename HNSWIndex<ArrayType>::SizeType HNSWIndex<ArrayType>::GreedySearch(DataType const *query,
+                                                                           SizeType entry_point,
+                                                                           SizeType level) const
+{
+  SizeType current  = entry_point;
+  DataType distance = Distance(query, Vector(current));
+
+  for (bool changed = true; changed;)
+  {
+    changed = false;
+    for (SizeType neighbour : links_[current][level])
+    {
+      DataType const neighbour_distance = Distance(query, Vector(neighbour));
+      if (neighbour_distance < distance)
+      {
+        distance = neighbour_distance;
+        current  = neighbour;
+        changed  = true;
+      }
+    }
+  }
+
+  return current;
+}
+
+/**
+ * Best first search of a single layer
+ * @param ef maximum number of results to keep
+ * @param skip_removed whether tombstoned nodes are excluded from the results, they are always
+ * traversed
+ * @return max heap of up to ef (distance, id) results
+ */
+template <typename ArrayType>
+typename HNSWIndex<ArrayType>::MaxHeap HNSWIndex<ArrayType>::SearchLayer(
+    DataType const *query, std::vector<SizeType> const &entry_points, SizeType ef, SizeType level,
+    bool skip_removed) const
+{
+  VisitedListPtr visited    = AcquireVisitedList();
+  VisitedMarks & marks      = visited->marks;
+  uint32_t const generation = visited->generation;
+
+  MinHeap  candidates;
+  MaxHeap  results;
+  DataType bound = fetch::math::numeric_max<DataType>();
+
+  for (SizeType entry_point : entry_points)
+  {
+    DataType const distance = Distance(query, Vector(entry_point));
+
+    marks[entry_point] = generation;
+    candidates.emplace(distance, entry_point);
+    if (!skip_removed || (removed_[entry_point] == 0))
+    {
+      results.emplace(distance, entry_point);
+    }
+  }
+
+  while (results.size() > ef)
+  {
+    results.pop();
+  }
+
+  if (results.size() == ef)
+  {
+    bound = results.top().first;
+  }
+
+  while (!candidates.empty())
+  {
+    Candidate const current = candidates.top();
+    if (current.first > bound)
+    {
+      break;
+    }
+    candidates.pop();
+
+    for (SizeType neighbour : links_[current.second][level])
+    {
+      if (marks[neighbour] == generation)
+      {
+        continue;
+      }
+      marks[neighbour] = generation;
+
+      DataType const distance = Distance(query, Vector(neighbour));
+      if ((results.size() < ef) || (distance < bound))
+      {
+        candidates.emplace(distance, neighbour);
+
+        if (!skip_removed || (removed_[neighbour] == 0))
+        {
+          results.emplace(distance, neighbour);
+          if (results.size() > ef)
+          {
+            results.pop();
+          }
+
+          if (results.size() == ef)
+          {
+            bound = results.top().first;
+          }
+        }
+      }
+    }
+  }
+
+  ReleaseVisitedList(std::move(visited));
+
+  return results;
+}
+
+/**
+ * Selects the neighbours of a node with the heuristic of the paper: a candidate is only linked if
+ * it is closer to the node than to any neighbour already selected, which keeps links spread out
+ * in all directions and the graph connected across clusters
+ * @param candidates max heap of (distance, id) candidates
+ */
+template <typename ArrayType>
+typename HNSWIndex<ArrayType>::Links HNSWIndex<ArrayType>::SelectNeighbours(
+    MaxHeap candidates, SizeType max_neighbours) const
+{
+  std::vector<Candidate> sorted;
+  sorted.reserve(candidates.size());
+  while (!candidates.empty())
+  {
+    sorted.push_back(candidates.top());
+    candidates.pop();
+  }
+  std::reverse(sorted.begin(), sorted.end());
+
+  Links selected;
+  selected.reserve(max_neighbours);
+  for (auto const &candidate : sorted)
+  {
+    if (selected.size() == max_neighbours)
+    {
+      break;
+    }
+
+    bool const diverse =
+        std::all_of(selected.begin(), selected.end(), [this, &candidate](SizeType other) {
+          return candidate.first < Distance(Vector(candidate.second), Vector(other));
+        });
+
+    if (diverse)
+    {
+      selected.push_back(candidate.second);
+    }
+  }
+
+  return selected;
+}
+
+/**
+ * Links a node to its neighbours in both directions, pruning any neighbour with too many links
+ */
+template <typename ArrayType>
+void HNSWIndex<ArrayType>::Connect(SizeType id, SizeType level, Links const &neighbours)
+{
+  SizeType const max_neighbours = MaxConnections(level);
+
+  links_[id][level] = neighbours;
+
+  for (SizeType neighbour : neighbours)
+  {
+    Links &neighbour_links = links_[neighbour][level];
+    neighbour_links.push_back(id);
+
+    if (neighbour_links.size() > max_neighbours)
+    {
+      MaxHeap candidates;
+      for (SizeType other : neighbour_links)
+      {
+        candidates.emplace(Distance(Vector(neighbour), Vector(other)), other);
+      }
+
+      neighbour_links = SelectNeighbours(std::move(candidates), max_neighbours);
+    }
+  }
+}
+
+/**
+ * Adds a prepared vector to the graph, the caller must hold the exclusive lock
+ */
+template <typename ArrayType>
+void HNSWIndex<ArrayType>::InsertVector(std::vector<DataType> vector)
+{
+  SizeType const id    = levels_.size();
+  SizeType const level = RandomLevel();
+
+  vectors_.insert(vectors_.end(), vector.begin(), vector.end());
+  levels_.push_back(level);
+  links_.emplace_back(level + 1);
+  removed_.push_back(0);
+
+  if (NONE == entry_point_)
+  {
+    entry_point_ = id;
+    max_level_   = level;
+    return;
+  }
+
+  DataType const *query = Vector(id);
+
+  // descend through the layers above the node without linking
+  SizeType entry_point = entry_point_;
+  for (SizeType l = max_level_; l > level; --l)
+  {
+    entry_point = GreedySearch(query, entry_point, l);
+  }
+
+  std::vector<SizeType> entry_points{entry_point};
+  for (SizeType l = std::min(level, max_level_) + 1; l > 0; --l)
+  {
+    MaxHeap candidates = SearchLayer(query, entry_points, ef_construction_, l - 1, false);
+
+    entry_points.clear();
+    for (auto copy = candidates; !copy.empty(); copy.pop())
+    {
+      entry_points.push_back(copy.top().second);
+    }
+
+    Connect(id, l - 1, SelectNeighbours(std::move(candidates), max_connections_));
+  }
+
+  if (level > max_level_)
+  {
+    entry_point_ = id;
+    max_level_   = level;
+  }
+}
+
+}  // namespace clustering
+}  // namespace math
+
+namespace serializers {
+
+template <typename A, typename D>
+struct MapSerializer<math::clustering::HNSWIndex<A>, D>
+{
+public:
+  using Type       = math::clustering::HNSWIndex<A>;
+  using DriverType = D;
+
+  static uint8_t const DIMENSIONS      = 1;
+  static uint8_t const METRIC          = 2;
+  static uint8_t const MAX_CONNECTIONS = 3;
+  static uint8_t const EF_CONSTRUCTION = 4;
+  static uint8_t const EF_SEARCH       = 5;
+  static uint8_t const VECTORS         = 6;
+  static uint8_t const LEVELS          = 7;
+  static uint8_t const LINKS           = 8;
+  static uint8_t const REMOVED         = 9;
+  static uint8_t const ENTRY_POINT     = 10;
+  static uint8_t const MAX_LEVEL       = 11;
+
+  template <typename Constructor>
+  static void Serialize(Constructor &map_constructor, Type const &index)
+  {
+    std::shared_lock<std::shared_timed_mutex> lock(index.mutex_);
+
+    auto map = map_constructor(11);
+    map.Append(DIMENSIONS, index.dimensions_);
+    map.Append(METRIC, static_cast<uint8_t>(index.metric_));
+    map.Append(MAX_CONNECTIONS, index.max_connections_);
+    map.Append(EF_CONSTRUCTION, index.ef_construction_);
+    map.Append(EF_SEARCH, index.ef_search_);
+    map.Append(VECTORS, index.vectors_);
+    map.Append(LEVELS, index.levels_);
+    map.Append(LINKS, index.links_);
+    map.Append(REMOVED, index.removed_);
+    map.Append(ENTRY_POINT, index.entry_point_);
+    map.Append(MAX_LEVEL, index.max_level_);
+  }
+
+  template <typename MapDeserializer>
+  static void Deserialize(MapDeserializer &map, Type &index)
+  {
+    std::unique_lock<std::shared_timed_mutex> lock(index.mutex_);
+
+    uint8_t metric{0};
+    map.ExpectKeyGetValue(DIMENSIONS, index.dimensions_);
+    map.ExpectKeyGetValue(METRIC, metric);
+    map.ExpectKeyGetValue(MAX_CONNECTIONS, index.max_connections_);
+    map.ExpectKeyGetValue(EF_CONSTRUCTION, index.ef_construction_);
+    map.ExpectKeyGetValue(EF_SEARCH, index.ef_search_);
+    map.ExpectKeyGetValue(VECTORS, index.vectors_);
+    map.ExpectKeyGetValue(LEVELS, index.levels_);
+    map.ExpectKeyGetValue(LINKS, index.links_);
+    map.ExpectKeyGetValue(REMOVED, index.removed_);
+    map.ExpectKeyGetValue(ENTRY_POINT, index.entry_point_);
+    map.ExpectKeyGetValue(MAX_LEVEL, index.max_level_);
+
+    index.metric_      = static_cast<typename Type::Metric>(metric);
+    index.num_removed_ = static_cast<typename Type::SizeType>(
+        std::count_if(index.removed_.begin(), index.removed_.end(),
+                      [](uint8_t removed) { return removed != 0; }));
+  }
+};
+
+}  // namespace serializers
+}  // namespace fetch
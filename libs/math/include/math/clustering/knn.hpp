@@ -17,6 +17,7 @@
 //
 //------------------------------------------------------------------------------
 
+#include "math/clustering/hnsw_index.hpp"
 #include "math/distance/cosine.hpp"
 
 #include <cassert>
@@ -163,6 +164,22 @@ std::vector<std::pair<typename ArrayType::SizeType, typename ArrayType::Type>> K
   return details::KNNImplementation<ArrayType, Distance>(array, vec, k);
 }
 
+/**
+ * Interface to get approximate K nearest neighbours of an input vector from a prebuilt index
+ * Avoids the brute force scan of the whole array, which makes it suitable for repeated queries
+ * against large arrays. The distance function is the metric of the index
+ * @tparam ArrayType  template for type of array
+ * @param index   index over the data points, see HNSWIndex::InsertRows
+ * @param vec the test vector
+ * @param k  value of k - i.e. how many nearest data points to find
+ */
+template <typename ArrayType>
+std::vector<std::pair<typename ArrayType::SizeType, typename ArrayType::Type>> KNN(
+    HNSWIndex<ArrayType> const &index, ArrayType const &vec, typename ArrayType::SizeType k)
+{
+  return index.Search(vec, k);
+}
+
 }  // namespace clustering
 }  // namespace math
 }  // namespace fetch
@@ -18,6 +18,7 @@
 //------------------------------------------------------------------------------
 
 #include "math/meta/math_type_traits.hpp"
+#include "math/standard_functions/fixed_point_vectorised.hpp"
 #include "vectorise/fixed_point/fixed_point.hpp"
 
 #include <cassert>
@@ -61,7 +62,16 @@ meta::IfIsArithmetic<Type, Type> Exp(Type const &x)
 }
 
 template <typename ArrayType>
-meta::IfIsMathArray<ArrayType, void> Exp(ArrayType const &array, ArrayType &ret)
+meta::IfIsMathFixedPointArray<ArrayType, void> Exp(ArrayType const &array, ArrayType &ret)
+{
+  using Type = typename ArrayType::Type;
+  assert(ret.shape() == array.shape());
+  details::ApplyFixedPointFunction(array, ret, [](auto const &x) { return vectorise::exp(x); },
+                                   [](Type const &x) { return Type::Exp(x); });
+}
+
+template <typename ArrayType>
+meta::IfIsMathNonFixedPointArray<ArrayType, void> Exp(ArrayType const &array, ArrayType &ret)
 {
   assert(ret.shape() == array.shape());
   auto it1 = array.cbegin();
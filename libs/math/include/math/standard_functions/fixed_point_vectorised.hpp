@@ -0,0 +1,108 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "math/base_types.hpp"
+#include "vectorise/math/standard_functions.hpp"
+
+#include <cassert>
+#include <type_traits>
+
+namespace fetch {
+namespace math {
+namespace details {
+
+template <typename ArrayType, typename VectorFunction, typename ScalarFunction>
+void ApplyFixedPointFunction(ArrayType const &array, ArrayType &ret,
+                             VectorFunction && /*vector_function*/,
+                             ScalarFunction &&scalar_function, std::false_type /*vectorised*/)
+{
+  // no vector registers for this type and architecture
+  auto it  = array.cbegin();
+  auto rit = ret.begin();
+  while (it.is_valid())
+  {
+    *rit = scalar_function(*it);
+    ++it;
+    ++rit;
+  }
+}
+
+template <typename ArrayType, typename VectorFunction, typename ScalarFunction>
+void ApplyFixedPointFunction(ArrayType const &array, ArrayType &ret,
+                             VectorFunction &&vector_function, ScalarFunction &&scalar_function,
+                             std::true_type /*vectorised*/)
+{
+  using VectorRegisterType = typename ArrayType::VectorRegisterType;
+  using Type               = typename ArrayType::Type;
+
+  assert(ret.shape() == array.shape());
+  assert(ret.padded_height() == array.padded_height());
+
+  if (array.size() == 0)
+  {
+    return;
+  }
+
+  SizeType const block_count = VectorRegisterType::E_BLOCK_COUNT;
+  SizeType const height      = array.height();
+  SizeType const columns     = array.size() / height;
+  SizeType const vectorised  = height - (height % block_count);
+
+  // columns start at multiples of the padded height, so the loads below are aligned
+  for (SizeType c = 0; c < columns; ++c)
+  {
+    Type const *in  = array.data().pointer() + c * array.padded_height();
+    Type *      out = ret.data().pointer() + c * ret.padded_height();
+
+    SizeType i = 0;
+    for (; i < vectorised; i += block_count)
+    {
+      VectorRegisterType const x(in + i);
+      vector_function(x).Store(out + i);
+    }
+
+    for (; i < height; ++i)
+    {
+      out[i] = scalar_function(in[i]);
+    }
+  }
+}
+
+/**
+ * Applies a function to every element of a fixed point array. Each column is processed a register
+ * at a time and the remaining elements are left to the scalar function. The vectorised functions
+ * are bit-exact, so the result and the fixed point state are those of the scalar function.
+ * @param array input array
+ * @param ret return array, may be the input array
+ * @param vector_function function of a VectorRegisterType
+ * @param scalar_function function of a single element
+ */
+template <typename ArrayType, typename VectorFunction, typename ScalarFunction>
+void ApplyFixedPointFunction(ArrayType const &array, ArrayType &ret,
+                             VectorFunction &&vector_function, ScalarFunction &&scalar_function)
+{
+  using VectorRegisterType = typename ArrayType::VectorRegisterType;
+
+  ApplyFixedPointFunction(array, ret, vector_function, scalar_function,
+                          std::integral_constant<bool, (VectorRegisterType::E_BLOCK_COUNT > 1)>{});
+}
+
+}  // namespace details
+}  // namespace math
+}  // namespace fetch
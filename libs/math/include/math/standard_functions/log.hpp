@@ -18,6 +18,7 @@
 //------------------------------------------------------------------------------
 
 #include "math/meta/math_type_traits.hpp"
+#include "math/standard_functions/fixed_point_vectorised.hpp"
 
 #include <cassert>
 
@@ -85,7 +86,16 @@ meta::IfIsArithmetic<Type, Type> Log(Type const &x)
 }
 
 template <typename ArrayType>
-meta::IfIsMathArray<ArrayType, void> Log(ArrayType const &array, ArrayType &ret)
+meta::IfIsMathFixedPointArray<ArrayType, void> Log(ArrayType const &array, ArrayType &ret)
+{
+  using Type = typename ArrayType::Type;
+  assert(ret.shape() == array.shape());
+  details::ApplyFixedPointFunction(array, ret, [](auto const &x) { return vectorise::log(x); },
+                                   [](Type const &x) { return Type::Log(x); });
+}
+
+template <typename ArrayType>
+meta::IfIsMathNonFixedPointArray<ArrayType, void> Log(ArrayType const &array, ArrayType &ret)
 {
   assert(ret.shape() == array.shape());
   auto it1 = array.cbegin();
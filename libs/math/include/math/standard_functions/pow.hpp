@@ -18,6 +18,7 @@
 //------------------------------------------------------------------------------
 
 #include "math/meta/math_type_traits.hpp"
+#include "math/standard_functions/fixed_point_vectorised.hpp"
 
 #include <cassert>
 
@@ -53,8 +54,24 @@ meta::IfIsArithmetic<Type, Type> Pow(Type const &x, Type const &exponent)
 }
 
 template <typename ArrayType>
-meta::IfIsMathArray<ArrayType, void> Pow(ArrayType const &               array1,
-                                         typename ArrayType::Type const &exponent, ArrayType &ret)
+meta::IfIsMathFixedPointArray<ArrayType, void> Pow(ArrayType const &               array1,
+                                                   typename ArrayType::Type const &exponent,
+                                                   ArrayType &                     ret)
+{
+  using Type               = typename ArrayType::Type;
+  using VectorRegisterType = typename ArrayType::VectorRegisterType;
+
+  assert(ret.shape() == array1.shape());
+  VectorRegisterType const y(exponent);
+  details::ApplyFixedPointFunction(array1, ret,
+                                   [&y](auto const &x) { return vectorise::pow(x, y); },
+                                   [exponent](Type const &x) { return Type::Pow(x, exponent); });
+}
+
+template <typename ArrayType>
+meta::IfIsMathNonFixedPointArray<ArrayType, void> Pow(ArrayType const &               array1,
+                                                      typename ArrayType::Type const &exponent,
+                                                      ArrayType &                     ret)
 {
   assert(ret.shape() == array1.shape());
   auto arr_it = array1.cbegin();
@@ -18,6 +18,7 @@
 //------------------------------------------------------------------------------
 
 #include "math/meta/math_type_traits.hpp"
+#include "math/standard_functions/fixed_point_vectorised.hpp"
 
 #include <cassert>
 
@@ -55,7 +56,16 @@ meta::IfIsArithmetic<Type, Type> Sqrt(Type const &x)
 }
 
 template <typename ArrayType>
-meta::IfIsMathArray<ArrayType, void> Sqrt(ArrayType const &array, ArrayType &ret)
+meta::IfIsMathFixedPointArray<ArrayType, void> Sqrt(ArrayType const &array, ArrayType &ret)
+{
+  using Type = typename ArrayType::Type;
+  assert(ret.shape() == array.shape());
+  details::ApplyFixedPointFunction(array, ret, [](auto const &x) { return vectorise::sqrt(x); },
+                                   [](Type const &x) { return Type::Sqrt(x); });
+}
+
+template <typename ArrayType>
+meta::IfIsMathNonFixedPointArray<ArrayType, void> Sqrt(ArrayType const &array, ArrayType &ret)
 {
   assert(ret.shape() == array.shape());
   auto arr_it = array.cbegin();
@@ -126,6 +126,7 @@ public:
   Tensor(Tensor &&other) noexcept = default;
   Tensor(Tensor const &other)     = default;
   explicit Tensor(SizeVector const &dims);
+  Tensor(ContainerType data, SizeVector const &shape);
   virtual ~Tensor() = default;
 
   Tensor &operator=(Tensor const &other) = default;
@@ -844,6 +845,26 @@ Tensor<T, C>::Tensor(SizeVector const &dims)
   Resize(dims);
 }
 
+/**
+ * Constructor builds a Tensor over an existing container without copying it
+ * @param data    container holding the padded column major layout of the shape
+ * @param shape   vector of lengths for each dimension
+ */
+template <typename T, typename C>
+Tensor<T, C>::Tensor(ContainerType data, SizeVector const &shape)
+  : data_(std::move(data))
+  , size_(SizeFromShape(shape))
+  , shape_(shape)
+  , padded_height_(shape.empty() ? 0 : PadValue(shape[0]))
+{
+  if (data_.size() < PaddedSizeFromShape(shape))
+  {
+    throw exceptions::WrongShape("container is too small for the padded tensor shape");
+  }
+
+  UpdateStrides();
+}
+
 /////////////////////////////////
 /// Tensor methods: iterators ///
 /////////////////////////////////
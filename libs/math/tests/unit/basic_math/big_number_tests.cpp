@@ -18,6 +18,7 @@
 
 #include "core/byte_array/encoders.hpp"
 #include "gmock/gmock.h"
+#include "vectorise/uint/montgomery.hpp"
 #include "vectorise/uint/uint.hpp"
 
 #include <cstddef>
@@ -264,6 +265,116 @@ TEST(big_number_gtest, division_tests)
   EXPECT_EQ(n5.ElementAt(3), 0);
 }
 
+TEST(big_number_gtest, multiplication_carries_across_limbs)
+{
+  // (2^128 - 1)^2 = 2^256 - 2^129 + 1
+  UInt<256> n1;
+  n1.ElementAt(0) = ULONG_MAX;
+  n1.ElementAt(1) = ULONG_MAX;
+  UInt<256> n2 = n1 * n1;
+  EXPECT_EQ(n2.ElementAt(0), 1u);
+  EXPECT_EQ(n2.ElementAt(1), 0u);
+  EXPECT_EQ(n2.ElementAt(2), 0xfffffffffffffffe);
+  EXPECT_EQ(n2.ElementAt(3), 0xffffffffffffffff);
+
+  // the product is truncated to the width of the type
+  n1 = UInt<256>::max;
+  n1 *= UInt<256>::max;
+  EXPECT_EQ(n1, UInt<256>::_1);
+}
+
+TEST(big_number_gtest, division_by_multi_limb_divisors)
+{
+  uint64_t seed = 0x9e3779b97f4a7c15;
+  auto     next = [&seed]() {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    return seed;
+  };
+
+  for (std::size_t limbs = 1; limbs <= 3; ++limbs)
+  {
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+      UInt<256> divisor;
+      UInt<256> quotient;
+      for (std::size_t j = 0; j < limbs; ++j)
+      {
+        divisor.ElementAt(j) = next();
+      }
+      for (std::size_t j = 0; j < 4 - limbs; ++j)
+      {
+        quotient.ElementAt(j) = next();
+      }
+      // keep quotient * divisor + remainder below 2^256
+      quotient.ElementAt(3 - limbs) >>= 1;
+      divisor.ElementAt(limbs - 1) >>= (i % 64);
+      divisor.ElementAt(limbs - 1) |= 1u;
+
+      UInt<256> const remainder = UInt<256>{next()} % divisor;
+      UInt<256> const dividend  = quotient * divisor + remainder;
+
+      EXPECT_EQ(dividend / divisor, quotient);
+      EXPECT_EQ(dividend % divisor, remainder);
+    }
+  }
+
+  UInt<256> n1{42u};
+  EXPECT_THROW(n1 /= UInt<256>::_0, std::runtime_error);
+  EXPECT_THROW(n1 %= UInt<256>::_0, std::runtime_error);
+}
+
+TEST(big_number_gtest, montgomery_multiplication_matches_reference)
+{
+  // 2^255 - 19
+  UInt<256> modulus{UInt<256>::max};
+  modulus >>= 1;
+  modulus -= 18u;
+
+  Montgomery<256> const montgomery{modulus};
+
+  UInt<256> a;
+  UInt<256> b;
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    a.ElementAt(i) = 0x0123456789abcdef * (i + 1);
+    b.ElementAt(i) = 0xfedcba9876543210 - i;
+  }
+  a %= modulus;
+  b %= modulus;
+
+  UInt<256> const product = montgomery.Multiply(montgomery.ToMontgomery(a),
+                                                montgomery.ToMontgomery(b));
+  EXPECT_EQ(montgomery.FromMontgomery(product), MulMod(a, b, modulus));
+  EXPECT_EQ(montgomery.FromMontgomery(montgomery.ToMontgomery(a)), a);
+
+  EXPECT_THROW(Montgomery<256>{UInt<256>{10u}}, std::runtime_error);
+}
+
+TEST(big_number_gtest, modular_exponentiation)
+{
+  // Fermat's little theorem for the prime 2^255 - 19
+  UInt<256> p{UInt<256>::max};
+  p >>= 1;
+  p -= 18u;
+
+  UInt<256> p_minus_one{p};
+  p_minus_one -= 1u;
+
+  for (uint64_t base : {2ull, 3ull, 0xdeadbeefdeadbeefull})
+  {
+    EXPECT_EQ(ModPow(UInt<256>{base}, p_minus_one, p), UInt<256>::_1);
+    EXPECT_EQ(ModPow(UInt<256>{base}, p, p), UInt<256>{base});
+  }
+
+  // small cases, including even moduli which do not use Montgomery arithmetic
+  EXPECT_EQ(ModPow(UInt<256>{3u}, UInt<256>{5u}, UInt<256>{10u}), UInt<256>{3u});
+  EXPECT_EQ(ModPow(UInt<256>{2u}, UInt<256>{10u}, UInt<256>{1000u}), UInt<256>{24u});
+  EXPECT_EQ(ModPow(UInt<256>{7u}, UInt<256>{0u}, UInt<256>{13u}), UInt<256>::_1);
+  EXPECT_EQ(ModPow(UInt<256>{7u}, UInt<256>{3u}, UInt<256>::_1), UInt<256>::_0);
+}
+
 TEST(big_number_gtest, msb_lsb_tests)
 {
   UInt<256> n1;
@@ -0,0 +1,205 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/random/lcg.hpp"
+#include "gtest/gtest.h"
+#include "math/activation_functions/sigmoid.hpp"
+#include "math/activation_functions/softmax.hpp"
+#include "math/standard_functions/exp.hpp"
+#include "math/standard_functions/log.hpp"
+#include "math/standard_functions/pow.hpp"
+#include "math/standard_functions/sqrt.hpp"
+#include "test_types.hpp"
+
+namespace fetch {
+namespace math {
+namespace test {
+
+template <typename T>
+class FixedPointFunctionsTest : public ::testing::Test
+{
+};
+
+using FixedPointTensorTypes =
+    ::testing::Types<fetch::math::Tensor<fetch::fixed_point::fp32_t>,
+                     fetch::math::Tensor<fetch::fixed_point::fp64_t>,
+                     fetch::math::Tensor<fetch::fixed_point::fp128_t>>;
+TYPED_TEST_CASE(FixedPointFunctionsTest, FixedPointTensorTypes);
+
+namespace {
+
+/// A height which is not a multiple of the register width and several columns
+template <typename TensorType>
+TensorType RandomTensor(double lower, double upper)
+{
+  using Type = typename TensorType::Type;
+
+  fetch::random::LinearCongruentialGenerator gen;
+
+  TensorType tensor({13, 5});
+  for (auto &x : tensor)
+  {
+    x = static_cast<Type>(lower + (upper - lower) * gen.AsDouble());
+  }
+  tensor(0, 0) = Type{0};
+  tensor(1, 0) = Type{1};
+  tensor(2, 1) = Type::NaN;
+  tensor(3, 2) = Type::POSITIVE_INFINITY;
+  tensor(4, 3) = Type::FP_MAX;
+
+  return tensor;
+}
+
+/// Compares the raw values, as NaN does not compare equal to itself
+template <typename TensorType>
+void ExpectBitExact(TensorType const &output, TensorType const &expected)
+{
+  auto it  = output.cbegin();
+  auto eit = expected.cbegin();
+  while (it.is_valid())
+  {
+    EXPECT_EQ((*it).Data(), (*eit).Data());
+    ++it;
+    ++eit;
+  }
+}
+
+/// Checks the tensor function against the scalar function, including the fixed point state
+template <typename TensorType, typename ArrayFunction, typename ScalarFunction>
+void Compare(TensorType const &input, ArrayFunction &&array_function,
+             ScalarFunction &&scalar_function)
+{
+  using Type = typename TensorType::Type;
+
+  Type::StateClear();
+  TensorType expected(input.shape());
+  auto       it  = input.cbegin();
+  auto       eit = expected.begin();
+  while (it.is_valid())
+  {
+    *eit = scalar_function(*it);
+    ++it;
+    ++eit;
+  }
+  auto const expected_state = Type::fp_state;
+
+  Type::StateClear();
+  TensorType output(input.shape());
+  array_function(input, output);
+  EXPECT_EQ(Type::fp_state, expected_state);
+
+  ExpectBitExact(output, expected);
+
+  // in place
+  Type::StateClear();
+  TensorType in_place = input.Copy();
+  array_function(in_place, in_place);
+  EXPECT_EQ(Type::fp_state, expected_state);
+  ExpectBitExact(in_place, expected);
+
+  Type::StateClear();
+}
+
+}  // namespace
+
+TYPED_TEST(FixedPointFunctionsTest, exp_matches_scalar)
+{
+  using Type = typename TypeParam::Type;
+  Compare(RandomTensor<TypeParam>(-12, 12),
+          [](TypeParam const &x, TypeParam &ret) { fetch::math::Exp(x, ret); },
+          [](Type const &x) { return Type::Exp(x); });
+}
+
+TYPED_TEST(FixedPointFunctionsTest, log_matches_scalar)
+{
+  using Type = typename TypeParam::Type;
+  Compare(RandomTensor<TypeParam>(-1, 100),
+          [](TypeParam const &x, TypeParam &ret) { fetch::math::Log(x, ret); },
+          [](Type const &x) { return Type::Log(x); });
+}
+
+TYPED_TEST(FixedPointFunctionsTest, sqrt_matches_scalar)
+{
+  using Type = typename TypeParam::Type;
+  Compare(RandomTensor<TypeParam>(-1, 100),
+          [](TypeParam const &x, TypeParam &ret) { fetch::math::Sqrt(x, ret); },
+          [](Type const &x) { return Type::Sqrt(x); });
+}
+
+TYPED_TEST(FixedPointFunctionsTest, pow_matches_scalar)
+{
+  using Type = typename TypeParam::Type;
+  for (Type y : {Type{3}, Type{-2}, Type{0.5}, Type{-1.25}})
+  {
+    Compare(RandomTensor<TypeParam>(-3, 3),
+            [y](TypeParam const &x, TypeParam &ret) { fetch::math::Pow(x, y, ret); },
+            [y](Type const &x) { return Type::Pow(x, y); });
+  }
+}
+
+TYPED_TEST(FixedPointFunctionsTest, sigmoid_matches_scalar)
+{
+  using Type = typename TypeParam::Type;
+  Type const one{1};
+  Compare(RandomTensor<TypeParam>(-15, 15),
+          [](TypeParam const &x, TypeParam &ret) { fetch::math::Sigmoid(x, ret); },
+          [one](Type const &x) {
+            if (x >= Type{0})
+            {
+              return one / (Type::Exp(-x) + one);
+            }
+            Type const e = Type::Exp(x);
+            return e / (e + one);
+          });
+}
+
+TYPED_TEST(FixedPointFunctionsTest, softmax_matches_scalar)
+{
+  using Type = typename TypeParam::Type;
+
+  fetch::random::LinearCongruentialGenerator gen;
+
+  TypeParam input({37});
+  for (auto &x : input)
+  {
+    x = static_cast<Type>(-10 + 20 * gen.AsDouble());
+  }
+
+  TypeParam expected({37});
+  Type      max = input.At(0);
+  for (auto const &x : input)
+  {
+    max = (x > max) ? x : max;
+  }
+  Type sum{0};
+  for (fetch::math::SizeType i = 0; i < input.size(); ++i)
+  {
+    expected.At(i) = Type::Exp(input.At(i) - max);
+    sum += expected.At(i);
+  }
+  for (auto &x : expected)
+  {
+    x /= sum;
+  }
+
+  EXPECT_EQ(fetch::math::Softmax(input), expected);
+}
+
+}  // namespace test
+}  // namespace math
+}  // namespace fetch
@@ -0,0 +1,292 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/random/lcg.hpp"
+#include "core/serializers/main_serializer.hpp"
+#include "math/clustering/hnsw_index.hpp"
+#include "math/clustering/knn.hpp"
+#include "math/distance/euclidean.hpp"
+#include "test_types.hpp"
+
+#include "gtest/gtest.h"
+
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace fetch {
+namespace math {
+namespace test {
+
+template <typename T>
+class HNSWIndexTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_CASE(HNSWIndexTest, HighPrecisionTensorFloatingTypes);
+
+namespace {
+
+template <typename ArrayType>
+ArrayType GenerateData(SizeType num_points, SizeType dimensions, uint64_t seed)
+{
+  using DataType = typename ArrayType::Type;
+
+  fetch::random::LinearCongruentialGenerator rng;
+  rng.Seed(seed);
+
+  ArrayType data({num_points, dimensions});
+  for (SizeType i{0}; i < num_points; ++i)
+  {
+    for (SizeType d{0}; d < dimensions; ++d)
+    {
+      data.At(i, d) = static_cast<DataType>(rng.AsDouble() * 10.0);
+    }
+  }
+
+  return data;
+}
+
+template <typename ArrayType>
+ArrayType Row(ArrayType const &data, SizeType i)
+{
+  ArrayType row({1, data.shape().at(1)});
+  for (SizeType d{0}; d < data.shape().at(1); ++d)
+  {
+    row.At(0, d) = data.At(i, d);
+  }
+
+  return row;
+}
+
+/**
+ * Fraction of the true k nearest neighbours found by the index, averaged over the queries
+ */
+template <typename ArrayType>
+double Recall(clustering::HNSWIndex<ArrayType> const &index, ArrayType const &data,
+              ArrayType const &queries, SizeType k)
+{
+  SizeType found{0};
+  for (SizeType q{0}; q < queries.shape().at(0); ++q)
+  {
+    ArrayType const query = Row(queries, q);
+
+    auto const exact =
+        clustering::KNN<ArrayType, fetch::math::distance::Euclidean>(data, query, k);
+    auto const approximate = clustering::KNN(index, query, k);
+
+    std::set<SizeType> expected;
+    for (auto const &neighbour : exact)
+    {
+      expected.insert(neighbour.first);
+    }
+
+    for (auto const &neighbour : approximate)
+    {
+      found += expected.count(neighbour.first);
+    }
+  }
+
+  return static_cast<double>(found) / static_cast<double>(queries.shape().at(0) * k);
+}
+
+}  // namespace
+
+TYPED_TEST(HNSWIndexTest, recall_matches_brute_force)
+{
+  using ArrayType = TypeParam;
+
+  ArrayType const data    = GenerateData<ArrayType>(1000, 8, 1);
+  ArrayType const queries = GenerateData<ArrayType>(50, 8, 2);
+
+  clustering::HNSWIndex<ArrayType> index{8};
+  index.InsertRows(data);
+
+  EXPECT_EQ(index.size(), SizeType{1000});
+  EXPECT_GE(Recall(index, data, queries, 10), 0.95);
+}
+
+TYPED_TEST(HNSWIndexTest, distances_are_sorted_and_exact)
+{
+  using ArrayType = TypeParam;
+
+  ArrayType const data = GenerateData<ArrayType>(200, 4, 3);
+
+  clustering::HNSWIndex<ArrayType> index{4};
+  index.InsertRows(data);
+
+  ArrayType const query = Row(data, 17);
+  auto const exact = clustering::KNN<ArrayType, fetch::math::distance::Euclidean>(data, query, 5);
+  auto const approximate = index.Search(query, 5);
+
+  ASSERT_EQ(approximate.size(), SizeType{5});
+  EXPECT_EQ(approximate.front().first, SizeType{17});
+  for (SizeType i{0}; i < approximate.size(); ++i)
+  {
+    EXPECT_EQ(approximate[i].first, exact[i].first);
+    EXPECT_NEAR(static_cast<double>(approximate[i].second), static_cast<double>(exact[i].second),
+                1e-4);
+  }
+}
+
+TYPED_TEST(HNSWIndexTest, cosine_metric_matches_brute_force)
+{
+  using ArrayType = TypeParam;
+  using Index     = clustering::HNSWIndex<ArrayType>;
+
+  ArrayType A = ArrayType::FromString("1, 2, 3, 4; 2, 3, 4, 5; -1, -2, -3, -4; -2, -3, -4, -5");
+  ArrayType v = ArrayType::FromString("3, 4, 5, 6");
+
+  Index index{4, Index::Metric::COSINE};
+  index.InsertRows(A);
+
+  auto const exact  = clustering::KNNCosine(A, v, 4);
+  auto const output = clustering::KNN(index, v, 4);
+
+  ASSERT_EQ(output.size(), exact.size());
+  for (SizeType i{0}; i < output.size(); ++i)
+  {
+    EXPECT_EQ(output[i].first, exact[i].first);
+    EXPECT_NEAR(static_cast<double>(output[i].second), static_cast<double>(exact[i].second), 1e-4);
+  }
+}
+
+TYPED_TEST(HNSWIndexTest, removed_vectors_are_not_returned)
+{
+  using ArrayType = TypeParam;
+
+  ArrayType const data = GenerateData<ArrayType>(300, 4, 4);
+
+  clustering::HNSWIndex<ArrayType> index{4};
+  index.InsertRows(data);
+
+  for (SizeType i{0}; i < 300; i += 2)
+  {
+    index.Remove(i);
+  }
+  index.Remove(0);
+
+  EXPECT_EQ(index.size(), SizeType{150});
+  EXPECT_TRUE(index.IsRemoved(0));
+  EXPECT_FALSE(index.IsRemoved(1));
+  EXPECT_THROW(index.Remove(300), std::out_of_range);
+
+  for (SizeType q{0}; q < 20; ++q)
+  {
+    auto const neighbours = index.Search(Row(data, q), 10);
+
+    EXPECT_EQ(neighbours.size(), SizeType{10});
+    for (auto const &neighbour : neighbours)
+    {
+      EXPECT_EQ(neighbour.first % 2, SizeType{1});
+    }
+  }
+
+  // inserting after removals continues the numbering
+  EXPECT_EQ(index.Insert(Row(data, 0)), SizeType{300});
+  EXPECT_EQ(index.Search(Row(data, 0), 1).front().first, SizeType{300});
+}
+
+TYPED_TEST(HNSWIndexTest, concurrent_queries_match_sequential_queries)
+{
+  using ArrayType = TypeParam;
+  using Index     = clustering::HNSWIndex<ArrayType>;
+
+  static constexpr SizeType NUM_THREADS = 4;
+
+  ArrayType const data    = GenerateData<ArrayType>(500, 6, 5);
+  ArrayType const queries = GenerateData<ArrayType>(40, 6, 6);
+
+  Index index{6};
+  index.InsertRows(data);
+
+  std::vector<typename Index::Neighbours> expected;
+  for (SizeType q{0}; q < queries.shape().at(0); ++q)
+  {
+    expected.push_back(index.Search(Row(queries, q), 5));
+  }
+
+  std::vector<std::vector<typename Index::Neighbours>> results(NUM_THREADS);
+  std::vector<std::thread>                             threads;
+  for (SizeType t{0}; t < NUM_THREADS; ++t)
+  {
+    threads.emplace_back([&index, &queries, &results, t]() {
+      for (SizeType q{0}; q < queries.shape().at(0); ++q)
+      {
+        results[t].push_back(index.Search(Row(queries, q), 5));
+      }
+    });
+  }
+
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  for (auto const &result : results)
+  {
+    EXPECT_EQ(result, expected);
+  }
+}
+
+TYPED_TEST(HNSWIndexTest, serialisation_preserves_queries)
+{
+  using ArrayType = TypeParam;
+  using Index     = clustering::HNSWIndex<ArrayType>;
+
+  ArrayType const data    = GenerateData<ArrayType>(300, 5, 7);
+  ArrayType const queries = GenerateData<ArrayType>(20, 5, 8);
+
+  Index index{5, Index::Metric::COSINE, 8, 50};
+  index.InsertRows(data);
+  index.Remove(3);
+  index.SetEfSearch(20);
+
+  fetch::serializers::MsgPackSerializer serializer;
+  serializer << index;
+  serializer.seek(0);
+
+  Index restored;
+  serializer >> restored;
+
+  EXPECT_EQ(restored.size(), index.size());
+  EXPECT_EQ(restored.dimensions(), index.dimensions());
+  EXPECT_EQ(restored.metric(), Index::Metric::COSINE);
+  EXPECT_TRUE(restored.IsRemoved(3));
+
+  for (SizeType q{0}; q < queries.shape().at(0); ++q)
+  {
+    EXPECT_EQ(restored.Search(Row(queries, q), 5), index.Search(Row(queries, q), 5));
+  }
+}
+
+TYPED_TEST(HNSWIndexTest, rejects_mismatched_dimensions)
+{
+  using ArrayType = TypeParam;
+
+  clustering::HNSWIndex<ArrayType> index{3};
+
+  EXPECT_TRUE(index.Search(ArrayType({1, 3}), 4).empty());
+  EXPECT_THROW(index.Insert(ArrayType({1, 4})), std::invalid_argument);
+  EXPECT_THROW(index.Search(ArrayType({1, 2}), 1), std::invalid_argument);
+  EXPECT_THROW(index.InsertRows(ArrayType({5, 2})), std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace math
+}  // namespace fetch
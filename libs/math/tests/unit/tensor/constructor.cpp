@@ -39,6 +39,27 @@ TYPED_TEST(TensorConstructorTest, string_construction)
   ASSERT_EQ(tensor.At(0, 2), TypeParam(4));
 }
 
+TYPED_TEST(TensorConstructorTest, container_construction_shares_memory)
+{
+  using TensorType    = fetch::math::Tensor<TypeParam>;
+  using ContainerType = typename TensorType::ContainerType;
+
+  SizeVector const shape{3, 2};
+  ContainerType    data(TensorType::PaddedSizeFromShape(shape));
+  data.SetAllZero();
+
+  TensorType tensor{data, shape};
+  ASSERT_EQ(tensor.shape(), shape);
+  ASSERT_EQ(tensor.size(), 6);
+  ASSERT_EQ(tensor.data().pointer(), data.pointer());
+
+  // the second column starts after the padding of the first one
+  data[tensor.padded_height() + 1] = TypeParam(7);
+  EXPECT_EQ(tensor.At(1, 1), TypeParam(7));
+
+  EXPECT_THROW((TensorType{ContainerType(4), shape}), fetch::math::exceptions::WrongShape);
+}
+
 }  // namespace test
 }  // namespace math
 }  // namespace fetch
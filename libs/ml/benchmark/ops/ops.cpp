@@ -18,6 +18,7 @@
 
 #include "math/tensor.hpp"
 #include "ml/ops/add.hpp"
+#include "ml/ops/convolution_2d.hpp"
 #include "ml/ops/divide.hpp"
 #include "ml/ops/exp.hpp"
 #include "ml/ops/log.hpp"
@@ -1098,4 +1099,106 @@ BENCHMARK_TEMPLATE(BM_SqueezeBackward, fetch::fixed_point::fp64_t, 2048)
 BENCHMARK_TEMPLATE(BM_SqueezeBackward, fetch::fixed_point::fp64_t, 4096)
     ->Unit(benchmark::kMicrosecond);
 
+template <typename T>
+void BM_Convolution2D_Forward(benchmark::State &state)
+{
+  using TensorType    = typename fetch::math::Tensor<T>;
+  using VecTensorType = typename fetch::ml::ops::Ops<TensorType>::VecTensorType;
+  using OpType        = fetch::ml::ops::Convolution2D<TensorType>;
+  using SizeType      = fetch::math::SizeType;
+
+  auto const input_channels  = static_cast<SizeType>(state.range(0));
+  auto const output_channels = static_cast<SizeType>(state.range(1));
+  auto const input_size      = static_cast<SizeType>(state.range(2));
+  auto const kernel_size     = static_cast<SizeType>(state.range(3));
+  auto const batch_size      = static_cast<SizeType>(state.range(4));
+
+  TensorType input({input_channels, input_size, input_size, batch_size});
+  TensorType kernels({output_channels, input_channels, kernel_size, kernel_size, 1});
+  input.FillUniformRandom();
+  kernels.FillUniformRandom();
+
+  VecTensorType inputs;
+  inputs.emplace_back(std::make_shared<TensorType>(input));
+  inputs.emplace_back(std::make_shared<TensorType>(kernels));
+
+  OpType conv;
+  conv.SetAlgorithm(static_cast<typename OpType::Algorithm>(state.range(5)));
+
+  TensorType output(conv.ComputeOutputShape(inputs));
+  for (auto _ : state)
+  {
+    conv.Forward(inputs, output);
+  }
+}
+
+template <typename T>
+void BM_Convolution2D_Backward(benchmark::State &state)
+{
+  using TensorType    = typename fetch::math::Tensor<T>;
+  using VecTensorType = typename fetch::ml::ops::Ops<TensorType>::VecTensorType;
+  using OpType        = fetch::ml::ops::Convolution2D<TensorType>;
+  using SizeType      = fetch::math::SizeType;
+
+  auto const input_channels  = static_cast<SizeType>(state.range(0));
+  auto const output_channels = static_cast<SizeType>(state.range(1));
+  auto const input_size      = static_cast<SizeType>(state.range(2));
+  auto const kernel_size     = static_cast<SizeType>(state.range(3));
+  auto const batch_size      = static_cast<SizeType>(state.range(4));
+
+  TensorType input({input_channels, input_size, input_size, batch_size});
+  TensorType kernels({output_channels, input_channels, kernel_size, kernel_size, 1});
+  input.FillUniformRandom();
+  kernels.FillUniformRandom();
+
+  VecTensorType inputs;
+  inputs.emplace_back(std::make_shared<TensorType>(input));
+  inputs.emplace_back(std::make_shared<TensorType>(kernels));
+
+  OpType conv;
+  conv.SetAlgorithm(static_cast<typename OpType::Algorithm>(state.range(5)));
+
+  TensorType error_signal(conv.ComputeOutputShape(inputs));
+  error_signal.FillUniformRandom();
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(conv.Backward(inputs, error_signal));
+  }
+}
+
+// {input channels, output channels, input size, kernel size, batch size, algorithm} where the
+// algorithm is one of AUTOMATIC (0), DIRECT (1), WINOGRAD (2) or IM2COL (3)
+void Convolution2DArguments(benchmark::internal::Benchmark *b)
+{
+  std::vector<std::vector<int64_t>> const layers = {
+      {1, 8, 28, 5, 16},   // MNIST first layer
+      {3, 16, 32, 3, 8},   // CIFAR first layer
+      {16, 32, 16, 3, 8},  // CIFAR hidden layer
+      {64, 64, 28, 3, 1},  // VGG / ResNet style block
+      {32, 32, 16, 5, 4},  // 5x5 hidden layer
+      {64, 64, 14, 1, 4},  // 1x1 bottleneck
+  };
+
+  for (auto const &layer : layers)
+  {
+    for (int64_t algorithm : {0, 1, 2, 3})
+    {
+      std::vector<int64_t> args = layer;
+      args.push_back(algorithm);
+      b->Args(args);
+    }
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_Convolution2D_Forward, float)
+    ->Apply(Convolution2DArguments)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_Convolution2D_Forward, fetch::fixed_point::fp32_t)
+    ->Apply(Convolution2DArguments)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_Convolution2D_Backward, float)
+    ->Apply(Convolution2DArguments)
+    ->Unit(benchmark::kMicrosecond);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,89 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/random/lcg.hpp"
+#include "math/tensor.hpp"
+#include "ml/optimisation/hogwild_sgns_trainer.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace {
+
+using SizeType   = fetch::math::SizeType;
+using TensorType = fetch::math::Tensor<float>;
+
+constexpr SizeType VOCAB_SIZE      = 10000;
+constexpr SizeType EMBEDDING_SIZE  = 100;
+constexpr SizeType SENTENCE_LENGTH = 20;
+
+// Zipf distributed words, roughly as in natural language
+std::vector<std::vector<SizeType>> GenerateCorpus(SizeType n_words, std::vector<SizeType> &counts)
+{
+  fetch::random::LinearCongruentialGenerator rng;
+  counts.assign(VOCAB_SIZE, 0);
+
+  std::vector<std::vector<SizeType>> sentences(n_words / SENTENCE_LENGTH);
+  for (auto &sentence : sentences)
+  {
+    for (SizeType i = 0; i < SENTENCE_LENGTH; ++i)
+    {
+      auto const word =
+          static_cast<SizeType>(std::pow(static_cast<double>(VOCAB_SIZE), rng.AsDouble())) - 1;
+      sentence.push_back(word);
+      ++counts[word];
+    }
+  }
+
+  return sentences;
+}
+
+void BM_HogwildSGNS(benchmark::State &state)
+{
+  std::vector<SizeType> counts;
+  auto const            sentences = GenerateCorpus(static_cast<SizeType>(state.range(0)), counts);
+
+  auto input = std::make_shared<fetch::ml::ops::Embeddings<TensorType>>(EMBEDDING_SIZE, VOCAB_SIZE);
+  auto context =
+      std::make_shared<fetch::ml::ops::Embeddings<TensorType>>(EMBEDDING_SIZE, VOCAB_SIZE);
+
+  fetch::ml::optimisers::SGNSTrainingParams<float> params;
+  params.n_threads = static_cast<SizeType>(state.range(1));
+
+  fetch::ml::optimisers::HogwildSGNSTrainer<TensorType> trainer(input, context, params);
+
+  SizeType words{0};
+  for (auto _ : state)
+  {
+    words += trainer.Train(sentences, counts);
+  }
+
+  state.counters["Words"] =
+      benchmark::Counter(static_cast<double>(words), benchmark::Counter::kIsRate);
+}
+
+}  // namespace
+
+BENCHMARK(BM_HogwildSGNS)
+    ->Args({100000, 1})
+    ->Args({100000, 2})
+    ->Args({100000, 4})
+    ->UseRealTime()->Unit(benchmark::kMillisecond);
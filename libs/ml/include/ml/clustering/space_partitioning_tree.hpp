@@ -0,0 +1,278 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "math/base_types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <limits>
+#include <vector>
+
+namespace fetch {
+namespace ml {
+
+/**
+ * Space partitioning tree (a quad-tree in two dimensions, an octree in three) used to approximate
+ * the repulsive forces of Barnes-Hut t-SNE, see: https://arxiv.org/abs/1301.3342
+ * Every cell tracks the number of points it contains and their centre of mass. A cell which is
+ * small compared to its distance from a point is summarised by its centre of mass, which brings
+ * the cost of the repulsive forces down from O(N^2) to O(N log N).
+ * @tparam T the data type of the point coordinates
+ */
+template <typename T>
+class SpacePartitioningTree
+{
+public:
+  using DataType = T;
+  using SizeType = fetch::math::SizeType;
+
+  static constexpr SizeType MAX_DIMENSIONS = 3;
+  static constexpr SizeType MAX_DEPTH      = 48;
+
+  /**
+   * Builds the tree over a set of points
+   * @param points row major [num_points x dimensions] coordinates
+   * @param num_points number of points
+   * @param dimensions number of coordinates per point, at most MAX_DIMENSIONS
+   */
+  SpacePartitioningTree(DataType const *points, SizeType num_points, SizeType dimensions)
+    : points_(points)
+    , dimensions_(dimensions)
+    , num_children_(SizeType{1} << dimensions)
+  {
+    assert((dimensions > 0) && (dimensions <= MAX_DIMENSIONS));
+
+    // the root cell is the bounding box of all of the points
+    std::vector<DataType> minimum(dimensions, fetch::math::numeric_max<DataType>());
+    std::vector<DataType> maximum(dimensions, fetch::math::numeric_lowest<DataType>());
+    for (SizeType i{0}; i < num_points; ++i)
+    {
+      for (SizeType d{0}; d < dimensions; ++d)
+      {
+        minimum[d] = std::min(minimum[d], points[(i * dimensions) + d]);
+        maximum[d] = std::max(maximum[d], points[(i * dimensions) + d]);
+      }
+    }
+
+    SizeType const root = AddCell();
+    for (SizeType d{0}; d < dimensions; ++d)
+    {
+      DataType const half_width = (maximum[d] - minimum[d]) / DataType{2};
+
+      centres_[d]     = minimum[d] + half_width;
+      half_widths_[d] = half_width + static_cast<DataType>(1e-5);
+    }
+
+    for (SizeType i{0}; i < num_points; ++i)
+    {
+      Insert(root, i);
+    }
+  }
+
+  /**
+   * Accumulates the (unnormalised) repulsive force acting on a point in the tree
+   * @param point index of the point
+   * @param theta accuracy trade off, cells with width / distance < theta are summarised
+   * @param force output array of dimensions values which the force is added to
+   * @return the contribution of this point to the normalisation term sum_{j != i} q_ij
+   */
+  DataType ComputeNonEdgeForces(SizeType point, DataType const &theta, DataType *force) const
+  {
+    DataType const *y             = points_ + (point * dimensions_);
+    DataType const  theta_squared = theta * theta;
+
+    DataType                             sum_q{0};
+    std::array<DataType, MAX_DIMENSIONS> diff{};
+    std::vector<SizeType>                stack{0};
+
+    while (!stack.empty())
+    {
+      SizeType const cell = stack.back();
+      stack.pop_back();
+
+      // a point does not repel itself
+      SizeType const count = counts_[cell] - ((points_in_cell_[cell] == point) ? 1 : 0);
+      if (count == 0)
+      {
+        continue;
+      }
+
+      DataType distance_squared{0};
+      DataType max_width{0};
+      for (SizeType d{0}; d < dimensions_; ++d)
+      {
+        diff[d] = y[d] - centres_of_mass_[(cell * dimensions_) + d];
+        distance_squared += diff[d] * diff[d];
+        max_width = std::max(max_width, half_widths_[(cell * dimensions_) + d]);
+      }
+      max_width = max_width * DataType{2};
+
+      bool const is_leaf = (NONE == first_child_[cell]);
+      if (is_leaf || (max_width * max_width < theta_squared * distance_squared))
+      {
+        DataType const q          = DataType{1} / (DataType{1} + distance_squared);
+        DataType const multiplier = static_cast<DataType>(count) * q;
+
+        sum_q += multiplier;
+        for (SizeType d{0}; d < dimensions_; ++d)
+        {
+          force[d] += multiplier * q * diff[d];
+        }
+      }
+      else
+      {
+        for (SizeType c{0}; c < num_children_; ++c)
+        {
+          stack.push_back(first_child_[cell] + c);
+        }
+      }
+    }
+
+    return sum_q;
+  }
+
+  SizeType num_cells() const
+  {
+    return counts_.size();
+  }
+
+private:
+  static constexpr SizeType NONE = std::numeric_limits<SizeType>::max();
+
+  SizeType AddCell()
+  {
+    SizeType const cell = counts_.size();
+
+    counts_.push_back(0);
+    points_in_cell_.push_back(SizeType{NONE});
+    first_child_.push_back(SizeType{NONE});
+    centres_.resize(centres_.size() + dimensions_);
+    half_widths_.resize(half_widths_.size() + dimensions_);
+    centres_of_mass_.resize(centres_of_mass_.size() + dimensions_);
+
+    return cell;
+  }
+
+  SizeType ChildIndex(SizeType cell, DataType const *y) const
+  {
+    SizeType child{0};
+    for (SizeType d{0}; d < dimensions_; ++d)
+    {
+      if (y[d] > centres_[(cell * dimensions_) + d])
+      {
+        child |= SizeType{1} << d;
+      }
+    }
+
+    return child;
+  }
+
+  bool IsDuplicate(SizeType a, SizeType b) const
+  {
+    return std::equal(points_ + (a * dimensions_), points_ + ((a + 1) * dimensions_),
+                      points_ + (b * dimensions_));
+  }
+
+  void Subdivide(SizeType cell)
+  {
+    SizeType const first_child = counts_.size();
+    for (SizeType c{0}; c < num_children_; ++c)
+    {
+      SizeType const child = AddCell();
+
+      for (SizeType d{0}; d < dimensions_; ++d)
+      {
+        DataType const half_width = half_widths_[(cell * dimensions_) + d] / DataType{2};
+        DataType const offset     = ((c >> d) & 1u) ? half_width : -half_width;
+
+        half_widths_[(child * dimensions_) + d] = half_width;
+        centres_[(child * dimensions_) + d]     = centres_[(cell * dimensions_) + d] + offset;
+      }
+    }
+
+    first_child_[cell] = first_child;
+  }
+
+  /**
+   * Inserts a point, updating the centre of mass of every cell along its path
+   */
+  void Insert(SizeType cell, SizeType point)
+  {
+    DataType const *y = points_ + (point * dimensions_);
+
+    for (SizeType depth{0};; ++depth)
+    {
+      SizeType const previous_count = counts_[cell];
+      DataType const new_count      = static_cast<DataType>(previous_count + 1);
+
+      std::array<DataType, MAX_DIMENSIONS> previous_centre_of_mass{};
+      for (SizeType d{0}; d < dimensions_; ++d)
+      {
+        DataType &centre_of_mass   = centres_of_mass_[(cell * dimensions_) + d];
+        previous_centre_of_mass[d] = centre_of_mass;
+        centre_of_mass += (y[d] - centre_of_mass) / new_count;
+      }
+      ++counts_[cell];
+
+      if (NONE == first_child_[cell])
+      {
+        if (0 == previous_count)
+        {
+          points_in_cell_[cell] = point;
+          return;
+        }
+
+        // duplicate points (or points which can not be separated) are aggregated in a single leaf
+        if ((depth >= MAX_DEPTH) || IsDuplicate(points_in_cell_[cell], point))
+        {
+          return;
+        }
+
+        // move the existing contents of the leaf down into a new child
+        SizeType const existing = points_in_cell_[cell];
+        Subdivide(cell);
+
+        SizeType const child =
+            first_child_[cell] + ChildIndex(cell, points_ + (existing * dimensions_));
+        counts_[child]         = previous_count;
+        points_in_cell_[child] = existing;
+        std::copy(previous_centre_of_mass.begin(),
+                  previous_centre_of_mass.begin() + static_cast<std::ptrdiff_t>(dimensions_),
+                  centres_of_mass_.begin() + static_cast<std::ptrdiff_t>(child * dimensions_));
+        points_in_cell_[cell] = NONE;
+      }
+
+      cell = first_child_[cell] + ChildIndex(cell, y);
+    }
+  }
+
+  DataType const *      points_;
+  SizeType              dimensions_;
+  SizeType              num_children_;
+  std::vector<SizeType> counts_;           ///< Number of points in each cell
+  std::vector<SizeType> points_in_cell_;   ///< The point held by each leaf, if any
+  std::vector<SizeType> first_child_;      ///< Index of the first of the children of each cell
+  std::vector<DataType> centres_;          ///< [num_cells x dimensions] cell centres
+  std::vector<DataType> half_widths_;      ///< [num_cells x dimensions] cell half widths
+  std::vector<DataType> centres_of_mass_;  ///< [num_cells x dimensions] centres of mass
+};
+
+}  // namespace ml
+}  // namespace fetch
@@ -29,9 +29,18 @@
 #include "math/standard_functions/log.hpp"
 #include "math/tensor.hpp"
 #include "meta/type_traits.hpp"
+#include "ml/clustering/space_partitioning_tree.hpp"
+#include "ml/clustering/vantage_point_tree.hpp"
+#include "ml/exceptions/exceptions.hpp"
 #include "ml/ops/flatten.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace fetch {
 namespace ml {
@@ -40,6 +49,12 @@ namespace ml {
  *  Implementation of T-SNE clustering algorithm based on paper:
  *  http://www.jmlr.org/papers/volume9/vandermaaten08a/vandermaaten08a.pdf
  *  i.e. Algorithm for high dimensional data reduction for visualisation
+ *
+ *  For larger data sets the Barnes-Hut approximation described here is used:
+ *  https://arxiv.org/abs/1301.3342
+ *  The input affinities are restricted to the nearest neighbours of each point, found with a
+ *  vantage point tree, and the repulsive forces are approximated with a space partitioning tree,
+ *  bringing the cost of each iteration down from O(N^2) to O(N log N).
  */
 template <class T>
 class TSNE
@@ -53,6 +68,18 @@ public:
 
   static constexpr char const *DESCRIPTOR = "TSNE";
 
+  enum class Mode : uint8_t
+  {
+    AUTOMATIC,  ///< Barnes-Hut for at least BARNES_HUT_MIN_SIZE points, exact otherwise
+    EXACT,
+    BARNES_HUT
+  };
+
+  /// Smallest data set for which the Barnes-Hut approximation is selected automatically
+  static constexpr SizeType BARNES_HUT_MIN_SIZE = 1000;
+  /// Minimum number of points given to each thread when computing the gradient
+  static constexpr SizeType MIN_POINTS_PER_THREAD = 256;
+
   template <typename DataType>
   static constexpr math::meta::IfIsFixedPoint<DataType, DataType> tsne_tolerance()
   {
@@ -65,13 +92,19 @@ public:
     return DataType(1e-12);
   }
 
-  TSNE(TensorType const &input_matrix, TensorType const &output_matrix, DataType const &perplexity)
+  TSNE(TensorType const &input_matrix, TensorType const &output_matrix, DataType const &perplexity,
+       Mode mode = Mode::AUTOMATIC, DataType const &theta = fetch::math::Type<DataType>("0.5"))
+    : mode_(mode)
+    , theta_(theta)
   {
     Init(input_matrix, output_matrix, perplexity);
   }
 
   TSNE(TensorType const &input_matrix, SizeType const &output_dimensions,
-       DataType const &perplexity, SizeType const &random_seed)
+       DataType const &perplexity, SizeType const &random_seed, Mode mode = Mode::AUTOMATIC,
+       DataType const &theta = fetch::math::Type<DataType>("0.5"))
+    : mode_(mode)
+    , theta_(theta)
   {
     assert(input_matrix.shape().size() >= 2);
     TensorType output_matrix(
@@ -91,7 +124,10 @@ public:
                 SizeType const &final_momentum_steps, SizeType const &p_later_correction_iteration)
   {
     // Initialise variables
-    output_symmetric_affinities_.Fill(static_cast<DataType>(0));
+    if (!barnes_hut_)
+    {
+      output_symmetric_affinities_.Fill(static_cast<DataType>(0));
+    }
     DataType const min_gain = fetch::math::Type<DataType>("0.01");
     DataType       momentum = initial_momentum;
     assert(output_matrix_.shape().size() == 2);
@@ -106,13 +142,25 @@ public:
     // Start optimisation
     for (SizeType iter{0}; iter < max_iters; iter++)
     {
-      // Compute output matrix pairwise affinities
-      TensorType num;
-      CalculateSymmetricAffinitiesQ(output_matrix_, output_symmetric_affinities_, num);
+      TensorType gradient;
+      DataType   loss;
 
-      // Compute gradient
-      TensorType gradient = ComputeGradient(output_matrix_, input_symmetric_affinities_,
-                                            output_symmetric_affinities_, num);
+      if (barnes_hut_)
+      {
+        gradient = ComputeGradientBarnesHut(output_matrix_, loss);
+      }
+      else
+      {
+        // Compute output matrix pairwise affinities
+        TensorType num;
+        CalculateSymmetricAffinitiesQ(output_matrix_, output_symmetric_affinities_, num);
+
+        // Compute gradient
+        gradient = ComputeGradient(output_matrix_, input_symmetric_affinities_,
+                                   output_symmetric_affinities_, num);
+
+        loss = KlDivergence(input_symmetric_affinities_, output_symmetric_affinities_);
+      }
 
       // Perform the update
       if (iter >= final_momentum_steps)
@@ -151,15 +199,23 @@ public:
       output_matrix_ -= y_mean;
 
       // Compute current value of cost function
-      std::cout << "Iteration " << iter << ", Loss: "
-                << static_cast<double>(
-                       KlDivergence(input_symmetric_affinities_, output_symmetric_affinities_))
-                << std::endl;
+      std::cout << "Iteration " << iter << ", Loss: " << static_cast<double>(loss) << std::endl;
 
       // Later P-values correction
       if (iter == p_later_correction_iteration)
       {
-        input_symmetric_affinities_ = fetch::math::Divide(input_symmetric_affinities_, DataType(4));
+        if (barnes_hut_)
+        {
+          for (auto &value : input_values_)
+          {
+            value = value / DataType(4);
+          }
+        }
+        else
+        {
+          input_symmetric_affinities_ =
+              fetch::math::Divide(input_symmetric_affinities_, DataType(4));
+        }
       }
     }
   }
@@ -169,6 +225,26 @@ public:
     return output_matrix_.Transpose();
   }
 
+  /**
+   * Sets the number of threads used to compute the Barnes-Hut gradient. Each thread handles a
+   * contiguous range of points and the partial results are reduced in order, so the result does not
+   * depend on the number of threads.
+   * @param n_threads number of threads, at least 1
+   */
+  void SetParallelism(SizeType n_threads)
+  {
+    if (n_threads == 0)
+    {
+      throw exceptions::InvalidMode("TSNE parallelism must be at least 1");
+    }
+    n_threads_ = n_threads;
+  }
+
+  bool IsBarnesHut() const
+  {
+    return barnes_hut_;
+  }
+
 private:
   /**
    * i.e. Sets initial values of TSNE and calculate P values
@@ -196,6 +272,14 @@ private:
     // Initialise high dimensional values
     SizeType input_data_size = input_matrix_.shape().at(0);
 
+    barnes_hut_ = SelectBarnesHut(input_data_size, output_matrix.shape().at(1));
+    if (barnes_hut_)
+    {
+      CalculateSparseAffinitiesP(input_matrix_, perplexity, perplexity_tolerance, max_tries);
+      output_matrix_ = output_matrix;
+      return;
+    }
+
     // Find Pj|i values for given perplexity value within perplexity_tolerance
     input_pairwise_affinities_ = TensorType({input_data_size, input_data_size});
     CalculatePairwiseAffinitiesP(input_matrix_, input_pairwise_affinities_, perplexity,
@@ -472,6 +556,324 @@ private:
     return ret;
   }
 
+  /**
+   * i.e. Decides whether the Barnes-Hut approximation is used
+   * @param input_data_size number of data points
+   * @param output_dimensions number of output dimensions
+   * @return true if Barnes-Hut is used
+   */
+  bool SelectBarnesHut(SizeType input_data_size, SizeType output_dimensions) const
+  {
+    bool const supported = (output_dimensions <= SpacePartitioningTree<DataType>::MAX_DIMENSIONS);
+
+    switch (mode_)
+    {
+    case Mode::EXACT:
+      return false;
+    case Mode::BARNES_HUT:
+      if (!supported)
+      {
+        throw exceptions::InvalidMode(
+            "Barnes-Hut TSNE supports at most 3 output dimensions, use exact mode instead");
+      }
+      return true;
+    default:
+      return supported && (input_data_size >= BARNES_HUT_MIN_SIZE);
+    }
+  }
+
+  /**
+   * i.e. Copies a [num_points x dimensions] matrix into a row major array
+   */
+  static std::vector<DataType> RowMajor(TensorType const &matrix)
+  {
+    SizeType const num_points = matrix.shape().at(0);
+    SizeType const dimensions = matrix.shape().at(1);
+
+    std::vector<DataType> points(num_points * dimensions);
+    for (SizeType d{0}; d < dimensions; ++d)
+    {
+      for (SizeType i{0}; i < num_points; ++i)
+      {
+        points[(i * dimensions) + d] = matrix.At(i, d);
+      }
+    }
+
+    return points;
+  }
+
+  /**
+   * i.e. Sparse equivalent of Hbeta over the squared distances to the nearest neighbours of a
+   * point. The distances are offset by the smallest one, which leaves the entropy and
+   * normalised p unchanged but avoids underflow for distant neighbourhoods
+   * @param d squared distances to the neighbours, nearest first
+   * @param p output normalised conditional affinities
+   * @param beta beta = 1/(2*sigma^2)
+   * @return Shannon's entropy of p
+   */
+  DataType SparseHbeta(std::vector<DataType> const &d, std::vector<DataType> &p,
+                       DataType const &beta) const
+  {
+    DataType sum_p{0};
+    DataType sum_d_p{0};
+    for (SizeType j{0}; j < d.size(); ++j)
+    {
+      DataType const offset_d = d[j] - d.front();
+
+      p[j] = fetch::math::Exp(DataType(-1) * offset_d * beta);
+      sum_p += p[j];
+      sum_d_p += offset_d * p[j];
+    }
+
+    for (auto &value : p)
+    {
+      value = value / sum_p;
+    }
+
+    return fetch::math::Log(sum_p) + beta * sum_d_p / sum_p;
+  }
+
+  /**
+   * i.e. Computes the symmetric input affinities Pij over the nearest neighbours of each point,
+   * stored in compressed sparse row form
+   * @param input_matrix input Tensor of input matrix values
+   * @param target_perplexity input Target perplexity value
+   * @param tolerance input Tolerance of perplexity value
+   * @param max_tries maximum number of steps of the binary search for beta
+   */
+  void CalculateSparseAffinitiesP(TensorType const &input_matrix,
+                                  DataType const &target_perplexity, DataType const &tolerance,
+                                  SizeType const &max_tries)
+  {
+    SizeType const input_data_size = input_matrix.shape().at(0);
+    SizeType const num_neighbours  = std::min(
+        input_data_size - 1, static_cast<SizeType>(3 * static_cast<double>(target_perplexity)));
+
+    std::vector<DataType> const      points = RowMajor(input_matrix);
+    VantagePointTree<DataType> const tree(points.data(), input_data_size,
+                                          input_matrix.shape().at(1));
+
+    DataType const target_entropy = fetch::math::Log(target_perplexity);
+    DataType const inf            = math::numeric_max<DataType>();
+    DataType const neg_inf        = math::numeric_lowest<DataType>();
+
+    // (row, column, Pj|i) for both Pj|i and its transpose
+    std::vector<std::tuple<SizeType, SizeType, DataType>> entries;
+    entries.reserve(2 * input_data_size * num_neighbours);
+
+    std::vector<SizeType> indices;
+    std::vector<DataType> distances;
+    std::vector<SizeType> neighbours(num_neighbours);
+    std::vector<DataType> d(num_neighbours);
+    std::vector<DataType> p(num_neighbours);
+
+    for (SizeType i{0}; i < input_data_size; i++)
+    {
+      tree.Search(i, num_neighbours + 1, indices, distances);
+
+      // exclude the point itself from its neighbours
+      SizeType n{0};
+      for (SizeType j{0}; (j < indices.size()) && (n < num_neighbours); ++j)
+      {
+        if (indices[j] != i)
+        {
+          neighbours[n] = indices[j];
+          d[n]          = distances[j] * distances[j];
+          ++n;
+        }
+      }
+
+      // binary search for the beta matching the target perplexity
+      DataType beta{1};
+      DataType beta_min     = neg_inf;
+      DataType beta_max     = inf;
+      DataType entropy_diff = SparseHbeta(d, p, beta) - target_entropy;
+      SizeType tries        = 0;
+
+      while (fetch::math::Abs(entropy_diff) > tolerance && tries < max_tries)
+      {
+        if (entropy_diff > 0)
+        {
+          beta_min = beta;
+          beta     = (beta_max == inf) ? beta * DataType(2) : (beta + beta_max) / DataType(2);
+        }
+        else
+        {
+          beta_max = beta;
+          beta     = (beta_min == neg_inf) ? beta / DataType(2) : (beta + beta_min) / DataType(2);
+        }
+
+        entropy_diff = SparseHbeta(d, p, beta) - target_entropy;
+        tries++;
+      }
+
+      for (SizeType j{0}; j < num_neighbours; ++j)
+      {
+        entries.emplace_back(i, neighbours[j], p[j]);
+        entries.emplace_back(neighbours[j], i, p[j]);
+      }
+    }
+
+    // Pij=(Pj|i+Pi|j)/sum(Pij), merging the duplicate entries
+    std::sort(entries.begin(), entries.end(),
+              [](std::tuple<SizeType, SizeType, DataType> const &a,
+                 std::tuple<SizeType, SizeType, DataType> const &b) {
+                return std::make_pair(std::get<0>(a), std::get<1>(a)) <
+                       std::make_pair(std::get<0>(b), std::get<1>(b));
+              });
+
+    input_row_offsets_.assign(input_data_size + 1, 0);
+    input_columns_.clear();
+    input_values_.clear();
+
+    DataType sum{0};
+    for (SizeType e{0}; e < entries.size(); ++e)
+    {
+      SizeType const row    = std::get<0>(entries[e]);
+      SizeType const column = std::get<1>(entries[e]);
+      DataType const value  = std::get<2>(entries[e]);
+
+      bool const duplicate = (e > 0) && (row == std::get<0>(entries[e - 1])) &&
+                             (column == std::get<1>(entries[e - 1]));
+
+      if (duplicate)
+      {
+        input_values_.back() += value;
+      }
+      else
+      {
+        input_columns_.push_back(column);
+        input_values_.push_back(value);
+        ++input_row_offsets_[row + 1];
+      }
+
+      sum += value;
+    }
+
+    for (SizeType i{0}; i < input_data_size; ++i)
+    {
+      input_row_offsets_[i + 1] += input_row_offsets_[i];
+    }
+
+    // Normalise, with early exaggeration
+    for (auto &value : input_values_)
+    {
+      value = (value / sum) * DataType(4);
+    }
+  }
+
+  /**
+   * i.e. Calls function(begin, end) over contiguous ranges of [0, size) on up to n_threads_
+   * threads, including the calling thread
+   */
+  template <typename Function>
+  void ParallelFor(SizeType size, Function const &function) const
+  {
+    SizeType const n_threads =
+        std::max(SizeType{1}, std::min(n_threads_, size / MIN_POINTS_PER_THREAD));
+    SizeType const chunk_size = (size + n_threads - 1) / n_threads;
+
+    std::vector<std::thread> workers;
+    workers.reserve(n_threads - 1);
+    for (SizeType t{1}; t < n_threads; ++t)
+    {
+      SizeType const begin = std::min(size, t * chunk_size);
+      SizeType const end   = std::min(size, begin + chunk_size);
+      workers.emplace_back([&function, begin, end]() { function(begin, end); });
+    }
+
+    function(0, std::min(size, chunk_size));
+
+    for (auto &worker : workers)
+    {
+      worker.join();
+    }
+  }
+
+  /**
+   * i.e. Calculates the Barnes-Hut approximation of the gradient of the Kullback-Leibler divergence
+   * between the sparse input affinities P and the Student-t based joint probability distribution Q
+   * @param output_matrix output low dimensional values tensor
+   * @param kl_divergence output value of the cost function
+   * @return output_matrix shaped tensor of gradient values
+   */
+  TensorType ComputeGradientBarnesHut(TensorType const &output_matrix, DataType &kl_divergence)
+  {
+    SizeType const n          = output_matrix.shape().at(0);
+    SizeType const dimensions = output_matrix.shape().at(1);
+
+    std::vector<DataType> const           y = RowMajor(output_matrix);
+    SpacePartitioningTree<DataType> const tree(y.data(), n, dimensions);
+
+    std::vector<DataType> attractive(n * dimensions, DataType{0});
+    std::vector<DataType> repulsive(n * dimensions, DataType{0});
+    std::vector<DataType> sum_q(n, DataType{0});
+    std::vector<DataType> row_kl(n, DataType{0});
+
+    ParallelFor(n, [&](SizeType begin, SizeType end) {
+      for (SizeType i = begin; i < end; ++i)
+      {
+        DataType const *y_i = y.data() + (i * dimensions);
+
+        // Attractive forces over the sparse input affinities
+        for (SizeType e = input_row_offsets_[i]; e < input_row_offsets_[i + 1]; ++e)
+        {
+          DataType const *y_j = y.data() + (input_columns_[e] * dimensions);
+
+          DataType distance_squared{0};
+          for (SizeType d{0}; d < dimensions; ++d)
+          {
+            DataType const diff = y_i[d] - y_j[d];
+            distance_squared += diff * diff;
+          }
+
+          DataType const num        = DataType{1} / (DataType{1} + distance_squared);
+          DataType const multiplier = input_values_[e] * num;
+          for (SizeType d{0}; d < dimensions; ++d)
+          {
+            attractive[(i * dimensions) + d] += multiplier * (y_i[d] - y_j[d]);
+          }
+
+          // KL(P||Q) without the normalisation term, which is added once Z is known
+          if (input_values_[e] > DataType{0})
+          {
+            row_kl[i] += input_values_[e] *
+                         (fetch::math::Log(input_values_[e]) - fetch::math::Log(num));
+          }
+        }
+
+        // Repulsive forces approximated with the space partitioning tree
+        sum_q[i] = tree.ComputeNonEdgeForces(i, theta_, repulsive.data() + (i * dimensions));
+      }
+    });
+
+    // Reduce in point order so that the result is independent of the number of threads
+    DataType z{0};
+    DataType sum_p{0};
+    kl_divergence = DataType{0};
+    for (SizeType i{0}; i < n; ++i)
+    {
+      z += sum_q[i];
+      kl_divergence += row_kl[i];
+    }
+    for (auto const &value : input_values_)
+    {
+      sum_p += value;
+    }
+    kl_divergence += sum_p * fetch::math::Log(z);
+
+    TensorType ret(output_matrix.shape());
+    for (SizeType d{0}; d < dimensions; ++d)
+    {
+      for (SizeType i{0}; i < n; ++i)
+      {
+        ret(i, d) = attractive[(i * dimensions) + d] - (repulsive[(i * dimensions) + d] / z);
+      }
+    }
+
+    return ret;
+  }
+
   /**
    * i.e. if any value of input matrix is lower than min, sets it to min
    * @param matrix input tensor
@@ -490,6 +892,16 @@ private:
   TensorType input_pairwise_affinities_, input_symmetric_affinities_;
   TensorType output_symmetric_affinities_;
   RNG        rng_;
+
+  Mode     mode_{Mode::AUTOMATIC};
+  DataType theta_;
+  bool     barnes_hut_{false};
+  SizeType n_threads_{std::max(SizeType{1}, SizeType{std::thread::hardware_concurrency()})};
+
+  // Barnes-Hut input affinities in compressed sparse row form
+  std::vector<SizeType> input_row_offsets_;
+  std::vector<SizeType> input_columns_;
+  std::vector<DataType> input_values_;
 };
 
 }  // namespace ml
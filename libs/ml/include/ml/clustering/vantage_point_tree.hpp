@@ -0,0 +1,222 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/random/lcg.hpp"
+#include "math/base_types.hpp"
+#include "math/standard_functions/sqrt.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace fetch {
+namespace ml {
+
+/**
+ * Vantage point tree for exact k nearest neighbour queries under the euclidean metric, see:
+ * https://dl.acm.org/citation.cfm?id=313789
+ * Each node partitions the remaining points into those inside and outside a ball around its
+ * vantage point, so that whole subtrees can be pruned with the triangle inequality.
+ * @tparam T the data type of the point coordinates
+ */
+template <typename T>
+class VantagePointTree
+{
+public:
+  using DataType = T;
+  using SizeType = fetch::math::SizeType;
+
+  /**
+   * Builds the tree over a set of points
+   * @param points row major [num_points x dimensions] coordinates, which must outlive the tree
+   * @param num_points number of points
+   * @param dimensions number of coordinates per point
+   */
+  VantagePointTree(DataType const *points, SizeType num_points, SizeType dimensions)
+    : points_(points)
+    , dimensions_(dimensions)
+  {
+    order_.resize(num_points);
+    for (SizeType i{0}; i < num_points; ++i)
+    {
+      order_[i] = i;
+    }
+
+    nodes_.reserve(num_points);
+    root_ = Build(0, num_points);
+  }
+
+  /**
+   * Finds the k nearest neighbours of one of the points in the tree, including the point itself
+   * @param query index of the query point
+   * @param k number of neighbours to find
+   * @param indices output indices of the neighbours, nearest first
+   * @param distances output euclidean distances of the neighbours, nearest first
+   */
+  void Search(SizeType query, SizeType k, std::vector<SizeType> &indices,
+              std::vector<DataType> &distances) const
+  {
+    Heap     heap;
+    DataType tau = fetch::math::numeric_max<DataType>();
+    Search(root_, query, k, heap, tau);
+
+    indices.resize(heap.size());
+    distances.resize(heap.size());
+    for (SizeType i = heap.size(); i > 0; --i)
+    {
+      distances[i - 1] = heap.top().first;
+      indices[i - 1]   = heap.top().second;
+      heap.pop();
+    }
+  }
+
+private:
+  static constexpr SizeType NONE = std::numeric_limits<SizeType>::max();
+
+  struct Node
+  {
+    SizeType point{NONE};    ///< The vantage point of this node
+    DataType threshold{0};   ///< Radius of the ball around the vantage point
+    SizeType inside{NONE};   ///< Child containing the points within the ball
+    SizeType outside{NONE};  ///< Child containing the points outside the ball
+  };
+
+  using Neighbour = std::pair<DataType, SizeType>;
+  using Heap      = std::priority_queue<Neighbour>;  ///< Max heap of the current neighbours
+
+  DataType Distance(SizeType a, SizeType b) const
+  {
+    DataType const *x = points_ + (a * dimensions_);
+    DataType const *y = points_ + (b * dimensions_);
+
+    DataType sum{0};
+    for (SizeType d{0}; d < dimensions_; ++d)
+    {
+      DataType const diff = x[d] - y[d];
+      sum += diff * diff;
+    }
+
+    return fetch::math::Sqrt(sum);
+  }
+
+  /**
+   * Recursively builds the subtree over order_[lower, upper)
+   * @return index of the root node of the subtree
+   */
+  SizeType Build(SizeType lower, SizeType upper)
+  {
+    if (lower == upper)
+    {
+      return NONE;
+    }
+
+    SizeType const index = nodes_.size();
+    nodes_.emplace_back();
+
+    // choose a random vantage point and move it to the front of the range
+    std::swap(order_[lower], order_[lower + (rng_() % (upper - lower))]);
+    SizeType const vantage_point = order_[lower];
+    nodes_[index].point          = vantage_point;
+
+    if (upper - lower > 1)
+    {
+      // partition the remaining points around the median distance to the vantage point
+      SizeType const median = (lower + upper) / 2;
+      std::nth_element(order_.begin() + static_cast<std::ptrdiff_t>(lower + 1),
+                       order_.begin() + static_cast<std::ptrdiff_t>(median),
+                       order_.begin() + static_cast<std::ptrdiff_t>(upper),
+                       [this, vantage_point](SizeType a, SizeType b) {
+                         return Distance(vantage_point, a) < Distance(vantage_point, b);
+                       });
+
+      nodes_[index].threshold = Distance(vantage_point, order_[median]);
+
+      SizeType const inside  = Build(lower + 1, median);
+      SizeType const outside = Build(median, upper);
+      nodes_[index].inside   = inside;
+      nodes_[index].outside  = outside;
+    }
+
+    return index;
+  }
+
+  void Search(SizeType index, SizeType query, SizeType k, Heap &heap, DataType &tau) const
+  {
+    if (NONE == index)
+    {
+      return;
+    }
+
+    Node const &   node     = nodes_[index];
+    DataType const distance = Distance(node.point, query);
+
+    if (distance < tau)
+    {
+      heap.emplace(distance, node.point);
+      if (heap.size() > k)
+      {
+        heap.pop();
+      }
+
+      if (heap.size() == k)
+      {
+        tau = heap.top().first;
+      }
+    }
+
+    // until k neighbours have been found both subtrees have to be searched
+    if (distance < node.threshold)
+    {
+      if ((heap.size() < k) || (distance - tau <= node.threshold))
+      {
+        Search(node.inside, query, k, heap, tau);
+      }
+
+      if ((heap.size() < k) || (distance + tau >= node.threshold))
+      {
+        Search(node.outside, query, k, heap, tau);
+      }
+    }
+    else
+    {
+      if ((heap.size() < k) || (distance + tau >= node.threshold))
+      {
+        Search(node.outside, query, k, heap, tau);
+      }
+
+      if ((heap.size() < k) || (distance - tau <= node.threshold))
+      {
+        Search(node.inside, query, k, heap, tau);
+      }
+    }
+  }
+
+  DataType const *                          points_;
+  SizeType                                  dimensions_;
+  std::vector<SizeType>                     order_;
+  std::vector<Node>                         nodes_;
+  SizeType                                  root_{NONE};
+  fetch::random::LinearCongruentialGenerator rng_;
+};
+
+}  // namespace ml
+}  // namespace fetch
@@ -0,0 +1,374 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "math/base_types.hpp"
+#include "ml/core/node.hpp"
+#include "ml/exceptions/exceptions.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fetch {
+namespace ml {
+
+template <class T>
+class Graph;
+
+/**
+ * Buffer usage of the passes run through the execution plans of a graph, including the graphs
+ * of its layers. A step is a forward pass and the backward pass which follows it.
+ *
+ * Allocations count the tensors allocated for node outputs and error signal buffers, whether by the
+ * plan when the input shapes change or by ops which return new error signals instead of writing
+ * into the buffers they are given. Temporaries allocated inside the ops are not counted.
+ */
+struct ExecutionStats
+{
+  using SizeType = fetch::math::SizeType;
+
+  SizeType steps{0};              ///< Number of forward passes run
+  SizeType allocations{0};        ///< Tensors allocated during the last step
+  SizeType total_allocations{0};  ///< Tensors allocated over all steps
+  SizeType activation_bytes{0};   ///< Bytes held by node outputs
+  SizeType gradient_bytes{0};     ///< Bytes held by error signal buffers
+  SizeType peak_bytes{0};         ///< Maximum of activation_bytes + gradient_bytes
+};
+
+/**
+ * The order in which the nodes needed to compute one target node are executed, built once when
+ * the target is first evaluated after compilation.
+ *
+ * Forward evaluates the nodes in topological order, so that every node finds its inputs already
+ * cached, and then sizes the error signal buffers of the plan to the outputs. Every node has a
+ * buffer for the signal of its output, into which the signals of nodes feeding several others are
+ * summed before backpropagating through them once, and a buffer for the signal of each of its
+ * inputs, which its op writes into. The buffers are kept between steps, so that once the input
+ * shapes settle a step allocates nothing, provided the ops write into the buffers they are given.
+ * @tparam TensorType
+ */
+template <typename TensorType>
+class ExecutionPlan
+{
+public:
+  using SizeType    = fetch::math::SizeType;
+  using DataType    = typename TensorType::Type;
+  using NodeType    = Node<TensorType>;
+  using NodePtrType = std::shared_ptr<NodeType>;
+  using GraphType   = Graph<TensorType>;
+
+  explicit ExecutionPlan(NodePtrType const &target);
+
+  std::shared_ptr<TensorType> Forward(bool is_training, ExecutionStats &stats);
+  void                        Backward(TensorType const &error_signal, ExecutionStats &stats);
+
+  std::vector<TensorType> const &LeafErrorSignals(NodeType const *node) const;
+
+  SizeType size() const
+  {
+    return order_.size();
+  }
+
+private:
+  void AddNode(NodePtrType const &node);
+  void AllocateErrorSignals();
+  void Accumulate(SizeType index, TensorType const &error_signal);
+  void UpdateStats(ExecutionStats &stats) const;
+
+  std::vector<NodePtrType>                       order_;      ///< Nodes in topological order
+  std::vector<std::vector<SizeType>>             inputs_;     ///< Positions of node inputs
+  std::unordered_map<NodeType const *, SizeType> positions_;  ///< Position of each node
+  std::vector<GraphType *>                       subgraphs_;  ///< Ops of nodes which are graphs
+
+  std::vector<TensorType>              error_signals_;     ///< Summed error signal of each node
+  std::vector<uint8_t>                 has_error_signal_;  ///< Whether a node received a signal
+  std::vector<std::vector<TensorType>> op_error_signals_;  ///< Signals written by each op
+  std::vector<DataType const *>        op_storage_;        ///< Storage of the signals of an op
+
+  SizeType allocations_{0};  ///< Tensors allocated during the current step
+};
+
+/**
+ * Orders the target and all of the nodes it depends on
+ * @param target the node whose output the plan computes
+ */
+template <typename TensorType>
+ExecutionPlan<TensorType>::ExecutionPlan(NodePtrType const &target)
+{
+  AddNode(target);
+
+  error_signals_.resize(order_.size());
+  has_error_signal_.resize(order_.size(), 0);
+  op_error_signals_.resize(order_.size());
+  for (SizeType i = 0; i < order_.size(); ++i)
+  {
+    op_error_signals_[i].resize(inputs_[i].size());
+  }
+}
+
+/**
+ * Depth first traversal which appends every node after all of its inputs
+ */
+template <typename TensorType>
+void ExecutionPlan<TensorType>::AddNode(NodePtrType const &node)
+{
+  if (positions_.find(node.get()) != positions_.end())
+  {
+    return;
+  }
+
+  std::vector<SizeType> inputs;
+  for (auto const &input : node->GetInputs())
+  {
+    auto input_ptr = input.lock();
+    if (!input_ptr)
+    {
+      throw std::runtime_error("Unable to lock weak pointer.");
+    }
+
+    AddNode(input_ptr);
+    inputs.push_back(positions_.at(input_ptr.get()));
+  }
+
+  positions_[node.get()] = order_.size();
+  order_.push_back(node);
+  inputs_.push_back(std::move(inputs));
+
+  auto graph_ptr = dynamic_cast<GraphType *>(node->GetOp().get());
+  if (graph_ptr)
+  {
+    subgraphs_.push_back(graph_ptr);
+  }
+}
+
+/**
+ * Evaluates every node of the plan, starting a new step
+ * @return the output of the target node
+ */
+template <typename TensorType>
+std::shared_ptr<TensorType> ExecutionPlan<TensorType>::Forward(bool            is_training,
+                                                               ExecutionStats &stats)
+{
+  allocations_      = 0;
+  stats.allocations = 0;
+  ++stats.steps;
+
+  std::shared_ptr<TensorType> output;
+  for (auto const &node : order_)
+  {
+    SizeType const previous_allocations = node->output_allocations();
+    output                              = node->Evaluate(is_training);
+    allocations_ += node->output_allocations() - previous_allocations;
+  }
+
+  AllocateErrorSignals();
+  UpdateStats(stats);
+
+  return output;
+}
+
+/**
+ * Gives the error signal buffers the shapes of the node outputs they belong to, reallocating only
+ * the buffers whose shapes changed
+ */
+template <typename TensorType>
+void ExecutionPlan<TensorType>::AllocateErrorSignals()
+{
+  // the signal of the target belongs to the caller
+  for (SizeType i = 0; i + 1 < order_.size(); ++i)
+  {
+    if (error_signals_[i].shape() != order_[i]->output_shape())
+    {
+      error_signals_[i] = TensorType(order_[i]->output_shape());
+      ++allocations_;
+    }
+  }
+
+  for (SizeType i = 0; i < order_.size(); ++i)
+  {
+    auto const &inputs = inputs_[i];
+    for (SizeType j = 0; j < inputs.size(); ++j)
+    {
+      TensorType &buffer = op_error_signals_[i][j];
+      if (buffer.shape() != order_[inputs[j]]->output_shape())
+      {
+        buffer = TensorType(order_[inputs[j]]->output_shape());
+        ++allocations_;
+      }
+    }
+  }
+}
+
+/**
+ * Backpropagates an error signal from the target through every node of the plan. Forward must
+ * have been called first
+ * @param error_signal the error signal of the target
+ */
+template <typename TensorType>
+void ExecutionPlan<TensorType>::Backward(TensorType const &error_signal, ExecutionStats &stats)
+{
+  std::fill(has_error_signal_.begin(), has_error_signal_.end(), 0);
+
+  // the target does not feed any node of the plan so its signal never needs summing
+  SizeType const target     = order_.size() - 1;
+  error_signals_[target]    = error_signal;
+  has_error_signal_[target] = 1;
+
+  for (SizeType i = order_.size(); i > 0; --i)
+  {
+    SizeType const index = i - 1;
+    if (has_error_signal_[index] == 0)
+    {
+      continue;
+    }
+
+    auto &error_signals = op_error_signals_[index];
+
+    op_storage_.clear();
+    for (auto const &signal : error_signals)
+    {
+      op_storage_.push_back(signal.data().pointer());
+    }
+
+    order_[index]->BackwardInto(error_signals_[index], error_signals);
+
+    // signals the op did not write into the buffers it was given were allocated by the op
+    for (SizeType j = 0; j < error_signals.size(); ++j)
+    {
+      if ((j >= op_storage_.size()) || (error_signals[j].data().pointer() != op_storage_[j]))
+      {
+        ++allocations_;
+      }
+    }
+
+    auto const &inputs = inputs_[index];
+    if (inputs.empty())
+    {
+      continue;
+    }
+
+    if (error_signals.size() != inputs.size())
+    {
+      throw exceptions::InvalidMode("op returned an error signal for each of " +
+                                    std::to_string(error_signals.size()) + " of " +
+                                    std::to_string(inputs.size()) + " inputs");
+    }
+
+    for (SizeType j = 0; j < inputs.size(); ++j)
+    {
+      Accumulate(inputs[j], error_signals[j]);
+    }
+  }
+
+  UpdateStats(stats);
+}
+
+/**
+ * @return the error signals produced by a node without inputs during the last backward pass, or
+ * no signals if the node is not part of the plan
+ */
+template <typename TensorType>
+std::vector<TensorType> const &ExecutionPlan<TensorType>::LeafErrorSignals(
+    NodeType const *node) const
+{
+  static std::vector<TensorType> const none{};
+
+  auto it = positions_.find(node);
+  if ((it == positions_.end()) || (has_error_signal_[it->second] == 0))
+  {
+    return none;
+  }
+
+  return op_error_signals_[it->second];
+}
+
+/**
+ * Adds an error signal to the buffer of a node, which is only reallocated if the signal does not
+ * have the shape of the output of the node
+ */
+template <typename TensorType>
+void ExecutionPlan<TensorType>::Accumulate(SizeType index, TensorType const &error_signal)
+{
+  TensorType &buffer = error_signals_[index];
+
+  if (has_error_signal_[index] != 0)
+  {
+    buffer.InlineAdd(error_signal);
+    return;
+  }
+
+  if (buffer.shape() == error_signal.shape())
+  {
+    buffer.Assign(error_signal);
+  }
+  else
+  {
+    buffer = error_signal.Copy();
+    ++allocations_;
+  }
+
+  has_error_signal_[index] = 1;
+}
+
+template <typename TensorType>
+void ExecutionPlan<TensorType>::UpdateStats(ExecutionStats &stats) const
+{
+  SizeType activation_bytes{0};
+  SizeType gradient_bytes{0};
+  for (SizeType i = 0; i < order_.size(); ++i)
+  {
+    activation_bytes += order_[i]->output_size() * sizeof(DataType);
+
+    // the signal of the target belongs to the caller
+    if (i + 1 < order_.size())
+    {
+      gradient_bytes += error_signals_[i].size() * sizeof(DataType);
+    }
+
+    for (auto const &signal : op_error_signals_[i])
+    {
+      gradient_bytes += signal.size() * sizeof(DataType);
+    }
+  }
+
+  SizeType allocations = allocations_;
+  for (auto const *subgraph : subgraphs_)
+  {
+    auto const &subgraph_stats = subgraph->GetExecutionStats();
+
+    activation_bytes += subgraph_stats.activation_bytes;
+    gradient_bytes += subgraph_stats.gradient_bytes;
+    allocations += subgraph_stats.allocations;
+  }
+
+  // allocations only grow during a step, which starts with a forward pass resetting them
+  assert(allocations >= stats.allocations);
+  stats.total_allocations += allocations - stats.allocations;
+  stats.allocations      = allocations;
+  stats.activation_bytes = activation_bytes;
+  stats.gradient_bytes   = gradient_bytes;
+  stats.peak_bytes       = std::max(stats.peak_bytes, activation_bytes + gradient_bytes);
+}
+
+}  // namespace ml
+}  // namespace fetch
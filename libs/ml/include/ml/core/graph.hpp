@@ -17,6 +17,7 @@
 //
 //------------------------------------------------------------------------------
 
+#include "ml/core/execution_plan.hpp"
 #include "ml/core/node.hpp"
 #include "ml/meta/ml_type_traits.hpp"
 #include "ml/ops/weights.hpp"
@@ -91,6 +92,7 @@ public:
   using RegPtrType       = std::shared_ptr<fetch::ml::regularisers::Regulariser<T>>;
   using SPType           = GraphSaveableParams<TensorType>;
   using OpPtrType        = std::shared_ptr<fetch::ml::ops::Ops<TensorType>>;
+  using PlanType         = ExecutionPlan<TensorType>;
 
   static constexpr char const *DESCRIPTOR = "Graph";
 
@@ -157,6 +159,13 @@ public:
 
   void ResetGradients();
 
+  //////////////////////////////
+  /// public execution stats ///
+  //////////////////////////////
+
+  ExecutionStats const &GetExecutionStats() const;
+  void                  ResetExecutionStats();
+
 protected:
   std::map<std::string, NodePtrType>                            nodes_;
   std::map<std::string, NodePtrType>                            trainable_lookup_;
@@ -166,9 +175,16 @@ protected:
   void       InsertSharedCopy(std::shared_ptr<Graph<TensorType>> output_ptr);
   TensorType ForwardPropagate(std::string const &node_name, bool is_training = true);
 
+  ArrayPtrType EvaluatePlan(std::string const &node_name, bool is_training);
+  PlanType &   BackPropagatePlan(std::string const &node_name, TensorType const &error_signal);
+
 private:
   GraphState graph_state_ = GraphState::NOT_COMPILED;
 
+  // execution plans of every node evaluated since the last compilation
+  std::map<std::string, PlanType> plans_;
+  ExecutionStats                  stats_;
+
   friend class optimisers::Optimiser<TensorType>;
   friend class model::ModelInterface<TensorType>;
   friend class dmlf::collective_learning::ClientAlgorithm<TensorType>;
@@ -191,6 +207,8 @@ private:
 
   void ResetGraphCache(bool input_size_changed, std::shared_ptr<Node<T>> n = {});
 
+  PlanType &GetExecutionPlan(std::string const &node_name);
+
   //////////////////////////////////////////
   /// recursive implementation functions ///
   //////////////////////////////////////////
@@ -243,6 +261,7 @@ std::string Graph<TensorType>::AddNode(std::string const &             node_name
                                        std::vector<std::string> const &inputs, Params... params)
 {
   graph_state_ = GraphState::NOT_COMPILED;
+  plans_.clear();
 
   // guarantee unique op name
   std::string updated_name;
@@ -283,6 +302,7 @@ template <typename TensorType>
 void Graph<TensorType>::ResetCompile()
 {
   graph_state_ = GraphState::NOT_COMPILED;
+  plans_.clear();
 
   for (auto &connection : connections_)
   {
@@ -431,7 +451,7 @@ TensorType Graph<TensorType>::ForwardImplementation(std::string const &node_name
     case GraphState::UPDATED:
     {
       graph_state_ = GraphState::EVALUATED;
-      auto ret     = (*(nodes_[node_name]->Evaluate(is_training)));
+      auto ret     = *EvaluatePlan(node_name, is_training);
       if (evaluate_mode)
       {
         return ret.Copy();
@@ -481,7 +501,7 @@ void Graph<TensorType>::BackPropagate(std::string const &node_name, TensorType c
     case GraphState::BACKWARD:
     case GraphState::UPDATED:
     {
-      nodes_[node_name]->BackPropagate(error_signal);
+      BackPropagatePlan(node_name, error_signal);
       graph_state_ = GraphState::BACKWARD;
       break;
     }
@@ -498,10 +518,60 @@ void Graph<TensorType>::BackPropagate(std::string const &node_name, TensorType c
   }
 }
 
+/**
+ * Buffer usage of the forward and backward passes run through this graph, including the graphs
+ * of its layers
+ * @tparam TensorType
+ * @return
+ */
+template <typename TensorType>
+ExecutionStats const &Graph<TensorType>::GetExecutionStats() const
+{
+  return stats_;
+}
+
+template <typename TensorType>
+void Graph<TensorType>::ResetExecutionStats()
+{
+  stats_ = ExecutionStats{};
+}
+
 /////////////////////////
 /// PROTECTED METHODS ///
 /////////////////////////
 
+/**
+ * Evaluates a node and everything it depends on through its execution plan, without any of the
+ * compilation and state checks of Evaluate
+ * @tparam TensorType
+ * @param node_name name of the node to evaluate
+ * @param is_training
+ * @return pointer to the cached output of the node
+ */
+template <typename TensorType>
+typename Graph<TensorType>::ArrayPtrType Graph<TensorType>::EvaluatePlan(
+    std::string const &node_name, bool is_training)
+{
+  return GetExecutionPlan(node_name).Forward(is_training, stats_);
+}
+
+/**
+ * Backpropagates an error signal from a node through its execution plan, without any of the
+ * compilation and state checks of BackPropagate
+ * @tparam TensorType
+ * @param node_name name of the node to backpropagate from
+ * @param error_signal
+ * @return the plan, which holds the error signals of the nodes without inputs
+ */
+template <typename TensorType>
+typename Graph<TensorType>::PlanType &Graph<TensorType>::BackPropagatePlan(
+    std::string const &node_name, TensorType const &error_signal)
+{
+  auto &plan = GetExecutionPlan(node_name);
+  plan.Backward(error_signal, stats_);
+  return plan;
+}
+
 ///////////////////////
 /// PRIVATE METHODS ///
 ///////////////////////
@@ -688,6 +758,8 @@ void Graph<TensorType>::ApplySparseGradients(std::vector<TensorType> &grad,
 template <typename T>
 bool Graph<T>::InsertNode(std::string const &node_name, NodePtrType node_ptr)
 {
+  plans_.clear();
+
   // put node in look up table
   nodes_[node_name] = node_ptr;
   return nodes_.find(node_name) != nodes_.end();
@@ -1014,6 +1086,26 @@ void Graph<TensorType>::LinkNodesInGraph(std::string const &             node_na
   }
 }
 
+/**
+ * Returns the execution plan of a node, building it on first use. Plans are discarded whenever
+ * the structure of the graph changes
+ * @tparam TensorType
+ * @param node_name
+ * @return
+ */
+template <typename TensorType>
+typename Graph<TensorType>::PlanType &Graph<TensorType>::GetExecutionPlan(
+    std::string const &node_name)
+{
+  auto it = plans_.find(node_name);
+  if (it == plans_.end())
+  {
+    it = plans_.emplace(node_name, PlanType{nodes_.at(node_name)}).first;
+  }
+
+  return it->second;
+}
+
 /**
  * generates a new variable name if necessary to ensure uniqueness within graph
  * @param pre_string
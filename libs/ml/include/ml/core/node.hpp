@@ -47,6 +47,8 @@ private:
 
 public:
   using DataType        = typename TensorType::Type;
+  using SizeType        = fetch::math::SizeType;
+  using SizeVector      = fetch::math::SizeVector;
   using NodeWeakPtrType = std::weak_ptr<Node<TensorType>>;
 
   using VecTensorType    = typename fetch::ml::ops::Ops<TensorType>::VecTensorType;
@@ -108,10 +110,13 @@ public:
   VecTensorType               GatherInputs() const;
   std::shared_ptr<TensorType> Evaluate(bool is_training);
 
-  NodeErrorMapType BackPropagate(TensorType const &error_signal);
+  std::vector<TensorType> Backward(TensorType const &error_signal);
+  void BackwardInto(TensorType const &error_signal, std::vector<TensorType> &error_signals);
+  NodeErrorMapType        BackPropagate(TensorType const &error_signal);
 
   void                                AddInput(NodeWeakPtrType const &i);
   std::vector<std::string>            GetInputNames();
+  std::vector<NodeWeakPtrType> const &GetInputs() const;
   void                                AddOutput(NodeWeakPtrType const &o);
   std::vector<NodeWeakPtrType> const &GetOutputs() const;
   void                                ResetCache(bool input_size_changed);
@@ -141,6 +146,33 @@ public:
     return static_cast<bool>(cached_output_status_ == CachedOutputState::VALID_CACHE);
   }
 
+  /**
+   * returns the number of elements of the cached output
+   * @return
+   */
+  SizeType output_size() const
+  {
+    return cached_output_.size();
+  }
+
+  /**
+   * returns the shape of the cached output
+   * @return
+   */
+  SizeVector const &output_shape() const
+  {
+    return cached_output_.shape();
+  }
+
+  /**
+   * returns the number of times the cached output has been reallocated to a new shape
+   * @return
+   */
+  SizeType output_allocations() const
+  {
+    return output_allocations_;
+  }
+
 private:
   std::vector<NodeWeakPtrType> input_nodes_;
   std::vector<NodeWeakPtrType> outputs_;
@@ -149,6 +181,7 @@ private:
   TensorType        cached_output_;
   CachedOutputState cached_output_status_;
   OpType            operation_type_;
+  SizeType          output_allocations_ = 0;
 
   std::shared_ptr<ops::Ops<TensorType>> op_ptr_;
 };
@@ -219,6 +252,7 @@ std::shared_ptr<TensorType> Node<TensorType>::Evaluate(bool is_training)
           output_shape)  // make shape compatible right before we do the forwarding
       {
         cached_output_.Reshape(output_shape);
+        ++output_allocations_;
       }
     }
 
@@ -244,6 +278,50 @@ std::shared_ptr<TensorType> Node<TensorType>::Evaluate(bool is_training)
   return std::make_shared<TensorType>(cached_output_);
 }
 
+/**
+ * Backpropagates error_signal through the op of this node only
+ * @tparam T the tensor type
+ * @param error_signal the error signal of the output of this node
+ * @return the error signals of each input, or of this node if it has no inputs
+ */
+template <typename TensorType>
+std::vector<TensorType> Node<TensorType>::Backward(TensorType const &error_signal)
+{
+  std::vector<TensorType> error_signals;
+  BackwardInto(error_signal, error_signals);
+  return error_signals;
+}
+
+/**
+ * Backpropagates error_signal through the op of this node only, writing the error signals into
+ * buffers owned by the caller
+ * @tparam T the tensor type
+ * @param error_signal the error signal of the output of this node
+ * @param error_signals the error signals of each input, or of this node if it has no inputs
+ */
+template <typename TensorType>
+void Node<TensorType>::BackwardInto(TensorType const &       error_signal,
+                                    std::vector<TensorType> &error_signals)
+{
+  op_ptr_->BackwardInto(GatherInputs(), error_signal, error_signals);
+  assert(error_signals.size() == input_nodes_.size() || input_nodes_.empty());
+
+  if (math::state_division_by_zero<DataType>())
+  {
+    throw std::runtime_error("Division by zero encountered in Node::BackPropagate");
+  }
+  if (math::state_infinity<DataType>())
+  {
+    throw std::runtime_error("Infinity encountered in Node::BackPropagate");
+  }
+  if (math::state_nan<DataType>())
+  {
+    throw std::runtime_error("NaN encountered in Node::BackPropagate");
+  }
+
+  assert(!math::state_overflow<DataType>());
+}
+
 /**
  * Recursively backpropagates error_signal through this node to all input nodes
  * @tparam T the tensor type
@@ -258,8 +336,7 @@ typename Node<TensorType>::NodeErrorMapType Node<TensorType>::BackPropagate(
   NodeErrorMapType ret;
 
   // gather inputs and backprop for this node
-  std::vector<TensorType> error_signals = op_ptr_->Backward(GatherInputs(), error_signal);
-  assert(error_signals.size() == GatherInputs().size() || GatherInputs().empty());
+  std::vector<TensorType> error_signals = Backward(error_signal);
 
   if (input_nodes_.empty())
   {
@@ -286,20 +363,6 @@ typename Node<TensorType>::NodeErrorMapType Node<TensorType>::BackPropagate(
     }
   }
 
-  if (math::state_division_by_zero<DataType>())
-  {
-    throw std::runtime_error("Division by zero encountered in Node::BackPropagate");
-  }
-  if (math::state_infinity<DataType>())
-  {
-    throw std::runtime_error("Infinity encountered in Node::BackPropagate");
-  }
-  if (math::state_nan<DataType>())
-  {
-    throw std::runtime_error("NaN encountered in Node::BackPropagate");
-  }
-
-  assert(!math::state_overflow<DataType>());
   return ret;
 }
 /**
@@ -349,6 +412,17 @@ std::vector<std::string> Node<TensorType>::GetInputNames()
   return ret;
 }
 
+/**
+ * gets all registered inputs of this node
+ * @tparam T tensor type
+ * @return vector of pointers to input nodes
+ */
+template <typename TensorType>
+std::vector<typename Node<TensorType>::NodeWeakPtrType> const &Node<TensorType>::GetInputs() const
+{
+  return input_nodes_;
+}
+
 /**
  * registers a node as an output to this node
  * @tparam T tensor type
@@ -84,7 +84,7 @@ void SubGraph<TensorType>::Forward(VecTensorType const &inputs, TensorType &outp
   {
     this->SetInput(input_node_names_[i], *(inputs.at(i)));
   }
-  output = *(this->nodes_[output_node_name_]->Evaluate(this->is_training_));
+  output = *(this->EvaluatePlan(output_node_name_, this->is_training_));
 }
 
 /**
@@ -104,12 +104,11 @@ std::vector<TensorType> SubGraph<TensorType>::Backward(VecTensorType const &inpu
   FETCH_UNUSED(inputs);
   std::vector<TensorType> ret;
 
-  NodeErrorMapType map_node_error_signals =
-      this->nodes_[output_node_name_]->BackPropagate(error_signal);
+  auto const &plan = this->BackPropagatePlan(output_node_name_, error_signal);
   for (std::size_t i = 0; i < input_node_names_.size(); i++)
   {
     NodePtrType node          = this->nodes_[input_node_names_[i]];
-    auto        error_signals = map_node_error_signals[node.get()];
+    auto const &error_signals = plan.LeafErrorSignals(node.get());
     ret.insert(ret.end(), error_signals.begin(), error_signals.end());
   }
 
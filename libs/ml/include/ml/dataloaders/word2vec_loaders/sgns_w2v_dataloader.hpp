@@ -77,6 +77,9 @@ public:
   SizeType            IndexFromWord(std::string const &word) const;
   SizeType            WindowSize();
 
+  std::vector<std::vector<SizeType>> const &GetData() const;
+  std::vector<SizeType> const &             GetCounts() const;
+
   byte_array::ConstByteArray GetVocabHash();
 
   LoaderType LoaderCode() override
@@ -693,6 +696,28 @@ typename GraphW2VLoader<TensorType>::SizeType GraphW2VLoader<TensorType>::Window
   return window_size_;
 }
 
+/**
+ * returns the sentences of the corpus as word ids
+ * @return
+ */
+template <typename TensorType>
+std::vector<std::vector<typename GraphW2VLoader<TensorType>::SizeType>> const &
+GraphW2VLoader<TensorType>::GetData() const
+{
+  return data_;
+}
+
+/**
+ * returns the number of occurrences of each word id in the corpus
+ * @return
+ */
+template <typename TensorType>
+std::vector<typename GraphW2VLoader<TensorType>::SizeType> const &
+GraphW2VLoader<TensorType>::GetCounts() const
+{
+  return word_id_counts_;
+}
+
 /**
  * Preprocesses a string turning it into a vector of words
  * @param s
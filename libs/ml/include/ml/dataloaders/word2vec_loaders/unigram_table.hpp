@@ -34,6 +34,7 @@ public:
 
   void ResetTable(std::vector<SizeType> const &count, SizeType size);
   bool Sample(SizeType &ret);
+  bool Sample(fetch::random::LinearCongruentialGenerator &rng, SizeType &ret) const;
   bool SampleNegative(SizeType positive_index, SizeType &ret);
   bool SampleNegative(fetch::math::Tensor<SizeType> const &positive_indices, SizeType &ret);
   void ResetRNG();
@@ -106,6 +107,18 @@ inline bool UnigramTable::Sample(SizeType &ret)
   return true;
 }
 
+/**
+ * samples a random data point from the unigram table using the caller's random number generator,
+ * so that several threads may sample from the same table
+ * @return
+ */
+inline bool UnigramTable::Sample(fetch::random::LinearCongruentialGenerator &rng,
+                                 SizeType &                                  ret) const
+{
+  ret = data_[rng() % data_.size()];
+  return true;
+}
+
 /**
  * samples a negative value from unigram table, method is unsafe (could loop forever)
  * @param positive_index
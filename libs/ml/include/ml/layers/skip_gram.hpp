@@ -128,6 +128,23 @@ public:
     return embed_in_;
   }
 
+  /**
+   * returns the embeddings of the context words, which the input embeddings are trained against
+   * @return
+   */
+  std::shared_ptr<ops::Embeddings<TensorType>> GetContextEmbeddings()
+  {
+    for (auto const &node : this->nodes_)
+    {
+      if ((node.first != embed_in_) && (node.second->get_op_type() == OpType::OP_EMBEDDINGS))
+      {
+        return std::dynamic_pointer_cast<ops::Embeddings<TensorType>>(node.second->GetOp());
+      }
+    }
+
+    return nullptr;
+  }
+
   std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
   {
     return {inputs.front()->shape().at(1), 1};
@@ -80,12 +80,20 @@ public:
    */
   std::vector<TensorType> Backward(VecTensorType const &inputs,
                                    TensorType const &   error_signal) override
+  {
+    std::vector<TensorType> error_signals;
+    BackwardInto(inputs, error_signal, error_signals);
+    return error_signals;
+  }
+
+  void BackwardInto(VecTensorType const &inputs, TensorType const &error_signal,
+                    std::vector<TensorType> &error_signals) override
   {
     assert(inputs.size() == 1);
     assert(inputs.at(0)->shape() == error_signal.shape());
 
-    TensorType const &input = (*inputs.front());
-    TensorType        return_signal{error_signal.shape()};
+    TensorType const &input         = (*inputs.front());
+    TensorType &      return_signal = this->ErrorSignalBuffer(error_signals, 0, error_signal.shape());
 
     auto it1    = input.begin();
     auto it2    = return_signal.begin();
@@ -105,8 +113,6 @@ public:
       ++it2;
       ++err_it;
     }
-
-    return {return_signal};
   }
 
   std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
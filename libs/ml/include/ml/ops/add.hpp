@@ -77,21 +77,36 @@ public:
 
   std::vector<TensorType> Backward(VecTensorType const &inputs,
                                    TensorType const &   error_signal) override
+  {
+    std::vector<TensorType> error_signals;
+    BackwardInto(inputs, error_signal, error_signals);
+    return error_signals;
+  }
+
+  void BackwardInto(VecTensorType const &inputs, TensorType const &error_signal,
+                    std::vector<TensorType> &error_signals) override
   {
     assert(inputs.size() == 2);
     assert(inputs.at(0)->shape().size() == inputs.at(1)->shape().size());
     assert(inputs.at(0)->shape() == error_signal.shape());
     assert(error_signal.shape() == ComputeOutputShape(inputs));
 
+    error_signals.resize(2);
+
+    // the signal passes through unchanged, so it is shared rather than copied
+    error_signals[0] = error_signal;
+
     if (inputs.at(0)->shape() == inputs.at(1)->shape())
     {
       // Non-broadcast Add
-      return {error_signal, error_signal};
+      error_signals[1] = error_signal;
+      return;
     }
 
     // Broadcast Add
     UpdateAxes(inputs);
-    return {error_signal, fetch::math::ReduceSum(error_signal, axes_)};
+    fetch::math::ReduceSum(error_signal, axes_,
+                           this->ErrorSignalBuffer(error_signals, 1, inputs.at(1)->shape()));
   }
 
   std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
@@ -18,9 +18,12 @@
 //------------------------------------------------------------------------------
 
 #include "math/matrix_operations.hpp"
+#include "meta/type_traits.hpp"
 #include "ml/ops/ops.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -84,35 +87,80 @@ public:
   }
   static constexpr char const *DESCRIPTOR = "Convolution2D";
 
+  /**
+   * The kernel used to compute the convolution. AUTOMATIC selects direct or Winograd convolution
+   * based on the shape of the layer and the data type, the remaining values force a particular
+   * kernel (where applicable). im2col is never selected automatically since the general matrix
+   * multiplication it relies on is slower than the direct kernel for all typical layer shapes.
+   */
+  enum class Algorithm : uint8_t
+  {
+    AUTOMATIC,
+    DIRECT,    ///< Direct convolution, vectorised over the output channels
+    WINOGRAD,  ///< Winograd F(2x2, 3x3), floating point 3x3 kernels with unit stride only
+    IM2COL     ///< im2col followed by a general matrix multiplication
+  };
+
+  /// Minimum (input channels x output channels) for which Winograd beats direct convolution
+  static constexpr SizeType WINOGRAD_MIN_CHANNEL_PRODUCT = 8;
+  /// Minimum (output height x output width x batch size) over which the kernel transform amortises
+  static constexpr SizeType WINOGRAD_MIN_OUTPUT_SIZE = 64;
+
+  void SetAlgorithm(Algorithm algorithm)
+  {
+    algorithm_ = algorithm;
+  }
+
+  Algorithm SelectAlgorithm(TensorType const &input, TensorType const &kernels) const;
+
 private:
-  void FillVerticalStride(TensorType &input, TensorType &vertical_stride, SizeType output_channels,
-                          SizeType input_channels, SizeType kernel_height, SizeType kernel_width);
+  void ForwardDirect(TensorType const &input, TensorType const &kernels, TensorType &output) const;
+
+  void ForwardWinograd(TensorType const &input, TensorType const &kernels,
+                       TensorType &output) const;
+
+  void ForwardIm2Col(TensorType const &input, TensorType const &kernels, TensorType &output) const;
+
+  void BackwardDirect(TensorType const &input, TensorType const &kernels,
+                      TensorType const &error_signal, TensorType &input_error,
+                      TensorType &kernel_error) const;
+
+  void BackwardIm2Col(TensorType const &input, TensorType const &kernels,
+                      TensorType const &error_signal, TensorType &input_error,
+                      TensorType &kernel_error) const;
+
+  void FillVerticalStride(TensorType const &input, TensorType &vertical_stride,
+                          SizeType output_channels, SizeType input_channels,
+                          SizeType kernel_height, SizeType kernel_width) const;
 
-  void ReverseFillVerticalStride(TensorType &input, TensorType &vertical_stride,
+  void ReverseFillVerticalStride(TensorType &input, TensorType const &vertical_stride,
                                  SizeType output_channels, SizeType input_channels,
-                                 SizeType kernel_height, SizeType kernel_width);
+                                 SizeType kernel_height, SizeType kernel_width) const;
 
-  void FillHorizontalStride(TensorType &input, TensorType &horizontal_stride,
+  void FillHorizontalStride(TensorType const &input, TensorType &horizontal_stride,
                             SizeType output_height, SizeType output_width, SizeType input_channels,
-                            SizeType kernel_height, SizeType kernel_width, SizeType batch_size);
+                            SizeType kernel_height, SizeType kernel_width,
+                            SizeType batch_size) const;
 
-  void ReverseFillHorizontalStride(TensorType &input, TensorType &horizontal_stride,
+  void ReverseFillHorizontalStride(TensorType &input, TensorType const &horizontal_stride,
                                    SizeType output_height, SizeType output_width,
                                    SizeType input_channels, SizeType kernel_height,
-                                   SizeType kernel_width, SizeType batch_size);
+                                   SizeType kernel_width, SizeType batch_size) const;
 
   void FillOutput(TensorType const &gemm_output, TensorType &output, SizeType output_channels,
-                  SizeType output_height, SizeType output_width, SizeType batch_size);
+                  SizeType output_height, SizeType output_width, SizeType batch_size) const;
 
   void ReverseFillOutput(TensorType &gemm_output, TensorType const &output,
                          SizeType output_channels, SizeType output_height, SizeType output_width,
-                         SizeType batch_size);
+                         SizeType batch_size) const;
 
-  SizeType stride_size_;
+  SizeType  stride_size_;
+  Algorithm algorithm_{Algorithm::AUTOMATIC};
 };
 
 /**
- * Applies 2D convolution using im2col with General Matrix Multiplication described here:
+ * Applies 2D convolution. Depending on the shape of the layer this uses direct convolution,
+ * Winograd F(2x2, 3x3) or im2col with General Matrix Multiplication described here:
  * https://www.scss.tcd.ie/~andersan/static/papers/asap-2017.pdf
  * @param inputs vector of tensor references where at:
  * inputs[0] = input_data[input_channels x input_height x input_width x batch_position], inputs[1] =
@@ -131,9 +179,397 @@ void Convolution2D<TensorType>::Forward(VecTensorType const &inputs, TensorType
   assert(inputs.at(1)->shape().size() == 5);
   assert(output.shape() == ComputeOutputShape(inputs));
 
-  TensorType input   = (*inputs.at(0));
-  TensorType kernels = (*inputs.at(1));
+  TensorType const &input   = *inputs.at(0);
+  TensorType const &kernels = *inputs.at(1);
+
+  switch (SelectAlgorithm(input, kernels))
+  {
+  case Algorithm::WINOGRAD:
+    ForwardWinograd(input, kernels, output);
+    break;
+  case Algorithm::IM2COL:
+    ForwardIm2Col(input, kernels, output);
+    break;
+  default:
+    ForwardDirect(input, kernels, output);
+    break;
+  }
+}
+
+/**
+ * Computes gradient of 2D convolution, either directly or using reversed im2col and General Matrix
+ * Multiplication described here: https://www.scss.tcd.ie/~andersan/static/papers/asap-2017.pdf
+ * @param inputs vector of tensor references where at:
+ * inputs[0] = input_data[input_channels x input_height x input_width], inputs[1] =
+ * kernel_data[kernel_channels x kernel_height x kernel_width x batch_position]
+ * @param error_signal tensor of size [output_channels x
+ * number_of_stride_sized_steps_over_input_height x number_of_stride_sized_steps_over_input_width x
+ * batch_position]
+ * @return: output vector of tensors with back propagated error signal
+ * output[0]=input_error[inputs[0].shape], output[1]=kernel_error[inputs[1].shape]
+ */
+template <class TensorType>
+std::vector<TensorType> Convolution2D<TensorType>::Backward(VecTensorType const &inputs,
+                                                            TensorType const &   error_signal)
+{
+  assert(inputs.size() == 2);
+  // Input should be a 4D tensor [C x H x W x N]
+  assert(inputs.at(0)->shape().size() == 4);
+  // Kernels should be a 5D tensor [oC x iC x H x W x N]
+  assert(inputs.at(1)->shape().size() == 5);
+  assert(error_signal.shape() == ComputeOutputShape(inputs));
+
+  // input data channels = kernel input channels
+  assert(inputs.at(0)->shape().at(0) == inputs.at(1)->shape().at(1));
+
+  TensorType const &input   = *inputs.at(0);
+  TensorType const &kernels = *inputs.at(1);
+
+  TensorType input_error(input.shape());
+  TensorType kernel_error(kernels.shape());
+
+  // there is no Winograd gradient, the direct kernel is used in its place
+  if (Algorithm::IM2COL == SelectAlgorithm(input, kernels))
+  {
+    BackwardIm2Col(input, kernels, error_signal, input_error, kernel_error);
+  }
+  else
+  {
+    BackwardDirect(input, kernels, error_signal, input_error, kernel_error);
+  }
+
+  return {input_error, kernel_error};
+}
+
+template <class TensorType>
+std::vector<typename TensorType::SizeType> Convolution2D<TensorType>::ComputeOutputShape(
+    VecTensorType const &inputs) const
+{
+  std::vector<SizeType> output_shape;
+
+  // output_shape_[0]=number of output channels
+  output_shape.emplace_back(inputs.at(1)->shape()[0]);
+  // output_shape_[1]=number of stride_size steps over input height
+  output_shape.emplace_back((inputs.at(0)->shape()[1] - inputs.at(1)->shape()[2] + stride_size_) /
+                            stride_size_);
+  // output_shape_[2]=number of stride_size steps over input width
+  output_shape.emplace_back((inputs.at(0)->shape()[2] - inputs.at(1)->shape()[3] + stride_size_) /
+                            stride_size_);
+  // output_shape_[3]=batch dimension
+  output_shape.emplace_back(inputs.at(0)->shape().at(3));
+
+  return output_shape;
+}
+
+/**
+ * Selects the convolution kernel for a layer. Winograd is only used for floating point types since
+ * its transforms would accumulate additional rounding error in fixed point.
+ * @param input input data [C x H x W x N]
+ * @param kernels kernel data [oC x iC x kH x kW x 1]
+ * @return the kernel to use for the forward pass
+ */
+template <class TensorType>
+typename Convolution2D<TensorType>::Algorithm Convolution2D<TensorType>::SelectAlgorithm(
+    TensorType const &input, TensorType const &kernels) const
+{
+  SizeType const kernel_height = kernels.shape().at(2);
+  SizeType const kernel_width  = kernels.shape().at(3);
+
+  bool const winograd_applicable = fetch::meta::IsFloat<DataType> && (kernel_height == 3) &&
+                                   (kernel_width == 3) && (stride_size_ == 1);
+
+  if (Algorithm::AUTOMATIC != algorithm_)
+  {
+    if ((Algorithm::WINOGRAD == algorithm_) && !winograd_applicable)
+    {
+      return Algorithm::DIRECT;
+    }
+
+    return algorithm_;
+  }
+
+  if (winograd_applicable)
+  {
+    SizeType const output_height   = input.shape().at(1) - kernel_height + 1;
+    SizeType const output_width    = input.shape().at(2) - kernel_width + 1;
+    SizeType const output_size     = output_height * output_width * input.shape().at(3);
+    SizeType const channel_product = input.shape().at(0) * kernels.shape().at(0);
+
+    if ((channel_product >= WINOGRAD_MIN_CHANNEL_PRODUCT) &&
+        (output_size >= WINOGRAD_MIN_OUTPUT_SIZE))
+    {
+      return Algorithm::WINOGRAD;
+    }
+  }
+
+  return Algorithm::DIRECT;
+}
+
+/**
+ * Direct convolution. For each output pixel the kernel window is accumulated into a vector of
+ * output channels, which are contiguous in both the kernel and output tensors
+ * @param input input data [C x H x W x N]
+ * @param kernels kernel data [oC x iC x kH x kW x 1]
+ * @param output output data [oC x oH x oW x N]
+ */
+template <class TensorType>
+void Convolution2D<TensorType>::ForwardDirect(TensorType const &input, TensorType const &kernels,
+                                              TensorType &output) const
+{
+  SizeType const input_channels  = input.shape().at(0);
+  SizeType const batch_size      = input.shape().at(3);
+  SizeType const output_channels = kernels.shape().at(0);
+  SizeType const kernel_height   = kernels.shape().at(2);
+  SizeType const kernel_width    = kernels.shape().at(3);
+  SizeType const output_height   = output.shape().at(1);
+  SizeType const output_width    = output.shape().at(2);
+
+  auto const &input_stride  = input.stride();
+  auto const &kernel_stride = kernels.stride();
+  auto const &output_stride = output.stride();
+
+  DataType const *input_data  = input.data().pointer();
+  DataType const *kernel_data = kernels.data().pointer();
+  DataType *      output_data = output.data().pointer();
+
+  std::vector<DataType> accumulator(output_channels);
+
+  for (SizeType i_b{0}; i_b < batch_size; ++i_b)  // Iterate over batch
+  {
+    for (SizeType j_o{0}; j_o < output_width; ++j_o)  // Iterate over output width
+    {
+      for (SizeType i_o{0}; i_o < output_height; ++i_o)  // Iterate over output height
+      {
+        std::fill(accumulator.begin(), accumulator.end(), DataType{0});
+
+        for (SizeType j_k{0}; j_k < kernel_width; ++j_k)  // Iterate over kernel width
+        {
+          for (SizeType i_k{0}; i_k < kernel_height; ++i_k)  // Iterate over kernel height
+          {
+            DataType const *window = input_data + ((i_o * stride_size_ + i_k) * input_stride[1]) +
+                                     ((j_o * stride_size_ + j_k) * input_stride[2]) +
+                                     (i_b * input_stride[3]);
+            DataType const *kernel =
+                kernel_data + (i_k * kernel_stride[2]) + (j_k * kernel_stride[3]);
+
+            for (SizeType i_ic{0}; i_ic < input_channels; ++i_ic)  // Iterate over input channels
+            {
+              DataType const  value   = window[i_ic];
+              DataType const *weights = kernel + (i_ic * kernel_stride[1]);
+
+              for (SizeType i_oc{0}; i_oc < output_channels; ++i_oc)
+              {
+                accumulator[i_oc] += weights[i_oc] * value;
+              }
+            }
+          }
+        }
+
+        std::copy(accumulator.begin(), accumulator.end(),
+                  output_data + (i_o * output_stride[1]) + (j_o * output_stride[2]) +
+                      (i_b * output_stride[3]));
+      }
+    }
+  }
+}
+
+/**
+ * Winograd F(2x2, 3x3) convolution as described here: https://arxiv.org/abs/1509.09308
+ * Each 2x2 output tile is computed from a 4x4 input tile with 16 multiplications per channel pair
+ * rather than 36. The transformed tiles are batched so that the elementwise products become 16
+ * independent matrix products, vectorised over the output channels.
+ * @param input input data [C x H x W x N]
+ * @param kernels kernel data [oC x iC x 3 x 3 x 1]
+ * @param output output data [oC x oH x oW x N]
+ */
+template <class TensorType>
+void Convolution2D<TensorType>::ForwardWinograd(TensorType const &input, TensorType const &kernels,
+                                                TensorType &output) const
+{
+  static constexpr SizeType TILE = 4;  // input tile size
+  static constexpr SizeType AREA = TILE * TILE;
+
+  SizeType const input_channels  = input.shape().at(0);
+  SizeType const input_height    = input.shape().at(1);
+  SizeType const input_width     = input.shape().at(2);
+  SizeType const batch_size      = input.shape().at(3);
+  SizeType const output_channels = kernels.shape().at(0);
+  SizeType const output_height   = output.shape().at(1);
+  SizeType const output_width    = output.shape().at(2);
+  SizeType const tiles_height    = (output_height + 1) / 2;
+  SizeType const tiles_width     = (output_width + 1) / 2;
+  SizeType const num_tiles       = tiles_height * tiles_width;
+
+  auto const &input_stride  = input.stride();
+  auto const &kernel_stride = kernels.stride();
+  auto const &output_stride = output.stride();
+
+  DataType const *input_data  = input.data().pointer();
+  DataType const *kernel_data = kernels.data().pointer();
+  DataType *      output_data = output.data().pointer();
+
+  DataType const zero{0};
+  DataType const half = static_cast<DataType>(0.5);
+
+  // Kernel transform U = G g G^T, stored as [16 x input_channels x output_channels]
+  std::vector<DataType> transformed_kernels(AREA * input_channels * output_channels);
+  for (SizeType i_ic{0}; i_ic < input_channels; ++i_ic)
+  {
+    for (SizeType i_oc{0}; i_oc < output_channels; ++i_oc)
+    {
+      DataType const *g = kernel_data + i_oc + (i_ic * kernel_stride[1]);
+
+      DataType gg[TILE][3];
+      for (SizeType j{0}; j < 3; ++j)
+      {
+        DataType const g0 = g[j * kernel_stride[3]];
+        DataType const g1 = g[kernel_stride[2] + (j * kernel_stride[3])];
+        DataType const g2 = g[(2 * kernel_stride[2]) + (j * kernel_stride[3])];
+
+        gg[0][j] = g0;
+        gg[1][j] = half * (g0 + g1 + g2);
+        gg[2][j] = half * (g0 - g1 + g2);
+        gg[3][j] = g2;
+      }
+
+      for (SizeType i{0}; i < TILE; ++i)
+      {
+        DataType const u[TILE] = {gg[i][0], half * (gg[i][0] + gg[i][1] + gg[i][2]),
+                                  half * (gg[i][0] - gg[i][1] + gg[i][2]), gg[i][2]};
+
+        for (SizeType j{0}; j < TILE; ++j)
+        {
+          transformed_kernels[(((i * TILE) + j) * input_channels + i_ic) * output_channels + i_oc] =
+              u[j];
+        }
+      }
+    }
+  }
+
+  std::vector<DataType> transformed_input(AREA * num_tiles * input_channels);
+  std::vector<DataType> products(AREA * num_tiles * output_channels);
+
+  for (SizeType i_b{0}; i_b < batch_size; ++i_b)  // Iterate over batch
+  {
+    // Input transform V = B^T d B, stored as [16 x num_tiles x input_channels]
+    for (SizeType tile{0}; tile < num_tiles; ++tile)
+    {
+      SizeType const i_o = 2 * (tile % tiles_height);
+      SizeType const j_o = 2 * (tile / tiles_height);
+
+      for (SizeType i_ic{0}; i_ic < input_channels; ++i_ic)
+      {
+        DataType d[TILE][TILE];
+        for (SizeType j{0}; j < TILE; ++j)
+        {
+          for (SizeType i{0}; i < TILE; ++i)
+          {
+            bool const in_bounds = ((i_o + i) < input_height) && ((j_o + j) < input_width);
+
+            d[i][j] = in_bounds ? input_data[i_ic + ((i_o + i) * input_stride[1]) +
+                                             ((j_o + j) * input_stride[2]) +
+                                             (i_b * input_stride[3])]
+                                : zero;
+          }
+        }
+
+        DataType t[TILE][TILE];
+        for (SizeType j{0}; j < TILE; ++j)
+        {
+          t[0][j] = d[0][j] - d[2][j];
+          t[1][j] = d[1][j] + d[2][j];
+          t[2][j] = d[2][j] - d[1][j];
+          t[3][j] = d[1][j] - d[3][j];
+        }
 
+        for (SizeType i{0}; i < TILE; ++i)
+        {
+          DataType const v[TILE] = {t[i][0] - t[i][2], t[i][1] + t[i][2], t[i][2] - t[i][1],
+                                    t[i][1] - t[i][3]};
+
+          for (SizeType j{0}; j < TILE; ++j)
+          {
+            transformed_input[(((i * TILE) + j) * num_tiles + tile) * input_channels + i_ic] = v[j];
+          }
+        }
+      }
+    }
+
+    // Elementwise products, reduced over the input channels: M = sum_c U * V
+    std::fill(products.begin(), products.end(), zero);
+    for (SizeType xi{0}; xi < AREA; ++xi)
+    {
+      for (SizeType tile{0}; tile < num_tiles; ++tile)
+      {
+        DataType const *v = transformed_input.data() + (xi * num_tiles + tile) * input_channels;
+        DataType *      m = products.data() + (xi * num_tiles + tile) * output_channels;
+
+        for (SizeType i_ic{0}; i_ic < input_channels; ++i_ic)
+        {
+          DataType const  value = v[i_ic];
+          DataType const *u =
+              transformed_kernels.data() + (xi * input_channels + i_ic) * output_channels;
+
+          for (SizeType i_oc{0}; i_oc < output_channels; ++i_oc)
+          {
+            m[i_oc] += value * u[i_oc];
+          }
+        }
+      }
+    }
+
+    // Output transform Y = A^T M A
+    for (SizeType tile{0}; tile < num_tiles; ++tile)
+    {
+      SizeType const i_o = 2 * (tile % tiles_height);
+      SizeType const j_o = 2 * (tile / tiles_height);
+
+      for (SizeType i_oc{0}; i_oc < output_channels; ++i_oc)
+      {
+        DataType m[TILE][TILE];
+        for (SizeType i{0}; i < TILE; ++i)
+        {
+          for (SizeType j{0}; j < TILE; ++j)
+          {
+            m[i][j] = products[(((i * TILE) + j) * num_tiles + tile) * output_channels + i_oc];
+          }
+        }
+
+        DataType t[2][TILE];
+        for (SizeType j{0}; j < TILE; ++j)
+        {
+          t[0][j] = m[0][j] + m[1][j] + m[2][j];
+          t[1][j] = m[1][j] - m[2][j] - m[3][j];
+        }
+
+        for (SizeType i{0}; i < 2; ++i)
+        {
+          DataType const y[2] = {t[i][0] + t[i][1] + t[i][2], t[i][1] - t[i][2] - t[i][3]};
+
+          for (SizeType j{0}; j < 2; ++j)
+          {
+            if (((i_o + i) < output_height) && ((j_o + j) < output_width))
+            {
+              output_data[i_oc + ((i_o + i) * output_stride[1]) +
+                          ((j_o + j) * output_stride[2]) + (i_b * output_stride[3])] = y[j];
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Convolution using im2col with General Matrix Multiplication
+ * @param input input data [C x H x W x N]
+ * @param kernels kernel data [oC x iC x kH x kW x 1]
+ * @param output output data [oC x oH x oW x N]
+ */
+template <class TensorType>
+void Convolution2D<TensorType>::ForwardIm2Col(TensorType const &input, TensorType const &kernels,
+                                              TensorType &output) const
+{
   SizeType input_channels  = input.shape().at(0);
   SizeType batch_size      = input.shape().at(3);
   SizeType output_channels = kernels.shape().at(0);
@@ -167,44 +603,100 @@ void Convolution2D<TensorType>::Forward(VecTensorType const &inputs, TensorType
 }
 
 /**
- * Computes gradient of 2D convolution using reversed im2col and General Matrix Multiplication
- * described here: https://www.scss.tcd.ie/~andersan/static/papers/asap-2017.pdf
- * @param inputs vector of tensor references where at:
- * inputs[0] = input_data[input_channels x input_height x input_width], inputs[1] =
- * kernel_data[kernel_channels x kernel_height x kernel_width x batch_position]
- * @param error_signal tensor of size [output_channels x
- * number_of_stride_sized_steps_over_input_height x number_of_stride_sized_steps_over_input_width x
- * batch_position]
- * @return: output vector of tensors with back propagated error signal
- * output[0]=input_error[inputs[0].shape], output[1]=kernel_error[inputs[1].shape]
+ * Direct convolution gradient. The error signal of every output pixel is scattered back over its
+ * (possibly overlapping) kernel window
+ * @param input input data [C x H x W x N]
+ * @param kernels kernel data [oC x iC x kH x kW x 1]
+ * @param error_signal [oC x oH x oW x N]
+ * @param input_error zero initialised tensor of the input shape
+ * @param kernel_error zero initialised tensor of the kernel shape
  */
 template <class TensorType>
-std::vector<TensorType> Convolution2D<TensorType>::Backward(VecTensorType const &inputs,
-                                                            TensorType const &   error_signal)
+void Convolution2D<TensorType>::BackwardDirect(TensorType const &input, TensorType const &kernels,
+                                               TensorType const &error_signal,
+                                               TensorType &input_error,
+                                               TensorType &kernel_error) const
 {
-  assert(inputs.size() == 2);
-  // Input should be a 4D tensor [C x H x W x N]
-  assert(inputs.at(0)->shape().size() == 4);
-  // Kernels should be a 5D tensor [oC x iC x H x W x N]
-  assert(inputs.at(1)->shape().size() == 5);
-  assert(error_signal.shape() == ComputeOutputShape(inputs));
+  SizeType const input_channels  = input.shape().at(0);
+  SizeType const batch_size      = input.shape().at(3);
+  SizeType const output_channels = kernels.shape().at(0);
+  SizeType const kernel_height   = kernels.shape().at(2);
+  SizeType const kernel_width    = kernels.shape().at(3);
+  SizeType const output_height   = error_signal.shape().at(1);
+  SizeType const output_width    = error_signal.shape().at(2);
+
+  auto const &input_stride  = input.stride();
+  auto const &kernel_stride = kernels.stride();
+  auto const &error_stride  = error_signal.stride();
+
+  DataType const *input_data        = input.data().pointer();
+  DataType const *kernel_data       = kernels.data().pointer();
+  DataType const *error_data        = error_signal.data().pointer();
+  DataType *      input_error_data  = input_error.data().pointer();
+  DataType *      kernel_error_data = kernel_error.data().pointer();
 
-  // input data channels = kernel input channels
-  assert(inputs.at(0)->shape().at(0) == inputs.at(1)->shape().at(1));
+  for (SizeType i_b{0}; i_b < batch_size; ++i_b)  // Iterate over batch
+  {
+    for (SizeType j_o{0}; j_o < output_width; ++j_o)  // Iterate over output width
+    {
+      for (SizeType i_o{0}; i_o < output_height; ++i_o)  // Iterate over output height
+      {
+        DataType const *error = error_data + (i_o * error_stride[1]) + (j_o * error_stride[2]) +
+                                (i_b * error_stride[3]);
 
-  SizeType output_height = error_signal.shape().at(1);
-  SizeType output_width  = error_signal.shape().at(2);
+        for (SizeType j_k{0}; j_k < kernel_width; ++j_k)  // Iterate over kernel width
+        {
+          for (SizeType i_k{0}; i_k < kernel_height; ++i_k)  // Iterate over kernel height
+          {
+            SizeType const window = ((i_o * stride_size_ + i_k) * input_stride[1]) +
+                                    ((j_o * stride_size_ + j_k) * input_stride[2]) +
+                                    (i_b * input_stride[3]);
+            SizeType const kernel = (i_k * kernel_stride[2]) + (j_k * kernel_stride[3]);
 
-  TensorType input   = (*inputs.at(0));
-  TensorType kernels = (*inputs.at(1));
+            for (SizeType i_ic{0}; i_ic < input_channels; ++i_ic)  // Iterate over input channels
+            {
+              SizeType const  offset         = kernel + (i_ic * kernel_stride[1]);
+              DataType const  value          = input_data[window + i_ic];
+              DataType const *weights        = kernel_data + offset;
+              DataType *      weight_updates = kernel_error_data + offset;
+
+              DataType sum{0};
+              for (SizeType i_oc{0}; i_oc < output_channels; ++i_oc)
+              {
+                sum += weights[i_oc] * error[i_oc];
+                weight_updates[i_oc] += error[i_oc] * value;
+              }
+
+              input_error_data[window + i_ic] += sum;
+            }
+          }
+        }
+      }
+    }
+  }
+}
 
-  SizeType   input_channels  = input.shape().at(0);
-  SizeType   batch_size      = input.shape().at(3);
-  SizeType   output_channels = kernels.shape().at(0);
-  SizeType   kernel_height   = kernels.shape().at(2);
-  SizeType   kernel_width    = kernels.shape().at(3);
-  TensorType input_error(input.shape());
-  TensorType kernel_error(kernels.shape());
+/**
+ * Convolution gradient using reversed im2col and General Matrix Multiplication
+ * @param input input data [C x H x W x N]
+ * @param kernels kernel data [oC x iC x kH x kW x 1]
+ * @param error_signal [oC x oH x oW x N]
+ * @param input_error zero initialised tensor of the input shape
+ * @param kernel_error zero initialised tensor of the kernel shape
+ */
+template <class TensorType>
+void Convolution2D<TensorType>::BackwardIm2Col(TensorType const &input, TensorType const &kernels,
+                                               TensorType const &error_signal,
+                                               TensorType &input_error,
+                                               TensorType &kernel_error) const
+{
+  SizeType input_channels  = input.shape().at(0);
+  SizeType batch_size      = input.shape().at(3);
+  SizeType output_channels = kernels.shape().at(0);
+  SizeType kernel_height   = kernels.shape().at(2);
+  SizeType kernel_width    = kernels.shape().at(3);
+  SizeType output_height   = error_signal.shape().at(1);
+  SizeType output_width    = error_signal.shape().at(2);
 
   SizeType horizontal_stride_width  = kernel_width * kernel_height * input_channels;
   SizeType horizontal_stride_height = output_height * output_width * batch_size;
@@ -238,33 +730,11 @@ std::vector<TensorType> Convolution2D<TensorType>::Backward(VecTensorType const
   // Reshape vertical stride to kernel data error_signal - reversed im2col
   ReverseFillVerticalStride(kernel_error, error2, output_channels, input_channels, kernel_height,
                             kernel_width);
-
-  return {input_error, kernel_error};
-}
-
-template <class TensorType>
-std::vector<typename TensorType::SizeType> Convolution2D<TensorType>::ComputeOutputShape(
-    VecTensorType const &inputs) const
-{
-  std::vector<SizeType> output_shape;
-
-  // output_shape_[0]=number of output channels
-  output_shape.emplace_back(inputs.at(1)->shape()[0]);
-  // output_shape_[1]=number of stride_size steps over input height
-  output_shape.emplace_back((inputs.at(0)->shape()[1] - inputs.at(1)->shape()[2] + stride_size_) /
-                            stride_size_);
-  // output_shape_[2]=number of stride_size steps over input width
-  output_shape.emplace_back((inputs.at(0)->shape()[2] - inputs.at(1)->shape()[3] + stride_size_) /
-                            stride_size_);
-  // output_shape_[3]=batch dimension
-  output_shape.emplace_back(inputs.at(0)->shape().at(3));
-
-  return output_shape;
 }
 
-// TODO(issue 943): Make im2col efficient using iterators
 /**
- * Reshapes input tensor to vertical_stride tensor using im2col
+ * Reshapes kernel tensor to vertical_stride tensor using im2col. Column (i_ic, i_k, j_k) of the
+ * vertical stride is the contiguous vector of output channels of that kernel element.
  * @tparam TensorType
  * @param input
  * @param vertical_stride
@@ -274,34 +744,34 @@ std::vector<typename TensorType::SizeType> Convolution2D<TensorType>::ComputeOut
  * @param kernel_width
  */
 template <class TensorType>
-void Convolution2D<TensorType>::FillVerticalStride(TensorType &input, TensorType &vertical_stride,
-                                                   SizeType const output_channels,
-                                                   SizeType const input_channels,
-                                                   SizeType const kernel_height,
-                                                   SizeType const kernel_width)
+void Convolution2D<TensorType>::FillVerticalStride(
+    TensorType const &input, TensorType &vertical_stride, SizeType const output_channels,
+    SizeType const input_channels, SizeType const kernel_height, SizeType const kernel_width) const
 {
-  SizeType j_s;                                           // stride height iterator
-  for (SizeType i_oc{0}; i_oc < output_channels; ++i_oc)  // Iterate over output channels
+  auto const &input_stride  = input.stride();
+  SizeType    column_stride = vertical_stride.stride()[1];
+
+  DataType const *input_data = input.data().pointer();
+  DataType *      column     = vertical_stride.data().pointer();
+
+  for (SizeType j_k(0); j_k < kernel_width; j_k++)  // Iterate over kernel width
   {
-    j_s = 0;
-    for (SizeType i_ic{0}; i_ic < input_channels; ++i_ic)  // Iterate over input channels
+    for (SizeType i_k(0); i_k < kernel_height; i_k++)  // Iterate over kernel height
     {
-
-      for (SizeType i_k(0); i_k < kernel_height; i_k++)  // Iterate over kernel height
+      for (SizeType i_ic{0}; i_ic < input_channels; ++i_ic)  // Iterate over input channels
       {
-        for (SizeType j_k(0); j_k < kernel_width; j_k++)  // Iterate over kernel width
-        {
-          vertical_stride(i_oc, j_s) = input.At(i_oc, i_ic, i_k, j_k, 0);
-          ++j_s;
-        }
+        DataType const *kernel = input_data + (i_ic * input_stride[1]) + (i_k * input_stride[2]) +
+                                 (j_k * input_stride[3]);
+
+        std::copy(kernel, kernel + output_channels, column);
+        column += column_stride;
       }
     }
   }
 }
 
-// TODO(issue 943): Make im2col efficient using iterators
 /**
- * Reshapes vertical_stride tensor to input tensor using reversed im2col
+ * Reshapes vertical_stride tensor to kernel tensor using reversed im2col
  * @tparam TensorType
  * @param input
  * @param vertical_stride
@@ -312,31 +782,33 @@ void Convolution2D<TensorType>::FillVerticalStride(TensorType &input, TensorType
  */
 template <class TensorType>
 void Convolution2D<TensorType>::ReverseFillVerticalStride(
-    TensorType &input, TensorType &vertical_stride, SizeType const output_channels,
-    SizeType const input_channels, SizeType const kernel_height, SizeType const kernel_width)
+    TensorType &input, TensorType const &vertical_stride, SizeType const output_channels,
+    SizeType const input_channels, SizeType const kernel_height, SizeType const kernel_width) const
 {
-  SizeType j_s;                                           // stride height iterator
-  for (SizeType i_oc{0}; i_oc < output_channels; ++i_oc)  // Iterate over output channels
+  auto const &input_stride  = input.stride();
+  SizeType    column_stride = vertical_stride.stride()[1];
+
+  DataType *      input_data = input.data().pointer();
+  DataType const *column     = vertical_stride.data().pointer();
+
+  for (SizeType j_k(0); j_k < kernel_width; j_k++)  // Iterate over kernel width
   {
-    j_s = 0;
-    for (SizeType i_ic{0}; i_ic < input_channels; ++i_ic)  // Iterate over input channels
+    for (SizeType i_k(0); i_k < kernel_height; i_k++)  // Iterate over kernel height
     {
-
-      for (SizeType i_k(0); i_k < kernel_height; i_k++)  // Iterate over kernel height
+      for (SizeType i_ic{0}; i_ic < input_channels; ++i_ic)  // Iterate over input channels
       {
-        for (SizeType j_k(0); j_k < kernel_width; j_k++)  // Iterate over kernel width
-        {
-          input(i_oc, i_ic, i_k, j_k, 0) = vertical_stride.At(i_oc, j_s);
-          ++j_s;
-        }
+        std::copy(column, column + output_channels,
+                  input_data + (i_ic * input_stride[1]) + (i_k * input_stride[2]) +
+                      (j_k * input_stride[3]));
+        column += column_stride;
       }
     }
   }
 }
 
-// TODO(issue 943): Make im2col efficient using iterators
 /**
- * Reshapes kernel(input) tensor to horizontal_stride tensor using im2col
+ * Reshapes input tensor to horizontal_stride tensor using im2col. Each column of the horizontal
+ * stride holds the kernel window of one output pixel, with the input channels contiguous.
  * @tparam TensorType
  * @param input
  * @param horizontal_stride
@@ -348,43 +820,46 @@ void Convolution2D<TensorType>::ReverseFillVerticalStride(
  */
 template <class TensorType>
 void Convolution2D<TensorType>::FillHorizontalStride(
-    TensorType &input, TensorType &horizontal_stride, SizeType const output_height,
+    TensorType const &input, TensorType &horizontal_stride, SizeType const output_height,
     SizeType const output_width, SizeType const input_channels, SizeType const kernel_height,
-    SizeType const kernel_width, SizeType const batch_size)
+    SizeType const kernel_width, SizeType const batch_size) const
 {
-  SizeType i_s;  // stride width index
-  SizeType j_s;  // stride height index
+  auto const &input_stride  = input.stride();
+  SizeType    column_stride = horizontal_stride.stride()[1];
+
+  DataType const *input_data = input.data().pointer();
+  DataType *      column     = horizontal_stride.data().pointer();
 
-  j_s = 0;
   for (SizeType i_b{0}; i_b < batch_size; ++i_b)  // Iterate over batch
   {
-    for (SizeType i_o{0}; i_o < output_height; ++i_o)  // Iterate over output height
+    for (SizeType j_o{0}; j_o < output_width; ++j_o)  // Iterate over output width
     {
-      for (SizeType j_o{0}; j_o < output_width; ++j_o)  // Iterate over output width
+      for (SizeType i_o{0}; i_o < output_height; ++i_o)  // Iterate over output height
       {
-        i_s = 0;
-        for (SizeType i_ic(0); i_ic < input_channels; ++i_ic)  // Iterate over input channels
-        {
+        DataType *it = column;
 
+        for (SizeType j_k(0); j_k < kernel_width; j_k++)  // Iterate over kernel width
+        {
           for (SizeType i_k(0); i_k < kernel_height; i_k++)  // Iterate over kernel height
           {
-            for (SizeType j_k(0); j_k < kernel_width; j_k++)  // Iterate over kernel width
-            {
-              horizontal_stride(i_s, j_s) =
-                  input.At(i_ic, i_o * stride_size_ + i_k, j_o * stride_size_ + j_k, i_b);
-              ++i_s;
-            }
+            DataType const *window = input_data +
+                                     ((i_o * stride_size_ + i_k) * input_stride[1]) +
+                                     ((j_o * stride_size_ + j_k) * input_stride[2]) +
+                                     (i_b * input_stride[3]);
+
+            it = std::copy(window, window + input_channels, it);
           }
         }
-        ++j_s;
+
+        column += column_stride;
       }
     }
   }
 }
 
-// TODO(issue 943): Make im2col efficient using iterators
 /**
- * Reshapes horizontal_stride tensor to kernel(input) tensor using reversed im2col
+ * Reshapes horizontal_stride tensor to input tensor using reversed im2col. Overlapping kernel
+ * windows accumulate into the input.
  * @tparam TensorType
  * @param input
  * @param horizontal_stride
@@ -396,41 +871,45 @@ void Convolution2D<TensorType>::FillHorizontalStride(
  */
 template <class TensorType>
 void Convolution2D<TensorType>::ReverseFillHorizontalStride(
-    TensorType &input, TensorType &horizontal_stride, SizeType const output_height,
+    TensorType &input, TensorType const &horizontal_stride, SizeType const output_height,
     SizeType const output_width, SizeType const input_channels, SizeType const kernel_height,
-    SizeType const kernel_width, SizeType const batch_size)
+    SizeType const kernel_width, SizeType const batch_size) const
 {
-  SizeType i_s;  // stride width index
-  SizeType j_s;  // stride height index
+  auto const &input_stride  = input.stride();
+  SizeType    column_stride = horizontal_stride.stride()[1];
+
+  DataType *      input_data = input.data().pointer();
+  DataType const *column     = horizontal_stride.data().pointer();
 
-  j_s = 0;
   for (SizeType i_b{0}; i_b < batch_size; ++i_b)  // Iterate over batch
   {
-    for (SizeType i_o{0}; i_o < output_height; ++i_o)  // Iterate over output height
+    for (SizeType j_o{0}; j_o < output_width; ++j_o)  // Iterate over output width
     {
-      for (SizeType j_o{0}; j_o < output_width; ++j_o)  // Iterate over output width
+      for (SizeType i_o{0}; i_o < output_height; ++i_o)  // Iterate over output height
       {
-        i_s = 0;
-        for (SizeType i_ic(0); i_ic < input_channels; ++i_ic)  // Iterate over input channels
-        {
+        DataType const *it = column;
 
+        for (SizeType j_k(0); j_k < kernel_width; j_k++)  // Iterate over kernel width
+        {
           for (SizeType i_k(0); i_k < kernel_height; i_k++)  // Iterate over kernel height
           {
-            for (SizeType j_k(0); j_k < kernel_width; j_k++)  // Iterate over kernel width
+            DataType *window = input_data + ((i_o * stride_size_ + i_k) * input_stride[1]) +
+                               ((j_o * stride_size_ + j_k) * input_stride[2]) +
+                               (i_b * input_stride[3]);
+
+            for (SizeType i_ic(0); i_ic < input_channels; ++i_ic)  // Iterate over input channels
             {
-              input(i_ic, i_o * stride_size_ + i_k, j_o * stride_size_ + j_k, i_b) =
-                  horizontal_stride.At(i_s, j_s);
-              ++i_s;
+              window[i_ic] += *it++;
             }
           }
         }
-        ++j_s;
+
+        column += column_stride;
       }
     }
   }
 }
 
-// TODO(issue 943): Make im2col efficient using iterators
 /**
  * Reshape gemm_output tensor (result of matmul on vertical and horizontal stride) to output tensor
  * @tparam TensorType
@@ -444,28 +923,30 @@ template <class TensorType>
 void Convolution2D<TensorType>::FillOutput(TensorType const &gemm_output, TensorType &output,
                                            SizeType const output_channels,
                                            SizeType const output_height,
-                                           SizeType const output_width, SizeType const batch_size)
+                                           SizeType const output_width,
+                                           SizeType const batch_size) const
 {
+  auto const &output_stride = output.stride();
+  SizeType    column_stride = gemm_output.stride()[1];
 
-  SizeType it;
-  for (SizeType i_oc{0}; i_oc < output_channels; ++i_oc)  // Iterate over output channels
+  DataType *      output_data = output.data().pointer();
+  DataType const *column      = gemm_output.data().pointer();
+
+  for (SizeType i_b{0}; i_b < batch_size; ++i_b)  // Iterate over batch
   {
-    it = 0;
-    for (SizeType i_b{0}; i_b < batch_size; ++i_b)  // Iterate over batch
+    for (SizeType j_o{0}; j_o < output_width; ++j_o)  // Iterate over output width
     {
       for (SizeType i_o{0}; i_o < output_height; ++i_o)  // Iterate over output height
       {
-        for (SizeType j_o{0}; j_o < output_width; ++j_o)  // Iterate over output width
-        {
-          output(i_oc, i_o, j_o, i_b) = gemm_output.At(i_oc, it);
-          ++it;
-        }
+        std::copy(column, column + output_channels,
+                  output_data + (i_o * output_stride[1]) + (j_o * output_stride[2]) +
+                      (i_b * output_stride[3]));
+        column += column_stride;
       }
     }
   }
 }
 
-// TODO(issue 943): Make im2col efficient using iterators
 /**
  * Reshape output tensor to gemm_output tensor (result of matmul on vertical and horizontal stride)
  * @tparam TensorType
@@ -480,22 +961,25 @@ void Convolution2D<TensorType>::ReverseFillOutput(TensorType &gemm_output, Tenso
                                                   SizeType const output_channels,
                                                   SizeType const output_height,
                                                   SizeType const output_width,
-                                                  SizeType const batch_size)
+                                                  SizeType const batch_size) const
 {
+  auto const &output_stride = output.stride();
+  SizeType    column_stride = gemm_output.stride()[1];
+
+  DataType const *output_data = output.data().pointer();
+  DataType *      column      = gemm_output.data().pointer();
 
-  SizeType it;
-  for (SizeType i_oc{0}; i_oc < output_channels; ++i_oc)  // Iterate over output channels
+  for (SizeType i_b{0}; i_b < batch_size; ++i_b)  // Iterate over batch
   {
-    it = 0;
-    for (SizeType i_b{0}; i_b < batch_size; ++i_b)  // Iterate over batch
+    for (SizeType j_o{0}; j_o < output_width; ++j_o)  // Iterate over output width
     {
       for (SizeType i_o{0}; i_o < output_height; ++i_o)  // Iterate over output height
       {
-        for (SizeType j_o{0}; j_o < output_width; ++j_o)  // Iterate over output width
-        {
-          gemm_output(i_oc, it) = output.At(i_oc, i_o, j_o, i_b);
-          ++it;
-        }
+        DataType const *pixel = output_data + (i_o * output_stride[1]) + (j_o * output_stride[2]) +
+                                (i_b * output_stride[3]);
+
+        std::copy(pixel, pixel + output_channels, column);
+        column += column_stride;
       }
     }
   }
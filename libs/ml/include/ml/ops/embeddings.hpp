@@ -37,6 +37,7 @@ public:
   using DataType      = typename TensorType::Type;
   using ArrayPtrType  = std::shared_ptr<TensorType>;
   using SizeType      = fetch::math::SizeType;
+  using SizeSet       = typename Weights<T>::SizeSet;
   using VecTensorType = typename Weights<T>::VecTensorType;
   using SPType        = OpEmbeddingsSaveableParams<TensorType>;
   using MyType        = Embeddings<TensorType>;
@@ -109,15 +110,26 @@ public:
       auto indices  = inputs.front()->shape().at(0);
       auto input_it = inputs.front()->begin();
 
+      // replicas sharing these embeddings accumulate into their own buffer
+      TensorType *gradient          = this->gradient_accumulation_.get();
+      SizeSet *   updated_rows      = &this->updated_rows_;
+      auto        replica_gradients = ReplicaGradients<T>::Active();
+      if (replica_gradients)
+      {
+        auto &buffer = replica_gradients->Lookup(this, this->data_->shape());
+        gradient     = &buffer.gradient;
+        updated_rows = &buffer.updated_rows;
+      }
+
       for (SizeType i{0}; i < indices; i++)
       {
         for (SizeType n{0}; n < batch_size; n++)
         {
           auto error_view    = error_signal.View({i, n});
-          auto gradient_view = this->gradient_accumulation_->View(static_cast<SizeType>(*input_it));
+          auto gradient_view = gradient->View(static_cast<SizeType>(*input_it));
 
           // Mark update
-          this->updated_rows_.insert(static_cast<SizeType>(*input_it));
+          updated_rows->insert(static_cast<SizeType>(*input_it));
 
           auto error_view_it    = error_view.cbegin();
           auto gradient_view_it = gradient_view.begin();
@@ -131,7 +143,10 @@ public:
         }
       }
 
-      this->reset_gradients_ = true;
+      if (!replica_gradients)
+      {
+        this->reset_gradients_ = true;
+      }
     }
 
     return {TensorType(error_signal.shape())};
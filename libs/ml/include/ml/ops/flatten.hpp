@@ -79,16 +79,22 @@ public:
 
   std::vector<TensorType> Backward(VecTensorType const &inputs,
                                    TensorType const &   error_signal) override
+  {
+    std::vector<TensorType> error_signals;
+    BackwardInto(inputs, error_signal, error_signals);
+    return error_signals;
+  }
+
+  void BackwardInto(VecTensorType const &inputs, TensorType const &error_signal,
+                    std::vector<TensorType> &error_signals) override
   {
     FETCH_UNUSED(inputs);
     assert(inputs.size() == 1);
-    TensorType ret(input_shape_);
+    TensorType &ret = this->ErrorSignalBuffer(error_signals, 0, input_shape_);
 
     assert(ret.shape().at(ret.shape().size() - 1) ==
            error_signal.shape().at(error_signal.shape().size() - 1));
     ret.Assign(error_signal.View());
-
-    return {ret};
   }
 
   std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
@@ -112,6 +112,11 @@ public:
     return {ret / batch_size, ret};
   }
 
+  bool IsBatchAveraged() const override
+  {
+    return true;
+  }
+
   std::vector<typename T::SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
   {
     (void)inputs;
@@ -163,13 +163,21 @@ public:
    */
   std::vector<TensorType> Backward(VecTensorType const &inputs,
                                    TensorType const &   error_signal) override
+  {
+    std::vector<TensorType> error_signals;
+    BackwardInto(inputs, error_signal, error_signals);
+    return error_signals;
+  }
+
+  void BackwardInto(VecTensorType const &inputs, TensorType const &error_signal,
+                    std::vector<TensorType> &error_signals) override
   {
     FETCH_UNUSED(error_signal);
 
     assert(inputs.size() == 2);
     assert(inputs.at(0)->shape() == inputs.at(1)->shape());
 
-    TensorType return_signal(inputs.front()->shape());
+    TensorType &return_signal = this->ErrorSignalBuffer(error_signals, 0, inputs.front()->shape());
 
     SizeType data_size = inputs.at(0)->shape(inputs.at(0)->shape().size() - 1);
     auto     count     = static_cast<DataType>(data_size);
@@ -249,7 +257,14 @@ public:
 
     fetch::math::Multiply(return_signal, static_cast<DataType>(2), return_signal);
 
-    return {return_signal, return_signal};
+    // the signal of the ground truth is not used, so it shares the buffer of the input
+    error_signals.resize(2);
+    error_signals[1] = error_signals[0];
+  }
+
+  bool IsBatchAveraged() const override
+  {
+    return true;
   }
 
   std::vector<typename T::SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
@@ -96,6 +96,8 @@ public:
   void                    Forward(VecTensorType const &inputs, TensorType &output) override;
   std::vector<TensorType> Backward(VecTensorType const &inputs,
                                    TensorType const &   error_signal) override;
+  void                    BackwardInto(VecTensorType const &inputs, TensorType const &error_signal,
+                                       std::vector<TensorType> &error_signals) override;
   std::vector<SizeType>   ComputeOutputShape(VecTensorType const &inputs) const override;
 
   static constexpr OpType OpCode()
@@ -307,6 +309,38 @@ std::vector<T> MatrixMultiply<T>::Backward(VecTensorType const &inputs,
   return {error_signal_1_, error_signal_2_};
 }
 
+/**
+ * Backward which writes the error signals into the buffers of the caller. The batched cases are
+ * computed in the cached containers and copied out
+ * @tparam T tensor type
+ * @param inputs input tensors
+ * @param error_signal back pass error signal
+ * @param error_signals buffers for the error signals of the inputs
+ */
+template <class T>
+void MatrixMultiply<T>::BackwardInto(VecTensorType const &inputs, TensorType const &error_signal,
+                                     std::vector<TensorType> &error_signals)
+{
+  assert(inputs.size() == 2);
+
+  // size the vector first so that the buffer of the first input is not moved
+  error_signals.resize(2);
+  TensorType &error_signal_1 = this->ErrorSignalBuffer(error_signals, 0, inputs.at(0)->shape());
+  TensorType &error_signal_2 = this->ErrorSignalBuffer(error_signals, 1, inputs.at(1)->shape());
+
+  // Normal MatMul 2D @ 2D
+  if (inputs.at(0)->shape().size() == 2 && inputs.at(1)->shape().size() == 2)
+  {
+    BackDotWithTranspose((*inputs.at(0)), (*inputs.at(1)), error_signal, error_signal_1,
+                         error_signal_2);
+    return;
+  }
+
+  Backward(inputs, error_signal);
+  error_signal_1.Assign(error_signal_1_);
+  error_signal_2.Assign(error_signal_2_);
+}
+
 template <class T>
 std::vector<typename fetch::math::SizeType> MatrixMultiply<T>::ComputeOutputShape(
     VecTensorType const &inputs) const
@@ -46,6 +46,17 @@ public:
   virtual void                    Forward(VecTensorType const &inputs, TensorType &output) = 0;
   virtual std::vector<TensorType> Backward(VecTensorType const &inputs,
                                            TensorType const &   error_signal)                 = 0;
+
+  /*
+   * Backward which writes the error signals into buffers owned by the caller. A caller keeping the
+   * buffers between steps only has them reallocated when the shapes of the inputs change. Ops
+   * which do not override this return new tensors from Backward, which replace the buffers
+   */
+  virtual void BackwardInto(VecTensorType const &inputs, TensorType const &error_signal,
+                            std::vector<TensorType> &error_signals)
+  {
+    error_signals = Backward(inputs, error_signal);
+  }
   /*
    * ComputeOutputShape is usually expensive function and should be used only for initialisation or
    * in ASSERT. On Forward you can use output.shape() and on Backward there is error_signal.shape()
@@ -63,6 +74,16 @@ public:
 
   virtual std::shared_ptr<Ops<TensorType>> MakeSharedCopy(std::shared_ptr<Ops<TensorType>> me) = 0;
 
+  /*
+   * Loss functions report whether the gradient from Backward is averaged over the batch. If so,
+   * gradients computed over parts of a batch combine in proportion to the size of each part,
+   * otherwise they are summed
+   */
+  virtual bool IsBatchAveraged() const
+  {
+    return false;
+  }
+
   void SetTraining(bool is_training)
   {
     is_training_ = is_training;
@@ -74,6 +95,26 @@ public:
   }
 
 protected:
+  /*
+   * Returns the error signal buffer of an input, replacing it only if its shape does not match
+   */
+  static TensorType &ErrorSignalBuffer(std::vector<TensorType> &error_signals, SizeType index,
+                                       std::vector<SizeType> const &shape)
+  {
+    if (error_signals.size() <= index)
+    {
+      error_signals.resize(index + 1);
+    }
+
+    TensorType &buffer = error_signals[index];
+    if (buffer.shape() != shape)
+    {
+      buffer = TensorType(shape);
+    }
+
+    return buffer;
+  }
+
   bool is_training_ = true;
 };
 
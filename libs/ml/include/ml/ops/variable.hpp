@@ -27,6 +27,7 @@
 
 #include <cassert>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace fetch {
@@ -46,6 +47,93 @@ struct OpVariableSaveableParams : public OpDataHolderSaveableParams<TensorType>
 
 namespace ops {
 
+template <class T>
+class Variable;
+
+/**
+ * Per-replica gradient buffers for Variables shared between graph replicas.
+ * While a set of replica gradients is active on a thread, Variables accumulate the gradients
+ * computed by Backward into it instead of into their own (shared) gradient accumulation. Reduce
+ * then merges the buffers back into the Variables, which lets several replicas sharing the same
+ * weights backpropagate concurrently.
+ * @tparam T TensorType
+ */
+template <class T>
+class ReplicaGradients
+{
+public:
+  using TensorType = T;
+  using DataType   = typename TensorType::Type;
+  using SizeType   = fetch::math::SizeType;
+  using SizeSet    = std::unordered_set<SizeType>;
+
+  struct Buffer
+  {
+    TensorType gradient;
+    SizeSet    updated_rows;
+    bool       touched = false;
+  };
+
+  ReplicaGradients()                             = default;
+  ReplicaGradients(ReplicaGradients &&) noexcept = default;
+  ReplicaGradients &operator=(ReplicaGradients &&) noexcept = default;
+
+  // the buffers are scratch space for a single backward pass, so copies start out empty
+  ReplicaGradients(ReplicaGradients const & /*other*/)
+  {}
+
+  ReplicaGradients &operator=(ReplicaGradients const & /*other*/)
+  {
+    buffers_.clear();
+    return *this;
+  }
+
+  /**
+   * Redirects gradient accumulation on the calling thread to this object
+   */
+  void Activate()
+  {
+    active_ = this;
+  }
+
+  /**
+   * Restores gradient accumulation on the calling thread to the Variables themselves
+   */
+  static void Deactivate()
+  {
+    active_ = nullptr;
+  }
+
+  static ReplicaGradients *Active()
+  {
+    return active_;
+  }
+
+  /**
+   * Returns the buffer for a Variable, creating a zeroed buffer of the given shape on first use
+   */
+  Buffer &Lookup(Variable<T> *variable, std::vector<SizeType> const &shape)
+  {
+    Buffer &buffer = buffers_[variable];
+    if (buffer.gradient.shape() != shape)
+    {
+      buffer.gradient = TensorType(shape);
+    }
+    buffer.touched = true;
+    return buffer;
+  }
+
+  void Reduce(DataType const &scale = DataType{1});
+
+private:
+  std::unordered_map<Variable<T> *, Buffer> buffers_;
+
+  static thread_local ReplicaGradients *active_;
+};
+
+template <class T>
+thread_local ReplicaGradients<T> *ReplicaGradients<T>::active_ = nullptr;
+
 /**
  * A Variable is a DataHolder intended to store trainable data; for example weights.
  * It has the following features:
@@ -136,8 +224,16 @@ public:
 
     if (!this->value_frozen_)
     {
-      gradient_accumulation_->InlineAdd(error_signal);
-      reset_gradients_ = true;
+      auto replica_gradients = ReplicaGradients<T>::Active();
+      if (replica_gradients)
+      {
+        replica_gradients->Lookup(this, this->data_->shape()).gradient.InlineAdd(error_signal);
+      }
+      else
+      {
+        gradient_accumulation_->InlineAdd(error_signal);
+        reset_gradients_ = true;
+      }
     }
     return {error_signal};
   }
@@ -232,6 +328,26 @@ public:
     }
   }
 
+  /**
+   * Merges a gradient computed by a graph replica into the gradient accumulation. An empty set of
+   * updated rows means the whole gradient was written, as in Backward.
+   * @param grad TensorType gradient
+   * @param rows_updated SizeSet of rows written to grad
+   */
+  void MergeReplicaGradient(TensorType const &grad, SizeSet const &rows_updated)
+  {
+    if (rows_updated.empty())
+    {
+      gradient_accumulation_->InlineAdd(grad);
+    }
+    else
+    {
+      updated_rows_.insert(rows_updated.begin(), rows_updated.end());
+      utilities::SparseAdd(grad, *gradient_accumulation_, rows_updated);
+    }
+    reset_gradients_ = true;
+  }
+
   /**
    * Sets the internally stored data, and ensures the correct shape for
    * gradient accumulation
@@ -330,6 +446,50 @@ protected:
     }
   }
 };
+
+/**
+ * Merges all buffers into their Variables and zeroes the buffers for the next step
+ * @param scale factor applied to the buffered gradients before merging
+ */
+template <class T>
+void ReplicaGradients<T>::Reduce(DataType const &scale)
+{
+  for (auto &entry : buffers_)
+  {
+    Buffer &buffer = entry.second;
+    if (!buffer.touched)
+    {
+      continue;
+    }
+
+    if (scale != DataType{1})
+    {
+      buffer.gradient.InlineMultiply(scale);
+    }
+    entry.first->MergeReplicaGradient(buffer.gradient, buffer.updated_rows);
+
+    if (buffer.updated_rows.empty())
+    {
+      buffer.gradient.Fill(DataType{0});
+    }
+    else
+    {
+      for (SizeType row : buffer.updated_rows)
+      {
+        auto row_view = buffer.gradient.View(row);
+        auto row_it   = row_view.begin();
+        while (row_it.is_valid())
+        {
+          *row_it = DataType{0};
+          ++row_it;
+        }
+      }
+      buffer.updated_rows.clear();
+    }
+    buffer.touched = false;
+  }
+}
+
 }  // namespace ops
 }  // namespace ml
 }  // namespace fetch
@@ -0,0 +1,628 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/random/lcg.hpp"
+#include "math/base_types.hpp"
+#include "ml/dataloaders/word2vec_loaders/sgns_w2v_dataloader.hpp"
+#include "ml/dataloaders/word2vec_loaders/unigram_table.hpp"
+#include "ml/exceptions/exceptions.hpp"
+#include "ml/layers/skip_gram.hpp"
+#include "ml/ops/embeddings.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fetch {
+namespace ml {
+namespace optimisers {
+
+template <typename DataType>
+struct SGNSTrainingParams
+{
+  using SizeType = fetch::math::SizeType;
+
+  SizeType n_threads{std::max(SizeType{1}, SizeType{std::thread::hardware_concurrency()})};
+  SizeType window_size        = 5;  // maximum distance of a context word from its centre word
+  SizeType negative_samples   = 5;  // negative samples drawn for each context word
+  SizeType epochs             = 1;
+  SizeType unigram_table_size = 10000000;
+  SizeType seed               = 1337;
+
+  DataType starting_learning_rate = static_cast<DataType>(0.025);
+  DataType ending_learning_rate   = static_cast<DataType>(0.0000025);
+
+  // words more frequent than this are randomly discarded, 0 keeps every word
+  double freq_thresh = 0.001;
+
+  // whether the updates are added to the gradients of the embeddings instead of the weights
+  bool accumulate_gradients = false;
+};
+
+/**
+ * Skip-gram with negative sampling trainer for the two embeddings of a SkipGram layer, for corpora
+ * too large to train one sample at a time through the graph.
+ *
+ * Every thread trains on its own share of the sentences and writes its updates straight into the
+ * shared embedding matrices without any locking (Hogwild). The updates of a single pair of words
+ * touch only a few rows, so threads rarely collide, and when they do an update is occasionally
+ * lost, which SGD tolerates.
+ *
+ * Embedding rows are read and written as contiguous columns of the weights, and sigmoids are looked
+ * up in a precomputed table, so that training does not allocate.
+ *
+ * When accumulate_gradients is set, the change made to each row during Train is added to the
+ * gradients of the embeddings, the row is marked as updated and its weights are restored, so that
+ * the update is applied exactly once, by replaying it with ApplySparseGradients (here or on another
+ * copy of the embeddings). The gradients then hold whole updates rather than loss gradients, so
+ * they must not be stepped by an optimiser, which would scale them by its own learning rate.
+ * @tparam TensorType
+ */
+template <typename TensorType>
+class HogwildSGNSTrainer
+{
+public:
+  using DataType          = typename TensorType::Type;
+  using SizeType          = fetch::math::SizeType;
+  using SizeVector        = std::vector<SizeType>;
+  using SentencesType     = std::vector<std::vector<SizeType>>;
+  using EmbeddingsPtrType = std::shared_ptr<ops::Embeddings<TensorType>>;
+  using ParamsType        = SGNSTrainingParams<DataType>;
+
+  static constexpr SizeType SIGMOID_TABLE_SIZE   = 1000;
+  static constexpr SizeType MAX_EXP              = 6;
+  static constexpr SizeType WORDS_PER_LR_UPDATE  = 10000;
+  static constexpr SizeType MAX_SENTENCE_LENGTH  = 1000;
+  static constexpr SizeType MIN_WORDS_PER_THREAD = 1000;
+
+  HogwildSGNSTrainer(EmbeddingsPtrType input_embeddings, EmbeddingsPtrType context_embeddings,
+                     ParamsType const &params = ParamsType());
+  explicit HogwildSGNSTrainer(layers::SkipGram<TensorType> &skipgram,
+                              ParamsType const &             params = ParamsType());
+
+  SizeType Train(SentencesType const &sentences, SizeVector const &counts);
+  SizeType Train(dataloaders::GraphW2VLoader<TensorType> const &loader);
+
+  ParamsType const &GetParams() const;
+  DataType          GetLearningRate() const;
+
+private:
+  struct WorkerState
+  {
+    fetch::random::LinearCongruentialGenerator rng;
+
+    std::vector<DataType> input_error;
+    SizeVector            sentence;
+    std::vector<uint8_t>  input_rows_updated;
+    std::vector<uint8_t>  context_rows_updated;
+    SizeType              words_trained = 0;
+  };
+
+  EmbeddingsPtrType input_embeddings_;
+  EmbeddingsPtrType context_embeddings_;
+  ParamsType        params_;
+
+  // shallow copies of the embedding weights, taken at the start of every Train
+  TensorType input_weights_;
+  TensorType context_weights_;
+  SizeType   embedding_size_ = 0;
+  SizeType   vocab_size_     = 0;
+
+  std::vector<DataType> sigmoid_table_;
+  std::vector<double>   keep_probabilities_;
+  UnigramTable          unigram_table_;
+
+  std::atomic<SizeType> words_processed_{0};
+  SizeType              total_words_ = 0;
+
+  void Prepare(SentencesType const &sentences, SizeVector const &counts);
+  void TrainSentences(SentencesType const &sentences, SizeType begin, SizeType end,
+                      WorkerState &state);
+  void TrainPair(SizeType input_word, SizeType context_word, DataType learning_rate,
+                 WorkerState &state);
+  void AccumulateGradients(EmbeddingsPtrType const &embeddings, TensorType &weights,
+                           TensorType &initial_weights, std::vector<WorkerState> const &states,
+                           std::vector<uint8_t> WorkerState::*rows_updated);
+
+  DataType  LearningRate(SizeType words_processed) const;
+  DataType *Row(TensorType &weights, SizeType row);
+};
+
+namespace details {
+
+template <typename DataType, typename SizeType>
+DataType Dot(DataType const *a, DataType const *b, SizeType size)
+{
+  // independent partial sums so that the loop can be vectorised and pipelined
+  DataType sum0{0};
+  DataType sum1{0};
+  DataType sum2{0};
+  DataType sum3{0};
+
+  SizeType i = 0;
+  for (; i + 4 <= size; i += 4)
+  {
+    sum0 += a[i] * b[i];
+    sum1 += a[i + 1] * b[i + 1];
+    sum2 += a[i + 2] * b[i + 2];
+    sum3 += a[i + 3] * b[i + 3];
+  }
+  for (; i < size; ++i)
+  {
+    sum0 += a[i] * b[i];
+  }
+
+  return (sum0 + sum1) + (sum2 + sum3);
+}
+
+// y += alpha * x
+template <typename DataType, typename SizeType>
+void Axpy(DataType alpha, DataType const *x, DataType *y, SizeType size)
+{
+  for (SizeType i = 0; i < size; ++i)
+  {
+    y[i] += alpha * x[i];
+  }
+}
+
+}  // namespace details
+
+/**
+ * @param input_embeddings embeddings of the centre words, which are exported as the word vectors
+ * @param context_embeddings embeddings of the context words and negative samples
+ * @param params
+ */
+template <typename TensorType>
+HogwildSGNSTrainer<TensorType>::HogwildSGNSTrainer(EmbeddingsPtrType input_embeddings,
+                                                   EmbeddingsPtrType context_embeddings,
+                                                   ParamsType const &params)
+  : input_embeddings_(std::move(input_embeddings))
+  , context_embeddings_(std::move(context_embeddings))
+  , params_(params)
+{
+  if (!input_embeddings_ || !context_embeddings_)
+  {
+    throw exceptions::InvalidInput("SGNS trainer requires both input and context embeddings");
+  }
+  if (params_.n_threads == 0)
+  {
+    throw exceptions::InvalidInput("SGNS trainer requires at least one thread");
+  }
+
+  // sigmoid(x) for x in [-MAX_EXP, MAX_EXP)
+  sigmoid_table_.resize(SIGMOID_TABLE_SIZE);
+  for (SizeType i = 0; i < SIGMOID_TABLE_SIZE; ++i)
+  {
+    double const x =
+        ((2.0 * static_cast<double>(i) / static_cast<double>(SIGMOID_TABLE_SIZE)) - 1.0) *
+        static_cast<double>(MAX_EXP);
+    sigmoid_table_[i] = static_cast<DataType>(1.0 / (1.0 + std::exp(-x)));
+  }
+}
+
+/**
+ * Trains the embeddings of a SkipGram layer
+ * @param skipgram
+ * @param params
+ */
+template <typename TensorType>
+HogwildSGNSTrainer<TensorType>::HogwildSGNSTrainer(layers::SkipGram<TensorType> &skipgram,
+                                                   ParamsType const &             params)
+  : HogwildSGNSTrainer(std::dynamic_pointer_cast<ops::Embeddings<TensorType>>(
+                           skipgram.GetNode(skipgram.GetEmbedName())->GetOp()),
+                       skipgram.GetContextEmbeddings(), params)
+{}
+
+/**
+ * Trains the embeddings on the sentences of the corpus for params.epochs epochs
+ * @param sentences sentences of the corpus as word ids
+ * @param counts number of occurrences of each word id in the corpus, for subsampling and for the
+ * distribution of negative samples
+ * @return number of words trained on after subsampling
+ */
+template <typename TensorType>
+typename HogwildSGNSTrainer<TensorType>::SizeType HogwildSGNSTrainer<TensorType>::Train(
+    SentencesType const &sentences, SizeVector const &counts)
+{
+  Prepare(sentences, counts);
+  if (total_words_ == 0)
+  {
+    return 0;
+  }
+
+  TensorType initial_input_weights;
+  TensorType initial_context_weights;
+  if (params_.accumulate_gradients)
+  {
+    initial_input_weights   = input_weights_.Copy();
+    initial_context_weights = context_weights_.Copy();
+  }
+
+  // small corpora are not worth the threads
+  SizeType const n_threads = std::max(
+      SizeType{1},
+      std::min({params_.n_threads, sentences.size(), total_words_ / MIN_WORDS_PER_THREAD}));
+
+  std::vector<WorkerState> states(n_threads);
+  for (SizeType t = 0; t < n_threads; ++t)
+  {
+    states[t].rng.Seed(params_.seed + t);
+    states[t].input_error.resize(embedding_size_);
+    states[t].input_rows_updated.resize(vocab_size_, 0);
+    states[t].context_rows_updated.resize(vocab_size_, 0);
+  }
+
+  // every thread trains on a contiguous share of the sentences, as evenly sized as possible
+  std::vector<SizeType> boundaries{0};
+  SizeType              words{0};
+  for (SizeType i = 0; i < sentences.size(); ++i)
+  {
+    words += sentences[i].size();
+    if (words * n_threads >= (total_words_ / params_.epochs) * boundaries.size())
+    {
+      boundaries.push_back(i + 1);
+    }
+  }
+  boundaries.resize(n_threads + 1, sentences.size());
+
+  std::vector<std::exception_ptr> errors(n_threads);
+  auto                            run = [&](SizeType t) {
+    try
+    {
+      for (SizeType epoch = 0; epoch < params_.epochs; ++epoch)
+      {
+        TrainSentences(sentences, boundaries[t], boundaries[t + 1], states[t]);
+      }
+    }
+    catch (...)
+    {
+      errors[t] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(n_threads - 1);
+  for (SizeType t = 1; t < n_threads; ++t)
+  {
+    workers.emplace_back(run, t);
+  }
+  run(0);
+
+  for (auto &worker : workers)
+  {
+    worker.join();
+  }
+
+  for (auto const &error : errors)
+  {
+    if (error)
+    {
+      std::rethrow_exception(error);
+    }
+  }
+
+  if (params_.accumulate_gradients)
+  {
+    AccumulateGradients(input_embeddings_, input_weights_, initial_input_weights, states,
+                        &WorkerState::input_rows_updated);
+    AccumulateGradients(context_embeddings_, context_weights_, initial_context_weights, states,
+                        &WorkerState::context_rows_updated);
+  }
+
+  SizeType words_trained{0};
+  for (auto const &state : states)
+  {
+    words_trained += state.words_trained;
+  }
+
+  return words_trained;
+}
+
+/**
+ * Trains the embeddings on the corpus and word counts of a word2vec data loader
+ * @param loader
+ * @return number of words trained on after subsampling
+ */
+template <typename TensorType>
+typename HogwildSGNSTrainer<TensorType>::SizeType HogwildSGNSTrainer<TensorType>::Train(
+    dataloaders::GraphW2VLoader<TensorType> const &loader)
+{
+  return Train(loader.GetData(), loader.GetCounts());
+}
+
+template <typename TensorType>
+typename HogwildSGNSTrainer<TensorType>::ParamsType const &
+HogwildSGNSTrainer<TensorType>::GetParams() const
+{
+  return params_;
+}
+
+/**
+ * @return the learning rate reached by the last call to Train
+ */
+template <typename TensorType>
+typename HogwildSGNSTrainer<TensorType>::DataType HogwildSGNSTrainer<TensorType>::GetLearningRate()
+    const
+{
+  if (total_words_ == 0)
+  {
+    return params_.starting_learning_rate;
+  }
+
+  return LearningRate(words_processed_.load());
+}
+
+/**
+ * Checks the corpus against the embeddings and sets up subsampling and negative sampling
+ */
+template <typename TensorType>
+void HogwildSGNSTrainer<TensorType>::Prepare(SentencesType const &sentences,
+                                             SizeVector const &   counts)
+{
+  input_weights_   = input_embeddings_->GetWeights();
+  context_weights_ = context_embeddings_->GetWeights();
+
+  if ((input_weights_.shape().size() != 2) || (input_weights_.shape() != context_weights_.shape()))
+  {
+    throw exceptions::InvalidInput("input and context embeddings must have the same 2D shape");
+  }
+
+  embedding_size_ = input_weights_.shape(0);
+  vocab_size_     = input_weights_.shape(1);
+
+  if (counts.size() > vocab_size_)
+  {
+    throw exceptions::InvalidInput("vocabulary of " + std::to_string(counts.size()) +
+                                   " words does not fit embeddings of " +
+                                   std::to_string(vocab_size_) + " words");
+  }
+
+  SizeType corpus_words{0};
+  for (auto const &sentence : sentences)
+  {
+    for (SizeType word : sentence)
+    {
+      if (word >= counts.size())
+      {
+        throw exceptions::InvalidInput("word id " + std::to_string(word) +
+                                       " outside of the vocabulary");
+      }
+    }
+    corpus_words += sentence.size();
+  }
+
+  // probability of keeping each word when subsampling, as in the data loader
+  keep_probabilities_.assign(counts.size(), 1.0);
+  if (params_.freq_thresh > 0.0)
+  {
+    for (SizeType i = 0; i < counts.size(); ++i)
+    {
+      double const freq = static_cast<double>(counts[i]) / static_cast<double>(corpus_words);
+      if (freq > params_.freq_thresh)
+      {
+        keep_probabilities_[i] = std::sqrt(params_.freq_thresh / freq);
+      }
+    }
+  }
+
+  if (corpus_words > 0)
+  {
+    unigram_table_.ResetTable(counts, params_.unigram_table_size);
+  }
+
+  total_words_ = corpus_words * params_.epochs;
+  words_processed_.store(0);
+}
+
+/**
+ * Trains on the sentences [begin, end) once. Runs on the thread of the worker
+ */
+template <typename TensorType>
+void HogwildSGNSTrainer<TensorType>::TrainSentences(SentencesType const &sentences,
+                                                    SizeType begin, SizeType end,
+                                                    WorkerState &state)
+{
+  DataType learning_rate = LearningRate(words_processed_.load(std::memory_order_relaxed));
+  SizeType words_since_update{0};
+
+  for (SizeType s = begin; s < end; ++s)
+  {
+    auto const &corpus_sentence = sentences[s];
+
+    for (SizeType offset = 0; offset < corpus_sentence.size(); offset += MAX_SENTENCE_LENGTH)
+    {
+      SizeType const length =
+          std::min(SizeType{MAX_SENTENCE_LENGTH}, corpus_sentence.size() - offset);
+
+      // subsample frequent words before choosing the windows
+      auto &sentence = state.sentence;
+      sentence.clear();
+      for (SizeType i = offset; i < offset + length; ++i)
+      {
+        double const keep_probability = keep_probabilities_[corpus_sentence[i]];
+        if ((keep_probability >= 1.0) || (state.rng.AsDouble() < keep_probability))
+        {
+          sentence.push_back(corpus_sentence[i]);
+        }
+      }
+
+      for (SizeType position = 0; position < sentence.size(); ++position)
+      {
+        SizeType const window = (state.rng() % params_.window_size) + 1;
+        SizeType const first  = position > window ? position - window : 0;
+        SizeType const last   = std::min(position + window + 1, sentence.size());
+
+        for (SizeType c = first; c < last; ++c)
+        {
+          if (c != position)
+          {
+            TrainPair(sentence[position], sentence[c], learning_rate, state);
+          }
+        }
+      }
+
+      state.words_trained += sentence.size();
+      words_since_update += length;
+      if (words_since_update >= WORDS_PER_LR_UPDATE)
+      {
+        SizeType const processed =
+            words_processed_.fetch_add(words_since_update, std::memory_order_relaxed) +
+            words_since_update;
+        learning_rate      = LearningRate(processed);
+        words_since_update = 0;
+      }
+    }
+  }
+
+  words_processed_.fetch_add(words_since_update, std::memory_order_relaxed);
+}
+
+/**
+ * One step of SGD on the pair, against params.negative_samples negative samples
+ * @param input_word the centre word
+ * @param context_word a word within the window of the centre word
+ */
+template <typename TensorType>
+void HogwildSGNSTrainer<TensorType>::TrainPair(SizeType input_word, SizeType context_word,
+                                               DataType learning_rate, WorkerState &state)
+{
+  DataType *input = Row(input_weights_, input_word);
+  DataType *error = state.input_error.data();
+  std::fill(error, error + embedding_size_, DataType{0});
+
+  DataType const max_exp = static_cast<DataType>(MAX_EXP);
+  DataType const scale =
+      static_cast<DataType>(static_cast<double>(SIGMOID_TABLE_SIZE) / (2.0 * MAX_EXP));
+
+  for (SizeType d = 0; d <= params_.negative_samples; ++d)
+  {
+    SizeType target = context_word;
+    DataType label{1};
+    if (d > 0)
+    {
+      unigram_table_.Sample(state.rng, target);
+      if (target == context_word)
+      {
+        continue;
+      }
+      label = DataType{0};
+    }
+
+    DataType *     context = Row(context_weights_, target);
+    DataType const f       = details::Dot(input, context, embedding_size_);
+
+    // gradient of the log likelihood with respect to f, scaled by the learning rate
+    DataType g;
+    if (f > max_exp)
+    {
+      g = (label - DataType{1}) * learning_rate;
+    }
+    else if (f < -max_exp)
+    {
+      g = label * learning_rate;
+    }
+    else
+    {
+      auto const index = static_cast<SizeType>((f + max_exp) * scale);
+      g = (label - sigmoid_table_[std::min(index, SIGMOID_TABLE_SIZE - 1)]) * learning_rate;
+    }
+
+    details::Axpy(g, context, error, embedding_size_);
+    details::Axpy(g, input, context, embedding_size_);
+    state.context_rows_updated[target] = 1;
+  }
+
+  details::Axpy(DataType{1}, error, input, embedding_size_);
+  state.input_rows_updated[input_word] = 1;
+}
+
+/**
+ * Moves the change of every updated row since the start of Train from the weights to the gradient
+ * of the embeddings
+ */
+template <typename TensorType>
+void HogwildSGNSTrainer<TensorType>::AccumulateGradients(
+    EmbeddingsPtrType const &embeddings, TensorType &weights, TensorType &initial_weights,
+    std::vector<WorkerState> const &states, std::vector<uint8_t> WorkerState::*rows_updated)
+{
+  SizeVector rows;
+  for (SizeType row = 0; row < vocab_size_; ++row)
+  {
+    for (auto const &state : states)
+    {
+      if ((state.*rows_updated)[row] != 0)
+      {
+        rows.push_back(row);
+        break;
+      }
+    }
+  }
+
+  if (rows.empty())
+  {
+    return;
+  }
+
+  // one column per updated row, in the order of rows
+  TensorType gradient({embedding_size_, rows.size()});
+  for (SizeType i = 0; i < rows.size(); ++i)
+  {
+    DataType *      change  = Row(gradient, i);
+    DataType *      current = Row(weights, rows[i]);
+    DataType const *initial = Row(initial_weights, rows[i]);
+    for (SizeType j = 0; j < embedding_size_; ++j)
+    {
+      change[j]  = current[j] - initial[j];
+      current[j] = initial[j];
+    }
+  }
+
+  embeddings->AddToGradient(gradient, rows);
+}
+
+template <typename TensorType>
+typename HogwildSGNSTrainer<TensorType>::DataType HogwildSGNSTrainer<TensorType>::LearningRate(
+    SizeType words_processed) const
+{
+  double const progress = static_cast<double>(words_processed) / static_cast<double>(total_words_);
+  auto const   decayed  = static_cast<DataType>(
+      static_cast<double>(params_.starting_learning_rate) * std::max(0.0, 1.0 - progress));
+
+  return std::max(decayed, params_.ending_learning_rate);
+}
+
+/**
+ * @return pointer to the contiguous values of one row of the embeddings
+ */
+template <typename TensorType>
+typename HogwildSGNSTrainer<TensorType>::DataType *HogwildSGNSTrainer<TensorType>::Row(
+    TensorType &weights, SizeType row)
+{
+  return weights.data().pointer() + (row * weights.padded_height());
+}
+
+}  // namespace optimisers
+}  // namespace ml
+}  // namespace fetch
@@ -23,10 +23,14 @@
 #include "ml/dataloaders/dataloader.hpp"
 #include "ml/meta/ml_type_traits.hpp"
 #include "ml/optimisation/learning_rate_params.hpp"
+#include "ml/optimisation/replica_workers.hpp"
 #include "ml/utilities/graph_builder.hpp"
 
 #include <chrono>
+#include <exception>
+#include <memory>
 #include <utility>
+#include <vector>
 
 namespace fetch {
 namespace ml {
@@ -61,8 +65,12 @@ public:
   void SetGraph(std::shared_ptr<Graph<T>> graph)
   {
     graph_ = graph;
+    replicas_.clear();
   }
 
+  void     SetParallelism(SizeType n_replicas);
+  SizeType GetParallelism() const;
+
   /// DATA RUN INTERFACES ///
   DataType Run(std::vector<TensorType> const &data, TensorType const &labels,
                SizeType batch_size = SIZE_NOT_SET);
@@ -113,8 +121,23 @@ private:
   TensorType                                     batch_labels_;
   LearningRateParam<DataType>                    learning_rate_param_;
 
+  // data-parallel training state - replicas share the trainables of graph_
+  SizeType                               n_replicas_ = 1;
+  std::vector<std::shared_ptr<Graph<T>>> replicas_;
+  std::vector<ops::ReplicaGradients<T>>  replica_gradients_;
+  std::vector<std::vector<TensorType>>   replica_data_;
+  std::vector<TensorType>                replica_labels_;
+  std::vector<DataType>                  replica_losses_;
+  std::vector<std::exception_ptr>        replica_errors_;
+  std::shared_ptr<ReplicaWorkers>        replica_workers_;
+
   void ResetGradients();
 
+  DataType ComputeGradients(std::vector<TensorType> const &data, TensorType const &labels);
+  DataType ComputeGradientsParallel(std::vector<TensorType> const &data, TensorType const &labels);
+  void     PrepareReplicas();
+  void     RunReplica(SizeType replica);
+
   void PrintStats(SizeType batch_size, SizeType subset_size);
 
   void Init();
@@ -130,6 +153,7 @@ void Optimiser<T>::Init()
   graph_->Compile();
 
   graph_trainables_ = graph_->GetTrainables();
+  replicas_.clear();
 
   gradients_.clear();
   for (auto &train : graph_trainables_)
@@ -241,20 +265,7 @@ typename T::Type Optimiser<T>::Run(std::vector<TensorType> const &data, TensorTy
       it++;
     }
 
-    // Set inputs
-    auto name_it = input_node_names_.begin();
-    for (auto &input : batch_data_)
-    {
-      graph_->SetInputReference(*name_it, input);
-      ++name_it;
-    }
-
-    // Set Label
-    graph_->SetInputReference(label_node_name_, batch_labels_);
-
-    auto loss_tensor = graph_->ForwardPropagate(output_node_name_);
-    loss_ += *(loss_tensor.begin());
-    graph_->BackPropagate(output_node_name_);
+    loss_ += ComputeGradients(batch_data_, batch_labels_);
 
     // Compute and apply gradient
     ApplyGradients(batch_size);
@@ -345,19 +356,7 @@ typename T::Type Optimiser<T>::RunImplementation(
     // Do batch back-propagation
     input = loader.PrepareBatch(batch_size, is_done_set);
 
-    auto name_it = input_node_names_.begin();
-    for (auto &cur_input : input.second)
-    {
-      graph_->SetInputReference(*name_it, cur_input);
-      ++name_it;
-    }
-
-    // Set Label
-    graph_->SetInputReference(label_node_name_, input.first);
-
-    auto loss_tensor = graph_->ForwardPropagate(output_node_name_);
-    loss_ += *(loss_tensor.begin());
-    graph_->BackPropagate(output_node_name_);
+    loss_ += ComputeGradients(input.second, input.first);
 
     // Compute and apply gradient
     ApplyGradients(batch_size);
@@ -383,6 +382,203 @@ typename T::Type Optimiser<T>::RunImplementation(
   return loss_sum_ / static_cast<DataType>(i);
 }
 
+/**
+ * Sets the number of graph replicas used to compute the gradients of each batch. Each batch is
+ * split along its trailing dimension and the replicas run forward and backward concurrently, one
+ * thread each, accumulating into per-replica gradient buffers which are then reduced in replica
+ * order. The worker threads are kept alive between batches. A value of 1 (the default) trains
+ * serially on the graph itself.
+ * Replicas are built with Graph::InsertSharedCopy, so every op in the graph must be shareable.
+ * The fixed point error state is global, so overflow detection is unreliable for fixed point
+ * types with more than one replica.
+ * @tparam T TensorType
+ * @param n_replicas number of replicas (threads) to use
+ */
+template <class T>
+void Optimiser<T>::SetParallelism(SizeType n_replicas)
+{
+  if (n_replicas == 0)
+  {
+    throw exceptions::InvalidMode("Optimiser parallelism must be at least 1");
+  }
+  n_replicas_ = n_replicas;
+  replicas_.clear();
+}
+
+template <class T>
+typename Optimiser<T>::SizeType Optimiser<T>::GetParallelism() const
+{
+  return n_replicas_;
+}
+
+/**
+ * Runs the forward and backward pass for one batch, leaving the gradients accumulated in the
+ * trainables of graph_
+ * @tparam T TensorType
+ * @param data vector of batch input tensors, one per input node
+ * @param labels batch labels
+ * @return batch loss
+ */
+template <class T>
+typename T::Type Optimiser<T>::ComputeGradients(std::vector<TensorType> const &data,
+                                                TensorType const &             labels)
+{
+  if (n_replicas_ > 1)
+  {
+    return ComputeGradientsParallel(data, labels);
+  }
+
+  // Set inputs
+  auto name_it = input_node_names_.begin();
+  for (auto &input : data)
+  {
+    graph_->SetInputReference(*name_it, input);
+    ++name_it;
+  }
+
+  // Set Label
+  graph_->SetInputReference(label_node_name_, labels);
+
+  auto     loss_tensor = graph_->ForwardPropagate(output_node_name_);
+  DataType loss        = *(loss_tensor.begin());
+  graph_->BackPropagate(output_node_name_);
+
+  return loss;
+}
+
+/**
+ * Data-parallel version of ComputeGradients. The batch is split evenly across the replicas, each
+ * replica backpropagates its share concurrently into its own gradient buffers, and the buffers are
+ * then reduced into the shared trainables in replica order so that the result is deterministic.
+ * @tparam T TensorType
+ * @param data vector of batch input tensors, one per input node
+ * @param labels batch labels
+ * @return batch loss
+ */
+template <class T>
+typename T::Type Optimiser<T>::ComputeGradientsParallel(std::vector<TensorType> const &data,
+                                                        TensorType const &             labels)
+{
+  PrepareReplicas();
+
+  SizeType const batch_dimension = labels.shape().size() - 1;
+  SizeType const batch_size      = labels.shape(batch_dimension);
+  SizeType const n_active        = std::min(n_replicas_, batch_size);
+
+  // split the batch as evenly as possible, earlier replicas taking the remainder
+  std::vector<SizeType> split_sizes(n_active, batch_size / n_active);
+  for (SizeType i{0}; i < batch_size % n_active; ++i)
+  {
+    ++split_sizes[i];
+  }
+
+  replica_data_.assign(n_active, std::vector<TensorType>(data.size()));
+  for (SizeType j{0}; j < data.size(); ++j)
+  {
+    auto parts = TensorType::Split(data.at(j), split_sizes, data.at(j).shape().size() - 1);
+    for (SizeType r{0}; r < n_active; ++r)
+    {
+      replica_data_[r][j] = std::move(parts[r]);
+    }
+  }
+  auto label_parts = TensorType::Split(labels, split_sizes, batch_dimension);
+  replica_labels_.assign(label_parts.begin(), label_parts.end());
+
+  replica_losses_.assign(n_active, DataType{0});
+  replica_errors_.assign(n_active, nullptr);
+
+  replica_workers_->Run(n_active, [this](SizeType r) { RunReplica(r); });
+
+  for (auto const &error : replica_errors_)
+  {
+    if (error)
+    {
+      std::rethrow_exception(error);
+    }
+  }
+
+  // losses which average their gradients over the batch have each replica's contribution
+  // weighted by its share of the batch
+  bool const mean_gradient = graph_->GetNode(output_node_name_)->GetOp()->IsBatchAveraged();
+
+  DataType loss{0};
+  for (SizeType r{0}; r < n_active; ++r)
+  {
+    DataType const share =
+        static_cast<DataType>(split_sizes[r]) / static_cast<DataType>(batch_size);
+
+    replica_gradients_[r].Reduce(mean_gradient ? share : DataType{1});
+    loss += replica_losses_[r] * share;
+  }
+
+  return loss;
+}
+
+/**
+ * Builds the graph replicas for data-parallel training. Replica 0 is graph_ itself, the others
+ * are shared copies of it
+ * @tparam T TensorType
+ */
+template <class T>
+void Optimiser<T>::PrepareReplicas()
+{
+  if (replicas_.size() == n_replicas_)
+  {
+    return;
+  }
+
+  replicas_.clear();
+  replicas_.emplace_back(graph_);
+  for (SizeType r{1}; r < n_replicas_; ++r)
+  {
+    auto replica = std::make_shared<Graph<T>>();
+    graph_->InsertSharedCopy(replica);
+    replicas_.emplace_back(replica);
+  }
+
+  replica_gradients_.clear();
+  replica_gradients_.resize(n_replicas_);
+
+  // replica 0 runs on the calling thread
+  replica_workers_ = std::make_shared<ReplicaWorkers>(n_replicas_ - 1);
+}
+
+/**
+ * Forward and backward pass of one replica over its share of the batch. Runs on its own thread
+ * @tparam T TensorType
+ * @param replica index of the replica
+ */
+template <class T>
+void Optimiser<T>::RunReplica(SizeType replica)
+{
+  try
+  {
+    auto &graph = replicas_[replica];
+
+    // shared weights may have been updated since this replica last evaluated them
+    graph->ResetGraphCache(false);
+
+    auto name_it = input_node_names_.begin();
+    for (auto &input : replica_data_[replica])
+    {
+      graph->SetInputReference(*name_it, input);
+      ++name_it;
+    }
+    graph->SetInputReference(label_node_name_, replica_labels_[replica]);
+
+    replica_gradients_[replica].Activate();
+    auto loss_tensor         = graph->ForwardPropagate(output_node_name_);
+    replica_losses_[replica] = *(loss_tensor.begin());
+    graph->BackPropagate(output_node_name_);
+    ops::ReplicaGradients<T>::Deactivate();
+  }
+  catch (...)
+  {
+    ops::ReplicaGradients<T>::Deactivate();
+    replica_errors_[replica] = std::current_exception();
+  }
+}
+
 template <typename T>
 void Optimiser<T>::PrintStats(SizeType batch_size, SizeType subset_size)
 {
@@ -0,0 +1,70 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "math/base_types.hpp"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace fetch {
+namespace ml {
+namespace optimisers {
+
+/**
+ * A fixed set of worker threads which run one task per replica for each batch. The threads are
+ * kept alive between batches so that data-parallel training does not pay for spawning a thread
+ * per replica on every step.
+ */
+class ReplicaWorkers
+{
+public:
+  using SizeType = fetch::math::SizeType;
+  using Task     = std::function<void(SizeType)>;
+
+  explicit ReplicaWorkers(SizeType n_workers);
+  ReplicaWorkers(ReplicaWorkers const &) = delete;
+  ReplicaWorkers(ReplicaWorkers &&)      = delete;
+  ~ReplicaWorkers();
+
+  void Run(SizeType n_tasks, Task const &task);
+
+  ReplicaWorkers &operator=(ReplicaWorkers const &) = delete;
+  ReplicaWorkers &operator=(ReplicaWorkers &&) = delete;
+
+private:
+  void WorkerLoop(SizeType index);
+
+  std::mutex               run_lock_;  ///< Serialises calls to Run
+  std::mutex               lock_;
+  std::condition_variable  start_;
+  std::condition_variable  done_;
+  Task const *             task_{nullptr};
+  SizeType                 n_tasks_{0};
+  SizeType                 generation_{0};
+  SizeType                 pending_{0};
+  bool                     stopping_{false};
+  std::vector<std::thread> threads_;
+};
+
+}  // namespace optimisers
+}  // namespace ml
+}  // namespace fetch
@@ -0,0 +1,126 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "ml/optimisation/replica_workers.hpp"
+
+#include <algorithm>
+
+namespace fetch {
+namespace ml {
+namespace optimisers {
+
+/**
+ * Start the worker threads. Task 0 of every run is executed on the calling thread, so a run of
+ * n tasks needs n - 1 workers
+ * @param n_workers number of worker threads
+ */
+ReplicaWorkers::ReplicaWorkers(SizeType n_workers)
+{
+  threads_.reserve(n_workers);
+  for (SizeType i{0}; i < n_workers; ++i)
+  {
+    threads_.emplace_back(&ReplicaWorkers::WorkerLoop, this, i + 1);
+  }
+}
+
+ReplicaWorkers::~ReplicaWorkers()
+{
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    stopping_ = true;
+  }
+  start_.notify_all();
+
+  for (auto &thread : threads_)
+  {
+    thread.join();
+  }
+}
+
+/**
+ * Run task(0) ... task(n_tasks - 1), one per thread, and wait for all of them to complete. The
+ * task is expected to handle its own exceptions
+ * @param n_tasks number of tasks, at most one more than the number of workers
+ * @param task the task to run, called with the index of the task
+ */
+void ReplicaWorkers::Run(SizeType n_tasks, Task const &task)
+{
+  std::lock_guard<std::mutex> run_guard(run_lock_);
+
+  SizeType const n_remote = std::min<SizeType>(n_tasks, threads_.size() + 1) - 1;
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    task_    = &task;
+    n_tasks_ = n_remote + 1;
+    pending_ = threads_.size();
+    ++generation_;
+  }
+  start_.notify_all();
+
+  task(0);
+
+  // tasks beyond the number of threads are run on the calling thread
+  for (SizeType i = n_remote + 1; i < n_tasks; ++i)
+  {
+    task(i);
+  }
+
+  std::unique_lock<std::mutex> lock(lock_);
+  done_.wait(lock, [this]() { return pending_ == 0; });
+  task_ = nullptr;
+}
+
+void ReplicaWorkers::WorkerLoop(SizeType index)
+{
+  SizeType seen_generation{0};
+
+  for (;;)
+  {
+    Task const *task{nullptr};
+    {
+      std::unique_lock<std::mutex> lock(lock_);
+      start_.wait(lock, [&]() { return stopping_ || (generation_ != seen_generation); });
+
+      if (stopping_)
+      {
+        return;
+      }
+
+      seen_generation = generation_;
+      if (index < n_tasks_)
+      {
+        task = task_;
+      }
+    }
+
+    if (task != nullptr)
+    {
+      (*task)(index);
+    }
+
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      --pending_;
+    }
+    done_.notify_one();
+  }
+}
+
+}  // namespace optimisers
+}  // namespace ml
+}  // namespace fetch
@@ -0,0 +1,155 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/random/lcg.hpp"
+#include "math/base_types.hpp"
+#include "ml/clustering/space_partitioning_tree.hpp"
+#include "ml/clustering/vantage_point_tree.hpp"
+#include "vectorise/fixed_point/fixed_point.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace fetch {
+namespace ml {
+namespace test {
+
+template <typename T>
+class ClusteringTreeTests : public ::testing::Test
+{
+};
+
+using ClusteringTreeTypes = ::testing::Types<double, fetch::fixed_point::fp64_t>;
+TYPED_TEST_CASE(ClusteringTreeTests, ClusteringTreeTypes);
+
+template <typename DataType>
+std::vector<DataType> GeneratePoints(math::SizeType num_points, math::SizeType dimensions)
+{
+  fetch::random::LinearCongruentialGenerator rng{};
+
+  std::vector<DataType> points(num_points * dimensions);
+  for (auto &point : points)
+  {
+    point = static_cast<DataType>((rng.AsDouble() * 20.0) - 10.0);
+  }
+
+  return points;
+}
+
+template <typename DataType>
+double SquaredDistance(std::vector<DataType> const &points, math::SizeType dimensions,
+                       math::SizeType a, math::SizeType b)
+{
+  double sum{0};
+  for (math::SizeType d = 0; d < dimensions; ++d)
+  {
+    double const diff = static_cast<double>(points[(a * dimensions) + d]) -
+                        static_cast<double>(points[(b * dimensions) + d]);
+    sum += diff * diff;
+  }
+
+  return sum;
+}
+
+TYPED_TEST(ClusteringTreeTests, vantage_point_tree_finds_nearest_neighbours)
+{
+  using SizeType = math::SizeType;
+
+  SizeType const NUM_POINTS{300};
+  SizeType const DIMENSIONS{5};
+  SizeType const K{10};
+
+  auto const points = GeneratePoints<TypeParam>(NUM_POINTS, DIMENSIONS);
+
+  VantagePointTree<TypeParam> const tree(points.data(), NUM_POINTS, DIMENSIONS);
+
+  std::vector<SizeType>  indices;
+  std::vector<TypeParam> distances;
+  for (SizeType query = 0; query < NUM_POINTS; query += 7)
+  {
+    tree.Search(query, K, indices, distances);
+
+    // brute force k nearest neighbours
+    std::vector<std::pair<double, SizeType>> expected;
+    for (SizeType i = 0; i < NUM_POINTS; ++i)
+    {
+      expected.emplace_back(SquaredDistance(points, DIMENSIONS, query, i), i);
+    }
+    std::partial_sort(expected.begin(), expected.begin() + K, expected.end());
+
+    ASSERT_EQ(indices.size(), K);
+    EXPECT_EQ(indices.front(), query);
+    for (SizeType k = 0; k < K; ++k)
+    {
+      EXPECT_EQ(indices[k], expected[k].second);
+    }
+  }
+}
+
+TYPED_TEST(ClusteringTreeTests, space_partitioning_tree_with_zero_theta_is_exact)
+{
+  using SizeType = math::SizeType;
+
+  SizeType const NUM_POINTS{200};
+  SizeType const DIMENSIONS{2};
+
+  auto points = GeneratePoints<TypeParam>(NUM_POINTS, DIMENSIONS);
+
+  // duplicate points must be aggregated rather than subdivided indefinitely
+  std::copy(points.begin(), points.begin() + DIMENSIONS, points.begin() + DIMENSIONS);
+
+  SpacePartitioningTree<TypeParam> const tree(points.data(), NUM_POINTS, DIMENSIONS);
+
+  for (SizeType i = 0; i < NUM_POINTS; i += 13)
+  {
+    std::vector<TypeParam> force(DIMENSIONS, TypeParam{0});
+    auto const             sum_q = tree.ComputeNonEdgeForces(i, TypeParam{0}, force.data());
+
+    double              expected_sum_q{0};
+    std::vector<double> expected_force(DIMENSIONS, 0.0);
+    for (SizeType j = 0; j < NUM_POINTS; ++j)
+    {
+      if (i == j)
+      {
+        continue;
+      }
+
+      double const q = 1.0 / (1.0 + SquaredDistance(points, DIMENSIONS, i, j));
+      expected_sum_q += q;
+      for (SizeType d = 0; d < DIMENSIONS; ++d)
+      {
+        expected_force[d] += q * q *
+                             (static_cast<double>(points[(i * DIMENSIONS) + d]) -
+                              static_cast<double>(points[(j * DIMENSIONS) + d]));
+      }
+    }
+
+    EXPECT_NEAR(static_cast<double>(sum_q), expected_sum_q, 1e-6);
+    for (SizeType d = 0; d < DIMENSIONS; ++d)
+    {
+      EXPECT_NEAR(static_cast<double>(force[d]), expected_force[d], 1e-6);
+    }
+  }
+}
+
+}  // namespace test
+}  // namespace ml
+}  // namespace fetch
@@ -22,6 +22,10 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
 namespace fetch {
 namespace ml {
 namespace test {
@@ -34,6 +38,32 @@ class TsneTests : public ::testing::Test
 // we do not test for fp32 since that tends to overflow
 TYPED_TEST_CASE(TsneTests, math::test::HighPrecisionTensorFloatingTypes);
 
+template <typename TensorType>
+TensorType GenerateClusters(typename TensorType::SizeType n_input_feature_size,
+                            typename TensorType::SizeType n_data_size)
+{
+  using SizeType = fetch::math::SizeType;
+  using DataType = typename TensorType::Type;
+
+  TensorType A({n_input_feature_size, n_data_size});
+
+  // Generate easily separable clusters of data, one per quarter of the data set
+  SizeType const cluster_size = n_data_size / 4;
+  for (SizeType i = 0; i < n_data_size; ++i)
+  {
+    SizeType const cluster = std::min(i / cluster_size, SizeType{3});
+    DataType const offset  = static_cast<DataType>(i) + static_cast<DataType>(50);
+
+    for (SizeType j = 0; j < n_input_feature_size; ++j)
+    {
+      bool const positive = (j == 0) ? (cluster >= 2) : ((cluster % 2) == 1);
+      A(j, i)             = positive ? offset : -offset;
+    }
+  }
+
+  return A;
+}
+
 template <typename TypeParam>
 TypeParam RunTest(typename TypeParam::SizeType n_output_feature_size,
                   typename TypeParam::SizeType n_data_size)
@@ -54,33 +84,7 @@ TypeParam RunTest(typename TypeParam::SizeType n_output_feature_size,
   SizeType FINAL_MOMENTUM_STEPS{20};
   SizeType P_LATER_CORRECTION_ITERATION{10};
 
-  TensorType A({N_INPUT_FEATURE_SIZE, N_DATA_SIZE});
-
-  // Generate easily separable clusters of data
-  for (SizeType i = 0; i < 25; ++i)
-  {
-    A(0, i) = -static_cast<DataType>(i) - static_cast<DataType>(50);
-    A(1, i) = -static_cast<DataType>(i) - static_cast<DataType>(50);
-    A(2, i) = -static_cast<DataType>(i) - static_cast<DataType>(50);
-  }
-  for (SizeType i = 25; i < 50; ++i)
-  {
-    A(0, i) = -static_cast<DataType>(i) - static_cast<DataType>(50);
-    A(1, i) = static_cast<DataType>(i) + static_cast<DataType>(50);
-    A(2, i) = static_cast<DataType>(i) + static_cast<DataType>(50);
-  }
-  for (SizeType i = 50; i < 75; ++i)
-  {
-    A(0, i) = static_cast<DataType>(i) + static_cast<DataType>(50);
-    A(1, i) = -static_cast<DataType>(i) - static_cast<DataType>(50);
-    A(2, i) = -static_cast<DataType>(i) - static_cast<DataType>(50);
-  }
-  for (SizeType i = 75; i < 100; ++i)
-  {
-    A(0, i) = static_cast<DataType>(i) + static_cast<DataType>(50);
-    A(1, i) = static_cast<DataType>(i) + static_cast<DataType>(50);
-    A(2, i) = static_cast<DataType>(i) + static_cast<DataType>(50);
-  }
+  TensorType A = GenerateClusters<TensorType>(N_INPUT_FEATURE_SIZE, N_DATA_SIZE);
 
   fetch::ml::TSNE<TensorType> tsn(A, N_OUTPUT_FEATURE_SIZE, PERPLEXITY, RANDOM_SEED);
 
@@ -122,6 +126,80 @@ TYPED_TEST(TsneTests, tsne_test_2d)
               50 * static_cast<double>(math::function_tolerance<DataType>()));
 }
 
+TYPED_TEST(TsneTests, tsne_barnes_hut_matches_exact_with_zero_theta)
+{
+  using DataType   = typename TypeParam::Type;
+  using TensorType = TypeParam;
+  using SizeType   = fetch::math::SizeType;
+  using TSNE       = fetch::ml::TSNE<TensorType>;
+
+  // with every point in every neighbourhood and theta = 0 Barnes-Hut computes the exact gradient
+  SizeType const N_DATA_SIZE{20};
+  SizeType const RANDOM_SEED{123456};
+  DataType const PERPLEXITY    = fetch::math::Type<DataType>("10");
+  DataType const LEARNING_RATE = fetch::math::Type<DataType>("100");
+  DataType const MOMENTUM      = fetch::math::Type<DataType>("0.5");
+
+  TensorType const A = GenerateClusters<TensorType>(3, N_DATA_SIZE);
+
+  TSNE exact(A, 2, PERPLEXITY, RANDOM_SEED, TSNE::Mode::EXACT);
+  TSNE barnes_hut(A, 2, PERPLEXITY, RANDOM_SEED, TSNE::Mode::BARNES_HUT, DataType{0});
+
+  EXPECT_FALSE(exact.IsBarnesHut());
+  EXPECT_TRUE(barnes_hut.IsBarnesHut());
+
+  exact.Optimise(LEARNING_RATE, 3, MOMENTUM, MOMENTUM, 20, 10);
+  barnes_hut.Optimise(LEARNING_RATE, 3, MOMENTUM, MOMENTUM, 20, 10);
+
+  EXPECT_TRUE(exact.GetOutputMatrix().AllClose(
+      barnes_hut.GetOutputMatrix(), fetch::math::Type<DataType>("0.001"),
+      fetch::math::Type<DataType>("0.001")));
+}
+
+TYPED_TEST(TsneTests, tsne_barnes_hut_separates_clusters)
+{
+  using DataType   = typename TypeParam::Type;
+  using TensorType = TypeParam;
+  using SizeType   = fetch::math::SizeType;
+  using TSNE       = fetch::ml::TSNE<TensorType>;
+
+  SizeType const N_DATA_SIZE{200};
+  SizeType const CLUSTER_SIZE{N_DATA_SIZE / 4};
+  SizeType const RANDOM_SEED{123456};
+  DataType const PERPLEXITY    = fetch::math::Type<DataType>("10");
+  DataType const LEARNING_RATE = fetch::math::Type<DataType>("100");
+
+  TSNE tsne(GenerateClusters<TensorType>(3, N_DATA_SIZE), 2, PERPLEXITY, RANDOM_SEED,
+            TSNE::Mode::BARNES_HUT);
+  tsne.SetParallelism(2);
+  tsne.Optimise(LEARNING_RATE, 100, fetch::math::Type<DataType>("0.5"),
+                fetch::math::Type<DataType>("0.8"), 20, 50);
+
+  TensorType const output = tsne.GetOutputMatrix();
+
+  // the clusters are elongated, so check that the nearest neighbour of every point in the
+  // embedding belongs to the same cluster
+  for (SizeType i = 0; i < N_DATA_SIZE; ++i)
+  {
+    SizeType nearest{i};
+    double   nearest_distance = std::numeric_limits<double>::max();
+    for (SizeType j = 0; j < N_DATA_SIZE; ++j)
+    {
+      double const dx = static_cast<double>(output.At(0, i)) - static_cast<double>(output.At(0, j));
+      double const dy = static_cast<double>(output.At(1, i)) - static_cast<double>(output.At(1, j));
+
+      double const distance = (dx * dx) + (dy * dy);
+      if ((i != j) && (distance < nearest_distance))
+      {
+        nearest          = j;
+        nearest_distance = distance;
+      }
+    }
+
+    EXPECT_EQ(nearest / CLUSTER_SIZE, i / CLUSTER_SIZE);
+  }
+}
+
 }  // namespace test
 }  // namespace ml
 }  // namespace fetch
@@ -701,6 +701,68 @@ TYPED_TEST(GraphTest, diamond_graph_getStateDict)
   EXPECT_EQ(sd.dict_["Diamond_Weight2"].weights_->shape(), data2.shape());
 }
 
+TYPED_TEST(GraphTest, execution_stats_no_allocations_after_first_step)
+{
+  using TensorType = TypeParam;
+  using SizeType   = fetch::math::SizeType;
+
+  fetch::ml::Graph<TensorType> g;
+
+  std::string input = g.template AddNode<fetch::ml::ops::PlaceHolder<TensorType>>("Input", {});
+  std::string label = g.template AddNode<fetch::ml::ops::PlaceHolder<TensorType>>("Label", {});
+  std::string fc1 = g.template AddNode<fetch::ml::layers::FullyConnected<TensorType>>(
+      "FC1", {input}, 4u, 8u, fetch::ml::details::ActivationType::RELU);
+  std::string fc2 = g.template AddNode<fetch::ml::layers::FullyConnected<TensorType>>(
+      "FC2", {fc1}, 8u, 2u);
+  std::string error =
+      g.template AddNode<fetch::ml::ops::MeanSquareErrorLoss<TensorType>>("Error", {fc2, label});
+  g.Compile();
+
+  auto run_step = [&g, &input, &label, &error](SizeType batch_size) {
+    TensorType data({4, batch_size});
+    TensorType gt({2, batch_size});
+    data.FillUniformRandom();
+    gt.FillUniformRandom();
+
+    g.SetInput(input, data);
+    g.SetInput(label, gt);
+    g.Evaluate(error);
+    g.BackPropagate(error);
+  };
+
+  run_step(3);
+  auto const &stats = g.GetExecutionStats();
+  EXPECT_EQ(stats.steps, 1);
+  EXPECT_GT(stats.activation_bytes, 0);
+  EXPECT_GT(stats.gradient_bytes, 0);
+  EXPECT_EQ(stats.peak_bytes, stats.activation_bytes + stats.gradient_bytes);
+
+  SizeType const first_step_allocations = stats.allocations;
+  SizeType const peak_bytes             = stats.peak_bytes;
+  EXPECT_GT(first_step_allocations, 0);
+
+  // the ops write their error signals into the buffers of the first step
+  for (SizeType i = 0; i < 3; ++i)
+  {
+    run_step(3);
+    EXPECT_EQ(stats.allocations, 0);
+  }
+  EXPECT_EQ(stats.steps, 4);
+  EXPECT_EQ(stats.total_allocations, first_step_allocations);
+  EXPECT_EQ(stats.peak_bytes, peak_bytes);
+
+  // a larger batch reallocates the buffers once
+  run_step(5);
+  EXPECT_GT(stats.allocations, 0);
+  EXPECT_GT(stats.peak_bytes, peak_bytes);
+  run_step(5);
+  EXPECT_EQ(stats.allocations, 0);
+
+  g.ResetExecutionStats();
+  EXPECT_EQ(g.GetExecutionStats().steps, 0);
+  EXPECT_EQ(g.GetExecutionStats().peak_bytes, 0);
+}
+
 }  // namespace test
 }  // namespace ml
 }  // namespace fetch
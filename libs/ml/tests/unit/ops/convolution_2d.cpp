@@ -25,6 +25,7 @@
 
 #include "gtest/gtest.h"
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -38,6 +39,108 @@ class Convolution2DTest : public ::testing::Test
 
 TYPED_TEST_CASE(Convolution2DTest, math::test::TensorFloatingTypes);
 
+template <typename TensorType>
+TensorType GenerateTensor(std::vector<fetch::math::SizeType> const &shape, int64_t seed)
+{
+  using DataType = typename TensorType::Type;
+
+  TensorType tensor(shape);
+  int64_t    value = seed;
+  for (auto &element : tensor)
+  {
+    value   = (value * 31 + 7) % 17;
+    element = static_cast<DataType>(static_cast<double>(value - 8) / 8.0);
+  }
+
+  return tensor;
+}
+
+/**
+ * Naive convolution used as the reference for the optimised kernels
+ */
+template <typename TensorType>
+TensorType ReferenceForward(TensorType const &input, TensorType const &kernels,
+                            fetch::math::SizeType stride)
+{
+  using DataType = typename TensorType::Type;
+  using SizeType = fetch::math::SizeType;
+
+  SizeType const output_height = (input.shape(1) - kernels.shape(2) + stride) / stride;
+  SizeType const output_width  = (input.shape(2) - kernels.shape(3) + stride) / stride;
+
+  TensorType output({kernels.shape(0), output_height, output_width, input.shape(3)});
+  for (SizeType i_b{0}; i_b < input.shape(3); ++i_b)
+  {
+    for (SizeType i_oc{0}; i_oc < kernels.shape(0); ++i_oc)
+    {
+      for (SizeType i_o{0}; i_o < output_height; ++i_o)
+      {
+        for (SizeType j_o{0}; j_o < output_width; ++j_o)
+        {
+          DataType sum{0};
+          for (SizeType i_ic{0}; i_ic < kernels.shape(1); ++i_ic)
+          {
+            for (SizeType i_k{0}; i_k < kernels.shape(2); ++i_k)
+            {
+              for (SizeType j_k{0}; j_k < kernels.shape(3); ++j_k)
+              {
+                sum += kernels.At(i_oc, i_ic, i_k, j_k, 0) *
+                       input.At(i_ic, i_o * stride + i_k, j_o * stride + j_k, i_b);
+              }
+            }
+          }
+          output.At(i_oc, i_o, j_o, i_b) = sum;
+        }
+      }
+    }
+  }
+
+  return output;
+}
+
+/**
+ * Naive convolution gradient used as the reference for the optimised kernels
+ */
+template <typename TensorType>
+std::vector<TensorType> ReferenceBackward(TensorType const &input, TensorType const &kernels,
+                                          TensorType const &error, fetch::math::SizeType stride)
+{
+  using SizeType = fetch::math::SizeType;
+
+  TensorType input_error(input.shape());
+  TensorType kernel_error(kernels.shape());
+  for (SizeType i_b{0}; i_b < error.shape(3); ++i_b)
+  {
+    for (SizeType i_oc{0}; i_oc < error.shape(0); ++i_oc)
+    {
+      for (SizeType i_o{0}; i_o < error.shape(1); ++i_o)
+      {
+        for (SizeType j_o{0}; j_o < error.shape(2); ++j_o)
+        {
+          for (SizeType i_ic{0}; i_ic < kernels.shape(1); ++i_ic)
+          {
+            for (SizeType i_k{0}; i_k < kernels.shape(2); ++i_k)
+            {
+              for (SizeType j_k{0}; j_k < kernels.shape(3); ++j_k)
+              {
+                SizeType const i_i = i_o * stride + i_k;
+                SizeType const j_i = j_o * stride + j_k;
+
+                input_error.At(i_ic, i_i, j_i, i_b) +=
+                    kernels.At(i_oc, i_ic, i_k, j_k, 0) * error.At(i_oc, i_o, j_o, i_b);
+                kernel_error.At(i_oc, i_ic, i_k, j_k, 0) +=
+                    input.At(i_ic, i_i, j_i, i_b) * error.At(i_oc, i_o, j_o, i_b);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return {input_error, kernel_error};
+}
+
 TYPED_TEST(Convolution2DTest, forward_1x1x1x2_1x1x1x1x2)
 {
   using DataType   = typename TypeParam::Type;
@@ -424,6 +527,77 @@ TYPED_TEST(Convolution2DTest, saveparams_backward_3x3x3x2_5x3x3x3x2)
       fetch::math::function_tolerance<typename TypeParam::Type>()));
 }
 
+TYPED_TEST(Convolution2DTest, forward_algorithms_match_reference)
+{
+  using TensorType = TypeParam;
+  using SizeType   = fetch::math::SizeType;
+  using OpType     = fetch::ml::ops::Convolution2D<TensorType>;
+  using Algorithm  = typename OpType::Algorithm;
+
+  // odd output height and even output width exercise the partial Winograd tiles
+  TensorType const input   = GenerateTensor<TensorType>({4, 9, 8, 2}, 1);
+  TensorType const kernels = GenerateTensor<TensorType>({6, 4, 3, 3, 1}, 2);
+
+  for (SizeType stride : {SizeType{1}, SizeType{2}})
+  {
+    TensorType const expected = ReferenceForward(input, kernels, stride);
+
+    for (Algorithm algorithm :
+         {Algorithm::AUTOMATIC, Algorithm::DIRECT, Algorithm::WINOGRAD, Algorithm::IM2COL})
+    {
+      OpType op(stride);
+      op.SetAlgorithm(algorithm);
+
+      TensorType output(op.ComputeOutputShape(
+          {std::make_shared<TensorType>(input), std::make_shared<TensorType>(kernels)}));
+      op.Forward({std::make_shared<TensorType>(input), std::make_shared<TensorType>(kernels)},
+                 output);
+
+      ASSERT_EQ(output.shape(), expected.shape());
+      EXPECT_TRUE(output.AllClose(expected,
+                                  fetch::math::function_tolerance<typename TypeParam::Type>(),
+                                  fetch::math::function_tolerance<typename TypeParam::Type>()));
+    }
+  }
+}
+
+TYPED_TEST(Convolution2DTest, backward_algorithms_accumulate_overlapping_windows)
+{
+  using TensorType = TypeParam;
+  using SizeType   = fetch::math::SizeType;
+  using OpType     = fetch::ml::ops::Convolution2D<TensorType>;
+  using Algorithm  = typename OpType::Algorithm;
+
+  TensorType const input   = GenerateTensor<TensorType>({2, 7, 6, 2}, 3);
+  TensorType const kernels = GenerateTensor<TensorType>({3, 2, 3, 3, 1}, 4);
+
+  for (SizeType stride : {SizeType{1}, SizeType{2}})
+  {
+    OpType     op(stride);
+    TensorType error = GenerateTensor<TensorType>(
+        op.ComputeOutputShape(
+            {std::make_shared<TensorType>(input), std::make_shared<TensorType>(kernels)}),
+        5);
+
+    std::vector<TensorType> const expected = ReferenceBackward(input, kernels, error, stride);
+
+    for (Algorithm algorithm : {Algorithm::AUTOMATIC, Algorithm::DIRECT, Algorithm::IM2COL})
+    {
+      op.SetAlgorithm(algorithm);
+
+      std::vector<TensorType> prediction = op.Backward(
+          {std::make_shared<TensorType>(input), std::make_shared<TensorType>(kernels)}, error);
+
+      EXPECT_TRUE(prediction.at(0).AllClose(
+          expected.at(0), fetch::math::function_tolerance<typename TypeParam::Type>(),
+          fetch::math::function_tolerance<typename TypeParam::Type>()));
+      EXPECT_TRUE(prediction.at(1).AllClose(
+          expected.at(1), fetch::math::function_tolerance<typename TypeParam::Type>(),
+          fetch::math::function_tolerance<typename TypeParam::Type>()));
+    }
+  }
+}
+
 }  // namespace test
 }  // namespace ml
 }  // namespace fetch
@@ -0,0 +1,273 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/random/lcg.hpp"
+#include "gtest/gtest.h"
+#include "ml/layers/skip_gram.hpp"
+#include "ml/optimisation/hogwild_sgns_trainer.hpp"
+#include "test_types.hpp"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace fetch {
+namespace ml {
+namespace test {
+
+template <typename T>
+class HogwildSGNSTrainerTest : public ::testing::Test
+{
+};
+
+using SGNSTensorTypes = ::testing::Types<fetch::math::Tensor<float>, fetch::math::Tensor<double>,
+                                         fetch::math::Tensor<fetch::fixed_point::fp64_t>>;
+TYPED_TEST_CASE(HogwildSGNSTrainerTest, SGNSTensorTypes);
+
+namespace hogwild_sgns_details {
+
+using SizeType = fetch::math::SizeType;
+
+constexpr SizeType VOCAB_SIZE     = 20;
+constexpr SizeType EMBEDDING_SIZE = 8;
+
+/**
+ * Sentences drawn from two disjoint halves of the vocabulary, so that words of the same half share
+ * their contexts
+ */
+inline std::vector<std::vector<SizeType>> GenerateCorpus(SizeType n_sentences,
+                                                          std::vector<SizeType> &counts)
+{
+  fetch::random::LinearCongruentialGenerator rng;
+  counts.assign(VOCAB_SIZE, 0);
+
+  std::vector<std::vector<SizeType>> sentences(n_sentences);
+  for (SizeType s = 0; s < n_sentences; ++s)
+  {
+    SizeType const half = (s % 2) * (VOCAB_SIZE / 2);
+    for (SizeType w = 0; w < 10; ++w)
+    {
+      SizeType const word = half + (rng() % (VOCAB_SIZE / 2));
+      sentences[s].push_back(word);
+      ++counts[word];
+    }
+  }
+
+  return sentences;
+}
+
+template <typename TensorType>
+std::shared_ptr<ops::Embeddings<TensorType>> MakeEmbeddings(SizeType seed)
+{
+  using DataType = typename TensorType::Type;
+
+  fetch::random::LinearCongruentialGenerator rng;
+  rng.Seed(seed);
+
+  TensorType weights({EMBEDDING_SIZE, VOCAB_SIZE});
+  for (auto &w : weights)
+  {
+    w = static_cast<DataType>((rng.AsDouble() - 0.5) / static_cast<double>(EMBEDDING_SIZE));
+  }
+
+  return std::make_shared<ops::Embeddings<TensorType>>(weights);
+}
+
+template <typename TensorType>
+double Cosine(TensorType const &weights, SizeType a, SizeType b)
+{
+  double dot{0};
+  double norm_a{0};
+  double norm_b{0};
+  for (SizeType i = 0; i < weights.shape(0); ++i)
+  {
+    auto const x = static_cast<double>(weights(i, a));
+    auto const y = static_cast<double>(weights(i, b));
+    dot += x * y;
+    norm_a += x * x;
+    norm_b += y * y;
+  }
+
+  return dot / std::sqrt(norm_a * norm_b);
+}
+
+}  // namespace hogwild_sgns_details
+
+TYPED_TEST(HogwildSGNSTrainerTest, similar_contexts_give_similar_embeddings)
+{
+  using namespace hogwild_sgns_details;
+  using TensorType = TypeParam;
+
+  std::vector<SizeType> counts;
+  auto const            sentences = GenerateCorpus(400, counts);
+
+  auto input   = MakeEmbeddings<TensorType>(1);
+  auto context = MakeEmbeddings<TensorType>(2);
+
+  optimisers::SGNSTrainingParams<typename TensorType::Type> params;
+  params.n_threads          = 2;
+  params.window_size        = 3;
+  params.negative_samples   = 3;
+  params.epochs             = 5;
+  params.freq_thresh        = 0;
+  params.unigram_table_size = 10000;
+
+  optimisers::HogwildSGNSTrainer<TensorType> trainer(input, context, params);
+  EXPECT_EQ(trainer.Train(sentences, counts), 400 * 10 * 5);
+  EXPECT_LT(static_cast<double>(trainer.GetLearningRate()),
+            static_cast<double>(params.starting_learning_rate));
+
+  // average similarity within and across the two halves of the vocabulary
+  auto const &weights = input->GetWeights();
+  double      same{0};
+  double      different{0};
+  for (SizeType a = 0; a < VOCAB_SIZE; ++a)
+  {
+    for (SizeType b = a + 1; b < VOCAB_SIZE; ++b)
+    {
+      bool const same_half = (a < VOCAB_SIZE / 2) == (b < VOCAB_SIZE / 2);
+      (same_half ? same : different) += Cosine(weights, a, b);
+    }
+  }
+  SizeType const pairs_per_half = (VOCAB_SIZE / 2) * (VOCAB_SIZE / 2 - 1) / 2;
+  same /= static_cast<double>(2 * pairs_per_half);
+  different /= static_cast<double>((VOCAB_SIZE / 2) * (VOCAB_SIZE / 2));
+
+  EXPECT_GT(same, different + 0.5);
+}
+
+TYPED_TEST(HogwildSGNSTrainerTest, single_thread_is_deterministic)
+{
+  using namespace hogwild_sgns_details;
+  using TensorType = TypeParam;
+
+  std::vector<SizeType> counts;
+  auto const            sentences = GenerateCorpus(50, counts);
+
+  optimisers::SGNSTrainingParams<typename TensorType::Type> params;
+  params.n_threads          = 1;
+  params.unigram_table_size = 1000;
+
+  std::vector<std::shared_ptr<ops::Embeddings<TensorType>>> inputs;
+  for (SizeType run = 0; run < 2; ++run)
+  {
+    inputs.push_back(MakeEmbeddings<TensorType>(1));
+    optimisers::HogwildSGNSTrainer<TensorType> trainer(inputs.back(), MakeEmbeddings<TensorType>(2),
+                                                       params);
+    trainer.Train(sentences, counts);
+  }
+
+  EXPECT_FALSE(inputs[0]->GetWeights().AllClose(MakeEmbeddings<TensorType>(1)->GetWeights()));
+  EXPECT_EQ(inputs[0]->GetWeights(), inputs[1]->GetWeights());
+}
+
+TYPED_TEST(HogwildSGNSTrainerTest, accumulated_gradients_replay_the_update)
+{
+  using namespace hogwild_sgns_details;
+  using TensorType = TypeParam;
+  using DataType   = typename TensorType::Type;
+
+  std::vector<SizeType> counts;
+  auto sentences = GenerateCorpus(50, counts);
+
+  // the second half of the vocabulary is never seen
+  sentences.erase(std::remove_if(sentences.begin(), sentences.end(),
+                                 [](std::vector<SizeType> const &sentence) {
+                                   return sentence.front() >= VOCAB_SIZE / 2;
+                                 }),
+                  sentences.end());
+
+  auto input   = MakeEmbeddings<TensorType>(1);
+  auto context = MakeEmbeddings<TensorType>(2);
+
+  optimisers::SGNSTrainingParams<DataType> params;
+  params.n_threads          = 1;
+  params.unigram_table_size = 1000;
+
+  // the same training, applied directly to the weights
+  auto reference = MakeEmbeddings<TensorType>(1);
+  {
+    optimisers::HogwildSGNSTrainer<TensorType> trainer(reference, MakeEmbeddings<TensorType>(2),
+                                                       params);
+    trainer.Train(sentences, counts);
+  }
+
+  params.accumulate_gradients = true;
+
+  optimisers::HogwildSGNSTrainer<TensorType> trainer(input, context, params);
+  trainer.Train(sentences, counts);
+
+  // the update is only recorded, the weights are left as they were
+  EXPECT_EQ(input->GetWeights(), MakeEmbeddings<TensorType>(1)->GetWeights());
+  EXPECT_EQ(context->GetWeights(), MakeEmbeddings<TensorType>(2)->GetWeights());
+
+  auto const &updated_rows = input->GetUpdatedRowsReferences();
+  EXPECT_FALSE(updated_rows.empty());
+  for (SizeType row : updated_rows)
+  {
+    EXPECT_LT(row, VOCAB_SIZE / 2);
+  }
+
+  // applying the recorded update once reproduces the trained weights
+  auto const gradient = input->GetGradientsReferences().Copy();
+  auto       rows     = updated_rows;
+  input->ApplySparseGradient(gradient, rows);
+  EXPECT_TRUE(input->GetWeights().AllClose(reference->GetWeights(),
+                                             fetch::math::function_tolerance<DataType>()));
+}
+
+TYPED_TEST(HogwildSGNSTrainerTest, trains_skipgram_layer)
+{
+  using namespace hogwild_sgns_details;
+  using TensorType = TypeParam;
+
+  layers::SkipGram<TensorType> skipgram(1, 1, EMBEDDING_SIZE, VOCAB_SIZE);
+  auto                         context = skipgram.GetContextEmbeddings();
+  ASSERT_NE(context, nullptr);
+
+  auto const initial = context->GetWeights().Copy();
+
+  std::vector<SizeType> counts;
+  auto const            sentences = GenerateCorpus(50, counts);
+
+  optimisers::SGNSTrainingParams<typename TensorType::Type> params;
+  params.unigram_table_size = 1000;
+
+  optimisers::HogwildSGNSTrainer<TensorType> trainer(skipgram, params);
+  EXPECT_GT(trainer.Train(sentences, counts), 0);
+  EXPECT_FALSE(context->GetWeights().AllClose(initial));
+}
+
+TYPED_TEST(HogwildSGNSTrainerTest, rejects_words_outside_vocabulary)
+{
+  using namespace hogwild_sgns_details;
+  using TensorType = TypeParam;
+
+  optimisers::HogwildSGNSTrainer<TensorType> trainer(MakeEmbeddings<TensorType>(1),
+                                                     MakeEmbeddings<TensorType>(2));
+
+  std::vector<SizeType> counts(VOCAB_SIZE, 1);
+  EXPECT_THROW(trainer.Train({{0, 1, VOCAB_SIZE}}, counts), exceptions::InvalidInput);
+
+  counts.resize(VOCAB_SIZE + 1, 1);
+  EXPECT_THROW(trainer.Train({{0, 1, 2}}, counts), exceptions::InvalidInput);
+}
+
+}  // namespace test
+}  // namespace ml
+}  // namespace fetch
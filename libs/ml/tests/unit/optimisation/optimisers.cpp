@@ -16,10 +16,12 @@
 //
 //------------------------------------------------------------------------------
 
+#include "core/random.hpp"
 #include "gtest/gtest.h"
 #include "ml/core/graph.hpp"
 #include "ml/layers/fully_connected.hpp"
 #include "ml/ops/activations/relu.hpp"
+#include "ml/ops/activations/softmax.hpp"
 #include "ml/ops/loss_functions.hpp"
 #include "ml/ops/placeholder.hpp"
 #include "ml/optimisation/adagrad_optimiser.hpp"
@@ -72,6 +74,95 @@ std::shared_ptr<fetch::ml::Graph<TypeParam>> PrepareTestGraph(
   return g;
 }
 
+template <typename TypeParam, typename LossType>
+std::shared_ptr<fetch::ml::Graph<TypeParam>> PrepareLossTestGraph(bool         softmax_output,
+                                                                  std::string &input_name,
+                                                                  std::string &label_name,
+                                                                  std::string &error_name)
+{
+  std::shared_ptr<fetch::ml::Graph<TypeParam>> g(std::make_shared<fetch::ml::Graph<TypeParam>>());
+
+  input_name = g->template AddNode<fetch::ml::ops::PlaceHolder<TypeParam>>("", {});
+
+  std::string output_name = g->template AddNode<fetch::ml::layers::FullyConnected<TypeParam>>(
+      "FC1", {input_name}, 4u, 3u);
+  if (softmax_output)
+  {
+    output_name = g->template AddNode<fetch::ml::ops::Softmax<TypeParam>>("", {output_name});
+  }
+
+  label_name = g->template AddNode<fetch::ml::ops::PlaceHolder<TypeParam>>("", {});
+  error_name = g->template AddNode<LossType>("Error", {output_name, label_name});
+
+  return g;
+}
+
+template <typename TypeParam>
+TypeParam PrepareOneHotLabels(fetch::math::SizeType n_classes, fetch::math::SizeType batch_size)
+{
+  using DataType = typename TypeParam::Type;
+
+  TypeParam gt({n_classes, batch_size});
+  for (fetch::math::SizeType i = 0; i < batch_size; ++i)
+  {
+    gt.Set(i % n_classes, i, DataType{1});
+  }
+
+  return gt;
+}
+
+/**
+ * Trains two identical models on the same batch, one serially and one split unevenly across
+ * replicas, and checks that they reach the same loss and weights
+ */
+template <typename TypeParam, typename LossType>
+void ExpectReplicasMatchSerial(TypeParam const &gt, bool softmax_output)
+{
+  using DataType = typename TypeParam::Type;
+  using SizeType = fetch::math::SizeType;
+
+  auto learning_rate = DataType{0.01f};
+
+  std::string                                  input_name;
+  std::string                                  label_name;
+  std::string                                  output_name;
+  std::shared_ptr<fetch::ml::Graph<TypeParam>> g = PrepareLossTestGraph<TypeParam, LossType>(
+      softmax_output, input_name, label_name, output_name);
+  std::shared_ptr<fetch::ml::Graph<TypeParam>> g_2 = PrepareLossTestGraph<TypeParam, LossType>(
+      softmax_output, input_name, label_name, output_name);
+
+  fetch::random::Random::generator.Seed(1337);
+  TypeParam data({4, gt.shape(1)});
+  data.FillUniformRandom();
+
+  fetch::ml::optimisers::SGDOptimiser<TypeParam> optimiser(g, {input_name}, label_name, output_name,
+                                                           learning_rate);
+  fetch::ml::optimisers::SGDOptimiser<TypeParam> optimiser_2(g_2, {input_name}, label_name,
+                                                             output_name, learning_rate);
+  optimiser_2.SetParallelism(3);
+
+  DataType loss{0};
+  DataType loss_2{0};
+  for (SizeType step = 0; step < 3; ++step)
+  {
+    loss   = optimiser.Run({data}, gt);
+    loss_2 = optimiser_2.Run({data}, gt);
+  }
+
+  auto tolerance = static_cast<double>(fetch::math::function_tolerance<DataType>()) *
+                   static_cast<double>(data.size());
+  EXPECT_NEAR(static_cast<double>(loss), static_cast<double>(loss_2), tolerance);
+
+  std::vector<TypeParam> weights   = g->GetWeights();
+  std::vector<TypeParam> weights_2 = g_2->GetWeights();
+  ASSERT_EQ(weights.size(), weights_2.size());
+  for (std::size_t i = 0; i < weights.size(); ++i)
+  {
+    EXPECT_TRUE(weights[i].AllClose(weights_2[i], fetch::math::function_tolerance<DataType>(),
+                                    fetch::math::function_tolerance<DataType>()));
+  }
+}
+
 template <typename TypeParam>
 void PrepareTestDataAndLabels1D(TypeParam &data, TypeParam &gt)
 {
@@ -259,6 +350,134 @@ TYPED_TEST(OptimisersTest, sgd_optimiser_serialisation)
   EXPECT_EQ(loss, loss_2);
 }
 
+TYPED_TEST(OptimisersTest, sgd_optimiser_replicas_match_serial)
+{
+  using DataType = typename TypeParam::Type;
+  using SizeType = fetch::math::SizeType;
+
+  auto learning_rate = DataType{0.0001f};
+
+  SizeType const n_replicas = 4;
+  SizeType const batch_size = 12;
+
+  // Prepare two identical models
+  std::string                                  input_name;
+  std::string                                  label_name;
+  std::string                                  output_name;
+  std::shared_ptr<fetch::ml::Graph<TypeParam>> g =
+      PrepareTestGraph<TypeParam>(4, 2, input_name, label_name, output_name);
+  std::shared_ptr<fetch::ml::Graph<TypeParam>> g_2 =
+      PrepareTestGraph<TypeParam>(4, 2, input_name, label_name, output_name);
+
+  // Prepare random data and labels from a fixed seed
+  fetch::random::Random::generator.Seed(1337);
+  TypeParam data({4, batch_size});
+  TypeParam gt({2, batch_size});
+  data.FillUniformRandom();
+  gt.FillUniformRandom();
+
+  fetch::ml::optimisers::SGDOptimiser<TypeParam> optimiser(g, {input_name}, label_name, output_name,
+                                                           learning_rate);
+  fetch::ml::optimisers::SGDOptimiser<TypeParam> optimiser_2(g_2, {input_name}, label_name,
+                                                             output_name, learning_rate);
+  optimiser_2.SetParallelism(n_replicas);
+
+  // Do several optimiser steps, reusing the replica worker threads
+  DataType loss{0};
+  DataType loss_2{0};
+  for (SizeType step = 0; step < 3; ++step)
+  {
+    loss   = optimiser.Run({data}, gt);
+    loss_2 = optimiser_2.Run({data}, gt);
+  }
+
+  auto tolerance = static_cast<double>(fetch::math::function_tolerance<DataType>()) *
+                   static_cast<double>(data.size());
+  EXPECT_NEAR(static_cast<double>(loss), static_cast<double>(loss_2), tolerance);
+
+  std::vector<TypeParam> weights   = g->GetWeights();
+  std::vector<TypeParam> weights_2 = g_2->GetWeights();
+  ASSERT_EQ(weights.size(), weights_2.size());
+  for (std::size_t i = 0; i < weights.size(); ++i)
+  {
+    EXPECT_TRUE(weights[i].AllClose(weights_2[i], fetch::math::function_tolerance<DataType>(),
+                                    fetch::math::function_tolerance<DataType>()));
+  }
+}
+
+TYPED_TEST(OptimisersTest, sgd_optimiser_data_parallel_training)
+{
+  using DataType = typename TypeParam::Type;
+
+  auto learning_rate = DataType{0.0001f};
+
+  // Prepare two identical models
+  std::string                                  input_name;
+  std::string                                  label_name;
+  std::string                                  output_name;
+  std::shared_ptr<fetch::ml::Graph<TypeParam>> g =
+      PrepareTestGraph<TypeParam>(4, 2, input_name, label_name, output_name);
+  std::shared_ptr<fetch::ml::Graph<TypeParam>> g_2 =
+      PrepareTestGraph<TypeParam>(4, 2, input_name, label_name, output_name);
+
+  // Prepare data and labels
+  TypeParam data;
+  TypeParam gt;
+  PrepareTestDataAndLabels2D(data, gt);
+
+  fetch::ml::optimisers::SGDOptimiser<TypeParam> optimiser(g, {input_name}, label_name, output_name,
+                                                           learning_rate);
+  fetch::ml::optimisers::SGDOptimiser<TypeParam> optimiser_2(g_2, {input_name}, label_name,
+                                                             output_name, learning_rate);
+
+  // the batch of 3 is split unevenly across 2 replicas
+  optimiser_2.SetParallelism(2);
+  EXPECT_EQ(optimiser_2.GetParallelism(), 2);
+
+  // Do 2 optimiser steps
+  optimiser.Run({data}, gt);
+  optimiser_2.Run({data}, gt);
+  DataType loss   = optimiser.Run({data}, gt);
+  DataType loss_2 = optimiser_2.Run({data}, gt);
+
+  auto tolerance = static_cast<double>(fetch::math::function_tolerance<DataType>()) *
+                   static_cast<double>(data.size());
+  EXPECT_NEAR(static_cast<double>(loss), static_cast<double>(loss_2), tolerance);
+
+  std::vector<TypeParam> weights   = g->GetWeights();
+  std::vector<TypeParam> weights_2 = g_2->GetWeights();
+  ASSERT_EQ(weights.size(), weights_2.size());
+  for (std::size_t i = 0; i < weights.size(); ++i)
+  {
+    EXPECT_TRUE(weights[i].AllClose(weights_2[i], fetch::math::function_tolerance<DataType>(),
+                                    fetch::math::function_tolerance<DataType>()));
+  }
+}
+
+TYPED_TEST(OptimisersTest, sgd_optimiser_replicas_match_serial_mean_square_error_loss)
+{
+  fetch::random::Random::generator.Seed(42);
+  TypeParam gt({3, 7});
+  gt.FillUniformRandom();
+
+  ExpectReplicasMatchSerial<TypeParam, fetch::ml::ops::MeanSquareErrorLoss<TypeParam>>(gt, false);
+}
+
+TYPED_TEST(OptimisersTest, sgd_optimiser_replicas_match_serial_cross_entropy_loss)
+{
+  auto gt = PrepareOneHotLabels<TypeParam>(3, 7);
+
+  ExpectReplicasMatchSerial<TypeParam, fetch::ml::ops::CrossEntropyLoss<TypeParam>>(gt, true);
+}
+
+TYPED_TEST(OptimisersTest, sgd_optimiser_replicas_match_serial_softmax_cross_entropy_loss)
+{
+  auto gt = PrepareOneHotLabels<TypeParam>(3, 7);
+
+  ExpectReplicasMatchSerial<TypeParam, fetch::ml::ops::SoftmaxCrossEntropyLoss<TypeParam>>(gt,
+                                                                                          false);
+}
+
 //////////////////////
 /// MOMENTUM TESTS ///
 //////////////////////
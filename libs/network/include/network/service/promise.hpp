@@ -34,6 +34,7 @@
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace fetch {
 
@@ -58,6 +59,7 @@ public:
   using ConstByteArray = byte_array::ConstByteArray;
   using ExceptionPtr   = std::unique_ptr<serializers::SerializableException>;
   using Callback       = std::function<void()>;
+  using Executor       = std::function<void(Callback const &)>;
   using Clock          = std::chrono::steady_clock;
   using Timepoint      = Clock::time_point;
   using Duration       = Clock::duration;
@@ -103,6 +105,11 @@ public:
   // Handler building
   PromiseBuilder WithHandlers();
 
+  /// @name Continuations
+  /// @{
+  void Then(Callback const &continuation, Executor const &executor = Executor{});
+  /// @}
+
   /// @name Promise Results
   /// @{
   void Fulfill(ConstByteArray const &value);
@@ -135,8 +142,19 @@ private:
   using AtomicState = std::atomic<State>;
   using Condition   = std::condition_variable;
 
+  struct Continuation
+  {
+    Callback callback;
+    Executor executor;
+
+    void Dispatch() const;
+  };
+
+  using Continuations = std::vector<Continuation>;
+
   void UpdateState(State state) const;
   void DispatchCallbacks() const;
+  void DispatchHandlers() const;
 
   static Counter counter_;
   static Mutex   counter_lock_;
@@ -157,6 +175,8 @@ private:
   mutable Callback callback_failure_;
   mutable Callback callback_completion_;
 
+  mutable Continuations continuations_;
+
   mutable Mutex     notify_lock_;
   mutable Condition notify_;
 };
@@ -239,10 +259,17 @@ using PromiseCounter = details::PromiseImplementation::Counter;
 using PromiseState   = details::PromiseImplementation::State;
 using Promise        = std::shared_ptr<details::PromiseImplementation>;
 using PromiseStates  = std::array<PromiseState, 4>;
+using Promises       = std::vector<Promise>;
 
 Promise MakePromise();
 Promise MakePromise(uint64_t pro, uint64_t func);
 
+/// @name Combinators
+/// @{
+Promise WhenAll(Promises const &promises);
+Promise WhenAny(Promises const &promises);
+/// @}
+
 char const *         ToString(PromiseState state);
 const PromiseStates &GetAllPromiseStates();
 
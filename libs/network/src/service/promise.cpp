@@ -19,7 +19,11 @@
 #include "core/serializers/exception.hpp"
 #include "network/service/promise.hpp"
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <memory>
+#include <utility>
 
 namespace fetch {
 namespace service {
@@ -122,6 +126,35 @@ PromiseBuilder PromiseImplementation::WithHandlers()
   return PromiseBuilder{*this};
 }
 
+/**
+ * Register a continuation to be run once the promise has been resolved, regardless of the outcome.
+ * Unlike the handlers set with WithHandlers() any number of continuations can be registered. If
+ * the promise has already been resolved the continuation is dispatched immediately.
+ *
+ * @param continuation The callback to be run on resolution
+ * @param executor The executor used to run the callback. If empty the callback is run inline on
+ * the thread which resolves the promise, so it should be short and must not block.
+ */
+void PromiseImplementation::Then(Callback const &continuation, Executor const &executor)
+{
+  Continuation entry{continuation, executor};
+
+  // check the state first, which also applies any pending timeout
+  if (IsWaiting())
+  {
+    FETCH_LOCK(callback_lock_);
+
+    // the promise might have been resolved in the mean time
+    if (State::WAITING == state_)
+    {
+      continuations_.emplace_back(std::move(entry));
+      return;
+    }
+  }
+
+  entry.Dispatch();
+}
+
 void PromiseImplementation::Fulfill(ConstByteArray const &value)
 {
   value_ = value;
@@ -223,8 +256,24 @@ void PromiseImplementation::UpdateState(State state) const
 
 void PromiseImplementation::DispatchCallbacks() const
 {
-  FETCH_LOCK(callback_lock_);
+  Continuations continuations{};
+
+  {
+    FETCH_LOCK(callback_lock_);
+    DispatchHandlers();
+
+    // continuations are run outside of the lock so that they are free to interact with the promise
+    std::swap(continuations, continuations_);
+  }
 
+  for (auto const &continuation : continuations)
+  {
+    continuation.Dispatch();
+  }
+}
+
+void PromiseImplementation::DispatchHandlers() const
+{
   Callback const *handler = nullptr;
 
   switch (state())
@@ -258,6 +307,23 @@ void PromiseImplementation::DispatchCallbacks() const
   callback_completion_ = nullptr;
 }
 
+void PromiseImplementation::Continuation::Dispatch() const
+{
+  if (!callback)
+  {
+    return;
+  }
+
+  if (executor)
+  {
+    executor(callback);
+  }
+  else
+  {
+    callback();
+  }
+}
+
 PromiseImplementation::Counter PromiseImplementation::GetNextId()
 {
   FETCH_LOCK(counter_lock_);
@@ -413,5 +479,110 @@ Promise MakePromise(uint64_t pro, uint64_t func)
   return std::make_shared<details::PromiseImplementation>(pro, func);
 }
 
+namespace {
+
+struct CombinatorState
+{
+  explicit CombinatorState(std::size_t count)
+    : remaining{count}
+  {}
+
+  std::atomic<std::size_t> remaining;
+  std::atomic<bool>        flag{false};
+};
+
+}  // namespace
+
+/**
+ * Build a promise which is resolved once all of the input promises have been resolved. The
+ * resulting promise is successful only if every one of the input promises was successful. The
+ * result values are not collected, they should be read from the input promises.
+ *
+ * @param promises The set of promises to combine
+ * @return The combined promise
+ */
+Promise WhenAll(Promises const &promises)
+{
+  auto combined = MakePromise();
+
+  if (promises.empty())
+  {
+    combined->Fulfill(byte_array::ConstByteArray{});
+    return combined;
+  }
+
+  auto state = std::make_shared<CombinatorState>(promises.size());
+
+  for (auto const &promise : promises)
+  {
+    // the continuation is owned by the input promise, so it must not keep the promise alive
+    std::weak_ptr<details::PromiseImplementation> weak_input{promise};
+
+    promise->Then([weak_input, combined, state]() {
+      auto input = weak_input.lock();
+      if (!(input && input->IsSuccessful()))
+      {
+        state->flag = true;  // failure
+      }
+
+      if (--state->remaining == 0)
+      {
+        if (state->flag)
+        {
+          combined->Fail();
+        }
+        else
+        {
+          combined->Fulfill(byte_array::ConstByteArray{});
+        }
+      }
+    });
+  }
+
+  return combined;
+}
+
+/**
+ * Build a promise which is resolved as soon as any one of the input promises is successful. The
+ * value of the first successful promise is used as the value of the combined promise. If none of
+ * the input promises succeed then the combined promise fails.
+ *
+ * @param promises The set of promises to combine
+ * @return The combined promise
+ */
+Promise WhenAny(Promises const &promises)
+{
+  auto combined = MakePromise();
+
+  if (promises.empty())
+  {
+    combined->Fail();
+    return combined;
+  }
+
+  auto state = std::make_shared<CombinatorState>(promises.size());
+
+  for (auto const &promise : promises)
+  {
+    // the continuation is owned by the input promise, so it must not keep the promise alive
+    std::weak_ptr<details::PromiseImplementation> weak_input{promise};
+
+    promise->Then([weak_input, combined, state]() {
+      auto input = weak_input.lock();
+      if (input && input->IsSuccessful() && !state->flag.exchange(true))
+      {
+        combined->Fulfill(input->value());
+      }
+
+      if ((--state->remaining == 0) && !state->flag)
+      {
+        combined->Fail();
+      }
+    });
+  }
+
+  return combined;
+}
+
 }  // namespace service
 }  // namespace fetch
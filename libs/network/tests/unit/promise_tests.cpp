@@ -0,0 +1,178 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/serializers/main_serializer.hpp"
+#include "network/service/promise.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace {
+
+using fetch::service::MakePromise;
+using fetch::service::Promise;
+using fetch::service::Promises;
+using fetch::service::SerializerType;
+using fetch::service::WhenAll;
+using fetch::service::WhenAny;
+
+using Callback = fetch::service::details::PromiseImplementation::Callback;
+
+Promises MakePromises(std::size_t count)
+{
+  Promises promises;
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    promises.emplace_back(MakePromise());
+  }
+  return promises;
+}
+
+void FulfillWith(Promise const &promise, uint64_t value)
+{
+  SerializerType serializer;
+  serializer << value;
+  promise->Fulfill(serializer.data());
+}
+
+TEST(PromiseTests, CheckContinuationsAreRunOnResolution)
+{
+  auto promise = MakePromise();
+
+  std::size_t count{0};
+  promise->Then([&count]() { ++count; });
+  promise->Then([&count]() { ++count; });
+
+  EXPECT_EQ(count, 0);
+
+  FulfillWith(promise, 42);
+  EXPECT_EQ(count, 2);
+
+  // continuations registered after resolution are run immediately
+  promise->Then([&count]() { ++count; });
+  EXPECT_EQ(count, 3);
+
+  // and the continuations are only ever run once
+  promise->Fail();
+  EXPECT_EQ(count, 3);
+}
+
+TEST(PromiseTests, CheckContinuationsAreRunOnTheExecutor)
+{
+  auto promise = MakePromise();
+
+  std::vector<Callback> queue;
+  bool                  called{false};
+
+  promise->Then([&called]() { called = true; },
+                [&queue](Callback const &cb) { queue.push_back(cb); });
+
+  promise->Fail();
+
+  ASSERT_EQ(queue.size(), 1);
+  EXPECT_FALSE(called);
+
+  queue.front()();
+  EXPECT_TRUE(called);
+}
+
+TEST(PromiseTests, CheckWhenAllWaitsForEveryPromise)
+{
+  auto promises = MakePromises(3);
+  auto all      = WhenAll(promises);
+
+  FulfillWith(promises[2], 2);
+  FulfillWith(promises[0], 0);
+  EXPECT_TRUE(all->IsWaiting());
+
+  FulfillWith(promises[1], 1);
+  EXPECT_TRUE(all->IsSuccessful());
+
+  for (uint64_t i = 0; i < promises.size(); ++i)
+  {
+    uint64_t value{0};
+    ASSERT_TRUE(promises[i]->GetResult(value));
+    EXPECT_EQ(value, i);
+  }
+}
+
+TEST(PromiseTests, CheckWhenAllFailsIfAnyPromiseFails)
+{
+  auto promises = MakePromises(3);
+  auto all      = WhenAll(promises);
+
+  FulfillWith(promises[0], 0);
+  promises[1]->Fail();
+  EXPECT_TRUE(all->IsWaiting());
+
+  FulfillWith(promises[2], 2);
+  EXPECT_TRUE(all->IsFailed());
+}
+
+TEST(PromiseTests, CheckWhenAllOfNothingIsImmediatelySuccessful)
+{
+  EXPECT_TRUE(WhenAll(Promises{})->IsSuccessful());
+}
+
+TEST(PromiseTests, CheckWhenAnyTakesTheFirstSuccessfulValue)
+{
+  auto promises = MakePromises(3);
+  auto any      = WhenAny(promises);
+
+  promises[0]->Fail();
+  EXPECT_TRUE(any->IsWaiting());
+
+  FulfillWith(promises[2], 2);
+  FulfillWith(promises[1], 1);
+
+  uint64_t value{0};
+  ASSERT_TRUE(any->GetResult(value));
+  EXPECT_EQ(value, 2);
+}
+
+TEST(PromiseTests, CheckWhenAnyFailsIfAllPromisesFail)
+{
+  auto promises = MakePromises(2);
+  auto any      = WhenAny(promises);
+
+  promises[0]->Fail();
+  EXPECT_TRUE(any->IsWaiting());
+
+  promises[1]->Fail();
+  EXPECT_TRUE(any->IsFailed());
+}
+
+TEST(PromiseTests, CheckCombinatorsDoNotKeepTheirInputsAlive)
+{
+  auto promises = MakePromises(2);
+  auto all      = WhenAll(promises);
+  auto any      = WhenAny(promises);
+
+  std::weak_ptr<fetch::service::details::PromiseImplementation> input{promises[0]};
+  promises.clear();
+
+  EXPECT_TRUE(input.expired());
+  EXPECT_TRUE(all->IsWaiting());
+  EXPECT_TRUE(any->IsWaiting());
+}
+
+}  // namespace
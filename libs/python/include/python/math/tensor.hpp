@@ -0,0 +1,150 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "math/tensor.hpp"
+#include "python/fetch_pybind.hpp"
+#include "vectorise/fixed_point/type_traits.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fetch {
+namespace math {
+namespace details {
+
+/// Element type seen from Python, fixed point numbers are exposed as their raw integers
+template <typename T, typename = void>
+struct PythonElementType
+{
+  using Type = T;
+};
+
+template <typename T>
+struct PythonElementType<T, std::enable_if_t<meta::IsFixedPoint<T>>>
+{
+  using Type = typename T::Type;
+};
+
+/// Alignment of the widest vector register the tensor kernels load with aligned instructions
+constexpr std::uintptr_t PYTHON_BUFFER_ALIGNMENT = 32;
+
+template <typename T>
+using PythonArray =
+    pybind11::array_t<typename PythonElementType<T>::Type,
+                      pybind11::array::f_style | pybind11::array::forcecast>;
+
+/**
+ * Builds a tensor from a NumPy array. Arrays which already have the padded column major layout
+ * of a tensor, i.e. Fortran ordered, suitably aligned and with a padded first dimension, are
+ * shared without copying, everything else is copied a column at a time.
+ */
+template <typename T>
+Tensor<T> TensorFromArray(PythonArray<T> array)
+{
+  using ElementType   = typename PythonElementType<T>::Type;
+  using TensorType    = Tensor<T>;
+  using ContainerType = typename TensorType::ContainerType;
+
+  static_assert(sizeof(ElementType) == sizeof(T), "Tensor elements must match the Python type");
+
+  SizeVector shape(array.shape(), array.shape() + array.ndim());
+  if (shape.empty())
+  {
+    shape.push_back(1);
+  }
+
+  auto const address = reinterpret_cast<std::uintptr_t>(array.data());
+  bool const shared  = array.writeable() && ((shape[0] % TensorType::PADDING) == 0) &&
+                      ((address % PYTHON_BUFFER_ALIGNMENT) == 0);
+
+  if (shared)
+  {
+    // the tensor keeps the array alive for as long as it refers to its memory
+    auto *             owner = new pybind11::object(array);
+    std::shared_ptr<T> data(reinterpret_cast<T *>(array.mutable_data()), [owner](T *) {
+      pybind11::gil_scoped_acquire gil;
+      delete owner;
+    });
+
+    return TensorType{ContainerType{std::move(data), TensorType::SizeFromShape(shape)}, shape};
+  }
+
+  TensorType tensor{shape};
+
+  SizeType const height  = shape[0];
+  SizeType const columns = (height == 0) ? 0 : tensor.size() / height;
+  auto *         target  = reinterpret_cast<ElementType *>(tensor.data().pointer());
+  for (SizeType i = 0; i < columns; ++i)
+  {
+    std::memcpy(target + (i * tensor.padded_height()), array.data() + (i * height),
+                height * sizeof(ElementType));
+  }
+
+  return tensor;
+}
+
+/**
+ * Describes the memory of a tensor to Python. The strides step over the padding at the end of
+ * every column, so NumPy sees exactly the logical elements.
+ */
+template <typename T>
+pybind11::buffer_info TensorBuffer(Tensor<T> &tensor)
+{
+  using ElementType = typename PythonElementType<T>::Type;
+
+  std::vector<pybind11::ssize_t> shape;
+  std::vector<pybind11::ssize_t> strides;
+  for (SizeType i = 0; i < tensor.shape().size(); ++i)
+  {
+    shape.push_back(static_cast<pybind11::ssize_t>(tensor.shape(i)));
+    strides.push_back(static_cast<pybind11::ssize_t>(tensor.stride()[i] * sizeof(ElementType)));
+  }
+
+  return pybind11::buffer_info(reinterpret_cast<ElementType *>(tensor.data().pointer()),
+                               sizeof(ElementType),
+                               pybind11::format_descriptor<ElementType>::format(), shape.size(),
+                               std::move(shape), std::move(strides));
+}
+
+}  // namespace details
+
+template <typename T>
+void BuildTensor(std::string const &custom_name, pybind11::module &module)
+{
+  namespace py = pybind11;
+  py::class_<Tensor<T>>(module, custom_name.c_str(), py::buffer_protocol())
+      .def(py::init<>())
+      .def(py::init(&details::TensorFromArray<T>))
+      .def_static("Zeroes", &Tensor<T>::Zeroes)
+      .def_buffer(&details::TensorBuffer<T>)
+      .def("shape", [](Tensor<T> const &o) { return o.shape(); })
+      .def("stride", [](Tensor<T> const &o) { return o.stride(); })
+      .def("padded_height", &Tensor<T>::padded_height)
+      .def("size", &Tensor<T>::size)
+      .def("Copy", static_cast<Tensor<T> (Tensor<T>::*)() const>(&Tensor<T>::Copy));
+}
+
+}  // namespace math
+}  // namespace fetch
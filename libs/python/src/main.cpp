@@ -18,6 +18,7 @@
 
 #include "python/fetch_pybind.hpp"
 
+#include "python/math/tensor.hpp"
 #include "python/memory/array.hpp"
 #include "python/memory/shared_array.hpp"
 
@@ -36,6 +37,7 @@ PYBIND11_MODULE(fetch, module)
   py::module ns_fetch_basic      = module.def_submodule("basic");
   py::module ns_fetch_byte_array = module.def_submodule("byte_array");
   py::module ns_fetch_serializer = module.def_submodule("serializers");
+  py::module ns_fetch_math       = module.def_submodule("math");
 
   fetch::memory::BuildArray<int8_t>("ArrayInt8", ns_fetch_basic);
   fetch::memory::BuildArray<int16_t>("ArrayInt16", ns_fetch_basic);
@@ -63,6 +65,11 @@ PYBIND11_MODULE(fetch, module)
   fetch::memory::BuildSharedArray<float>("SharedArrayFloat", ns_fetch_basic);
   fetch::memory::BuildSharedArray<double>("SharedArrayDouble", ns_fetch_basic);
 
+  fetch::math::BuildTensor<float>("TensorFloat", ns_fetch_math);
+  fetch::math::BuildTensor<double>("TensorDouble", ns_fetch_math);
+  fetch::math::BuildTensor<fetch::fixed_point::fp32_t>("TensorFixed32", ns_fetch_math);
+  fetch::math::BuildTensor<fetch::fixed_point::fp64_t>("TensorFixed64", ns_fetch_math);
+
   fetch::byte_array::BuildConstByteArray(ns_fetch_byte_array);
   fetch::byte_array::BuildByteArray(ns_fetch_byte_array);
 
@@ -0,0 +1,72 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "math/clustering/hnsw_index.hpp"
+#include "math/tensor.hpp"
+#include "semanticsearch/index/base_types.hpp"
+#include "semanticsearch/index/database_index_interface.hpp"
+#include "semanticsearch/index/semantic_subscription.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+namespace fetch {
+namespace semanticsearch {
+
+/* Database index backed by an approximate nearest neighbour graph rather than
+ * by the subscription groups of the InMemoryDBIndex. Memory use is linear in
+ * the number of subscriptions instead of growing with the number of depths
+ * indexed, and besides the subscription group lookup of the interface it can
+ * answer k nearest neighbour queries, which do not require the search radius
+ * to be known in advance.
+ *
+ * A subscription group lookup searches outwards from the centre of the group
+ * until all of the neighbours found lie outside of the ball enclosing the
+ * group. As the graph search is approximate, a subscription may occasionally
+ * be missed in very large indices.
+ *
+ * Queries may run concurrently with each other, but not with modifications.
+ */
+class ApproximateDBIndex : public DatabaseIndexInterface
+{
+public:
+  using Tensor = fetch::math::Tensor<double>;
+  using Index  = fetch::math::clustering::HNSWIndex<Tensor>;
+
+  static constexpr std::size_t INITIAL_GROUP_SEARCH_SIZE = 16;
+
+  explicit ApproximateDBIndex(std::size_t rank);
+  void          AddRelation(SemanticSubscription const &obj) override;
+  DBIndexSetPtr Find(SemanticCoordinateType depth, SemanticPosition position) const override;
+  std::size_t   rank() const override;
+
+  void                     RemoveRelation(DBIndexType index);
+  std::vector<DBIndexType> FindNearest(SemanticPosition const &position, std::size_t k) const;
+
+private:
+  Tensor ToTensor(SemanticPosition const &position) const;
+
+  Index                                                     index_;
+  std::vector<SemanticSubscription>                         subscriptions_{};
+  std::unordered_map<DBIndexType, std::vector<std::size_t>> nodes_{};
+  std::size_t                                               rank_{0};
+};
+
+}  // namespace semanticsearch
+}  // namespace fetch
@@ -0,0 +1,166 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "semanticsearch/index/approximate_db_index.hpp"
+#include "semanticsearch/index/subscription_group.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+
+namespace fetch {
+namespace semanticsearch {
+namespace {
+
+// Coordinates are mapped from the full range of the coordinate type onto [0, 1]
+constexpr double COORDINATE_SCALE = 1.0 / 18446744073709551616.0;
+
+}  // namespace
+
+constexpr std::size_t ApproximateDBIndex::INITIAL_GROUP_SEARCH_SIZE;
+
+ApproximateDBIndex::ApproximateDBIndex(std::size_t rank)
+  : index_{rank}
+  , rank_{rank}
+{}
+
+void ApproximateDBIndex::AddRelation(SemanticSubscription const &obj)
+{
+  if (obj.position.size() != rank_)
+  {
+    throw std::runtime_error("Rank of position differs from index.");
+  }
+
+  auto const node = index_.Insert(ToTensor(obj.position));
+  assert(node == subscriptions_.size());
+
+  subscriptions_.push_back(obj);
+  nodes_[obj.index].push_back(node);
+}
+
+DBIndexSetPtr ApproximateDBIndex::Find(SemanticCoordinateType depth,
+                                       SemanticPosition       position) const
+{
+  if (position.size() != rank_)
+  {
+    throw std::runtime_error("Rank of position differs from index.");
+  }
+
+  SubscriptionGroup const group{depth, position};
+
+  // All members of the group lie within the ball around its centre which encloses the hypercube
+  SemanticCoordinateType const width = SubscriptionGroup::CalculateWidthFromDepth(depth);
+  SemanticPosition             centre{};
+  for (auto const &index : group.indices)
+  {
+    centre.push_back((index * width) + (width >> 1));
+  }
+
+  double const radius = static_cast<double>(width) * COORDINATE_SCALE *
+                        std::sqrt(static_cast<double>(rank_)) * 0.5 * (1.0 + 1e-9);
+
+  Tensor const query = ToTensor(centre);
+  auto         ret   = std::make_shared<DBIndexSet>();
+
+  std::size_t const total = index_.size();
+  for (std::size_t k = std::min(INITIAL_GROUP_SEARCH_SIZE, total); k > 0; k *= 2)
+  {
+    auto const neighbours = index_.Search(query, k, k);
+
+    for (auto const &neighbour : neighbours)
+    {
+      auto const &subscription = subscriptions_[neighbour.first];
+      if (SubscriptionGroup{depth, subscription.position} == group)
+      {
+        ret->insert(subscription.index);
+      }
+    }
+
+    // stop once every subscription has been seen or the search has left the group
+    if ((neighbours.size() < k) || (k >= total) || (neighbours.back().second > radius))
+    {
+      break;
+    }
+  }
+
+  if (ret->empty())
+  {
+    return nullptr;
+  }
+
+  return ret;
+}
+
+std::size_t ApproximateDBIndex::rank() const
+{
+  return rank_;
+}
+
+/**
+ * Removes every subscription of a database record
+ */
+void ApproximateDBIndex::RemoveRelation(DBIndexType index)
+{
+  auto it = nodes_.find(index);
+  if (it == nodes_.end())
+  {
+    return;
+  }
+
+  for (auto const &node : it->second)
+  {
+    index_.Remove(node);
+  }
+
+  nodes_.erase(it);
+}
+
+/**
+ * Finds the records of the k subscriptions nearest to a position, nearest first
+ */
+std::vector<DBIndexType> ApproximateDBIndex::FindNearest(SemanticPosition const &position,
+                                                         std::size_t             k) const
+{
+  if (position.size() != rank_)
+  {
+    throw std::runtime_error("Rank of position differs from index.");
+  }
+
+  std::vector<DBIndexType> ret;
+  for (auto const &neighbour : index_.Search(ToTensor(position), k))
+  {
+    ret.push_back(subscriptions_[neighbour.first].index);
+  }
+
+  return ret;
+}
+
+ApproximateDBIndex::Tensor ApproximateDBIndex::ToTensor(SemanticPosition const &position) const
+{
+  Tensor ret({1, rank_});
+  for (std::size_t i = 0; i < rank_; ++i)
+  {
+    ret.At(0, i) = static_cast<double>(position[i]) * COORDINATE_SCALE;
+  }
+
+  return ret;
+}
+
+}  // namespace semanticsearch
+}  // namespace fetch
@@ -0,0 +1,103 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/random/lcg.hpp"
+#include "gtest/gtest.h"
+#include "semanticsearch/index/approximate_db_index.hpp"
+#include "semanticsearch/index/in_memory_db_index.hpp"
+using namespace fetch::semanticsearch;
+
+TEST(SemanticSearchApproximateIndex, BasicOperations2D)
+{
+  ApproximateDBIndex     database_index{2};
+  SemanticCoordinateType width = static_cast<SemanticCoordinateType>(-1) / 4;
+
+  // Adding points in a grid
+  for (SemanticCoordinateType i = 0; i < 4; ++i)
+  {
+    for (SemanticCoordinateType j = 0; j < 4; ++j)
+    {
+      SemanticSubscription rel;
+      rel.position.push_back(width * i + (width >> 1));
+      rel.position.push_back(width * j + (width >> 1));
+      rel.index = i * 4 + j;
+      database_index.AddRelation(rel);
+    }
+  }
+
+  EXPECT_THROW(database_index.Find(0, {width * 2}), std::runtime_error);
+
+  auto group0 = database_index.Find(0, {width * 2, width * 2});
+  EXPECT_NE(group0, nullptr);
+  EXPECT_EQ(*group0, std::set<DBIndexType>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}));
+
+  auto group1 = database_index.Find(1, {width, width});
+  EXPECT_NE(group1, nullptr);
+  EXPECT_EQ(*group1, std::set<DBIndexType>({0, 1, 4, 5}));
+
+  auto group4 = database_index.Find(1, {3 * width, 3 * width});
+  EXPECT_NE(group4, nullptr);
+  EXPECT_EQ(*group4, std::set<DBIndexType>({10, 11, 14, 15}));
+
+  auto nearest = database_index.FindNearest({width * 3 + (width >> 1), width >> 1}, 3);
+  ASSERT_EQ(nearest.size(), 3);
+  EXPECT_EQ(nearest[0], 12);
+  EXPECT_EQ(std::set<DBIndexType>(nearest.begin() + 1, nearest.end()),
+            std::set<DBIndexType>({8, 13}));
+
+  database_index.RemoveRelation(12);
+  EXPECT_EQ(*database_index.Find(1, {3 * width, width}), std::set<DBIndexType>({8, 9, 13}));
+}
+
+TEST(SemanticSearchApproximateIndex, MatchesInMemoryIndex)
+{
+  ApproximateDBIndex approximate_index{3};
+  InMemoryDBIndex    in_memory_index{3};
+
+  fetch::random::LinearCongruentialGenerator rng;
+  for (DBIndexType i = 0; i < 500; ++i)
+  {
+    SemanticSubscription rel;
+    rel.position = {rng(), rng(), rng()};
+    rel.index    = i;
+
+    approximate_index.AddRelation(rel);
+    in_memory_index.AddRelation(rel);
+  }
+
+  for (SemanticCoordinateType depth = 0; depth < 4; ++depth)
+  {
+    for (std::size_t q = 0; q < 20; ++q)
+    {
+      SemanticPosition const position = {rng(), rng(), rng()};
+
+      auto const expected = in_memory_index.Find(depth, position);
+      auto const actual   = approximate_index.Find(depth, position);
+
+      if (expected == nullptr)
+      {
+        EXPECT_EQ(actual, nullptr);
+      }
+      else
+      {
+        ASSERT_NE(actual, nullptr);
+        EXPECT_EQ(*actual, *expected);
+      }
+    }
+  }
+}
@@ -31,6 +31,8 @@
 #include "telemetry/utils/timer.hpp"
 
 #include <map>
+#include <utility>
+#include <vector>
 
 namespace fetch {
 namespace storage {
@@ -43,6 +45,10 @@ public:
   using CallContext          = service::CallContext;
 
   using Identifier = byte_array::ConstByteArray;
+  using Documents  = std::vector<Document>;
+  using Keys       = std::vector<ResourceID>;
+  using KeyValue   = std::pair<ResourceID, byte_array::ConstByteArray>;
+  using KeyValues  = std::vector<KeyValue>;
 
   static constexpr char const *LOGGING_NAME = "RevertibleDocumentStoreProtocol";
 
@@ -58,6 +64,9 @@ public:
     HASH_EXISTS,
     RESET,
 
+    GET_MANY,
+    SET_MANY,
+
     LOCK = 20,
     UNLOCK,
     HAS_LOCK
@@ -80,6 +89,10 @@ public:
     , unlock_count_(CreateCounter(lane, "ledger_statedb_unlock_total", "The total no. unlock ops"))
     , has_lock_count_(
           CreateCounter(lane, "ledger_statedb_has_lock_total", "The total no. has lock ops"))
+    , get_many_count_(
+          CreateCounter(lane, "ledger_statedb_get_many_total", "The total no. get many ops"))
+    , set_many_count_(
+          CreateCounter(lane, "ledger_statedb_set_many_total", "The total no. set many ops"))
     , get_durations_(CreateHistogram(lane, "ledger_statedb_get_request_seconds",
                                      "The histogram of get request durations"))
     , set_durations_(CreateHistogram(lane, "ledger_statedb_set_request_seconds",
@@ -88,6 +101,14 @@ public:
                                       "The histogram of lock request durations"))
     , unlock_durations_(CreateHistogram(lane, "ledger_statedb_unlock_request_seconds",
                                         "The histogram of unlock request durations"))
+    , get_many_durations_(CreateHistogram(lane, "ledger_statedb_get_many_request_seconds",
+                                          "The histogram of get many request durations"))
+    , set_many_durations_(CreateHistogram(lane, "ledger_statedb_set_many_request_seconds",
+                                          "The histogram of set many request durations"))
+    , get_many_batch_sizes_(CreateBatchHistogram(lane, "ledger_statedb_get_many_batch_size",
+                                                 "The histogram of get many batch sizes"))
+    , set_many_batch_sizes_(CreateBatchHistogram(lane, "ledger_statedb_set_many_batch_size",
+                                                 "The histogram of set many batch sizes"))
   {
     this->Expose(GET, this, &RevertibleDocumentStoreProtocol::Get);
     this->Expose(GET_OR_CREATE, this, &RevertibleDocumentStoreProtocol::GetOrCreate);
@@ -100,6 +121,10 @@ public:
     this->Expose(HASH_EXISTS, this, &RevertibleDocumentStoreProtocol::HashExists);
     this->Expose(RESET, this, &RevertibleDocumentStoreProtocol::Reset);
 
+    // Batched access
+    this->Expose(GET_MANY, this, &RevertibleDocumentStoreProtocol::GetMany);
+    this->Expose(SET_MANY, this, &RevertibleDocumentStoreProtocol::SetMany);
+
     this->ExposeWithClientContext(LOCK, this, &RevertibleDocumentStoreProtocol::LockResource);
     this->ExposeWithClientContext(UNLOCK, this, &RevertibleDocumentStoreProtocol::UnlockResource);
     this->ExposeWithClientContext(HAS_LOCK, this, &RevertibleDocumentStoreProtocol::HasLock);
@@ -221,6 +246,14 @@ private:
         name, description, {{"lane", std::to_string(lane)}});
   }
 
+  static telemetry::HistogramPtr CreateBatchHistogram(LaneType lane, char const *name,
+                                                      char const *description)
+  {
+    return telemetry::Registry::Instance().CreateHistogram(
+        {1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000, 50000, 100000}, name,
+        description, {{"lane", std::to_string(lane)}});
+  }
+
   Document Get(ResourceID const &rid)
   {
     telemetry::FunctionTimer const timer{*get_durations_};
@@ -247,6 +280,36 @@ private:
     set_count_->increment();
   }
 
+  Documents GetMany(Keys const &rids)
+  {
+    telemetry::FunctionTimer const timer{*get_many_durations_};
+
+    Documents docs{};
+    docs.reserve(rids.size());
+
+    for (auto const &rid : rids)
+    {
+      docs.emplace_back(doc_store_->Get(rid));
+    }
+
+    get_many_count_->increment();
+    get_many_batch_sizes_->Add(static_cast<double>(rids.size()));
+    return docs;
+  }
+
+  void SetMany(KeyValues const &entries)
+  {
+    telemetry::FunctionTimer const timer{*set_many_durations_};
+
+    for (auto const &entry : entries)
+    {
+      doc_store_->Set(entry.first, entry.second);
+    }
+
+    set_many_count_->increment();
+    set_many_batch_sizes_->Add(static_cast<double>(entries.size()));
+  }
+
   NewRevertibleDocumentStore::Hash Commit()
   {
     auto const hash = doc_store_->Commit();
@@ -309,10 +372,16 @@ private:
   telemetry::CounterPtr   lock_count_;
   telemetry::CounterPtr   unlock_count_;
   telemetry::CounterPtr   has_lock_count_;
+  telemetry::CounterPtr   get_many_count_;
+  telemetry::CounterPtr   set_many_count_;
   telemetry::HistogramPtr get_durations_;
   telemetry::HistogramPtr set_durations_;
   telemetry::HistogramPtr lock_durations_;
   telemetry::HistogramPtr unlock_durations_;
+  telemetry::HistogramPtr get_many_durations_;
+  telemetry::HistogramPtr set_many_durations_;
+  telemetry::HistogramPtr get_many_batch_sizes_;
+  telemetry::HistogramPtr set_many_batch_sizes_;
 };
 
 }  // namespace storage
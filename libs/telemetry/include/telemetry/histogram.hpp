@@ -19,6 +19,7 @@
 
 #include "telemetry/measurement.hpp"
 
+#include <cstdint>
 #include <functional>
 #include <initializer_list>
 #include <map>
@@ -43,7 +44,9 @@ public:
 
   /// @name Accessors
   /// @{
-  void Add(double const &value);
+  void     Add(double const &value);
+  uint64_t count() const;
+  double   sum() const;
   /// @}
 
   /// @name Measurement Interface
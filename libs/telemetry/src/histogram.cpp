@@ -93,6 +93,28 @@ void Histogram::Add(double const &value)
   sum_ += value;
 }
 
+/**
+ * Get the number of values which have been added to the histogram
+ *
+ * @return The number of values
+ */
+uint64_t Histogram::count() const
+{
+  std::lock_guard<std::mutex> guard(lock_);
+  return count_;
+}
+
+/**
+ * Get the total of the values which have been added to the histogram
+ *
+ * @return The sum of the values
+ */
+double Histogram::sum() const
+{
+  std::lock_guard<std::mutex> guard(lock_);
+  return sum_;
+}
+
 /**
  * Write the value of the metric to the stream so as to be consumed by external components
  *
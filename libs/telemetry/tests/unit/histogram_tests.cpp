@@ -75,4 +75,17 @@ request_time_count 7
   EXPECT_EQ(oss.str(), std::string{EXPECTED_TEXT});
 }
 
+TEST_F(HistogramTests, CheckAggregates)
+{
+  EXPECT_EQ(histogram_->count(), 0u);
+  EXPECT_DOUBLE_EQ(histogram_->sum(), 0.0);
+
+  histogram_->Add(0.1);
+  histogram_->Add(0.5);
+  histogram_->Add(10.0);
+
+  EXPECT_EQ(histogram_->count(), 3u);
+  EXPECT_DOUBLE_EQ(histogram_->sum(), 10.6);
+}
+
 }  // namespace
@@ -0,0 +1,162 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/fixed_point/fixed_point.hpp"
+#include "vectorise/math/standard_functions.hpp"
+#include "vectorise/memory/shared_array.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <cstddef>
+#include <random>
+
+#ifdef __AVX2__
+
+using fetch::fixed_point::fp32_t;
+using fetch::fixed_point::fp64_t;
+
+namespace {
+
+constexpr std::size_t N = 1 << 14;
+
+template <typename T>
+fetch::memory::SharedArray<T> RandomArray(double lower, double upper)
+{
+  std::mt19937_64                        rng(42);
+  std::uniform_real_distribution<double> uniform(lower, upper);
+
+  fetch::memory::SharedArray<T> array(N);
+  for (std::size_t i = 0; i < N; ++i)
+  {
+    array[i] = T(uniform(rng));
+  }
+  return array;
+}
+
+template <typename T, typename ScalarFunction>
+void Scalar(benchmark::State &state, double lower, double upper, ScalarFunction &&scalar_function)
+{
+  auto const input  = RandomArray<T>(lower, upper);
+  auto       output = RandomArray<T>(lower, upper);
+
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < N; ++i)
+    {
+      output[i] = scalar_function(input[i]);
+    }
+    benchmark::DoNotOptimize(output.pointer());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * N));
+}
+
+template <typename T, typename VectorFunction>
+void Vectorised(benchmark::State &state, double lower, double upper,
+                VectorFunction &&vector_function)
+{
+  using RegisterType = fetch::vectorise::VectorRegister<T, 256>;
+
+  auto const input  = RandomArray<T>(lower, upper);
+  auto       output = RandomArray<T>(lower, upper);
+
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < N; i += RegisterType::E_BLOCK_COUNT)
+    {
+      vector_function(RegisterType(input.pointer() + i)).Store(output.pointer() + i);
+    }
+    benchmark::DoNotOptimize(output.pointer());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * N));
+}
+
+template <typename T>
+void BM_ExpScalar(benchmark::State &state)
+{
+  Scalar<T>(state, -5, 5, [](T const &x) { return T::Exp(x); });
+}
+
+template <typename T>
+void BM_ExpVectorised(benchmark::State &state)
+{
+  Vectorised<T>(state, -5, 5, [](auto const &x) { return fetch::vectorise::exp(x); });
+}
+
+template <typename T>
+void BM_LogScalar(benchmark::State &state)
+{
+  Scalar<T>(state, 0, 100, [](T const &x) { return T::Log(x); });
+}
+
+template <typename T>
+void BM_LogVectorised(benchmark::State &state)
+{
+  Vectorised<T>(state, 0, 100, [](auto const &x) { return fetch::vectorise::log(x); });
+}
+
+template <typename T>
+void BM_SqrtScalar(benchmark::State &state)
+{
+  Scalar<T>(state, 0, 100, [](T const &x) { return T::Sqrt(x); });
+}
+
+template <typename T>
+void BM_SqrtVectorised(benchmark::State &state)
+{
+  Vectorised<T>(state, 0, 100, [](auto const &x) { return fetch::vectorise::sqrt(x); });
+}
+
+template <typename T>
+void BM_PowScalar(benchmark::State &state)
+{
+  T const y{1.5};
+  Scalar<T>(state, 0, 10, [y](T const &x) { return T::Pow(x, y); });
+}
+
+template <typename T>
+void BM_PowVectorised(benchmark::State &state)
+{
+  using RegisterType = fetch::vectorise::VectorRegister<T, 256>;
+
+  RegisterType const y(T{1.5});
+  Vectorised<T>(state, 0, 10, [&y](auto const &x) { return fetch::vectorise::pow(x, y); });
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_ExpScalar, fp32_t);
+BENCHMARK_TEMPLATE(BM_ExpVectorised, fp32_t);
+BENCHMARK_TEMPLATE(BM_ExpScalar, fp64_t);
+BENCHMARK_TEMPLATE(BM_ExpVectorised, fp64_t);
+
+BENCHMARK_TEMPLATE(BM_LogScalar, fp32_t);
+BENCHMARK_TEMPLATE(BM_LogVectorised, fp32_t);
+BENCHMARK_TEMPLATE(BM_LogScalar, fp64_t);
+BENCHMARK_TEMPLATE(BM_LogVectorised, fp64_t);
+
+BENCHMARK_TEMPLATE(BM_SqrtScalar, fp32_t);
+BENCHMARK_TEMPLATE(BM_SqrtVectorised, fp32_t);
+BENCHMARK_TEMPLATE(BM_SqrtScalar, fp64_t);
+BENCHMARK_TEMPLATE(BM_SqrtVectorised, fp64_t);
+
+BENCHMARK_TEMPLATE(BM_PowScalar, fp32_t);
+BENCHMARK_TEMPLATE(BM_PowVectorised, fp32_t);
+BENCHMARK_TEMPLATE(BM_PowScalar, fp64_t);
+BENCHMARK_TEMPLATE(BM_PowVectorised, fp64_t);
+
+#endif
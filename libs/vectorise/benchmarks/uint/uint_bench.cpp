@@ -0,0 +1,177 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/uint/montgomery.hpp"
+#include "vectorise/uint/uint.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using fetch::vectorise::Montgomery;
+using fetch::vectorise::UInt;
+
+namespace {
+
+using UInt256 = UInt<256>;
+
+constexpr std::size_t N = 1 << 10;
+
+/// Random numbers with the given number of significant 64-bit limbs
+std::vector<UInt256> RandomNumbers(std::size_t limbs)
+{
+  std::mt19937_64      rng(42);
+  std::vector<UInt256> numbers(N);
+  for (auto &number : numbers)
+  {
+    for (std::size_t i = 0; i < limbs; ++i)
+    {
+      number.ElementAt(i) = rng();
+    }
+  }
+  return numbers;
+}
+
+/// The prime 2^255 - 19
+UInt256 Prime()
+{
+  UInt256 prime{UInt256::max};
+  prime >>= 1;
+  prime -= 18u;
+  return prime;
+}
+
+void BM_UIntMultiply(benchmark::State &state)
+{
+  auto const lhs = RandomNumbers(4);
+  auto const rhs = RandomNumbers(4);
+
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < N; ++i)
+    {
+      benchmark::DoNotOptimize(lhs[i] * rhs[(i + 1) % N]);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+void BM_UIntDivide(benchmark::State &state)
+{
+  auto const dividends = RandomNumbers(4);
+  auto const divisors  = RandomNumbers(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < N; ++i)
+    {
+      benchmark::DoNotOptimize(dividends[i] / divisors[i]);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+void BM_UIntModulo(benchmark::State &state)
+{
+  auto const    dividends = RandomNumbers(4);
+  UInt256 const modulus   = Prime();
+
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < N; ++i)
+    {
+      benchmark::DoNotOptimize(dividends[i] % modulus);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+void BM_UIntMulMod(benchmark::State &state)
+{
+  UInt256 const modulus = Prime();
+  auto          lhs     = RandomNumbers(4);
+  auto          rhs     = RandomNumbers(4);
+  for (std::size_t i = 0; i < N; ++i)
+  {
+    lhs[i] %= modulus;
+    rhs[i] %= modulus;
+  }
+
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < N; ++i)
+    {
+      benchmark::DoNotOptimize(fetch::vectorise::MulMod(lhs[i], rhs[i], modulus));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+void BM_MontgomeryMultiply(benchmark::State &state)
+{
+  Montgomery<256> const montgomery{Prime()};
+  auto                  lhs = RandomNumbers(4);
+  auto                  rhs = RandomNumbers(4);
+  for (std::size_t i = 0; i < N; ++i)
+  {
+    lhs[i] = montgomery.ToMontgomery(lhs[i]);
+    rhs[i] = montgomery.ToMontgomery(rhs[i]);
+  }
+
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < N; ++i)
+    {
+      benchmark::DoNotOptimize(montgomery.Multiply(lhs[i], rhs[i]));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+void BM_ModPow(benchmark::State &state)
+{
+  UInt256 const modulus  = Prime();
+  UInt256 const exponent = modulus - UInt256::_1;
+  auto const    bases    = RandomNumbers(4);
+
+  std::size_t i = 0;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(fetch::vectorise::ModPow(bases[i], exponent, modulus));
+    i = (i + 1) % N;
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_UIntMultiply);
+BENCHMARK(BM_UIntDivide)->DenseRange(1, 4);  // significant limbs of the divisor
+BENCHMARK(BM_UIntModulo);
+BENCHMARK(BM_UIntMulMod);
+BENCHMARK(BM_MontgomeryMultiply);
+BENCHMARK(BM_ModPow);
@@ -0,0 +1,134 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/arch/avx2/math/fixed_point_lanes.hpp"
+#include "vectorise/fixed_point/fixed_point.hpp"
+
+namespace fetch {
+namespace vectorise {
+
+namespace details {
+
+/**
+ * Lane-wise FixedPoint::Exp(), performing the same operations in the same order as the scalar
+ * function. NaN, infinities and arguments above MAX_EXP are left to the scalar function.
+ */
+template <typename T>
+typename FixedPointLanes<T>::Register FixedPointExp(typename FixedPointLanes<T>::Register const &x,
+                                                    typename FixedPointLanes<T>::Register &overflow,
+                                                    typename FixedPointLanes<T>::Register &fallback)
+{
+  using L        = FixedPointLanes<T>;
+  using Register = typename L::Register;
+
+  Register const zero = L::Zero();
+  Register const one  = L::Constant(T::_1);
+  Register const ln2  = L::Constant(T::CONST_LN2);
+
+  Register const special   = L::Or(L::AndNot(L::Ordinary(x), L::AllBits()),
+                                 L::Greater(x, L::Constant(T::MAX_EXP)));
+  Register const underflow = L::Less(x, L::Constant(T::MIN_EXP));
+  Register const is_zero   = L::Equal(x, zero);
+  Register const negative  = L::Less(x, zero);
+
+  // e^x = 1 / e^(-x) for negative x
+  Register const ax     = L::Select(negative, L::Negate(x), x);
+  Register const is_one = L::Equal(ax, one);
+  Register const active = L::AndNot(L::Or(L::Or(special, underflow), is_zero), L::AllBits());
+  Register const main   = L::AndNot(is_one, active);
+
+  Register main_overflow = zero;
+  Register main_fallback = zero;
+
+  // x = k*ln2 + r, e^x = 2^k * e^r
+  Register const k  = L::IntegerPart(L::Divide(ax, ln2, main_fallback));
+  Register       r  = L::Subtract(ax, L::Multiply(L::FromInteger(k), ln2, main_overflow),
+                           main_overflow);
+  Register const e1 = L::ShiftLeft(one, k);
+
+  Register r2 = L::Multiply(r, r, main_overflow);
+  Register r3 = L::Multiply(r2, r, main_overflow);
+  Register r4 = L::Multiply(r3, r, main_overflow);
+  Register r5 = L::Multiply(r4, r, main_overflow);
+  r           = L::Multiply(r, L::Constant(static_cast<T>(fixed_point::Exp_P01)), main_overflow);
+  r2          = L::Multiply(r2, L::Constant(static_cast<T>(fixed_point::Exp_P02)), main_overflow);
+  r3          = L::Multiply(r3, L::Constant(static_cast<T>(fixed_point::Exp_P03)), main_overflow);
+  r4          = L::Multiply(r4, L::Constant(static_cast<T>(fixed_point::Exp_P04)), main_overflow);
+  r5          = L::Multiply(r5, L::Constant(static_cast<T>(fixed_point::Exp_P05)), main_overflow);
+
+  Register P = L::Add(one, r, main_overflow);
+  P          = L::Add(P, r2, main_overflow);
+  P          = L::Add(P, r3, main_overflow);
+  P          = L::Add(P, r4, main_overflow);
+  P          = L::Add(P, r5, main_overflow);
+  Register Q = L::Subtract(one, r, main_overflow);
+  Q          = L::Add(Q, r2, main_overflow);
+  Q          = L::Subtract(Q, r3, main_overflow);
+  Q          = L::Add(Q, r4, main_overflow);
+  Q          = L::Subtract(Q, r5, main_overflow);
+
+  Register const e2 = L::Divide(P, Q, main_fallback);
+  Register       e  = L::Multiply(e1, e2, main_overflow);
+  e                 = L::Select(is_one, L::Constant(T::CONST_E), e);
+
+  Register       reciprocal_fallback = zero;
+  Register const reciprocal          = L::Divide(one, e, reciprocal_fallback);
+  Register const inverted            = L::And(negative, active);
+
+  overflow = L::Or(overflow, L::And(main, main_overflow));
+  fallback = L::Or(fallback, L::Or(special, L::And(main, main_fallback)));
+  fallback = L::Or(fallback, L::And(inverted, reciprocal_fallback));
+
+  Register ret = L::Select(inverted, reciprocal, e);
+  ret          = L::Select(is_zero, one, ret);
+  return L::Select(underflow, zero, ret);
+}
+
+}  // namespace details
+
+inline VectorRegister<fixed_point::fp32_t, 256> exp(
+    VectorRegister<fixed_point::fp32_t, 256> const &x)
+{
+  using Type = fixed_point::fp32_t;
+  return details::ApplyFixedPointKernel(x, details::FixedPointExp<Type>,
+                                        [](Type const &v) { return Type::Exp(v); });
+}
+
+inline VectorRegister<fixed_point::fp64_t, 256> exp(
+    VectorRegister<fixed_point::fp64_t, 256> const &x)
+{
+  using Type = fixed_point::fp64_t;
+  return details::ApplyFixedPointKernel(x, details::FixedPointExp<Type>,
+                                        [](Type const &v) { return Type::Exp(v); });
+}
+
+inline VectorRegister<fixed_point::fp32_t, 128> exp(
+    VectorRegister<fixed_point::fp32_t, 128> const &x)
+{
+  return details::Narrow(exp(details::Widen(x)));
+}
+
+inline VectorRegister<fixed_point::fp64_t, 128> exp(
+    VectorRegister<fixed_point::fp64_t, 128> const &x)
+{
+  return details::Narrow(exp(details::Widen(x)));
+}
+
+}  // namespace vectorise
+}  // namespace fetch
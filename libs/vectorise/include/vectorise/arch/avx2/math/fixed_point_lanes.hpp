@@ -0,0 +1,600 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/arch/avx2/register_fixed32.hpp"
+#include "vectorise/arch/avx2/register_fixed64.hpp"
+#include "vectorise/fixed_point/fixed_point.hpp"
+#include "vectorise/platform.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+namespace fetch {
+namespace vectorise {
+namespace details {
+
+/**
+ * Lane-wise arithmetic on the raw values of fixed point numbers held in a 256-bit register, which
+ * truncates and saturates exactly like the scalar FixedPoint operators do for finite operands.
+ *
+ * Masks have all bits of a lane either set or cleared. Saturating operations report their lanes in
+ * an overflow mask, so that the caller can raise STATE_OVERFLOW only for the lanes whose result it
+ * keeps. Divisions which the scalar operator would not complete normally (division by zero, or a
+ * quotient outside the representable range) report their lanes in a fallback mask instead, and
+ * these lanes are recomputed with the scalar function.
+ * @tparam T the fixed point type
+ */
+template <typename T>
+struct FixedPointLanes;
+
+template <>
+struct FixedPointLanes<fixed_point::fp32_t>
+{
+  using Type     = fixed_point::fp32_t;
+  using RawType  = Type::Type;
+  using Register = __m256i;
+
+  enum
+  {
+    LANES           = 8,
+    FRACTIONAL_BITS = Type::FRACTIONAL_BITS
+  };
+
+  static Register Constant(Type const &x)
+  {
+    return _mm256_set1_epi32(x.Data());
+  }
+
+  static Register Integer(RawType n)
+  {
+    return _mm256_set1_epi32(n);
+  }
+
+  static Register Zero()
+  {
+    return _mm256_setzero_si256();
+  }
+
+  static Register AllBits()
+  {
+    return _mm256_cmpeq_epi32(Zero(), Zero());
+  }
+
+  static Register And(Register const &a, Register const &b)
+  {
+    return _mm256_and_si256(a, b);
+  }
+
+  static Register Or(Register const &a, Register const &b)
+  {
+    return _mm256_or_si256(a, b);
+  }
+
+  /// @return b with the lanes of mask cleared
+  static Register AndNot(Register const &mask, Register const &b)
+  {
+    return _mm256_andnot_si256(mask, b);
+  }
+
+  /// @return a in the lanes of mask, b in the others
+  static Register Select(Register const &mask, Register const &a, Register const &b)
+  {
+    return _mm256_blendv_epi8(b, a, mask);
+  }
+
+  static bool Any(Register const &mask)
+  {
+    return _mm256_movemask_epi8(mask) != 0;
+  }
+
+  static Register Equal(Register const &a, Register const &b)
+  {
+    return _mm256_cmpeq_epi32(a, b);
+  }
+
+  static Register Greater(Register const &a, Register const &b)
+  {
+    return _mm256_cmpgt_epi32(a, b);
+  }
+
+  static Register Less(Register const &a, Register const &b)
+  {
+    return _mm256_cmpgt_epi32(b, a);
+  }
+
+  /// @return the lanes which hold a number in [FP_MIN, FP_MAX], so neither NaN nor infinity
+  static Register Ordinary(Register const &x)
+  {
+    return AndNot(Or(Less(x, Integer(Type::MIN)), Greater(x, Integer(Type::MAX))), AllBits());
+  }
+
+  static Register IntegerAdd(Register const &a, Register const &b)
+  {
+    return _mm256_add_epi32(a, b);
+  }
+
+  static Register IntegerSubtract(Register const &a, Register const &b)
+  {
+    return _mm256_sub_epi32(a, b);
+  }
+
+  static Register Negate(Register const &a)
+  {
+    return _mm256_sub_epi32(Zero(), a);
+  }
+
+  static Register ShiftLeft(Register const &a, Register const &counts)
+  {
+    return _mm256_sllv_epi32(a, counts);
+  }
+
+  /// Shift of non-negative values
+  static Register ShiftRight(Register const &a, Register const &counts)
+  {
+    return _mm256_srlv_epi32(a, counts);
+  }
+
+  /// Integer() of non-negative values
+  static Register IntegerPart(Register const &a)
+  {
+    return _mm256_srli_epi32(a, FRACTIONAL_BITS);
+  }
+
+  static Register FromInteger(Register const &n)
+  {
+    return _mm256_slli_epi32(n, FRACTIONAL_BITS);
+  }
+
+  /// platform::HighestSetBit() of positive values
+  static Register HighestSetBit(Register const &a)
+  {
+    // the biased exponent of the exact conversion to double is the bit length plus 1022
+    __m256i const gather = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    __m256i const lo     = _mm256_srli_epi64(
+        _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_castsi256_si128(a))), 52);
+    __m256i const hi = _mm256_srli_epi64(
+        _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extracti128_si256(a, 1))), 52);
+
+    Register const exponents =
+        _mm256_set_m128i(_mm256_castsi256_si128(_mm256_permutevar8x32_epi32(hi, gather)),
+                         _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(lo, gather)));
+    return _mm256_sub_epi32(exponents, Integer(1022));
+  }
+
+  static Register Add(Register const &a, Register const &b, Register &overflow)
+  {
+    Register const over =
+        And(Greater(b, Zero()), Greater(a, IntegerSubtract(Integer(Type::MAX), b)));
+    Register const under = And(Less(b, Zero()), Less(a, IntegerSubtract(Integer(Type::MIN), b)));
+
+    overflow = Or(overflow, Or(over, under));
+    return Saturate(IntegerAdd(a, b), over, under);
+  }
+
+  static Register Subtract(Register const &a, Register const &b, Register &overflow)
+  {
+    Register const over  = And(Less(b, Zero()), Greater(a, IntegerAdd(Integer(Type::MAX), b)));
+    Register const under = And(Greater(b, Zero()), Less(a, IntegerAdd(Integer(Type::MIN), b)));
+
+    overflow = Or(overflow, Or(over, under));
+    return Saturate(IntegerSubtract(a, b), over, under);
+  }
+
+  static Register Multiply(Register const &a, Register const &b, Register &overflow)
+  {
+    // 64-bit products of the even and of the odd lanes
+    Register const even = _mm256_mul_epi32(a, b);
+    Register const odd  = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+
+    // the product saturates when it leaves [MIN, MAX] once shifted by the fractional bits
+    Register const upper = _mm256_set1_epi64x((static_cast<int64_t>(Type::MAX) << FRACTIONAL_BITS) |
+                                              ((int64_t{1} << FRACTIONAL_BITS) - 1));
+    Register const lower =
+        _mm256_set1_epi64x(static_cast<int64_t>(Type::MIN) * (int64_t{1} << FRACTIONAL_BITS));
+
+    Register const over  = _mm256_blend_epi32(_mm256_cmpgt_epi64(even, upper),
+                                             _mm256_cmpgt_epi64(odd, upper), 0xAA);
+    Register const under = _mm256_blend_epi32(_mm256_cmpgt_epi64(lower, even),
+                                              _mm256_cmpgt_epi64(lower, odd), 0xAA);
+
+    // bits [F, F + 32) of the even products stay in the low half of each 64-bit element and those
+    // of the odd products move to the high half
+    Register const prod =
+        _mm256_blend_epi32(_mm256_srli_epi64(even, FRACTIONAL_BITS),
+                           _mm256_slli_epi64(_mm256_srli_epi64(odd, FRACTIONAL_BITS), 32), 0xAA);
+
+    overflow = Or(overflow, Or(over, under));
+    return Saturate(prod, over, under);
+  }
+
+  static Register Divide(Register const &a, Register const &b, Register &fallback)
+  {
+    Register const abs_a = _mm256_abs_epi32(a);
+
+    __m128i in_range_lo;
+    __m128i in_range_hi;
+    __m128i const lo = DivideHalf(_mm256_castsi256_si128(abs_a), _mm256_castsi256_si128(b),
+                                  in_range_lo);
+    __m128i const hi = DivideHalf(_mm256_extracti128_si256(abs_a, 1),
+                                  _mm256_extracti128_si256(b, 1), in_range_hi);
+
+    Register const quotient = _mm256_set_m128i(hi, lo);
+    fallback = Or(fallback, AndNot(_mm256_set_m128i(in_range_hi, in_range_lo), AllBits()));
+
+    // the sign of the numerator is applied after dividing its absolute value
+    return Select(Less(a, Zero()), Negate(quotient), quotient);
+  }
+
+private:
+  static Register Saturate(Register const &x, Register const &over, Register const &under)
+  {
+    return Select(under, Integer(Type::MIN), Select(over, Integer(Type::MAX), x));
+  }
+
+  static __m128i DivideHalf(__m128i const &numerator, __m128i const &denominator,
+                            __m128i &in_range)
+  {
+    // numerator * 2^F / denominator is correctly rounded in double precision, and for 32-bit
+    // operands it lies too far from the next integer for the rounding to reach it, so truncating
+    // gives the integer quotient
+    __m256d const scale = _mm256_set1_pd(static_cast<double>(int64_t{1} << FRACTIONAL_BITS));
+    __m256d const quotient =
+        _mm256_round_pd(_mm256_div_pd(_mm256_mul_pd(_mm256_cvtepi32_pd(numerator), scale),
+                                      _mm256_cvtepi32_pd(denominator)),
+                        _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+
+    // division by zero gives an infinity or NaN, neither of which compares as in range
+    __m256d const magnitude = _mm256_andnot_pd(_mm256_set1_pd(-0.0), quotient);
+    __m256d const mask =
+        _mm256_cmp_pd(magnitude, _mm256_set1_pd(static_cast<double>(Type::MAX)), _CMP_LE_OQ);
+
+    in_range = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(
+        _mm256_castpd_si256(mask), _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+    return _mm256_cvttpd_epi32(_mm256_and_pd(mask, quotient));
+  }
+};
+
+template <>
+struct FixedPointLanes<fixed_point::fp64_t>
+{
+  using Type     = fixed_point::fp64_t;
+  using RawType  = Type::Type;
+  using NextType = Type::NextType;
+  using Register = __m256i;
+
+  enum
+  {
+    LANES           = 4,
+    FRACTIONAL_BITS = Type::FRACTIONAL_BITS
+  };
+
+  static Register Constant(Type const &x)
+  {
+    return _mm256_set1_epi64x(x.Data());
+  }
+
+  static Register Integer(RawType n)
+  {
+    return _mm256_set1_epi64x(n);
+  }
+
+  static Register Zero()
+  {
+    return _mm256_setzero_si256();
+  }
+
+  static Register AllBits()
+  {
+    return _mm256_cmpeq_epi64(Zero(), Zero());
+  }
+
+  static Register And(Register const &a, Register const &b)
+  {
+    return _mm256_and_si256(a, b);
+  }
+
+  static Register Or(Register const &a, Register const &b)
+  {
+    return _mm256_or_si256(a, b);
+  }
+
+  /// @return b with the lanes of mask cleared
+  static Register AndNot(Register const &mask, Register const &b)
+  {
+    return _mm256_andnot_si256(mask, b);
+  }
+
+  /// @return a in the lanes of mask, b in the others
+  static Register Select(Register const &mask, Register const &a, Register const &b)
+  {
+    return _mm256_blendv_epi8(b, a, mask);
+  }
+
+  static bool Any(Register const &mask)
+  {
+    return _mm256_movemask_epi8(mask) != 0;
+  }
+
+  static Register Equal(Register const &a, Register const &b)
+  {
+    return _mm256_cmpeq_epi64(a, b);
+  }
+
+  static Register Greater(Register const &a, Register const &b)
+  {
+    return _mm256_cmpgt_epi64(a, b);
+  }
+
+  static Register Less(Register const &a, Register const &b)
+  {
+    return _mm256_cmpgt_epi64(b, a);
+  }
+
+  /// @return the lanes which hold a number in [FP_MIN, FP_MAX], so neither NaN nor infinity
+  static Register Ordinary(Register const &x)
+  {
+    return AndNot(Or(Less(x, Integer(Type::MIN)), Greater(x, Integer(Type::MAX))), AllBits());
+  }
+
+  static Register IntegerAdd(Register const &a, Register const &b)
+  {
+    return _mm256_add_epi64(a, b);
+  }
+
+  static Register IntegerSubtract(Register const &a, Register const &b)
+  {
+    return _mm256_sub_epi64(a, b);
+  }
+
+  static Register Negate(Register const &a)
+  {
+    return _mm256_sub_epi64(Zero(), a);
+  }
+
+  static Register ShiftLeft(Register const &a, Register const &counts)
+  {
+    return _mm256_sllv_epi64(a, counts);
+  }
+
+  /// Shift of non-negative values
+  static Register ShiftRight(Register const &a, Register const &counts)
+  {
+    return _mm256_srlv_epi64(a, counts);
+  }
+
+  /// Integer() of non-negative values
+  static Register IntegerPart(Register const &a)
+  {
+    return _mm256_srli_epi64(a, FRACTIONAL_BITS);
+  }
+
+  static Register FromInteger(Register const &n)
+  {
+    return _mm256_slli_epi64(n, FRACTIONAL_BITS);
+  }
+
+  /// platform::HighestSetBit() of positive values
+  static Register HighestSetBit(Register const &a)
+  {
+    alignas(32) RawType values[LANES];
+    _mm256_store_si256(reinterpret_cast<Register *>(values), a);
+    for (auto &value : values)
+    {
+      value = platform::HighestSetBit(value);
+    }
+
+    return _mm256_load_si256(reinterpret_cast<Register const *>(values));
+  }
+
+  static Register Add(Register const &a, Register const &b, Register &overflow)
+  {
+    Register const over =
+        And(Greater(b, Zero()), Greater(a, IntegerSubtract(Integer(Type::MAX), b)));
+    Register const under = And(Less(b, Zero()), Less(a, IntegerSubtract(Integer(Type::MIN), b)));
+
+    overflow = Or(overflow, Or(over, under));
+    return Saturate(IntegerAdd(a, b), over, under);
+  }
+
+  static Register Subtract(Register const &a, Register const &b, Register &overflow)
+  {
+    Register const over  = And(Less(b, Zero()), Greater(a, IntegerAdd(Integer(Type::MAX), b)));
+    Register const under = And(Greater(b, Zero()), Less(a, IntegerAdd(Integer(Type::MIN), b)));
+
+    overflow = Or(overflow, Or(over, under));
+    return Saturate(IntegerSubtract(a, b), over, under);
+  }
+
+  // AVX2 has no 64 x 64 -> 128-bit multiplication or 128-bit division, so products and quotients
+  // are computed for each lane in 128-bit integer arithmetic as register_fixed64.hpp does
+
+  static Register Multiply(Register const &a, Register const &b, Register &overflow)
+  {
+    alignas(32) RawType lhs[LANES];
+    alignas(32) RawType rhs[LANES];
+    alignas(32) RawType flags[LANES];
+    _mm256_store_si256(reinterpret_cast<Register *>(lhs), a);
+    _mm256_store_si256(reinterpret_cast<Register *>(rhs), b);
+
+    for (std::size_t i = 0; i < LANES; ++i)
+    {
+      NextType const prod = (NextType(lhs[i]) * NextType(rhs[i])) >> FRACTIONAL_BITS;
+
+      flags[i] = -RawType((prod > NextType(Type::MAX)) || (prod < NextType(Type::MIN)));
+      lhs[i]   = prod > NextType(Type::MAX)
+                   ? Type::MAX
+                   : (prod < NextType(Type::MIN) ? Type::MIN : static_cast<RawType>(prod));
+    }
+
+    overflow = Or(overflow, _mm256_load_si256(reinterpret_cast<Register const *>(flags)));
+    return _mm256_load_si256(reinterpret_cast<Register const *>(lhs));
+  }
+
+  static Register Divide(Register const &a, Register const &b, Register &fallback)
+  {
+    alignas(32) RawType lhs[LANES];
+    alignas(32) RawType rhs[LANES];
+    alignas(32) RawType flags[LANES];
+    _mm256_store_si256(reinterpret_cast<Register *>(lhs), a);
+    _mm256_store_si256(reinterpret_cast<Register *>(rhs), b);
+
+    for (std::size_t i = 0; i < LANES; ++i)
+    {
+      flags[i] = 0;
+      if (rhs[i] == 0)
+      {
+        flags[i] = -1;
+        continue;
+      }
+
+      // the sign of the numerator is applied after dividing its absolute value
+      NextType const abs_lhs  = lhs[i] < 0 ? -NextType(lhs[i]) : NextType(lhs[i]);
+      NextType const quotient = (abs_lhs << FRACTIONAL_BITS) / NextType(rhs[i]);
+      if ((quotient > NextType(Type::MAX)) || (quotient < -NextType(Type::MAX)))
+      {
+        flags[i] = -1;
+        continue;
+      }
+
+      lhs[i] = static_cast<RawType>(lhs[i] < 0 ? -quotient : quotient);
+    }
+
+    Register const failed = _mm256_load_si256(reinterpret_cast<Register const *>(flags));
+    fallback              = Or(fallback, failed);
+    return AndNot(failed, _mm256_load_si256(reinterpret_cast<Register const *>(lhs)));
+  }
+
+private:
+  static Register Saturate(Register const &x, Register const &over, Register const &under)
+  {
+    return Select(under, Integer(Type::MIN), Select(over, Integer(Type::MAX), x));
+  }
+};
+
+/**
+ * Evaluates a vectorised fixed point function, raising STATE_OVERFLOW if any of the lanes it keeps
+ * saturated and recomputing the lanes it left to the scalar function
+ * @param x the argument
+ * @param kernel the vectorised function, taking the argument, overflow and fallback masks
+ * @param function the scalar function
+ */
+template <typename T, typename Kernel, typename Function>
+VectorRegister<T, 256> ApplyFixedPointKernel(VectorRegister<T, 256> const &x, Kernel &&kernel,
+                                             Function &&function)
+{
+  using Lanes    = FixedPointLanes<T>;
+  using Register = typename Lanes::Register;
+
+  Register overflow = Lanes::Zero();
+  Register fallback = Lanes::Zero();
+  Register ret      = kernel(x.data(), overflow, fallback);
+
+  if (Lanes::Any(Lanes::AndNot(fallback, overflow)))
+  {
+    T::fp_state |= T::STATE_OVERFLOW;
+  }
+
+  if (Lanes::Any(fallback))
+  {
+    alignas(32) T                         args[Lanes::LANES];
+    alignas(32) T                         results[Lanes::LANES];
+    alignas(32) typename Lanes::RawType mask[Lanes::LANES];
+    x.Store(args);
+    VectorRegister<T, 256>(ret).Store(results);
+    _mm256_store_si256(reinterpret_cast<Register *>(mask), fallback);
+
+    for (std::size_t i = 0; i < Lanes::LANES; ++i)
+    {
+      if (mask[i] != 0)
+      {
+        results[i] = function(args[i]);
+      }
+    }
+
+    ret = VectorRegister<T, 256>(results).data();
+  }
+
+  return {ret};
+}
+
+/**
+ * Two argument version of ApplyFixedPointKernel
+ */
+template <typename T, typename Kernel, typename Function>
+VectorRegister<T, 256> ApplyFixedPointKernel(VectorRegister<T, 256> const &x,
+                                             VectorRegister<T, 256> const &y, Kernel &&kernel,
+                                             Function &&function)
+{
+  using Lanes    = FixedPointLanes<T>;
+  using Register = typename Lanes::Register;
+
+  Register overflow = Lanes::Zero();
+  Register fallback = Lanes::Zero();
+  Register ret      = kernel(x.data(), y.data(), overflow, fallback);
+
+  if (Lanes::Any(Lanes::AndNot(fallback, overflow)))
+  {
+    T::fp_state |= T::STATE_OVERFLOW;
+  }
+
+  if (Lanes::Any(fallback))
+  {
+    alignas(32) T                         args_x[Lanes::LANES];
+    alignas(32) T                         args_y[Lanes::LANES];
+    alignas(32) T                         results[Lanes::LANES];
+    alignas(32) typename Lanes::RawType mask[Lanes::LANES];
+    x.Store(args_x);
+    y.Store(args_y);
+    VectorRegister<T, 256>(ret).Store(results);
+    _mm256_store_si256(reinterpret_cast<Register *>(mask), fallback);
+
+    for (std::size_t i = 0; i < Lanes::LANES; ++i)
+    {
+      if (mask[i] != 0)
+      {
+        results[i] = function(args_x[i], args_y[i]);
+      }
+    }
+
+    ret = VectorRegister<T, 256>(results).data();
+  }
+
+  return {ret};
+}
+
+/**
+ * The 128-bit functions run the 256-bit kernels with the argument in both halves. The duplicated
+ * lanes raise the same states as the original ones, so the resulting state is unchanged
+ */
+template <typename T>
+VectorRegister<T, 256> Widen(VectorRegister<T, 128> const &x)
+{
+  return {_mm256_set_m128i(x.data(), x.data())};
+}
+
+template <typename T>
+VectorRegister<T, 128> Narrow(VectorRegister<T, 256> const &x)
+{
+  return {_mm256_castsi256_si128(x.data())};
+}
+
+}  // namespace details
+}  // namespace vectorise
+}  // namespace fetch
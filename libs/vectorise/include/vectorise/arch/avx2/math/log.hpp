@@ -0,0 +1,151 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/arch/avx2/math/fixed_point_lanes.hpp"
+#include "vectorise/fixed_point/fixed_point.hpp"
+
+namespace fetch {
+namespace vectorise {
+
+namespace details {
+
+/**
+ * Lane-wise FixedPoint::Log2(), performing the same operations in the same order as the scalar
+ * function. NaN, infinities, non-positive arguments and arguments whose range reduction overflows
+ * are left to the scalar function.
+ */
+template <typename T>
+typename FixedPointLanes<T>::Register FixedPointLog2(
+    typename FixedPointLanes<T>::Register const &x, typename FixedPointLanes<T>::Register &overflow,
+    typename FixedPointLanes<T>::Register &fallback)
+{
+  using L        = FixedPointLanes<T>;
+  using Register = typename L::Register;
+  using RawType  = typename L::RawType;
+
+  Register const zero = L::Zero();
+  Register const one  = L::Constant(T::_1);
+
+  Register const positive = L::And(L::Ordinary(x), L::Greater(x, zero));
+  Register const special  = L::Or(L::AndNot(positive, L::AllBits()),
+                                 L::Equal(x, L::Constant(T::CONST_SMALLEST_FRACTION)));
+  Register const is_one   = L::Equal(x, one);
+  Register const active   = L::AndNot(L::Or(special, is_one), L::AllBits());
+
+  Register main_overflow = zero;
+  Register main_fallback = zero;
+
+  // log2(x) = -log2(1/x) for x < 1
+  Register const below_one  = L::Less(x, one);
+  Register const sign       = L::Select(below_one, L::Negate(one), one);
+  Register const reciprocal = L::Divide(one, x, main_fallback);
+  Register const y          = L::Select(below_one, reciprocal, x);
+  main_fallback             = L::And(below_one, main_fallback);
+
+  // x = 2^k * r, where the scalar function wraps around once 1 << k reaches the sign bit
+  RawType const  max_k = RawType(8 * sizeof(RawType) - 2) - RawType(L::FRACTIONAL_BITS);
+  Register const k = L::IntegerSubtract(L::HighestSetBit(y), L::Integer(L::FRACTIONAL_BITS));
+  main_fallback    = L::Or(main_fallback, L::Greater(k, L::Integer(max_k)));
+  Register const r = L::Divide(y, L::ShiftLeft(one, k), main_fallback);
+
+  Register const p00 = L::Constant(T{137});
+  Register const p01 = L::Constant(T{1762});
+  Register const p02 = L::Constant(T{3762});
+  Register const p04 = L::Constant(T{137});
+  Register const q0  = L::Constant(T{30});
+  Register const q01 = L::Constant(T{24});
+  Register const q02 = L::Constant(T{76});
+
+  Register P = L::Multiply(r, p04, main_overflow);
+  P          = L::Multiply(r, L::Add(p01, P, main_overflow), main_overflow);
+  P          = L::Multiply(r, L::Add(p02, P, main_overflow), main_overflow);
+  P          = L::Multiply(r, L::Add(p01, P, main_overflow), main_overflow);
+  P          = L::Add(p00, P, main_overflow);
+  P          = L::Multiply(L::Add(L::Negate(one), r, main_overflow), P, main_overflow);
+
+  Register Q = L::Multiply(r, L::Add(q01, r, main_overflow), main_overflow);
+  Q          = L::Multiply(r, L::Add(q02, Q, main_overflow), main_overflow);
+  Q          = L::Multiply(r, L::Add(q01, Q, main_overflow), main_overflow);
+  Q          = L::Add(one, Q, main_overflow);
+  Q = L::Multiply(L::Multiply(q0, L::Add(one, r, main_overflow), main_overflow), Q, main_overflow);
+  Q = L::Multiply(Q, L::Constant(T::CONST_LN2), main_overflow);
+
+  Register const R = L::Divide(P, Q, main_fallback);
+  Register const ret =
+      L::Multiply(sign, L::Add(L::FromInteger(k), R, main_overflow), main_overflow);
+
+  overflow = L::Or(overflow, L::And(active, main_overflow));
+  fallback = L::Or(fallback, L::Or(special, L::And(active, main_fallback)));
+
+  return L::Select(is_one, zero, ret);
+}
+
+/**
+ * Lane-wise FixedPoint::Log(), which divides Log2() by log2(e)
+ */
+template <typename T>
+typename FixedPointLanes<T>::Register FixedPointLog(typename FixedPointLanes<T>::Register const &x,
+                                                    typename FixedPointLanes<T>::Register &overflow,
+                                                    typename FixedPointLanes<T>::Register &fallback)
+{
+  using L        = FixedPointLanes<T>;
+  using Register = typename L::Register;
+
+  Register       log2_fallback = L::Zero();
+  Register const log2          = FixedPointLog2<T>(x, overflow, log2_fallback);
+
+  Register       quotient_fallback = L::Zero();
+  Register const ret = L::Divide(log2, L::Constant(T::CONST_LOG2E), quotient_fallback);
+
+  fallback = L::Or(fallback, L::Or(log2_fallback, quotient_fallback));
+  return ret;
+}
+
+}  // namespace details
+
+inline VectorRegister<fixed_point::fp32_t, 256> log(
+    VectorRegister<fixed_point::fp32_t, 256> const &x)
+{
+  using Type = fixed_point::fp32_t;
+  return details::ApplyFixedPointKernel(x, details::FixedPointLog<Type>,
+                                        [](Type const &v) { return Type::Log(v); });
+}
+
+inline VectorRegister<fixed_point::fp64_t, 256> log(
+    VectorRegister<fixed_point::fp64_t, 256> const &x)
+{
+  using Type = fixed_point::fp64_t;
+  return details::ApplyFixedPointKernel(x, details::FixedPointLog<Type>,
+                                        [](Type const &v) { return Type::Log(v); });
+}
+
+inline VectorRegister<fixed_point::fp32_t, 128> log(
+    VectorRegister<fixed_point::fp32_t, 128> const &x)
+{
+  return details::Narrow(log(details::Widen(x)));
+}
+
+inline VectorRegister<fixed_point::fp64_t, 128> log(
+    VectorRegister<fixed_point::fp64_t, 128> const &x)
+{
+  return details::Narrow(log(details::Widen(x)));
+}
+
+}  // namespace vectorise
+}  // namespace fetch
@@ -17,6 +17,11 @@
 //
 //------------------------------------------------------------------------------
 
+#include "vectorise/arch/avx2/math/exp.hpp"
+#include "vectorise/arch/avx2/math/fixed_point_lanes.hpp"
+#include "vectorise/arch/avx2/math/log.hpp"
+#include "vectorise/fixed_point/fixed_point.hpp"
+
 namespace fetch {
 namespace vectorise {
 
@@ -43,5 +48,117 @@ VectorRegister<T, S> pow(VectorRegister<T, S> base, int p)
   return result;
 }
 
+namespace details {
+
+/**
+ * Lane-wise FixedPoint::Pow(), performing the same operations in the same order as the scalar
+ * function. NaN, infinities, a zero base and negative bases with non-integer exponents are left
+ * to the scalar function.
+ */
+template <typename T>
+typename FixedPointLanes<T>::Register FixedPointPow(typename FixedPointLanes<T>::Register const &x,
+                                                    typename FixedPointLanes<T>::Register const &y,
+                                                    typename FixedPointLanes<T>::Register &overflow,
+                                                    typename FixedPointLanes<T>::Register &fallback)
+{
+  using L        = FixedPointLanes<T>;
+  using Register = typename L::Register;
+  using RawType  = typename L::RawType;
+
+  Register const zero     = L::Zero();
+  Register const one      = L::Constant(T::_1);
+  Register const all_bits = L::AllBits();
+
+  Register const ordinary  = L::And(L::Ordinary(x), L::Ordinary(y));
+  Register const special   = L::Or(L::AndNot(ordinary, all_bits), L::Equal(x, zero));
+  Register const y_is_zero = L::Equal(y, zero);
+  Register const y_is_one  = L::Equal(y, one);
+  Register const active    = L::AndNot(L::Or(L::Or(special, y_is_zero), y_is_one), all_bits);
+
+  Register const fraction = L::And(y, L::Integer((RawType(1) << L::FRACTIONAL_BITS) - 1));
+  Register const integral = L::And(active, L::Equal(fraction, zero));
+  Register const real     = L::AndNot(integral, active);
+
+  // integer exponents: repeated multiplication by x, or by 1/x for negative exponents
+  Register const negative_y = L::Less(y, zero);
+  Register       integral_overflow = zero;
+  Register       integral_fallback = zero;
+  Register const x1 = L::Select(negative_y, L::Divide(one, x, integral_fallback), x);
+  integral_fallback = L::And(negative_y, integral_fallback);
+
+  Register power = x1;
+  if (L::Any(integral))
+  {
+    Register remaining =
+        L::IntegerSubtract(L::IntegerPart(L::Select(negative_y, L::Negate(y), y)), L::Integer(1));
+    for (Register m = L::And(integral, L::Greater(remaining, zero)); L::Any(m);
+         m          = L::And(m, L::Greater(remaining, zero)))
+    {
+      Register       product_overflow = zero;
+      Register const product          = L::Multiply(power, x1, product_overflow);
+
+      power             = L::Select(m, product, power);
+      integral_overflow = L::Or(integral_overflow, L::And(m, product_overflow));
+      remaining         = L::IntegerAdd(remaining, m);
+    }
+  }
+
+  // other exponents of positive bases: e^(y * log(x))
+  Register const negative_x = L::And(real, L::Less(x, zero));
+  Register const exponent   = L::AndNot(negative_x, real);
+
+  Register       real_overflow = zero;
+  Register       real_fallback = zero;
+  Register const log           = FixedPointLog<T>(x, real_overflow, real_fallback);
+  Register const product       = L::Multiply(y, log, real_overflow);
+  Register const exp           = FixedPointExp<T>(product, real_overflow, real_fallback);
+
+  overflow = L::Or(overflow, L::Or(L::And(integral, integral_overflow),
+                                   L::And(exponent, real_overflow)));
+  fallback = L::Or(fallback, L::Or(special, negative_x));
+  fallback = L::Or(fallback, L::Or(L::And(integral, integral_fallback),
+                                   L::And(exponent, real_fallback)));
+
+  Register ret = L::Select(integral, power, exp);
+  ret          = L::Select(y_is_one, x, ret);
+  return L::Select(y_is_zero, one, ret);
+}
+
+}  // namespace details
+
+inline VectorRegister<fixed_point::fp32_t, 256> pow(
+    VectorRegister<fixed_point::fp32_t, 256> const &x,
+    VectorRegister<fixed_point::fp32_t, 256> const &y)
+{
+  using Type = fixed_point::fp32_t;
+  return details::ApplyFixedPointKernel(
+      x, y, details::FixedPointPow<Type>,
+      [](Type const &a, Type const &b) { return Type::Pow(a, b); });
+}
+
+inline VectorRegister<fixed_point::fp64_t, 256> pow(
+    VectorRegister<fixed_point::fp64_t, 256> const &x,
+    VectorRegister<fixed_point::fp64_t, 256> const &y)
+{
+  using Type = fixed_point::fp64_t;
+  return details::ApplyFixedPointKernel(
+      x, y, details::FixedPointPow<Type>,
+      [](Type const &a, Type const &b) { return Type::Pow(a, b); });
+}
+
+inline VectorRegister<fixed_point::fp32_t, 128> pow(
+    VectorRegister<fixed_point::fp32_t, 128> const &x,
+    VectorRegister<fixed_point::fp32_t, 128> const &y)
+{
+  return details::Narrow(pow(details::Widen(x), details::Widen(y)));
+}
+
+inline VectorRegister<fixed_point::fp64_t, 128> pow(
+    VectorRegister<fixed_point::fp64_t, 128> const &x,
+    VectorRegister<fixed_point::fp64_t, 128> const &y)
+{
+  return details::Narrow(pow(details::Widen(x), details::Widen(y)));
+}
+
 }  // namespace vectorise
 }  // namespace fetch
@@ -17,6 +17,9 @@
 //
 //------------------------------------------------------------------------------
 
+#include "vectorise/arch/avx2/math/fixed_point_lanes.hpp"
+#include "vectorise/fixed_point/fixed_point.hpp"
+
 namespace fetch {
 namespace vectorise {
 
@@ -40,5 +43,130 @@ inline VectorRegister<double, 256> sqrt(VectorRegister<double, 256> const &a)
   return {_mm256_sqrt_pd(a.data())};
 }
 
+namespace details {
+
+/**
+ * Lane-wise FixedPoint::Sqrt(), performing the same operations in the same order as the scalar
+ * function. NaN, infinities and negative arguments are left to the scalar function.
+ */
+template <typename T>
+typename FixedPointLanes<T>::Register FixedPointSqrt(
+    typename FixedPointLanes<T>::Register const &x, typename FixedPointLanes<T>::Register &overflow,
+    typename FixedPointLanes<T>::Register &fallback)
+{
+  using L        = FixedPointLanes<T>;
+  using Register = typename L::Register;
+
+  Register const zero = L::Zero();
+  Register const one  = L::Constant(T::_1);
+  Register const two  = L::Integer(2);
+  Register const four = L::Constant(T{4});
+
+  Register const special = L::Or(L::AndNot(L::Ordinary(x), L::AllBits()), L::Less(x, zero));
+  Register const is_one  = L::Equal(x, one);
+  Register const is_zero = L::Equal(x, zero);
+  Register const active  = L::AndNot(L::Or(L::Or(special, is_one), is_zero), L::AllBits());
+
+  // find k such as x = 2^{2*k} * r, where 1 <= r <= 4
+  Register r = x;
+  Register k = zero;
+  for (Register m = L::And(active, L::Greater(r, four)); L::Any(m);
+       m          = L::And(m, L::Greater(r, four)))
+  {
+    k = L::IntegerSubtract(k, m);
+    r = L::Select(m, L::ShiftRight(r, two), r);
+  }
+  Register const below_one = L::And(active, L::Less(r, one));
+  for (Register m = below_one; L::Any(m); m = L::And(m, L::Less(r, one)))
+  {
+    k = L::IntegerAdd(k, m);
+    r = L::Select(m, L::ShiftLeft(r, two), r);
+  }
+
+  Register const approximate = L::AndNot(L::Equal(r, one), active);
+
+  Register approximate_overflow = zero;
+  Register approximate_fallback = zero;
+
+  // Pade approximation, 4th order around 1
+  Register const p01 = L::Constant(T{3});
+  Register const p02 = L::Constant(T{11});
+  Register const p03 = L::Constant(T{9});
+  Register const q01 = L::Constant(T{3});
+  Register const q02 = L::Constant(T{27});
+  Register const q03 = L::Constant(T{33});
+
+  Register P = L::Multiply(r, L::Add(p03, r, approximate_overflow), approximate_overflow);
+  P          = L::Add(p02, P, approximate_overflow);
+  P = L::Multiply(L::Multiply(p01, r, approximate_overflow), P, approximate_overflow);
+  P = L::Add(one, P, approximate_overflow);
+  P = L::Multiply(L::Add(one, L::Multiply(p01, r, approximate_overflow), approximate_overflow), P,
+                  approximate_overflow);
+
+  Register Q = L::Multiply(r, L::Add(q03, r, approximate_overflow), approximate_overflow);
+  Q          = L::Multiply(r, L::Add(q02, Q, approximate_overflow), approximate_overflow);
+  Q          = L::Add(q01, Q, approximate_overflow);
+  Q          = L::Multiply(L::Add(q01, r, approximate_overflow), Q, approximate_overflow);
+
+  Register const R = L::Divide(P, Q, approximate_fallback);
+
+  // 2 iterations of Goldsmith's algorithm
+  Register const half = L::Constant(T{0.5});
+  Register const y_n  = L::Divide(one, R, approximate_fallback);
+  Register       x_n  = L::Multiply(r, y_n, approximate_overflow);
+  Register       h_n  = L::Multiply(half, y_n, approximate_overflow);
+  for (int i = 0; i < 2; ++i)
+  {
+    Register const r_n =
+        L::Subtract(half, L::Multiply(x_n, h_n, approximate_overflow), approximate_overflow);
+    x_n = L::Add(x_n, L::Multiply(x_n, r_n, approximate_overflow), approximate_overflow);
+    h_n = L::Add(h_n, L::Multiply(h_n, r_n, approximate_overflow), approximate_overflow);
+  }
+  r = L::Select(approximate, x_n, r);
+
+  Register const negative_k = L::Less(k, zero);
+  Register const twok       = L::Select(negative_k, L::ShiftRight(one, L::Negate(k)),
+                                  L::ShiftLeft(one, k));
+
+  Register       result_overflow = zero;
+  Register const ret             = L::Multiply(twok, r, result_overflow);
+
+  overflow = L::Or(overflow, L::And(approximate, approximate_overflow));
+  overflow = L::Or(overflow, L::And(active, result_overflow));
+  fallback = L::Or(fallback, L::Or(special, L::And(approximate, approximate_fallback)));
+
+  return L::Select(is_one, one, L::Select(is_zero, zero, ret));
+}
+
+}  // namespace details
+
+inline VectorRegister<fixed_point::fp32_t, 256> sqrt(
+    VectorRegister<fixed_point::fp32_t, 256> const &x)
+{
+  using Type = fixed_point::fp32_t;
+  return details::ApplyFixedPointKernel(x, details::FixedPointSqrt<Type>,
+                                        [](Type const &v) { return Type::Sqrt(v); });
+}
+
+inline VectorRegister<fixed_point::fp64_t, 256> sqrt(
+    VectorRegister<fixed_point::fp64_t, 256> const &x)
+{
+  using Type = fixed_point::fp64_t;
+  return details::ApplyFixedPointKernel(x, details::FixedPointSqrt<Type>,
+                                        [](Type const &v) { return Type::Sqrt(v); });
+}
+
+inline VectorRegister<fixed_point::fp32_t, 128> sqrt(
+    VectorRegister<fixed_point::fp32_t, 128> const &x)
+{
+  return details::Narrow(sqrt(details::Widen(x)));
+}
+
+inline VectorRegister<fixed_point::fp64_t, 128> sqrt(
+    VectorRegister<fixed_point::fp64_t, 128> const &x)
+{
+  return details::Narrow(sqrt(details::Widen(x)));
+}
+
 }  // namespace vectorise
 }  // namespace fetch
@@ -49,5 +49,23 @@ VectorRegister<T, S> exp(VectorRegister<T, S> x, T const &precision = 0.00001)
   return ret;
 }
 
+template <typename T, std::size_t S>
+VectorRegister<T, S> log(VectorRegister<T, S> const &x)
+{
+  return VectorRegister<T, S>(std::log(x.data()));
+}
+
+template <typename T, std::size_t S>
+VectorRegister<T, S> sqrt(VectorRegister<T, S> const &x)
+{
+  return VectorRegister<T, S>(std::sqrt(x.data()));
+}
+
+template <typename T, std::size_t S>
+VectorRegister<T, S> pow(VectorRegister<T, S> const &x, VectorRegister<T, S> const &y)
+{
+  return VectorRegister<T, S>(std::pow(x.data(), y.data()));
+}
+
 }  // namespace vectorise
 }  // namespace fetch
@@ -71,6 +71,16 @@ public:
 
   constexpr SharedArray() = default;
 
+  /**
+   * Adopts memory allocated elsewhere, e.g. a buffer owned by another runtime. The memory must be
+   * aligned like the arrays allocated above and hold at least padded_size() elements. It is
+   * released through the deleter of data once the last array referring to it goes away.
+   */
+  SharedArray(DataType data, std::size_t n) noexcept
+    : SuperType(data.get(), n)
+    , data_(std::move(data))
+  {}
+
   SharedArray(SharedArray const &other) noexcept
     : SuperType(other.pointer_, other.size())
     , data_(other.data_)
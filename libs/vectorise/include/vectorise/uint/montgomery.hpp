@@ -0,0 +1,302 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/uint/uint.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace fetch {
+namespace vectorise {
+
+/**
+ * Multiply two numbers modulo a third one, using a product of twice the width so that nothing is
+ * lost before the reduction.
+ *
+ * @param lhs The left hand side, smaller than the modulus
+ * @param rhs The right hand side, smaller than the modulus
+ * @param modulus The modulus
+ * @return lhs * rhs mod modulus
+ */
+template <uint16_t S>
+UInt<S> MulMod(UInt<S> const &lhs, UInt<S> const &rhs, UInt<S> const &modulus)
+{
+  using Wide = UInt<static_cast<uint16_t>(2 * S)>;
+
+  Wide wide_lhs;
+  Wide wide_rhs;
+  Wide wide_modulus;
+  for (std::size_t i = 0; i < UInt<S>::WIDE_ELEMENTS; ++i)
+  {
+    wide_lhs.ElementAt(i)     = lhs.ElementAt(i);
+    wide_rhs.ElementAt(i)     = rhs.ElementAt(i);
+    wide_modulus.ElementAt(i) = modulus.ElementAt(i);
+  }
+
+  Wide const product = (wide_lhs * wide_rhs) % wide_modulus;
+
+  UInt<S> result;
+  for (std::size_t i = 0; i < UInt<S>::WIDE_ELEMENTS; ++i)
+  {
+    result.ElementAt(i) = product.ElementAt(i);
+  }
+
+  return result;
+}
+
+/**
+ * Montgomery arithmetic modulo a fixed, odd modulus.
+ *
+ * Numbers are kept in Montgomery form, x * R mod m with R = 2^S. Multiplying two numbers in this
+ * form only takes limb multiplications, additions and shifts (CIOS, Koc et al. 1996) instead of
+ * a division by the modulus. Converting into and out of the form costs one multiplication each,
+ * so it pays off for long chains of multiplications such as modular exponentiation.
+ */
+template <uint16_t S = 256>
+class Montgomery
+{
+public:
+  using Number   = UInt<S>;
+  using WideType = typename Number::WideType;
+
+  static_assert((S % 64) == 0, "Montgomery arithmetic requires a whole number of 64-bit limbs");
+
+  // Construction / Destruction
+  explicit Montgomery(Number const &modulus);
+  Montgomery(Montgomery const &) = default;
+  Montgomery(Montgomery &&)      = default;
+  ~Montgomery()                  = default;
+
+  /// @name Conversion
+  /// @{
+  Number ToMontgomery(Number const &value) const;
+  Number FromMontgomery(Number const &value) const;
+  /// @}
+
+  /// @name Arithmetic on numbers in Montgomery form
+  /// @{
+  Number Multiply(Number const &lhs, Number const &rhs) const;
+  /// @}
+
+  Number Pow(Number const &base, Number const &exponent) const;
+
+  Number const &modulus() const;
+
+  // Operators
+  Montgomery &operator=(Montgomery const &) = default;
+  Montgomery &operator=(Montgomery &&) = default;
+
+private:
+  static constexpr std::size_t LIMBS = Number::WIDE_ELEMENTS;
+
+  Number   modulus_;
+  Number   one_;        ///< R mod m, i.e. one in Montgomery form
+  Number   r_squared_;  ///< R^2 mod m, used to convert into Montgomery form
+  WideType inverse_;    ///< -m^-1 mod 2^64
+};
+
+template <uint16_t S>
+constexpr std::size_t Montgomery<S>::LIMBS;
+
+template <uint16_t S>
+Montgomery<S>::Montgomery(Number const &modulus)
+  : modulus_{modulus}
+{
+  if ((modulus.ElementAt(0) & 1u) == 0)
+  {
+    throw std::runtime_error("Montgomery arithmetic requires an odd modulus");
+  }
+
+  // Newton iteration for the inverse of the lowest limb, each step doubles the correct bits
+  WideType const low     = modulus.ElementAt(0);
+  WideType       inverse = low;  // correct to 3 bits for any odd number
+  for (std::size_t i = 0; i < 5; ++i)
+  {
+    inverse *= 2 - low * inverse;
+  }
+  inverse_ = ~inverse + 1;
+
+  // R mod m = ((R - 1) mod m + 1) mod m, R itself does not fit the type
+  one_       = ((Number::max % modulus_) + Number::_1) % modulus_;
+  r_squared_ = MulMod(one_, one_, modulus_);
+}
+
+template <uint16_t S>
+typename Montgomery<S>::Number Montgomery<S>::ToMontgomery(Number const &value) const
+{
+  return Multiply(value % modulus_, r_squared_);
+}
+
+template <uint16_t S>
+typename Montgomery<S>::Number Montgomery<S>::FromMontgomery(Number const &value) const
+{
+  return Multiply(value, Number::_1);
+}
+
+/**
+ * Montgomery product lhs * rhs * R^-1 mod m of two numbers smaller than the modulus
+ */
+template <uint16_t S>
+typename Montgomery<S>::Number Montgomery<S>::Multiply(Number const &lhs, Number const &rhs) const
+{
+  // local copies of the limbs let the compiler keep the inner loops in registers
+  WideType a[LIMBS];
+  WideType b[LIMBS];
+  WideType m[LIMBS];
+  for (std::size_t i = 0; i < LIMBS; ++i)
+  {
+    a[i] = lhs.ElementAt(i);
+    b[i] = rhs.ElementAt(i);
+    m[i] = modulus_.ElementAt(i);
+  }
+
+  WideType t[LIMBS + 2] = {};
+  for (std::size_t i = 0; i < LIMBS; ++i)
+  {
+    // t += a * b[i]
+    __uint128_t carry = 0;
+    for (std::size_t j = 0; j < LIMBS; ++j)
+    {
+      carry += static_cast<__uint128_t>(a[j]) * b[i] + t[j];
+      t[j] = static_cast<WideType>(carry);
+      carry >>= 64;
+    }
+    carry += t[LIMBS];
+    t[LIMBS]     = static_cast<WideType>(carry);
+    t[LIMBS + 1] = static_cast<WideType>(carry >> 64);
+
+    // add the multiple of the modulus which clears the lowest limb, then drop that limb
+    WideType const factor = t[0] * inverse_;
+
+    carry = static_cast<__uint128_t>(factor) * m[0] + t[0];
+    carry >>= 64;
+    for (std::size_t j = 1; j < LIMBS; ++j)
+    {
+      carry += static_cast<__uint128_t>(factor) * m[j] + t[j];
+      t[j - 1] = static_cast<WideType>(carry);
+      carry >>= 64;
+    }
+    carry += t[LIMBS];
+    t[LIMBS - 1] = static_cast<WideType>(carry);
+    t[LIMBS]     = t[LIMBS + 1] + static_cast<WideType>(carry >> 64);
+  }
+
+  Number result;
+  for (std::size_t i = 0; i < LIMBS; ++i)
+  {
+    result.ElementAt(i) = t[i];
+  }
+
+  // the result is smaller than 2m, a single subtraction brings it into range
+  if ((t[LIMBS] != 0) || (result >= modulus_))
+  {
+    WideType borrow = 0;
+    for (std::size_t i = 0; i < LIMBS; ++i)
+    {
+      WideType const limb       = result.ElementAt(i);
+      WideType const difference = limb - m[i];
+      WideType const underflow  = (limb < m[i]) ? 1 : 0;
+      result.ElementAt(i)       = difference - borrow;
+      borrow                    = underflow | ((difference < borrow) ? 1 : 0);
+    }
+  }
+
+  return result;
+}
+
+/**
+ * Modular exponentiation by left to right binary exponentiation
+ *
+ * @param base The base, in normal form
+ * @param exponent The exponent
+ * @return base^exponent mod m, in normal form
+ */
+template <uint16_t S>
+typename Montgomery<S>::Number Montgomery<S>::Pow(Number const &base, Number const &exponent) const
+{
+  Number const value  = ToMontgomery(base);
+  Number       result = one_;
+
+  std::size_t const bits = (LIMBS * 64) - exponent.msb();
+  for (std::size_t i = bits; i-- > 0;)
+  {
+    result = Multiply(result, result);
+
+    if (((exponent.ElementAt(i / 64) >> (i % 64)) & 1u) != 0)
+    {
+      result = Multiply(result, value);
+    }
+  }
+
+  return FromMontgomery(result);
+}
+
+template <uint16_t S>
+typename Montgomery<S>::Number const &Montgomery<S>::modulus() const
+{
+  return modulus_;
+}
+
+/**
+ * Modular exponentiation, using Montgomery arithmetic when the modulus is odd
+ *
+ * @param base The base
+ * @param exponent The exponent
+ * @param modulus The modulus
+ * @return base^exponent mod modulus
+ */
+template <uint16_t S>
+UInt<S> ModPow(UInt<S> const &base, UInt<S> const &exponent, UInt<S> const &modulus)
+{
+  if (modulus == UInt<S>::_0)
+  {
+    throw std::runtime_error("division by zero!");
+  }
+
+  if (modulus == UInt<S>::_1)
+  {
+    return UInt<S>::_0;
+  }
+
+  if ((modulus.ElementAt(0) & 1u) != 0)
+  {
+    return Montgomery<S>{modulus}.Pow(base, exponent);
+  }
+
+  // even moduli fall back to plain square and multiply
+  UInt<S> const value  = base % modulus;
+  UInt<S>       result = UInt<S>::_1;
+
+  std::size_t const bits = (UInt<S>::WIDE_ELEMENTS * 64) - exponent.msb();
+  for (std::size_t i = bits; i-- > 0;)
+  {
+    result = MulMod(result, result, modulus);
+
+    if (((exponent.ElementAt(i / 64) >> (i % 64)) & 1u) != 0)
+    {
+      result = MulMod(result, value, modulus);
+    }
+  }
+
+  return result;
+}
+
+}  // namespace vectorise
+}  // namespace fetch
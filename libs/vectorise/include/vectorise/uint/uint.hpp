@@ -44,6 +44,56 @@ namespace vectorise {
  * one easily use this in combination with hashes etc.
  */
 
+namespace details {
+
+/**
+ * Reciprocal of a normalised (most significant bit set) 64-bit divisor, floor((2^128 - 1) / d) -
+ * 2^64, as used by the 2-by-1 division of Moller and Granlund, "Improved division by invariant
+ * integers", 2011.
+ */
+inline uint64_t Reciprocal(uint64_t divisor)
+{
+  return static_cast<uint64_t>(~__uint128_t{0} / divisor);
+}
+
+/**
+ * Divide the 128-bit value <high, low> by a normalised divisor using its precomputed reciprocal,
+ * replacing the 128-bit hardware (or library) division with two multiplications.
+ *
+ * @param high The upper word of the dividend, must be smaller than the divisor
+ * @param low The lower word of the dividend
+ * @param divisor The normalised divisor
+ * @param reciprocal The reciprocal of the divisor
+ * @param remainder The output remainder
+ * @return The quotient
+ */
+inline uint64_t DivideWord(uint64_t high, uint64_t low, uint64_t divisor, uint64_t reciprocal,
+                           uint64_t &remainder)
+{
+  __uint128_t const estimate = static_cast<__uint128_t>(reciprocal) * high +
+                               ((static_cast<__uint128_t>(high) << 64) | low);
+
+  auto     quotient = static_cast<uint64_t>(estimate >> 64) + 1;
+  uint64_t rest     = low - quotient * divisor;
+
+  if (rest > static_cast<uint64_t>(estimate))
+  {
+    --quotient;
+    rest += divisor;
+  }
+
+  if (rest >= divisor)
+  {
+    ++quotient;
+    rest -= divisor;
+  }
+
+  remainder = rest;
+  return quotient;
+}
+
+}  // namespace details
+
 // TODO(issue 1383): Handle 'residual' bits in the last element of `wide_` array
 template <uint16_t S = 256>
 class UInt
@@ -244,6 +294,8 @@ public:
 private:
   WideContainerType wide_;
 
+  static void DivMod(UInt const &dividend, UInt const &divisor, UInt &quotient, UInt &remainder);
+
   static constexpr WideType RESIDUAL_BITS_MASK{~WideType{0} >> RESIDUAL_BITS};
 
   constexpr ContainerType const &base() const;
@@ -597,124 +649,204 @@ constexpr UInt<S> &UInt<S>::operator-=(UInt<S> const &n)
   return *this;
 }
 
-// Implementation for 256-bits only
-template <>
-constexpr UInt<256> &UInt<256>::operator*=(UInt<256> const &n)
+template <uint16_t S>
+constexpr UInt<S> &UInt<S>::operator*=(UInt<S> const &n)
 {
-  // Calculate all products between each uint64_t element in the UInts
-  // Use int128_t type to hold the actual product.
-  __uint128_t products[WIDE_ELEMENTS][WIDE_ELEMENTS] = {};
+  /* Schoolbook multiplication on the 64-bit limbs, truncated to the width of the type. If a and b
+   * have the limbs a[0] .. a[N-1] and b[0] .. b[N-1] (little endian order) then
+   *
+   *   a * b = sum over i + j < N of (a[i] * b[j]) << (64 * (i + j))
+   *
+   * Each row accumulates a partial product, the limb already in the result and the carry from the
+   * previous column in 128 bits, which cannot overflow: (2^64 - 1)^2 + 2 * (2^64 - 1) = 2^128 - 1
+   */
+  WideType product[WIDE_ELEMENTS] = {};
 
   for (std::size_t i = 0; i < WIDE_ELEMENTS; ++i)
   {
-    for (std::size_t j = 0; j < WIDE_ELEMENTS; ++j)
+    if (wide_[i] == 0)
+    {
+      continue;
+    }
+
+    __uint128_t carry = 0;
+    for (std::size_t j = 0; i + j < WIDE_ELEMENTS; ++j)
     {
-      // Note: C++14 does not have constexpr std::array, we need to cast the array
-      products[i][j] =
-          static_cast<__uint128_t>(wide_[i]) * static_cast<__uint128_t>(n.ElementAt(j));
+      carry += static_cast<__uint128_t>(wide_[i]) * n.ElementAt(j) + product[i + j];
+      product[i + j] = static_cast<WideType>(carry);
+      carry >>= WIDE_ELEMENT_SIZE;
     }
   }
 
-  /* If a, b, two UInt<256> numbers, with the following elements (little endian order):
-   * |  a[3]  |  a[2]  |  a[1]  |  a[0]  |
-   * |  b[3]  |  b[2]  |  b[1]  |  b[0]  |
-   * Then both can be written in the following form:
-   * a = a[0] + (a[1] << 64) + (a[2] << 128) + (a[3] << 192)
-   * b = b[0] + (b[1] << 64) + (b[2] << 128) + (b[3] << 192)
-   *
-   * Then a * b is the following, truncating terms left shifted over 192 bits:
-   * a * b =  a[0] * b[0]
-   *       + (a[0] * b[1] + a[1] * b[0]) << 64
-   *       + (a[0] * b[2] + a[1] * b[1] + a[2] * b[0]) << 128
-   *       + (a[0] * b[3] + a[1] * b[2] + a[2] * b[1] + a[3] * b[0]) << 192
-   * In order to be accurate, we calculate these terms as 128-bit quantities and we add the
-   * high-64-bits as carry to the next term
-   */
+  std::copy(product, product + WIDE_ELEMENTS, wide_.begin());
+  mask_residual_bits();
 
-  __uint128_t carry = 0, terms[WIDE_ELEMENTS] = {};
-  terms[0] = products[0][0];
-  carry    = static_cast<WideType>(terms[0] >> WIDE_ELEMENT_SIZE);
-  terms[1] = products[0][1] + products[1][0] + carry;
-  carry    = static_cast<WideType>(terms[1] >> WIDE_ELEMENT_SIZE);
-  terms[2] = products[0][2] + products[1][1] + products[2][0] + carry;
-  carry    = static_cast<WideType>(terms[2] >> WIDE_ELEMENT_SIZE);
-  terms[3] = products[0][3] + products[1][2] + products[2][1] + products[3][0] + carry;
+  return *this;
+}
 
-  for (std::size_t i = 0; i < WIDE_ELEMENTS; ++i)
+template <uint16_t S>
+constexpr UInt<S> &UInt<S>::operator/=(UInt<S> const &n)
+{
+  if (n == _0)
   {
-    wide_[i] = static_cast<WideType>(terms[i]);
+    throw std::runtime_error("division by zero!");
   }
 
+  UInt<S> remainder;
+  DivMod(*this, n, *this, remainder);
+
   return *this;
 }
 
 template <uint16_t S>
-constexpr UInt<S> &UInt<S>::operator/=(UInt<S> const &n)
+constexpr UInt<S> &UInt<S>::operator%=(UInt<S> const &n)
 {
   if (n == _0)
   {
     throw std::runtime_error("division by zero!");
   }
-  if (n == _1)
-  {
-    return *this;
-  }
-  if (*this == n)
+
+  UInt<S> quotient;
+  DivMod(*this, n, quotient, *this);
+
+  return *this;
+}
+
+/**
+ * Long division on 64-bit limbs (Knuth, TAOCP Vol. 2, 4.3.1, Algorithm D).
+ *
+ * Both operands are first normalised so that the most significant bit of the divisor is set,
+ * which bounds the error of every estimated quotient limb by two. Divisors of a single limb take
+ * a faster path, dividing one limb at a time with a precomputed reciprocal.
+ *
+ * The quotient or the remainder may alias the dividend.
+ */
+template <uint16_t S>
+void UInt<S>::DivMod(UInt const &dividend, UInt const &divisor, UInt &quotient, UInt &remainder)
+{
+  auto const n = static_cast<std::size_t>(divisor.TrimmedWideSize());
+  auto const m = static_cast<std::size_t>(dividend.TrimmedWideSize());
+
+  if ((m < n) || (dividend < divisor))
   {
-    *this = _1;
-    return *this;
+    remainder = dividend;
+    quotient  = _0;
+    return;
   }
-  if (*this == _0)
+
+  // normalise the operands, the dividend gains an extra limb for the bits shifted out of it
+  auto const shift = static_cast<std::size_t>(platform::CountLeadingZeroes64(divisor.wide_[n - 1]));
+  auto const shift_left = [shift](WideType high, WideType low) -> WideType {
+    return (shift == 0) ? high : ((high << shift) | (low >> (WIDE_ELEMENT_SIZE - shift)));
+  };
+
+  WideType un[WIDE_ELEMENTS + 1] = {};
+  WideType vn[WIDE_ELEMENTS]     = {};
+  WideType q[WIDE_ELEMENTS]      = {};
+
+  un[m] = shift_left(0, dividend.wide_[m - 1]);
+  for (std::size_t i = m - 1; i > 0; --i)
   {
-    return *this;
+    un[i] = shift_left(dividend.wide_[i], dividend.wide_[i - 1]);
   }
-  // No fractions supported, if *this < n return 0
-  if (*this < n)
+  un[0] = shift_left(dividend.wide_[0], 0);
+
+  for (std::size_t i = n - 1; i > 0; --i)
   {
-    *this = _0;
-    return *this;
+    vn[i] = shift_left(divisor.wide_[i], divisor.wide_[i - 1]);
   }
+  vn[0] = shift_left(divisor.wide_[0], 0);
 
-  // Actual integer division algorithm
-  // First simplify dividend/divisor by shifting right by min LSB bit
-  // Essentially divide both by 2 as long as the LSB is zero
-  UInt<S>     N{*this}, D{n};
-  std::size_t lsb = std::min(N.lsb(), D.lsb());
-  N >>= lsb;
-  D >>= lsb;
-  UInt<S> multiple(1u);
-
-  // Find smallest multiple of divisor (D) that is larger than the dividend (N)
-  while (N > D)
+  if (n == 1)
   {
-    D <<= 1;
-    multiple <<= 1;
+    WideType const reciprocal = details::Reciprocal(vn[0]);
+
+    WideType rest = un[m];
+    for (std::size_t i = m; i-- > 0;)
+    {
+      q[i] = details::DivideWord(rest, un[i], vn[0], reciprocal, rest);
+    }
+    un[0] = rest;
+    un[1] = 0;
   }
-  // Calculate Quotient in a loop, essentially divide divisor by 2 and subtract from Remainder
-  // Add multiple to Quotient
-  UInt<S> Q = _0, R = N;
-  do
+  else
   {
-    if (R >= D)
+    WideType const reciprocal = details::Reciprocal(vn[n - 1]);
+
+    for (std::size_t j = m - n + 1; j-- > 0;)
     {
-      R -= D;
-      Q += multiple;
+      // estimate the quotient limb from the top two limbs of the remainder and the divisor
+      __uint128_t qhat;
+      __uint128_t rhat;
+      if (un[j + n] >= vn[n - 1])
+      {
+        // the estimate would not fit a limb, the top limbs can only be equal here
+        qhat = ~WideType{0};
+        rhat = static_cast<__uint128_t>(un[j + n - 1]) + vn[n - 1];
+      }
+      else
+      {
+        WideType rest;
+        qhat = details::DivideWord(un[j + n], un[j + n - 1], vn[n - 1], reciprocal, rest);
+        rhat = rest;
+      }
+
+      while (((rhat >> WIDE_ELEMENT_SIZE) == 0) &&
+             (qhat * vn[n - 2] > ((rhat << WIDE_ELEMENT_SIZE) | un[j + n - 2])))
+      {
+        --qhat;
+        rhat += vn[n - 1];
+      }
+
+      // subtract qhat times the divisor from the remainder
+      WideType carry  = 0;
+      WideType borrow = 0;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        __uint128_t const product = qhat * vn[i] + carry;
+        carry                     = static_cast<WideType>(product >> WIDE_ELEMENT_SIZE);
+
+        auto const     low        = static_cast<WideType>(product);
+        WideType const difference = un[i + j] - low;
+        WideType const underflow  = (un[i + j] < low) ? 1 : 0;
+        un[i + j]                 = difference - borrow;
+        borrow                    = underflow | ((difference < borrow) ? 1 : 0);
+      }
+
+      __uint128_t const subtrahend = static_cast<__uint128_t>(carry) + borrow;
+      bool const        negative   = subtrahend > un[j + n];
+      un[j + n] -= static_cast<WideType>(subtrahend);
+
+      // the estimate was one too large, add the divisor back
+      if (negative)
+      {
+        --qhat;
+
+        WideType add_carry = 0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          __uint128_t const sum =
+              static_cast<__uint128_t>(un[i + j]) + vn[i] + add_carry;
+          un[i + j] = static_cast<WideType>(sum);
+          add_carry = static_cast<WideType>(sum >> WIDE_ELEMENT_SIZE);
+        }
+        un[j + n] += add_carry;
+      }
+
+      q[j] = static_cast<WideType>(qhat);
     }
-    D >>= 1;  // Divide by two.
-    multiple >>= 1;
-  } while (multiple != 0u);
+  }
 
-  // Return the Quotient
-  *this = Q;
-  return *this;
-}
+  // the remainder is left in the lowest limbs, undo the normalisation
+  UInt<S> rest;
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    rest.wide_[i] = (shift == 0) ? un[i]
+                                 : ((un[i] >> shift) | (un[i + 1] << (WIDE_ELEMENT_SIZE - shift)));
+  }
 
-template <uint16_t S>
-constexpr UInt<S> &UInt<S>::operator%=(UInt<S> const &n)
-{
-  UInt<S> q = *this / n;
-  *this -= q * n;
-  return *this;
+  std::copy(q, q + WIDE_ELEMENTS, quotient.wide_.begin());
+  remainder = rest;
 }
 
 template <uint16_t S>
@@ -0,0 +1,233 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/fixed_point/fixed_point.hpp"
+#include "vectorise/math/standard_functions.hpp"
+#include "vectorise/vectorise.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#ifdef __AVX2__
+
+namespace {
+
+using fetch::fixed_point::fp32_t;
+using fetch::fixed_point::fp64_t;
+
+template <typename T>
+class FixedPointFunctionsTest : public ::testing::Test
+{
+public:
+  using RegisterType = fetch::vectorise::VectorRegister<T, 256>;
+
+  static constexpr std::size_t LANES = RegisterType::E_BLOCK_COUNT;
+
+  /// Uniformly distributed values, random raw values and the special cases of the functions
+  static std::vector<T> Inputs(double lower, double upper)
+  {
+    std::mt19937_64                        rng(42);
+    std::uniform_real_distribution<double> uniform(lower, upper);
+    std::uniform_int_distribution<int64_t> raw(-static_cast<int64_t>(T::MAX),
+                                               static_cast<int64_t>(T::MAX));
+
+    std::vector<T> values{T::_0,
+                          T::_1,
+                          -T::_1,
+                          T{2},
+                          T{4},
+                          T{0.5},
+                          T{-0.5},
+                          T::MIN_EXP,
+                          T::MAX_EXP,
+                          T::MIN_EXP - T::CONST_SMALLEST_FRACTION,
+                          T::MAX_EXP + T::CONST_SMALLEST_FRACTION,
+                          T::CONST_SMALLEST_FRACTION,
+                          T::FromBase(3),
+                          T::FP_MIN,
+                          T::FP_MAX,
+                          T::NaN,
+                          T::POSITIVE_INFINITY,
+                          T::NEGATIVE_INFINITY};
+    for (std::size_t i = 0; i < 2000; ++i)
+    {
+      values.emplace_back(uniform(rng));
+      values.push_back(T::FromBase(static_cast<typename T::Type>(raw(rng))));
+    }
+    while (values.size() % LANES != 0)
+    {
+      values.push_back(T::_1);
+    }
+
+    return values;
+  }
+
+  /// Checks that the register function gives the scalar results and fixed point state, lane by lane
+  template <typename VectorFunction, typename ScalarFunction>
+  static void Compare(std::vector<T> const &values, VectorFunction &&vector_function,
+                      ScalarFunction &&scalar_function)
+  {
+    for (std::size_t i = 0; i < values.size(); i += LANES)
+    {
+      alignas(32) T input[LANES];
+      alignas(32) T output[LANES];
+      T             expected[LANES];
+      std::copy(values.begin() + static_cast<std::ptrdiff_t>(i),
+                values.begin() + static_cast<std::ptrdiff_t>(i + LANES), input);
+
+      T::StateClear();
+      for (std::size_t j = 0; j < LANES; ++j)
+      {
+        expected[j] = scalar_function(input[j]);
+      }
+      auto const expected_state = T::fp_state;
+
+      T::StateClear();
+      vector_function(RegisterType(input)).Store(output);
+      EXPECT_EQ(T::fp_state, expected_state);
+
+      for (std::size_t j = 0; j < LANES; ++j)
+      {
+        EXPECT_EQ(output[j].Data(), expected[j].Data()) << "x = " << input[j];
+      }
+    }
+    T::StateClear();
+  }
+};
+
+template <typename T>
+constexpr std::size_t FixedPointFunctionsTest<T>::LANES;
+
+using FixedPointTypes = ::testing::Types<fp32_t, fp64_t>;
+TYPED_TEST_CASE(FixedPointFunctionsTest, FixedPointTypes);
+
+TYPED_TEST(FixedPointFunctionsTest, exp_is_bit_exact)
+{
+  using RegisterType = typename TestFixture::RegisterType;
+
+  auto const range = static_cast<double>(TypeParam::MAX_EXP) + 1;
+  TestFixture::Compare(TestFixture::Inputs(-range, range),
+                       [](RegisterType const &x) { return fetch::vectorise::exp(x); },
+                       [](TypeParam const &x) { return TypeParam::Exp(x); });
+}
+
+TYPED_TEST(FixedPointFunctionsTest, log_is_bit_exact)
+{
+  using RegisterType = typename TestFixture::RegisterType;
+
+  for (double upper : {0.01, 10.0, 30000.0})
+  {
+    TestFixture::Compare(TestFixture::Inputs(0, upper),
+                         [](RegisterType const &x) { return fetch::vectorise::log(x); },
+                         [](TypeParam const &x) { return TypeParam::Log(x); });
+  }
+}
+
+TYPED_TEST(FixedPointFunctionsTest, sqrt_is_bit_exact)
+{
+  using RegisterType = typename TestFixture::RegisterType;
+
+  for (double upper : {0.01, 10.0, 30000.0})
+  {
+    TestFixture::Compare(TestFixture::Inputs(0, upper),
+                         [](RegisterType const &x) { return fetch::vectorise::sqrt(x); },
+                         [](TypeParam const &x) { return TypeParam::Sqrt(x); });
+  }
+}
+
+TYPED_TEST(FixedPointFunctionsTest, pow_is_bit_exact)
+{
+  using RegisterType = typename TestFixture::RegisterType;
+
+  for (TypeParam y : {TypeParam{0}, TypeParam{1}, TypeParam{-1}, TypeParam{2}, TypeParam{-3},
+                      TypeParam{7}, TypeParam{0.5}, TypeParam{1.5}, TypeParam{-2.25}})
+  {
+    RegisterType const exponent(y);
+    TestFixture::Compare(TestFixture::Inputs(-5, 5),
+                         [&exponent](RegisterType const &x) {
+                           return fetch::vectorise::pow(x, exponent);
+                         },
+                         [y](TypeParam const &x) { return TypeParam::Pow(x, y); });
+  }
+}
+
+TYPED_TEST(FixedPointFunctionsTest, pow_with_different_exponents_per_lane)
+{
+  using RegisterType          = typename TestFixture::RegisterType;
+  constexpr std::size_t LANES = TestFixture::LANES;
+
+  auto const bases     = TestFixture::Inputs(0, 5);
+  auto const exponents = TestFixture::Inputs(-4, 4);
+
+  for (std::size_t i = 0; i < bases.size(); i += LANES)
+  {
+    alignas(32) TypeParam x[LANES];
+    alignas(32) TypeParam y[LANES];
+    alignas(32) TypeParam output[LANES];
+    TypeParam             expected[LANES];
+    for (std::size_t j = 0; j < LANES; ++j)
+    {
+      x[j] = bases[i + j];
+      // mix integer and fractional exponents within the register
+      y[j] = (j % 2 == 0) ? TypeParam{static_cast<int>(j) - 3} : exponents[i + j];
+    }
+
+    TypeParam::StateClear();
+    for (std::size_t j = 0; j < LANES; ++j)
+    {
+      expected[j] = TypeParam::Pow(x[j], y[j]);
+    }
+    auto const expected_state = TypeParam::fp_state;
+
+    TypeParam::StateClear();
+    fetch::vectorise::pow(RegisterType(x), RegisterType(y)).Store(output);
+    EXPECT_EQ(TypeParam::fp_state, expected_state);
+
+    for (std::size_t j = 0; j < LANES; ++j)
+    {
+      EXPECT_EQ(output[j].Data(), expected[j].Data()) << "x = " << x[j] << ", y = " << y[j];
+    }
+  }
+  TypeParam::StateClear();
+}
+
+TYPED_TEST(FixedPointFunctionsTest, half_registers_match_full_registers)
+{
+  using HalfRegisterType      = fetch::vectorise::VectorRegister<TypeParam, 128>;
+  constexpr std::size_t LANES = HalfRegisterType::E_BLOCK_COUNT;
+
+  alignas(16) TypeParam input[LANES];
+  alignas(16) TypeParam output[LANES];
+  for (std::size_t j = 0; j < LANES; ++j)
+  {
+    input[j] = TypeParam{0.75} * TypeParam{static_cast<int>(j) + 1};
+  }
+
+  fetch::vectorise::exp(HalfRegisterType(input)).Store(output);
+  for (std::size_t j = 0; j < LANES; ++j)
+  {
+    EXPECT_EQ(output[j], TypeParam::Exp(input[j]));
+  }
+}
+
+}  // namespace
+
+#endif
@@ -0,0 +1,155 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vm/map.hpp"
+#include "vm/string.hpp"
+#include "vm_modules/vm_factory.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace fetch::vm;
+
+namespace vm_modules {
+namespace benchmark {
+namespace map {
+
+namespace {
+
+using VMPtr  = std::shared_ptr<VM>;
+using Keys   = std::vector<TemplateParameter1>;
+using IntMap = Map<int64_t, int64_t>;
+using StrMap = Map<Ptr<Object>, int64_t>;
+
+void SetUp(VMPtr &vm)
+{
+  using VMFactory = fetch::vm_modules::VMFactory;
+
+  auto module = VMFactory::GetModule(VMFactory::USE_ALL);
+  vm          = std::make_shared<VM>(module.get());
+}
+
+/// Spread the keys out so that they do not simply fill consecutive buckets
+Keys CreateIntegerKeys(int64_t count)
+{
+  Keys keys;
+  keys.reserve(static_cast<std::size_t>(count));
+  for (int64_t i = 0; i < count; ++i)
+  {
+    keys.emplace_back(i * 4096 + (i % 7), TypeIds::Int64);
+  }
+  return keys;
+}
+
+Keys CreateStringKeys(VMPtr &vm, int64_t count)
+{
+  Keys keys;
+  keys.reserve(static_cast<std::size_t>(count));
+  for (int64_t i = 0; i < count; ++i)
+  {
+    Ptr<Object> key{new String{vm.get(), "balance_of_account_" + std::to_string(i)}};
+    keys.emplace_back(std::move(key), TypeIds::String);
+  }
+  return keys;
+}
+
+template <typename MapType>
+void Fill(MapType &map, Keys const &keys)
+{
+  int64_t value = 0;
+  for (auto const &key : keys)
+  {
+    map.SetIndexedValue(key, TemplateParameter2{value++, TypeIds::Int64});
+  }
+}
+
+template <typename MapType>
+void Insert(::benchmark::State &state, VMPtr &vm, Keys const &keys)
+{
+  for (auto _ : state)
+  {
+    MapType map{vm.get(), TypeIds::Unknown};
+    Fill(map, keys);
+    ::benchmark::DoNotOptimize(map.Count());
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(keys.size()));
+}
+
+template <typename MapType>
+void Lookup(::benchmark::State &state, VMPtr &vm, Keys const &keys)
+{
+  MapType map{vm.get(), TypeIds::Unknown};
+  Fill(map, keys);
+
+  for (auto _ : state)
+  {
+    int64_t sum = 0;
+    for (auto const &key : keys)
+    {
+      sum += map.GetIndexedValue(key).template Get<int64_t>();
+    }
+    ::benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(keys.size()));
+}
+
+void BM_MapInsertInteger(::benchmark::State &state)
+{
+  VMPtr vm;
+  SetUp(vm);
+  Insert<IntMap>(state, vm, CreateIntegerKeys(state.range(0)));
+}
+
+void BM_MapLookupInteger(::benchmark::State &state)
+{
+  VMPtr vm;
+  SetUp(vm);
+  Lookup<IntMap>(state, vm, CreateIntegerKeys(state.range(0)));
+}
+
+void BM_MapInsertString(::benchmark::State &state)
+{
+  VMPtr vm;
+  SetUp(vm);
+  Insert<StrMap>(state, vm, CreateStringKeys(vm, state.range(0)));
+}
+
+void BM_MapLookupString(::benchmark::State &state)
+{
+  VMPtr vm;
+  SetUp(vm);
+  Lookup<StrMap>(state, vm, CreateStringKeys(vm, state.range(0)));
+}
+
+}  // namespace
+
+// number of entries
+BENCHMARK(BM_MapInsertInteger)->RangeMultiplier(10)->Range(10000, 1000000);
+BENCHMARK(BM_MapLookupInteger)->RangeMultiplier(10)->Range(10000, 1000000);
+BENCHMARK(BM_MapInsertString)->RangeMultiplier(10)->Range(10000, 1000000);
+BENCHMARK(BM_MapLookupString)->RangeMultiplier(10)->Range(10000, 1000000);
+
+}  // namespace map
+}  // namespace benchmark
+}  // namespace vm_modules
@@ -20,6 +20,7 @@
 #include "vectorise/fixed_point/fixed_point.hpp"
 
 #include "vm_modules/math/tensor/tensor.hpp"
+#include "vm_modules/math/tensor/tensor_expression.hpp"
 #include "vm_modules/ml/model/model.hpp"
 #include "vm_modules/ml/model/model_estimator.hpp"
 #include "vm_modules/vm_factory.hpp"
@@ -1342,6 +1343,363 @@ BENCHMARK(BM_ArgMaxNoIndices)->Args({5, 1, 1, 1000000, 1, 1})->Unit(::benchmark:
 BENCHMARK(BM_ArgMaxNoIndices)->Args({5, 1, 1, 1, 1000000, 1})->Unit(::benchmark::kMicrosecond);
 BENCHMARK(BM_ArgMaxNoIndices)->Args({5, 1, 1, 1, 1, 1000000})->Unit(::benchmark::kMicrosecond);
 
+fetch::vm_modules::math::DataType const ZERO{0};
+
+// Element-wise chains of the form `x * w + b` on the tensor sizes typically found in contracts,
+// comparing the allocating operators against the in-place, fused and lazy forms
+
+void BM_ChainAllocating(::benchmark::State &state)
+{
+  using VMPtr = std::shared_ptr<VM>;
+
+  // Get args form state
+  BM_Tensor_config config{state};
+
+  state.counters["Size"] =
+      static_cast<double>(fetch::math::Tensor<float>::SizeFromShape(config.shape));
+
+  VMPtr vm;
+  SetUp(vm);
+
+  auto x = CreateTensor(vm, config.shape);
+  auto w = CreateTensor(vm, config.shape);
+  auto b = CreateTensor(vm, config.shape);
+  x->FillRandom();
+  w->FillRandom();
+  b->FillRandom();
+
+  state.counters["charge"] = static_cast<double>(x->Estimator().MultiplyOperator(w) +
+                                                 x->Estimator().AddOperator(b));
+
+  for (auto _ : state)
+  {
+    auto result = x->MultiplyOperator(w)->AddOperator(b);
+    ::benchmark::DoNotOptimize(result);
+  }
+}
+
+BENCHMARK(BM_ChainAllocating)->Args({1, 16})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_ChainAllocating)->Args({2, 10, 10})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_ChainAllocating)->Args({2, 32, 32})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_ChainAllocating)->Args({2, 784, 1})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_ChainAllocating)->Args({2, 128, 64})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_ChainAllocating)->Args({3, 28, 28, 32})->Unit(::benchmark::kMicrosecond);
+
+void BM_ChainInPlace(::benchmark::State &state)
+{
+  using VMPtr = std::shared_ptr<VM>;
+
+  // Get args form state
+  BM_Tensor_config config{state};
+
+  state.counters["Size"] =
+      static_cast<double>(fetch::math::Tensor<float>::SizeFromShape(config.shape));
+
+  VMPtr vm;
+  SetUp(vm);
+
+  auto x      = CreateTensor(vm, config.shape);
+  auto w      = CreateTensor(vm, config.shape);
+  auto b      = CreateTensor(vm, config.shape);
+  auto result = CreateTensor(vm, config.shape);
+  x->FillRandom();
+  w->FillRandom();
+  b->FillRandom();
+
+  state.counters["charge"] = static_cast<double>(result->Estimator().Fill(ZERO) +
+                                                 result->Estimator().AddInPlace(x) +
+                                                 result->Estimator().MultiplyInPlace(w) +
+                                                 result->Estimator().AddInPlace(b));
+
+  for (auto _ : state)
+  {
+    result->Fill(ZERO);
+    result->AddInPlace(x);
+    result->MultiplyInPlace(w);
+    result->AddInPlace(b);
+  }
+}
+
+BENCHMARK(BM_ChainInPlace)->Args({1, 16})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_ChainInPlace)->Args({2, 10, 10})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_ChainInPlace)->Args({2, 32, 32})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_ChainInPlace)->Args({2, 784, 1})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_ChainInPlace)->Args({2, 128, 64})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_ChainInPlace)->Args({3, 28, 28, 32})->Unit(::benchmark::kMicrosecond);
+
+void BM_ChainMultiplyAdd(::benchmark::State &state)
+{
+  using VMPtr = std::shared_ptr<VM>;
+
+  // Get args form state
+  BM_Tensor_config config{state};
+
+  state.counters["Size"] =
+      static_cast<double>(fetch::math::Tensor<float>::SizeFromShape(config.shape));
+
+  VMPtr vm;
+  SetUp(vm);
+
+  auto x      = CreateTensor(vm, config.shape);
+  auto w      = CreateTensor(vm, config.shape);
+  auto b      = CreateTensor(vm, config.shape);
+  auto result = CreateTensor(vm, config.shape);
+  x->FillRandom();
+  w->FillRandom();
+  b->FillRandom();
+
+  state.counters["charge"] = static_cast<double>(result->Estimator().Fill(ZERO) +
+                                                 result->Estimator().AddInPlace(b) +
+                                                 result->Estimator().MultiplyAdd(x, w));
+
+  for (auto _ : state)
+  {
+    result->Fill(ZERO);
+    result->AddInPlace(b);
+    result->MultiplyAdd(x, w);
+  }
+}
+
+BENCHMARK(BM_ChainMultiplyAdd)->Args({1, 16})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_ChainMultiplyAdd)->Args({2, 10, 10})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_ChainMultiplyAdd)->Args({2, 32, 32})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_ChainMultiplyAdd)->Args({2, 784, 1})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_ChainMultiplyAdd)->Args({2, 128, 64})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_ChainMultiplyAdd)->Args({3, 28, 28, 32})->Unit(::benchmark::kMicrosecond);
+
+void BM_ChainLazy(::benchmark::State &state)
+{
+  using VMPtr = std::shared_ptr<VM>;
+
+  // Get args form state
+  BM_Tensor_config config{state};
+
+  state.counters["Size"] =
+      static_cast<double>(fetch::math::Tensor<float>::SizeFromShape(config.shape));
+
+  VMPtr vm;
+  SetUp(vm);
+
+  auto x      = CreateTensor(vm, config.shape);
+  auto w      = CreateTensor(vm, config.shape);
+  auto b      = CreateTensor(vm, config.shape);
+  auto result = CreateTensor(vm, config.shape);
+  x->FillRandom();
+  w->FillRandom();
+  b->FillRandom();
+
+  state.counters["charge"] =
+      static_cast<double>(result->Estimator().Assign(x->Lazy()->Multiply(w)->Add(b)));
+
+  for (auto _ : state)
+  {
+    result->Assign(x->Lazy()->Multiply(w)->Add(b));
+  }
+}
+
+BENCHMARK(BM_ChainLazy)->Args({1, 16})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_ChainLazy)->Args({2, 10, 10})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_ChainLazy)->Args({2, 32, 32})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_ChainLazy)->Args({2, 784, 1})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_ChainLazy)->Args({2, 128, 64})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_ChainLazy)->Args({3, 28, 28, 32})->Unit(::benchmark::kMicrosecond);
+
+// Single element-wise operations, from which the charges of the in-place, fused and lazy forms are
+// fitted. The allocating add is the reference which relates them to the default charges.
+
+void BM_AddOperator(::benchmark::State &state)
+{
+  using VMPtr = std::shared_ptr<VM>;
+
+  // Get args form state
+  BM_Tensor_config config{state};
+
+  state.counters["PaddedSize"] =
+      static_cast<double>(fetch::math::Tensor<float>::PaddedSizeFromShape(config.shape));
+
+  state.counters["Size"] =
+      static_cast<double>(fetch::math::Tensor<float>::SizeFromShape(config.shape));
+
+  VMPtr vm;
+  SetUp(vm);
+
+  auto x = CreateTensor(vm, config.shape);
+  auto y = CreateTensor(vm, config.shape);
+  x->FillRandom();
+  y->FillRandom();
+
+  state.counters["charge"] = static_cast<double>(x->Estimator().AddOperator(y));
+
+  for (auto _ : state)
+  {
+    auto result = x->AddOperator(y);
+    ::benchmark::DoNotOptimize(result);
+  }
+}
+
+BENCHMARK(BM_AddOperator)->Args({2, 1, 1})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_AddOperator)->Args({2, 10, 10})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_AddOperator)->Args({2, 1000, 1})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_AddOperator)->Args({2, 1, 1000})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_AddOperator)->Args({2, 100, 100})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_AddOperator)->Args({2, 100000, 1})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_AddOperator)->Args({2, 1, 100000})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_AddOperator)->Args({3, 1, 1, 100000})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_AddOperator)->Args({2, 1000, 1000})->Unit(::benchmark::kMicrosecond);
+
+void BM_AddInPlace(::benchmark::State &state)
+{
+  using VMPtr = std::shared_ptr<VM>;
+
+  // Get args form state
+  BM_Tensor_config config{state};
+
+  state.counters["PaddedSize"] =
+      static_cast<double>(fetch::math::Tensor<float>::PaddedSizeFromShape(config.shape));
+
+  state.counters["Size"] =
+      static_cast<double>(fetch::math::Tensor<float>::SizeFromShape(config.shape));
+
+  VMPtr vm;
+  SetUp(vm);
+
+  auto x = CreateTensor(vm, config.shape);
+  auto y = CreateTensor(vm, config.shape);
+  x->FillRandom();
+  y->FillRandom();
+
+  state.counters["charge"] = static_cast<double>(x->Estimator().AddInPlace(y));
+
+  for (auto _ : state)
+  {
+    x->AddInPlace(y);
+  }
+}
+
+BENCHMARK(BM_AddInPlace)->Args({2, 1, 1})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_AddInPlace)->Args({2, 10, 10})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_AddInPlace)->Args({2, 1000, 1})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_AddInPlace)->Args({2, 1, 1000})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_AddInPlace)->Args({2, 100, 100})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_AddInPlace)->Args({2, 100000, 1})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_AddInPlace)->Args({2, 1, 100000})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_AddInPlace)->Args({3, 1, 1, 100000})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_AddInPlace)->Args({2, 1000, 1000})->Unit(::benchmark::kMicrosecond);
+
+void BM_MultiplyAdd(::benchmark::State &state)
+{
+  using VMPtr = std::shared_ptr<VM>;
+
+  // Get args form state
+  BM_Tensor_config config{state};
+
+  state.counters["PaddedSize"] =
+      static_cast<double>(fetch::math::Tensor<float>::PaddedSizeFromShape(config.shape));
+
+  state.counters["Size"] =
+      static_cast<double>(fetch::math::Tensor<float>::SizeFromShape(config.shape));
+
+  VMPtr vm;
+  SetUp(vm);
+
+  auto x = CreateTensor(vm, config.shape);
+  auto a = CreateTensor(vm, config.shape);
+  auto b = CreateTensor(vm, config.shape);
+  a->FillRandom();
+  b->FillRandom();
+
+  state.counters["charge"] = static_cast<double>(x->Estimator().MultiplyAdd(a, b));
+
+  for (auto _ : state)
+  {
+    x->MultiplyAdd(a, b);
+  }
+}
+
+BENCHMARK(BM_MultiplyAdd)->Args({2, 1, 1})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_MultiplyAdd)->Args({2, 10, 10})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_MultiplyAdd)->Args({2, 1000, 1})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_MultiplyAdd)->Args({2, 1, 1000})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_MultiplyAdd)->Args({2, 100, 100})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_MultiplyAdd)->Args({2, 100000, 1})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_MultiplyAdd)->Args({2, 1, 100000})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_MultiplyAdd)->Args({3, 1, 1, 100000})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_MultiplyAdd)->Args({2, 1000, 1000})->Unit(::benchmark::kMicrosecond);
+
+struct BM_Assign_config
+{
+  using SizeType = fetch::math::SizeType;
+
+  explicit BM_Assign_config(::benchmark::State const &state)
+  {
+    operations    = static_cast<SizeType>(state.range(0));
+    auto size_len = static_cast<SizeType>(state.range(1));
+
+    shape.reserve(size_len);
+    for (SizeType i{0}; i < size_len; ++i)
+    {
+      shape.emplace_back(static_cast<SizeType>(state.range(2 + i)));
+    }
+  }
+
+  SizeType              operations;  // number of operations recorded in the expression
+  std::vector<SizeType> shape;
+};
+
+void BM_Assign(::benchmark::State &state)
+{
+  using VMPtr = std::shared_ptr<VM>;
+
+  // Get args form state
+  BM_Assign_config config{state};
+
+  state.counters["PaddedSize"] =
+      static_cast<double>(fetch::math::Tensor<float>::PaddedSizeFromShape(config.shape));
+
+  state.counters["Size"] =
+      static_cast<double>(fetch::math::Tensor<float>::SizeFromShape(config.shape));
+
+  state.counters["Operations"] = static_cast<double>(config.operations);
+
+  VMPtr vm;
+  SetUp(vm);
+
+  auto x      = CreateTensor(vm, config.shape);
+  auto w      = CreateTensor(vm, config.shape);
+  auto result = CreateTensor(vm, config.shape);
+  x->FillRandom();
+  w->FillRandom();
+
+  auto expression = x->Lazy();
+  for (fetch::math::SizeType i{0}; i < config.operations; ++i)
+  {
+    expression = (i % 2 == 0) ? expression->Multiply(w) : expression->Add(w);
+  }
+
+  state.counters["charge"] = static_cast<double>(result->Estimator().Assign(expression));
+
+  for (auto _ : state)
+  {
+    result->Assign(expression);
+  }
+}
+
+BENCHMARK(BM_Assign)->Args({1, 2, 1, 1})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_Assign)->Args({1, 2, 100, 100})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_Assign)->Args({1, 2, 1, 100000})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_Assign)->Args({1, 2, 100000, 1})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_Assign)->Args({1, 2, 1000, 1000})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_Assign)->Args({2, 2, 100, 100})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_Assign)->Args({2, 2, 1, 100000})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_Assign)->Args({2, 2, 1000, 1000})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_Assign)->Args({4, 2, 1, 1})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_Assign)->Args({4, 2, 100, 100})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_Assign)->Args({4, 2, 100000, 1})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_Assign)->Args({4, 2, 1000, 1000})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_Assign)->Args({8, 2, 100, 100})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_Assign)->Args({8, 2, 1, 100000})->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_Assign)->Args({8, 2, 1000, 1000})->Unit(::benchmark::kMicrosecond);
+
 }  // namespace tensor
 }  // namespace ml
 }  // namespace benchmark
@@ -41,6 +41,8 @@ struct Array;
 namespace vm_modules {
 namespace math {
 
+class VMTensorExpression;
+
 class VMTensor : public fetch::vm::Object
 {
 public:
@@ -143,6 +145,26 @@ public:
 
   void InplaceDivide(vm::Ptr<Object> const &lhso, vm::Ptr<Object> const &rhso) override;
 
+  ////////////////////////////////////
+  /// IN-PLACE AND FUSED ARITHMETIC ///
+  ////////////////////////////////////
+
+  void AddInPlace(vm::Ptr<VMTensor> const &other);
+
+  void SubtractInPlace(vm::Ptr<VMTensor> const &other);
+
+  void MultiplyInPlace(vm::Ptr<VMTensor> const &other);
+
+  void DivideInPlace(vm::Ptr<VMTensor> const &other);
+
+  void MultiplyAdd(vm::Ptr<VMTensor> const &lhs, vm::Ptr<VMTensor> const &rhs);
+
+  void MultiplyAddScalar(DataType const &alpha, vm::Ptr<VMTensor> const &other);
+
+  vm::Ptr<VMTensorExpression> Lazy();
+
+  void Assign(vm::Ptr<VMTensorExpression> const &expression);
+
   /////////////////////////
   /// MATRIX OPERATIONS ///
   /////////////////////////
@@ -180,6 +202,8 @@ public:
   static const std::size_t RECTANGULAR_SHAPE_SIZE = 2;
 
 private:
+  bool IsSameShape(vm::Ptr<VMTensor> const &other, char const *operation);
+
   TensorType      tensor_;
   TensorEstimator estimator_;
 };
@@ -41,6 +41,7 @@ namespace vm_modules {
 namespace math {
 
 class VMTensor;
+class VMTensorExpression;
 
 class TensorEstimator
 {
@@ -136,6 +137,24 @@ public:
 
   /// END OF OPERATORS ///
 
+  /// IN-PLACE AND FUSED ARITHMETIC ///
+
+  ChargeAmount AddInPlace(vm::Ptr<VMTensor> const &other);
+
+  ChargeAmount SubtractInPlace(vm::Ptr<VMTensor> const &other);
+
+  ChargeAmount MultiplyInPlace(vm::Ptr<VMTensor> const &other);
+
+  ChargeAmount DivideInPlace(vm::Ptr<VMTensor> const &other);
+
+  ChargeAmount MultiplyAdd(vm::Ptr<VMTensor> const &lhs, vm::Ptr<VMTensor> const &rhs);
+
+  ChargeAmount MultiplyAddScalar(DataType const &alpha, vm::Ptr<VMTensor> const &other);
+
+  ChargeAmount Lazy();
+
+  ChargeAmount Assign(vm::Ptr<VMTensorExpression> const &expression);
+
   ChargeAmount GetReshapeCost(SizeVector const &new_shape);
 
   ChargeAmount Transpose();
@@ -185,6 +204,22 @@ public:
   static const fixed_point::fp64_t TO_STRING_SIZE_COEF;
   static const fixed_point::fp64_t TO_STRING_CONST_COEF;
 
+  // IN_PLACE
+  static const fixed_point::fp64_t IN_PLACE_PADDED_SIZE_COEF;
+  static const fixed_point::fp64_t IN_PLACE_SIZE_COEF;
+  static const fixed_point::fp64_t IN_PLACE_CONST_COEF;
+
+  // MULTIPLY_ADD
+  static const fixed_point::fp64_t MULTIPLY_ADD_PADDED_SIZE_COEF;
+  static const fixed_point::fp64_t MULTIPLY_ADD_SIZE_COEF;
+  static const fixed_point::fp64_t MULTIPLY_ADD_CONST_COEF;
+
+  // ASSIGN (expression evaluation, the per element cost grows with each recorded operation)
+  static const fixed_point::fp64_t ASSIGN_PADDED_SIZE_COEF;
+  static const fixed_point::fp64_t ASSIGN_SIZE_COEF;
+  static const fixed_point::fp64_t ASSIGN_OPERATION_SIZE_COEF;
+  static const fixed_point::fp64_t ASSIGN_CONST_COEF;
+
   static const fixed_point::fp64_t DEFAULT_PADDED_SIZE_COEF;
   static const fixed_point::fp64_t DEFAULT_SIZE_COEF;
   static const fixed_point::fp64_t DEFAULT_CONST_COEF;
@@ -197,6 +232,8 @@ private:
 
   static ChargeAmount MaximumCharge(std::string const &log_msg = "");
 
+  ChargeAmount GetInPlaceCost();
+
   VMObjectType &tensor_;
 };
 
@@ -0,0 +1,117 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "math/tensor.hpp"
+#include "vm/common.hpp"
+#include "vm/object.hpp"
+#include "vm_modules/math/tensor/tensor.hpp"
+#include "vm_modules/math/type.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace fetch {
+
+namespace vm {
+class Module;
+}  // namespace vm
+
+namespace vm_modules {
+namespace math {
+
+/**
+ * A deferred chain of element-wise operations applied to a source tensor.
+ *
+ * Contracts build an expression with `tensor.lazy()` followed by any number of chained arithmetic
+ * calls, e.g. `x.lazy().multiply(w).add(b)`, and nothing is computed until the expression is
+ * assigned to a tensor with `result.assign(expression)`. At that point every operation is applied
+ * in a single pass over the data, without allocating any intermediate tensors.
+ *
+ * Every chained call returns a new expression and leaves the one it was called on unchanged, so
+ * `var e2 = e.add(b)` does not alter `e`.
+ *
+ * Operand tensors are captured by reference, so the values used are those held at the point of
+ * assignment rather than at the point the expression was built.
+ */
+class VMTensorExpression : public fetch::vm::Object
+{
+public:
+  using DataType   = fetch::vm_modules::math::DataType;
+  using TensorType = typename fetch::math::Tensor<DataType>;
+
+  enum class Operation : uint8_t
+  {
+    ADD,
+    SUBTRACT,
+    MULTIPLY,
+    DIVIDE
+  };
+
+  VMTensorExpression(fetch::vm::VM *vm, fetch::vm::TypeId type_id,
+                     fetch::vm::Ptr<VMTensor> source);
+
+  static void Bind(fetch::vm::Module &module);
+
+  /// @name Building
+  /// @{
+  fetch::vm::Ptr<VMTensorExpression> Add(fetch::vm::Ptr<VMTensor> const &other);
+  fetch::vm::Ptr<VMTensorExpression> AddScalar(DataType const &scalar);
+  fetch::vm::Ptr<VMTensorExpression> Subtract(fetch::vm::Ptr<VMTensor> const &other);
+  fetch::vm::Ptr<VMTensorExpression> SubtractScalar(DataType const &scalar);
+  fetch::vm::Ptr<VMTensorExpression> Multiply(fetch::vm::Ptr<VMTensor> const &other);
+  fetch::vm::Ptr<VMTensorExpression> MultiplyScalar(DataType const &scalar);
+  fetch::vm::Ptr<VMTensorExpression> Divide(fetch::vm::Ptr<VMTensor> const &other);
+  fetch::vm::Ptr<VMTensorExpression> DivideScalar(DataType const &scalar);
+  /// @}
+
+  /// @name Evaluation
+  /// @{
+  bool Evaluate(TensorType &output);
+  /// @}
+
+  std::size_t size() const;
+
+  // Charge for recording a single operation, independent of the size of the operands
+  static constexpr fetch::vm::ChargeAmount RECORD_CHARGE = 5 * fetch::vm::COMPUTE_CHARGE_COST;
+
+  // Charge for each of the operations already recorded, which are copied into the new expression
+  static constexpr fetch::vm::ChargeAmount RECORD_STEP_CHARGE = fetch::vm::COMPUTE_CHARGE_COST;
+
+private:
+  struct Step
+  {
+    Operation                op;
+    fetch::vm::Ptr<VMTensor> operand;  ///< The tensor operand, null when the operand is a scalar
+    DataType                 scalar;
+  };
+
+  using Steps = std::vector<Step>;
+
+  fetch::vm::Ptr<VMTensorExpression> Record(Operation op, fetch::vm::Ptr<VMTensor> const &operand,
+                                            DataType const &scalar);
+  fetch::vm::Ptr<VMTensorExpression> RecordTensor(Operation                       op,
+                                                  fetch::vm::Ptr<VMTensor> const &operand);
+
+  fetch::vm::Ptr<VMTensor> source_;
+  Steps                    steps_;
+};
+
+}  // namespace math
+}  // namespace vm_modules
+}  // namespace fetch
@@ -23,6 +23,7 @@
 #include "vm/object.hpp"
 #include "vm_modules/math/tensor/tensor.hpp"
 #include "vm_modules/math/tensor/tensor_estimator.hpp"
+#include "vm_modules/math/tensor/tensor_expression.hpp"
 #include "vm_modules/math/type.hpp"
 #include "vm_modules/use_estimator.hpp"
 
@@ -121,6 +122,18 @@ void VMTensor::Bind(Module &module, bool const enable_experimental)
                                 UseEstimator(&TensorEstimator::MultiplyOperator))
           .CreateMemberFunction("divide", &VMTensor::DivideOperator,
                                 UseEstimator(&TensorEstimator::DivideOperator))
+          .CreateMemberFunction("addInPlace", &VMTensor::AddInPlace,
+                                UseEstimator(&TensorEstimator::AddInPlace))
+          .CreateMemberFunction("subtractInPlace", &VMTensor::SubtractInPlace,
+                                UseEstimator(&TensorEstimator::SubtractInPlace))
+          .CreateMemberFunction("multiplyInPlace", &VMTensor::MultiplyInPlace,
+                                UseEstimator(&TensorEstimator::MultiplyInPlace))
+          .CreateMemberFunction("divideInPlace", &VMTensor::DivideInPlace,
+                                UseEstimator(&TensorEstimator::DivideInPlace))
+          .CreateMemberFunction("multiplyAdd", &VMTensor::MultiplyAdd,
+                                UseEstimator(&TensorEstimator::MultiplyAdd))
+          .CreateMemberFunction("multiplyAdd", &VMTensor::MultiplyAddScalar,
+                                UseEstimator(&TensorEstimator::MultiplyAddScalar))
           //          .EnableOperator(Operator::Negate)
           //          .EnableOperator(Operator::Equal)
           //          .EnableOperator(Operator::NotEqual)
@@ -141,6 +154,13 @@ void VMTensor::Bind(Module &module, bool const enable_experimental)
           .CreateMemberFunction("toString", &VMTensor::ToString,
                                 UseEstimator(&TensorEstimator::ToString));
 
+  // the expression type refers to tensors, and tensors to expressions, so the tensor members which
+  // use expressions are only bound once both types exist
+  VMTensorExpression::Bind(module);
+
+  interface.CreateMemberFunction("lazy", &VMTensor::Lazy, UseEstimator(&TensorEstimator::Lazy))
+      .CreateMemberFunction("assign", &VMTensor::Assign, UseEstimator(&TensorEstimator::Assign));
+
   if (enable_experimental)
   {
     // no tensor features are experimental
@@ -420,6 +440,110 @@ void VMTensor::InplaceDivide(vm::Ptr<Object> const &lhso, vm::Ptr<Object> const
   left->GetTensor().InlineDivide(right->GetTensor());
 }
 
+////////////////////////////////////
+/// IN-PLACE AND FUSED ARITHMETIC ///
+////////////////////////////////////
+
+void VMTensor::AddInPlace(vm::Ptr<VMTensor> const &other)
+{
+  if (IsSameShape(other, "addInPlace"))
+  {
+    fetch::math::Add(tensor_, other->GetTensor(), tensor_);
+  }
+}
+
+void VMTensor::SubtractInPlace(vm::Ptr<VMTensor> const &other)
+{
+  if (IsSameShape(other, "subtractInPlace"))
+  {
+    fetch::math::Subtract(tensor_, other->GetTensor(), tensor_);
+  }
+}
+
+void VMTensor::MultiplyInPlace(vm::Ptr<VMTensor> const &other)
+{
+  if (IsSameShape(other, "multiplyInPlace"))
+  {
+    fetch::math::Multiply(tensor_, other->GetTensor(), tensor_);
+  }
+}
+
+void VMTensor::DivideInPlace(vm::Ptr<VMTensor> const &other)
+{
+  if (IsSameShape(other, "divideInPlace"))
+  {
+    fetch::math::Divide(tensor_, other->GetTensor(), tensor_);
+  }
+}
+
+/**
+ * Fused multiply-add, this += lhs * rhs (element-wise), computed in a single pass
+ */
+void VMTensor::MultiplyAdd(vm::Ptr<VMTensor> const &lhs, vm::Ptr<VMTensor> const &rhs)
+{
+  if (!IsSameShape(lhs, "multiplyAdd") || !IsSameShape(rhs, "multiplyAdd"))
+  {
+    return;
+  }
+
+  auto lhs_it = lhs->GetConstTensor().cbegin();
+  auto rhs_it = rhs->GetConstTensor().cbegin();
+  auto it     = tensor_.begin();
+  while (it.is_valid())
+  {
+    *it += (*lhs_it) * (*rhs_it);
+    ++lhs_it;
+    ++rhs_it;
+    ++it;
+  }
+}
+
+/**
+ * Scaled add, this += alpha * other (element-wise), computed in a single pass
+ */
+void VMTensor::MultiplyAddScalar(DataType const &alpha, vm::Ptr<VMTensor> const &other)
+{
+  if (!IsSameShape(other, "multiplyAdd"))
+  {
+    return;
+  }
+
+  auto other_it = other->GetConstTensor().cbegin();
+  auto it       = tensor_.begin();
+  while (it.is_valid())
+  {
+    *it += alpha * (*other_it);
+    ++other_it;
+    ++it;
+  }
+}
+
+vm::Ptr<VMTensorExpression> VMTensor::Lazy()
+{
+  return vm_->CreateNewObject<VMTensorExpression>(Ptr<VMTensor>::PtrFromThis(this));
+}
+
+void VMTensor::Assign(vm::Ptr<VMTensorExpression> const &expression)
+{
+  if (!expression)
+  {
+    RuntimeError("Unable to assign tensor expression: expression is null");
+    return;
+  }
+
+  expression->Evaluate(tensor_);
+}
+
+bool VMTensor::IsSameShape(vm::Ptr<VMTensor> const &other, char const *operation)
+{
+  if (other->shape() != shape())
+  {
+    RuntimeError("Tensor shape mismatch in " + std::string(operation) + "!");
+    return false;
+  }
+  return true;
+}
+
 /////////////////////////
 /// MATRIX OPERATIONS ///
 /////////////////////////
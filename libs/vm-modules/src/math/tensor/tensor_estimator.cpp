@@ -22,6 +22,7 @@
 #include "vm/object.hpp"
 #include "vm_modules/math/tensor/tensor.hpp"
 #include "vm_modules/math/tensor/tensor_estimator.hpp"
+#include "vm_modules/math/tensor/tensor_expression.hpp"
 #include "vm_modules/math/type.hpp"
 #include "vm_modules/use_estimator.hpp"
 
@@ -411,6 +412,84 @@ ChargeAmount TensorEstimator::InplaceDivide()
 
 /// END OF OPERATORS ///
 
+/// IN-PLACE AND FUSED ARITHMETIC ///
+
+ChargeAmount TensorEstimator::AddInPlace(vm::Ptr<VMTensor> const & /*other*/)
+{
+  return GetInPlaceCost();
+}
+
+ChargeAmount TensorEstimator::SubtractInPlace(vm::Ptr<VMTensor> const & /*other*/)
+{
+  return GetInPlaceCost();
+}
+
+ChargeAmount TensorEstimator::MultiplyInPlace(vm::Ptr<VMTensor> const & /*other*/)
+{
+  return GetInPlaceCost();
+}
+
+ChargeAmount TensorEstimator::DivideInPlace(vm::Ptr<VMTensor> const & /*other*/)
+{
+  return GetInPlaceCost();
+}
+
+ChargeAmount TensorEstimator::MultiplyAdd(vm::Ptr<VMTensor> const & /*lhs*/,
+                                          vm::Ptr<VMTensor> const & /*rhs*/)
+{
+  SizeType padded_size = fetch::math::Tensor<DataType>::PaddedSizeFromShape(tensor_.shape());
+  SizeType size        = fetch::math::Tensor<DataType>::SizeFromShape(tensor_.shape());
+
+  return static_cast<ChargeAmount>(MULTIPLY_ADD_PADDED_SIZE_COEF * padded_size +
+                                   MULTIPLY_ADD_SIZE_COEF * size + MULTIPLY_ADD_CONST_COEF) *
+         COMPUTE_CHARGE_COST;
+}
+
+ChargeAmount TensorEstimator::MultiplyAddScalar(DataType const & /*alpha*/,
+                                                vm::Ptr<VMTensor> const & /*other*/)
+{
+  SizeType padded_size = fetch::math::Tensor<DataType>::PaddedSizeFromShape(tensor_.shape());
+  SizeType size        = fetch::math::Tensor<DataType>::SizeFromShape(tensor_.shape());
+
+  return static_cast<ChargeAmount>(MULTIPLY_ADD_PADDED_SIZE_COEF * padded_size +
+                                   MULTIPLY_ADD_SIZE_COEF * size + MULTIPLY_ADD_CONST_COEF) *
+         COMPUTE_CHARGE_COST;
+}
+
+ChargeAmount TensorEstimator::Lazy()
+{
+  return LOW_CHARGE;
+}
+
+ChargeAmount TensorEstimator::Assign(vm::Ptr<VMTensorExpression> const &expression)
+{
+  // a null expression is reported by the assignment itself
+  if (!expression)
+  {
+    return LOW_CHARGE;
+  }
+
+  SizeType padded_size = fetch::math::Tensor<DataType>::PaddedSizeFromShape(tensor_.shape());
+  SizeType size        = fetch::math::Tensor<DataType>::SizeFromShape(tensor_.shape());
+  SizeType operations  = static_cast<SizeType>(expression->size());
+
+  return static_cast<ChargeAmount>(ASSIGN_PADDED_SIZE_COEF * padded_size +
+                                   ASSIGN_SIZE_COEF * size +
+                                   ASSIGN_OPERATION_SIZE_COEF * operations * size +
+                                   ASSIGN_CONST_COEF) *
+         COMPUTE_CHARGE_COST;
+}
+
+ChargeAmount TensorEstimator::GetInPlaceCost()
+{
+  SizeType padded_size = fetch::math::Tensor<DataType>::PaddedSizeFromShape(tensor_.shape());
+  SizeType size        = fetch::math::Tensor<DataType>::SizeFromShape(tensor_.shape());
+
+  return static_cast<ChargeAmount>(IN_PLACE_PADDED_SIZE_COEF * padded_size +
+                                   IN_PLACE_SIZE_COEF * size + IN_PLACE_CONST_COEF) *
+         COMPUTE_CHARGE_COST;
+}
+
 ChargeAmount TensorEstimator::Transpose()
 {
   if (tensor_.shape().size() != 2)
@@ -496,6 +575,27 @@ fixed_point::fp64_t const TensorEstimator::TO_STRING_PADDED_SIZE_COEF =
 fixed_point::fp64_t const TensorEstimator::TO_STRING_SIZE_COEF  = fixed_point::fp64_t("0.00107809");
 fixed_point::fp64_t const TensorEstimator::TO_STRING_CONST_COEF = fixed_point::fp64_t("5");
 
+// IN_PLACE
+fixed_point::fp64_t const TensorEstimator::IN_PLACE_PADDED_SIZE_COEF =
+    fixed_point::fp64_t("0.00007378");
+fixed_point::fp64_t const TensorEstimator::IN_PLACE_SIZE_COEF  = fixed_point::fp64_t("0.00112457");
+fixed_point::fp64_t const TensorEstimator::IN_PLACE_CONST_COEF = fixed_point::fp64_t("5");
+
+// MULTIPLY_ADD
+fixed_point::fp64_t const TensorEstimator::MULTIPLY_ADD_PADDED_SIZE_COEF =
+    fixed_point::fp64_t("0.00008738");
+fixed_point::fp64_t const TensorEstimator::MULTIPLY_ADD_SIZE_COEF =
+    fixed_point::fp64_t("0.00196275");
+fixed_point::fp64_t const TensorEstimator::MULTIPLY_ADD_CONST_COEF = fixed_point::fp64_t("5");
+
+// ASSIGN
+fixed_point::fp64_t const TensorEstimator::ASSIGN_PADDED_SIZE_COEF =
+    fixed_point::fp64_t("0.00070728");
+fixed_point::fp64_t const TensorEstimator::ASSIGN_SIZE_COEF = fixed_point::fp64_t("0.00042130");
+fixed_point::fp64_t const TensorEstimator::ASSIGN_OPERATION_SIZE_COEF =
+    fixed_point::fp64_t("0.00184926");
+fixed_point::fp64_t const TensorEstimator::ASSIGN_CONST_COEF = fixed_point::fp64_t("5");
+
 // DEFAULT
 fixed_point::fp64_t const TensorEstimator::DEFAULT_PADDED_SIZE_COEF =
     fixed_point::fp64_t("0.00023451");
@@ -0,0 +1,247 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "math/tensor.hpp"
+#include "vm/module.hpp"
+#include "vm/object.hpp"
+#include "vm_modules/math/tensor/tensor.hpp"
+#include "vm_modules/math/tensor/tensor_expression.hpp"
+#include "vm_modules/math/type.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+using namespace fetch::vm;
+
+namespace fetch {
+namespace vm_modules {
+namespace math {
+
+using TensorType        = VMTensorExpression::TensorType;
+using ConstIteratorType = TensorType::ConstIteratorType;
+
+constexpr ChargeAmount VMTensorExpression::RECORD_CHARGE;
+constexpr ChargeAmount VMTensorExpression::RECORD_STEP_CHARGE;
+
+namespace {
+
+/**
+ * The charge for chaining an operation onto an expression. Every chained call copies the
+ * operations recorded so far, so the charge grows with the length of the expression.
+ */
+ChargeAmount RecordCharge(Ptr<VMTensorExpression> const &expression)
+{
+  return VMTensorExpression::RECORD_CHARGE +
+         (static_cast<ChargeAmount>(expression->size()) * VMTensorExpression::RECORD_STEP_CHARGE);
+}
+
+ChargeAmount RecordTensorCharge(Ptr<VMTensorExpression> const &expression,
+                                Ptr<VMTensor> const & /*other*/)
+{
+  return RecordCharge(expression);
+}
+
+ChargeAmount RecordScalarCharge(Ptr<VMTensorExpression> const &expression,
+                                VMTensorExpression::DataType const & /*scalar*/)
+{
+  return RecordCharge(expression);
+}
+
+}  // namespace
+
+VMTensorExpression::VMTensorExpression(VM *vm, TypeId type_id, Ptr<VMTensor> source)
+  : Object(vm, type_id)
+  , source_(std::move(source))
+{}
+
+void VMTensorExpression::Bind(Module &module)
+{
+  module.CreateClassType<VMTensorExpression>("TensorExpression")
+      .CreateMemberFunction("add", &VMTensorExpression::Add, &RecordTensorCharge)
+      .CreateMemberFunction("add", &VMTensorExpression::AddScalar, &RecordScalarCharge)
+      .CreateMemberFunction("subtract", &VMTensorExpression::Subtract, &RecordTensorCharge)
+      .CreateMemberFunction("subtract", &VMTensorExpression::SubtractScalar, &RecordScalarCharge)
+      .CreateMemberFunction("multiply", &VMTensorExpression::Multiply, &RecordTensorCharge)
+      .CreateMemberFunction("multiply", &VMTensorExpression::MultiplyScalar, &RecordScalarCharge)
+      .CreateMemberFunction("divide", &VMTensorExpression::Divide, &RecordTensorCharge)
+      .CreateMemberFunction("divide", &VMTensorExpression::DivideScalar, &RecordScalarCharge);
+}
+
+Ptr<VMTensorExpression> VMTensorExpression::Add(Ptr<VMTensor> const &other)
+{
+  return RecordTensor(Operation::ADD, other);
+}
+
+Ptr<VMTensorExpression> VMTensorExpression::AddScalar(DataType const &scalar)
+{
+  return Record(Operation::ADD, {}, scalar);
+}
+
+Ptr<VMTensorExpression> VMTensorExpression::Subtract(Ptr<VMTensor> const &other)
+{
+  return RecordTensor(Operation::SUBTRACT, other);
+}
+
+Ptr<VMTensorExpression> VMTensorExpression::SubtractScalar(DataType const &scalar)
+{
+  return Record(Operation::SUBTRACT, {}, scalar);
+}
+
+Ptr<VMTensorExpression> VMTensorExpression::Multiply(Ptr<VMTensor> const &other)
+{
+  return RecordTensor(Operation::MULTIPLY, other);
+}
+
+Ptr<VMTensorExpression> VMTensorExpression::MultiplyScalar(DataType const &scalar)
+{
+  return Record(Operation::MULTIPLY, {}, scalar);
+}
+
+Ptr<VMTensorExpression> VMTensorExpression::Divide(Ptr<VMTensor> const &other)
+{
+  return RecordTensor(Operation::DIVIDE, other);
+}
+
+Ptr<VMTensorExpression> VMTensorExpression::DivideScalar(DataType const &scalar)
+{
+  return Record(Operation::DIVIDE, {}, scalar);
+}
+
+/**
+ * Evaluate the expression into the output tensor in a single pass. The source tensor, every tensor
+ * operand and the output must all have the same shape. The output may also appear in the
+ * expression, since each element is read from all of the operands before it is written.
+ *
+ * @param output The tensor to be populated
+ * @return true if successful, otherwise false
+ */
+bool VMTensorExpression::Evaluate(TensorType &output)
+{
+  if (!source_)
+  {
+    RuntimeError("Unable to evaluate tensor expression: no source tensor");
+    return false;
+  }
+
+  if (source_->shape() != output.shape())
+  {
+    RuntimeError("Unable to evaluate tensor expression: source and output shapes differ");
+    return false;
+  }
+
+  std::vector<ConstIteratorType> operands;
+  operands.reserve(steps_.size());
+
+  for (auto const &step : steps_)
+  {
+    if (step.operand)
+    {
+      TensorType const &operand = step.operand->GetConstTensor();
+
+      if (operand.shape() != output.shape())
+      {
+        RuntimeError("Unable to evaluate tensor expression: operand and output shapes differ");
+        return false;
+      }
+
+      operands.emplace_back(operand.cbegin());
+    }
+  }
+
+  auto source_it = source_->GetConstTensor().cbegin();
+  auto output_it = output.begin();
+
+  while (output_it.is_valid())
+  {
+    DataType    value = *source_it;
+    std::size_t index{0};
+
+    for (auto const &step : steps_)
+    {
+      DataType const &operand = step.operand ? *operands[index++] : step.scalar;
+
+      switch (step.op)
+      {
+      case Operation::ADD:
+        value += operand;
+        break;
+      case Operation::SUBTRACT:
+        value -= operand;
+        break;
+      case Operation::MULTIPLY:
+        value *= operand;
+        break;
+      case Operation::DIVIDE:
+        value /= operand;
+        break;
+      }
+    }
+
+    *output_it = value;
+
+    ++source_it;
+    ++output_it;
+    for (auto &operand_it : operands)
+    {
+      ++operand_it;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Get the number of operations recorded in the expression
+ *
+ * @return The number of operations
+ */
+std::size_t VMTensorExpression::size() const
+{
+  return steps_.size();
+}
+
+/**
+ * Create a new expression made of the operations of this one followed by another operation. This
+ * expression is left unchanged, so that it can be shared by several expressions.
+ */
+Ptr<VMTensorExpression> VMTensorExpression::Record(Operation op, Ptr<VMTensor> const &operand,
+                                                   DataType const &scalar)
+{
+  auto expression = vm_->CreateNewObject<VMTensorExpression>(source_);
+  expression->steps_.reserve(steps_.size() + 1);
+  expression->steps_ = steps_;
+  expression->steps_.emplace_back(Step{op, operand, scalar});
+
+  return expression;
+}
+
+Ptr<VMTensorExpression> VMTensorExpression::RecordTensor(Operation op, Ptr<VMTensor> const &operand)
+{
+  if (!operand)
+  {
+    RuntimeError("Unable to build tensor expression: operand tensor is null");
+    return {};
+  }
+
+  return Record(op, operand, DataType{0});
+}
+
+}  // namespace math
+}  // namespace vm_modules
+}  // namespace fetch
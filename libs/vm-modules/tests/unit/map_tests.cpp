@@ -0,0 +1,210 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vm/map.hpp"
+#include "vm_test_toolkit.hpp"
+
+#include "gmock/gmock.h"
+
+#include <cstdint>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+using namespace fetch::vm;
+
+namespace {
+
+class MapTests : public ::testing::Test
+{
+public:
+  std::stringstream stdout;
+  VmTestToolkit     toolkit{&stdout};
+};
+
+TEST_F(MapTests, integer_keys_are_inserted_and_found)
+{
+  static char const *TEXT = R"(
+    function main()
+      var map = Map<Int64, Int32>();
+      for (i in 0:5000)
+        map[toInt64(i) * 1024i64] = i;
+      endfor
+      var sum = 0i64;
+      for (i in 0:5000)
+        sum += toInt64(map[toInt64(i) * 1024i64]);
+      endfor
+      printLn(map.count());
+      printLn(sum);
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+  ASSERT_TRUE(toolkit.Run());
+  EXPECT_EQ(stdout.str(), "5000\n12497500\n");
+}
+
+TEST_F(MapTests, existing_keys_are_overwritten)
+{
+  static char const *TEXT = R"(
+    function main()
+      var map = Map<Fixed64, Bool>();
+      map[1.5fp64] = false;
+      map[2.5fp64] = false;
+      map[1.5fp64] = true;
+      printLn(map.count());
+      printLn(map[1.5fp64]);
+      printLn(map[2.5fp64]);
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+  ASSERT_TRUE(toolkit.Run());
+  EXPECT_EQ(stdout.str(), "2\ntrue\nfalse\n");
+}
+
+TEST_F(MapTests, string_keys_are_compared_by_value)
+{
+  static char const *TEXT = R"(
+    function main()
+      var map = Map<String, Int32>();
+      for (i in 0:1000)
+        map["key" + toString(i)] = i;
+      endfor
+      var key = "ke" + "y999";
+      printLn(map.count());
+      printLn(map[key]);
+      printLn(map["key" + toString(500)]);
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+  ASSERT_TRUE(toolkit.Run());
+  EXPECT_EQ(stdout.str(), "1000\n999\n500\n");
+}
+
+TEST_F(MapTests, missing_key_is_a_runtime_error)
+{
+  static char const *TEXT = R"(
+    function main()
+      var map = Map<Int32, Int32>();
+      map[1] = 1;
+      printLn(map[2]);
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+  EXPECT_FALSE(toolkit.Run());
+}
+
+TEST_F(MapTests, entries_survive_a_round_trip_through_state)
+{
+  static char const *ser_src = R"(
+    function main()
+      var map = Map<String, Int32>();
+      for (i in 0:200)
+        map[toString(i)] = i * i;
+      endfor
+      State<Map<String, Int32>>("map").set(map);
+    endfunction
+  )";
+
+  EXPECT_CALL(toolkit.observer(), Write("map", _, _));
+
+  ASSERT_TRUE(toolkit.Compile(ser_src));
+  ASSERT_TRUE(toolkit.Run());
+
+  static char const *deser_src = R"(
+    function main()
+      var map = State<Map<String, Int32>>("map").get(Map<String, Int32>());
+      var sum = 0;
+      for (i in 0:200)
+        sum += map[toString(i)];
+      endfor
+      printLn(map.count());
+      printLn(sum);
+    endfunction
+  )";
+
+  EXPECT_CALL(toolkit.observer(), Exists("map"));
+  EXPECT_CALL(toolkit.observer(), Read("map", _, _)).Times(testing::AtLeast(1));
+
+  ASSERT_TRUE(toolkit.Compile(deser_src));
+  ASSERT_TRUE(toolkit.Run());
+  EXPECT_EQ(stdout.str(), "200\n2646700\n");
+}
+
+TEST(FlatMapTests, entries_are_iterated_in_insertion_order)
+{
+  FlatMap<int32_t>     map;
+  std::vector<int32_t> keys;
+  for (int32_t i = 0; i < 1000; ++i)
+  {
+    int32_t const key = (i * 7919) % 1009;
+    keys.push_back(key);
+    map.Set(key, TemplateParameter2{i, TypeIds::Int32});
+  }
+
+  ASSERT_EQ(map.size(), keys.size());
+
+  std::size_t index = 0;
+  for (auto const &entry : map)
+  {
+    EXPECT_EQ(entry.key, keys[index]);
+    EXPECT_EQ(entry.value.Get<int32_t>(), static_cast<int32_t>(index));
+    ++index;
+  }
+}
+
+TEST(FlatMapTests, entries_are_serialised_in_unordered_map_order)
+{
+  FlatMap<int64_t>                  map;
+  std::unordered_map<int64_t, bool> reference;
+  for (int64_t i = 0; i < 1000; ++i)
+  {
+    int64_t const key = (i * 7919) % 1009;
+    map.Set(key, TemplateParameter2{i, TypeIds::Int64});
+    reference[key] = true;
+  }
+
+  auto const order = map.SerialisationOrder();
+  ASSERT_EQ(order.size(), reference.size());
+
+  auto it = reference.begin();
+  for (auto const *entry : order)
+  {
+    EXPECT_EQ(entry->key, it->first);
+    ++it;
+  }
+}
+
+TEST(FlatMapTests, insert_does_not_replace_existing_values)
+{
+  FlatMap<uint64_t> map;
+
+  EXPECT_TRUE(map.Insert(42u, TemplateParameter2{int32_t{1}, TypeIds::Int32}));
+  EXPECT_FALSE(map.Insert(42u, TemplateParameter2{int32_t{2}, TypeIds::Int32}));
+  EXPECT_EQ(map.size(), 1u);
+
+  auto *value = map.Find(42u);
+  ASSERT_NE(value, nullptr);
+  EXPECT_EQ(value->Get<int32_t>(), 1);
+  EXPECT_EQ(map.Find(43u), nullptr);
+}
+
+}  // namespace
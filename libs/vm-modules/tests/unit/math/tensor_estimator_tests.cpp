@@ -20,6 +20,7 @@
 #include "vm/array.hpp"
 #include "vm_modules/math/tensor/tensor.hpp"
 #include "vm_modules/math/tensor/tensor_estimator.hpp"
+#include "vm_modules/math/tensor/tensor_expression.hpp"
 #include "vm_test_toolkit.hpp"
 
 namespace {
@@ -29,6 +30,7 @@ using DataType          = fetch::vm_modules::math::DataType;
 using MathTensor        = fetch::math::Tensor<DataType>;
 using VmTensor          = fetch::vm_modules::math::VMTensor;
 using VmTensorEstimator = fetch::vm_modules::math::TensorEstimator;
+using VmExpression      = fetch::vm_modules::math::VMTensorExpression;
 
 using ShapeFrom = std::vector<SizeType>;
 using ShapeTo   = std::vector<SizeType>;
@@ -48,6 +50,13 @@ std::vector<ShapePair> const EQUAL_TRANSFORMATIONS{
     {{64, 8, 4, 2}, {64, 8, 4, 2}},                                    //
     {{1, 2, 3, 4, 5, 6}, {1, 2, 3, 4, 5, 6}},                          //
 };
+std::vector<ShapeFrom> const ELEMENTWISE_SHAPES{
+    {1},           //
+    {7, 3},        //
+    {16, 16},      //
+    {3, 5, 9},     //
+    {64, 8, 4, 2}  //
+};
 std::vector<ShapePair> const INVALID_TRANSFORMATIONS{
     {{1, 1, 1, 1}, {0}},                                 //
     {{2, 2, 2, 2}, {3, 4}},                              //
@@ -330,4 +339,101 @@ TEST_F(MathTensorEstimatorTests, tensor_estimator_invalid_reshape_test)
   }
 }
 
+TEST_F(MathTensorEstimatorTests, tensor_estimator_in_place_test)
+{
+  using namespace fetch::vm;
+  for (ShapeFrom const &shape : ELEMENTWISE_SHAPES)
+  {
+    VmTensor          vm_tensor(&toolkit.vm(), TypeIds::Unknown, MathTensor{shape});
+    VmTensor          other(&toolkit.vm(), TypeIds::Unknown, MathTensor{shape});
+    VmTensorEstimator tensor_estimator(vm_tensor);
+
+    SizeType padded_size = MathTensor::PaddedSizeFromShape(shape);
+    SizeType size        = MathTensor::SizeFromShape(shape);
+
+    ChargeAmount const expected_charge =
+        static_cast<ChargeAmount>(VmTensorEstimator::IN_PLACE_PADDED_SIZE_COEF * padded_size +
+                                  VmTensorEstimator::IN_PLACE_SIZE_COEF * size +
+                                  VmTensorEstimator::IN_PLACE_CONST_COEF) *
+        COMPUTE_CHARGE_COST;
+
+    Ptr<VmTensor> other_ptr = Ptr<VmTensor>::PtrFromThis(&other);
+    EXPECT_EQ(tensor_estimator.AddInPlace(other_ptr), expected_charge);
+    EXPECT_EQ(tensor_estimator.SubtractInPlace(other_ptr), expected_charge);
+    EXPECT_EQ(tensor_estimator.MultiplyInPlace(other_ptr), expected_charge);
+    EXPECT_EQ(tensor_estimator.DivideInPlace(other_ptr), expected_charge);
+
+    // avoiding the intermediate tensor must never cost more than the allocating operator
+    EXPECT_LE(expected_charge, tensor_estimator.AddOperator(other_ptr));
+  }
+}
+
+TEST_F(MathTensorEstimatorTests, tensor_estimator_multiply_add_test)
+{
+  using namespace fetch::vm;
+  for (ShapeFrom const &shape : ELEMENTWISE_SHAPES)
+  {
+    VmTensor          vm_tensor(&toolkit.vm(), TypeIds::Unknown, MathTensor{shape});
+    VmTensor          other(&toolkit.vm(), TypeIds::Unknown, MathTensor{shape});
+    VmTensorEstimator tensor_estimator(vm_tensor);
+
+    SizeType padded_size = MathTensor::PaddedSizeFromShape(shape);
+    SizeType size        = MathTensor::SizeFromShape(shape);
+
+    ChargeAmount const expected_charge =
+        static_cast<ChargeAmount>(VmTensorEstimator::MULTIPLY_ADD_PADDED_SIZE_COEF * padded_size +
+                                  VmTensorEstimator::MULTIPLY_ADD_SIZE_COEF * size +
+                                  VmTensorEstimator::MULTIPLY_ADD_CONST_COEF) *
+        COMPUTE_CHARGE_COST;
+
+    Ptr<VmTensor> other_ptr = Ptr<VmTensor>::PtrFromThis(&other);
+    EXPECT_EQ(tensor_estimator.MultiplyAdd(other_ptr, other_ptr), expected_charge);
+    EXPECT_EQ(tensor_estimator.MultiplyAddScalar(DataType{2}, other_ptr), expected_charge);
+
+    // the fused operation must never cost more than the two operations it replaces
+    EXPECT_LE(expected_charge, tensor_estimator.MultiplyOperator(other_ptr) +
+                                   tensor_estimator.AddInPlace(other_ptr));
+  }
+}
+
+TEST_F(MathTensorEstimatorTests, tensor_estimator_assign_test)
+{
+  using namespace fetch::vm;
+
+  // chaining creates new expressions, which needs a vm
+  ASSERT_TRUE(toolkit.Compile(R"(
+    function main()
+    endfunction
+  )"));
+
+  for (ShapeFrom const &shape : ELEMENTWISE_SHAPES)
+  {
+    VmTensor          vm_tensor(&toolkit.vm(), TypeIds::Unknown, MathTensor{shape});
+    VmTensor          other(&toolkit.vm(), TypeIds::Unknown, MathTensor{shape});
+    VmTensorEstimator tensor_estimator(vm_tensor);
+
+    Ptr<VmTensor>     other_ptr = Ptr<VmTensor>::PtrFromThis(&other);
+    VmExpression      expression(&toolkit.vm(), TypeIds::Unknown, other_ptr);
+    Ptr<VmExpression> expression_ptr = Ptr<VmExpression>::PtrFromThis(&expression);
+
+    SizeType padded_size = MathTensor::PaddedSizeFromShape(shape);
+    SizeType size        = MathTensor::SizeFromShape(shape);
+
+    for (SizeType operations = 0; operations < 8; ++operations)
+    {
+      ChargeAmount const expected_charge =
+          static_cast<ChargeAmount>(VmTensorEstimator::ASSIGN_PADDED_SIZE_COEF * padded_size +
+                                    VmTensorEstimator::ASSIGN_SIZE_COEF * size +
+                                    VmTensorEstimator::ASSIGN_OPERATION_SIZE_COEF * operations *
+                                        size +
+                                    VmTensorEstimator::ASSIGN_CONST_COEF) *
+          COMPUTE_CHARGE_COST;
+
+      EXPECT_EQ(tensor_estimator.Assign(expression_ptr), expected_charge);
+
+      expression_ptr = expression_ptr->Multiply(other_ptr);
+    }
+  }
+}
+
 }  // namespace
@@ -20,12 +20,14 @@
 #include "vm/array.hpp"
 #include "vm_modules/math/math.hpp"
 #include "vm_modules/math/tensor/tensor.hpp"
+#include "vm_modules/math/tensor/tensor_expression.hpp"
 #include "vm_modules/math/type.hpp"
 #include "vm_test_toolkit.hpp"
 
 #include "gmock/gmock.h"
 
 #include <sstream>
+#include <string>
 
 using namespace fetch::vm;
 
@@ -750,6 +752,265 @@ TEST_F(MathTensorTests, tensor_divide_test)
   EXPECT_TRUE(gt.AllClose(tensor));
 }
 
+TEST_F(MathTensorTests, tensor_in_place_arithmetic_test)
+{
+  static char const *tensor_in_place_src = R"(
+    function main() : Tensor
+      var tensor_shape = Array<UInt64>(2);
+      tensor_shape[0] = 3u64;
+      tensor_shape[1] = 3u64;
+      var x = Tensor(tensor_shape);
+      var y = Tensor(tensor_shape);
+      x.fill(7.0fp64);
+      y.fill(2.0fp64);
+      x.addInPlace(y);
+      x.multiplyInPlace(y);
+      x.subtractInPlace(y);
+      x.divideInPlace(y);
+      return x;
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(tensor_in_place_src));
+  Variant res;
+  ASSERT_TRUE(toolkit.Run(&res));
+
+  auto const                    tensor_ptr = res.Get<Ptr<fetch::vm_modules::math::VMTensor>>();
+  auto                          tensor     = tensor_ptr->GetTensor();
+  fetch::math::Tensor<DataType> gt({3, 3});
+  gt.Fill(fetch::math::Type<DataType>("8.0"));
+
+  EXPECT_TRUE(gt.AllClose(tensor));
+}
+
+TEST_F(MathTensorTests, tensor_in_place_shape_mismatch_test)
+{
+  static char const *tensor_in_place_src = R"(
+    function main()
+      var x_shape = Array<UInt64>(2);
+      x_shape[0] = 3u64;
+      x_shape[1] = 3u64;
+      var y_shape = Array<UInt64>(2);
+      y_shape[0] = 3u64;
+      y_shape[1] = 4u64;
+      var x = Tensor(x_shape);
+      var y = Tensor(y_shape);
+      x.addInPlace(y);
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(tensor_in_place_src));
+  EXPECT_FALSE(toolkit.Run());
+}
+
+TEST_F(MathTensorTests, tensor_multiply_add_test)
+{
+  static char const *tensor_multiply_add_src = R"(
+    function main() : Tensor
+      var tensor_shape = Array<UInt64>(2);
+      tensor_shape[0] = 4u64;
+      tensor_shape[1] = 5u64;
+      var acc = Tensor(tensor_shape);
+      var x = Tensor(tensor_shape);
+      var y = Tensor(tensor_shape);
+      acc.fill(1.0fp64);
+      x.fill(3.0fp64);
+      y.fill(-2.0fp64);
+      acc.multiplyAdd(x, y);
+      acc.multiplyAdd(0.5fp64, x);
+      return acc;
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(tensor_multiply_add_src));
+  Variant res;
+  ASSERT_TRUE(toolkit.Run(&res));
+
+  auto const                    tensor_ptr = res.Get<Ptr<fetch::vm_modules::math::VMTensor>>();
+  auto                          tensor     = tensor_ptr->GetTensor();
+  fetch::math::Tensor<DataType> gt({4, 5});
+  gt.Fill(fetch::math::Type<DataType>("-3.5"));
+
+  EXPECT_TRUE(gt.AllClose(tensor));
+}
+
+TEST_F(MathTensorTests, tensor_lazy_expression_test)
+{
+  static char const *tensor_lazy_src = R"(
+    function main() : Tensor
+      var tensor_shape = Array<UInt64>(2);
+      tensor_shape[0] = 3u64;
+      tensor_shape[1] = 7u64;
+      var x = Tensor(tensor_shape);
+      var w = Tensor(tensor_shape);
+      var b = Tensor(tensor_shape);
+      var result = Tensor(tensor_shape);
+      x.fill(2.0fp64);
+      w.fill(3.0fp64);
+      b.fill(-1.0fp64);
+      var expression = x.lazy().multiply(w).add(b).multiply(2.0fp64).subtract(0.5fp64);
+      result.assign(expression);
+      return result;
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(tensor_lazy_src));
+  Variant res;
+  ASSERT_TRUE(toolkit.Run(&res));
+
+  auto const                    tensor_ptr = res.Get<Ptr<fetch::vm_modules::math::VMTensor>>();
+  auto                          tensor     = tensor_ptr->GetTensor();
+  fetch::math::Tensor<DataType> gt({3, 7});
+  gt.Fill(fetch::math::Type<DataType>("9.5"));
+
+  EXPECT_TRUE(gt.AllClose(tensor));
+}
+
+TEST_F(MathTensorTests, tensor_lazy_expression_aliasing_test)
+{
+  static char const *tensor_lazy_src = R"(
+    function main() : Tensor
+      var tensor_shape = Array<UInt64>(1);
+      tensor_shape[0] = 10u64;
+      var x = Tensor(tensor_shape);
+      var y = Tensor(tensor_shape);
+      x.fill(3.0fp64);
+      y.fill(4.0fp64);
+      x.assign(x.lazy().multiply(x).divide(y).add(x));
+      return x;
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(tensor_lazy_src));
+  Variant res;
+  ASSERT_TRUE(toolkit.Run(&res));
+
+  auto const                    tensor_ptr = res.Get<Ptr<fetch::vm_modules::math::VMTensor>>();
+  auto                          tensor     = tensor_ptr->GetTensor();
+  fetch::math::Tensor<DataType> gt({10});
+  gt.Fill(fetch::math::Type<DataType>("5.25"));
+
+  EXPECT_TRUE(gt.AllClose(tensor));
+}
+
+TEST_F(MathTensorTests, tensor_lazy_expression_is_not_modified_by_chaining_test)
+{
+  static char const *tensor_lazy_src = R"(
+    function main() : Tensor
+      var tensor_shape = Array<UInt64>(1);
+      tensor_shape[0] = 10u64;
+      var x = Tensor(tensor_shape);
+      var b = Tensor(tensor_shape);
+      var first = Tensor(tensor_shape);
+      var second = Tensor(tensor_shape);
+      x.fill(3.0fp64);
+      b.fill(4.0fp64);
+      var e = x.lazy().add(b);
+      var e2 = e.multiply(2.0fp64);
+      second.assign(e2);
+      first.assign(e);
+      return first.add(second);
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(tensor_lazy_src));
+  Variant res;
+  ASSERT_TRUE(toolkit.Run(&res));
+
+  // 7 from the first expression plus 14 from the second
+  auto const                    tensor_ptr = res.Get<Ptr<fetch::vm_modules::math::VMTensor>>();
+  auto                          tensor     = tensor_ptr->GetTensor();
+  fetch::math::Tensor<DataType> gt({10});
+  gt.Fill(fetch::math::Type<DataType>("21.0"));
+
+  EXPECT_TRUE(gt.AllClose(tensor));
+}
+
+TEST_F(MathTensorTests, tensor_lazy_expression_shape_mismatch_test)
+{
+  static char const *tensor_lazy_src = R"(
+    function main()
+      var x_shape = Array<UInt64>(1);
+      x_shape[0] = 10u64;
+      var y_shape = Array<UInt64>(1);
+      y_shape[0] = 11u64;
+      var x = Tensor(x_shape);
+      var y = Tensor(y_shape);
+      var result = Tensor(x_shape);
+      result.assign(x.lazy().add(y));
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(tensor_lazy_src));
+  EXPECT_FALSE(toolkit.Run());
+}
+
+TEST_F(MathTensorTests, tensor_lazy_expression_null_operand_test)
+{
+  static char const *tensor_lazy_src = R"(
+    function main()
+      var tensor_shape = Array<UInt64>(1);
+      tensor_shape[0] = 10u64;
+      var x = Tensor(tensor_shape);
+      var y : Tensor;
+      var result = Tensor(tensor_shape);
+      result.assign(x.lazy().divide(y));
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(tensor_lazy_src));
+  EXPECT_FALSE(toolkit.Run());
+}
+
+TEST_F(MathTensorTests, tensor_lazy_expression_null_assign_test)
+{
+  static char const *tensor_lazy_src = R"(
+    function main()
+      var tensor_shape = Array<UInt64>(1);
+      tensor_shape[0] = 10u64;
+      var expression : TensorExpression;
+      var result = Tensor(tensor_shape);
+      result.assign(expression);
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(tensor_lazy_src));
+  EXPECT_FALSE(toolkit.Run());
+}
+
+TEST_F(MathTensorTests, tensor_lazy_expression_chaining_charge_grows_with_length_test)
+{
+  using fetch::vm::ChargeAmount;
+  using fetch::vm_modules::math::VMTensorExpression;
+
+  // every chained call copies the operations recorded so far, and is charged for them
+  auto const chain_charge = [this](std::size_t length) -> ChargeAmount {
+    std::string const tensor_lazy_src = R"(
+      function main()
+        var tensor_shape = Array<UInt64>(1);
+        tensor_shape[0] = 10u64;
+        var x = Tensor(tensor_shape);
+        var e = x.lazy();
+        for (i in 0:)" + std::to_string(length) +
+                                        R"()
+          e = e.add(1.0fp64);
+        endfor
+      endfunction
+    )";
+
+    EXPECT_TRUE(toolkit.Compile(tensor_lazy_src));
+    EXPECT_TRUE(toolkit.Run());
+    return toolkit.vm().GetChargeTotal();
+  };
+
+  // the charges which are linear in the length of the chain cancel out
+  ChargeAmount const empty  = chain_charge(0);
+  ChargeAmount const single = chain_charge(50);
+  ChargeAmount const twice  = chain_charge(100);
+
+  EXPECT_EQ(twice + empty - (2 * single), 50 * 50 * VMTensorExpression::RECORD_STEP_CHARGE);
+}
+
 // TODO (ML-340) - enable test when operators can take estimators and inplace operator can be bound
 // to tensor
 TEST_F(MathTensorTests, DISABLED_tensor_inplace_multiply_test)
@@ -0,0 +1,221 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vm/array.hpp"
+#include "vm/object_arena.hpp"
+#include "vm/string.hpp"
+#include "vm_test_toolkit.hpp"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <vector>
+
+namespace {
+
+using fetch::vm::ObjectArena;
+
+class ObjectArenaTests : public ::testing::Test
+{
+public:
+  std::stringstream stdout;
+  VmTestToolkit     toolkit{&stdout};
+};
+
+TEST_F(ObjectArenaTests, objects_created_during_execution_are_allocated_from_the_arena)
+{
+  static char const *TEXT = R"(
+    function main()
+      var total = 0;
+      for (i in 0:100)
+        var s = "value" + toString(i);
+        total += s.length();
+      endfor
+      printLn(total);
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+  ASSERT_TRUE(toolkit.Run());
+  EXPECT_EQ(stdout.str(), "690\n");
+
+  auto const &statistics = toolkit.vm().GetAllocationStatistics();
+  EXPECT_GE(statistics.arena_allocations, 100u);
+  EXPECT_GE(statistics.chunks_allocated, 1u);
+  EXPECT_EQ(statistics.chunks_detached, 0u);
+}
+
+TEST_F(ObjectArenaTests, returned_objects_outlive_the_execution)
+{
+  static char const *TEXT = R"(
+    function main() : Array<String>
+      var values = Array<String>(3);
+      values[0] = "alpha";
+      values[1] = "beta";
+      values[2] = "gamma";
+      return values;
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+
+  fetch::vm::Variant output;
+  ASSERT_TRUE(toolkit.Run(&output));
+  EXPECT_EQ(toolkit.vm().GetAllocationStatistics().chunks_detached, 1u);
+
+  // run again so that any recycled memory would overwrite the first result
+  fetch::vm::Variant second;
+  ASSERT_TRUE(toolkit.Run(&second));
+
+  using fetch::vm::Ptr;
+  using fetch::vm::String;
+
+  auto values = output.Get<Ptr<fetch::vm::Array<Ptr<fetch::vm::Object>>>>();
+  ASSERT_TRUE(values);
+  ASSERT_EQ(values->elements.size(), 3u);
+  EXPECT_EQ(Ptr<String>{values->elements[0]}->string(), "alpha");
+  EXPECT_EQ(Ptr<String>{values->elements[1]}->string(), "beta");
+  EXPECT_EQ(Ptr<String>{values->elements[2]}->string(), "gamma");
+}
+
+TEST_F(ObjectArenaTests, chunks_are_recycled_between_executions)
+{
+  static char const *TEXT = R"(
+    function main()
+      var a = Array<Int32>(10);
+      var s = "text";
+      for (i in 0:1000)
+        s = toString(i);
+      endfor
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+  ASSERT_TRUE(toolkit.Run());
+
+  auto const &statistics = toolkit.vm().GetAllocationStatistics();
+  auto const  allocated  = statistics.chunks_allocated;
+  ASSERT_GE(allocated, 1u);
+
+  for (int i = 0; i < 5; ++i)
+  {
+    ASSERT_TRUE(toolkit.Run());
+  }
+
+  EXPECT_EQ(statistics.chunks_allocated, allocated);
+  EXPECT_GE(statistics.chunks_recycled, 5u);
+  EXPECT_EQ(statistics.chunks_detached, 0u);
+}
+
+TEST_F(ObjectArenaTests, released_objects_are_reused_within_an_execution)
+{
+  static char const *TEXT = R"(
+    function main()
+      var s = "text";
+      for (i in 0:100000)
+        s = toString(i);
+      endfor
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+  ASSERT_TRUE(toolkit.Run());
+
+  auto const &statistics = toolkit.vm().GetAllocationStatistics();
+  EXPECT_GE(statistics.blocks_reused, 90000u);
+  EXPECT_EQ(statistics.chunks_allocated, 1u);
+  EXPECT_EQ(statistics.heap_allocations, 0u);
+}
+
+TEST(ObjectArenaAllocationTests, large_allocations_fall_back_to_the_heap)
+{
+  ObjectArena arena;
+  {
+    ObjectArena::Scope const scope{arena};
+
+    void *small = ObjectArena::Allocate(64);
+    void *large = ObjectArena::Allocate(ObjectArena::MAX_ALLOCATION_SIZE);
+    ObjectArena::Deallocate(small);
+    ObjectArena::Deallocate(large);
+  }
+
+  EXPECT_EQ(arena.statistics().arena_allocations, 1u);
+  EXPECT_EQ(arena.statistics().heap_allocations, 1u);
+}
+
+TEST(ObjectArenaAllocationTests, allocations_outside_a_scope_use_the_heap)
+{
+  ObjectArena arena;
+  void *      ptr = ObjectArena::Allocate(32);
+  ObjectArena::Deallocate(ptr);
+
+  EXPECT_EQ(arena.statistics().arena_allocations, 0u);
+  EXPECT_EQ(arena.statistics().heap_allocations, 0u);
+}
+
+TEST(ObjectArenaAllocationTests, released_memory_is_reused_for_objects_of_the_same_size)
+{
+  ObjectArena arena;
+  {
+    ObjectArena::Scope const scope{arena};
+
+    void *first = ObjectArena::Allocate(48);
+    ObjectArena::Deallocate(first);
+
+    void *second = ObjectArena::Allocate(48);
+    void *other  = ObjectArena::Allocate(96);
+    EXPECT_EQ(second, first);
+    EXPECT_NE(other, first);
+
+    ObjectArena::Deallocate(second);
+    ObjectArena::Deallocate(other);
+  }
+
+  EXPECT_EQ(arena.statistics().arena_allocations, 3u);
+  EXPECT_EQ(arena.statistics().blocks_reused, 1u);
+}
+
+TEST(ObjectArenaAllocationTests, arena_memory_is_bounded)
+{
+  std::size_t const block_size = ObjectArena::MAX_ALLOCATION_SIZE / 2;
+  std::size_t const count = (ObjectArena::MAX_CHUNKS * ObjectArena::CHUNK_SIZE / block_size) + 100;
+
+  ObjectArena arena;
+  {
+    ObjectArena::Scope const scope{arena};
+
+    std::vector<void *> blocks;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      blocks.push_back(ObjectArena::Allocate(block_size));
+    }
+
+    for (auto *block : blocks)
+    {
+      ObjectArena::Deallocate(block);
+    }
+  }
+
+  auto const &statistics = arena.statistics();
+  EXPECT_EQ(statistics.chunks_allocated, ObjectArena::MAX_CHUNKS);
+  EXPECT_GE(statistics.heap_allocations, 100u);
+  EXPECT_EQ(statistics.arena_allocations + statistics.heap_allocations, count);
+  EXPECT_EQ(statistics.chunks_detached, 0u);
+}
+
+}  // namespace
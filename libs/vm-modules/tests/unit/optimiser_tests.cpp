@@ -0,0 +1,190 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vm_test_toolkit.hpp"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+
+namespace {
+
+struct RunResult
+{
+  bool         succeeded{false};
+  std::string  output;
+  ChargeAmount charge{0};
+};
+
+RunResult CompileAndRun(char const *text, bool optimise)
+{
+  std::stringstream stdout;
+  VmTestToolkit     toolkit{&stdout};
+  toolkit.setOptimiserEnabled(optimise);
+
+  RunResult result;
+  if (toolkit.Compile(text))
+  {
+    result.succeeded = toolkit.Run();
+    result.charge    = toolkit.vm().GetChargeTotal();
+  }
+  result.output = stdout.str();
+
+  return result;
+}
+
+/// Runs the program with and without the optimiser, expecting the same behaviour for less charge
+void ExpectCheaperWithSameOutput(char const *text, std::string const &expected_output)
+{
+  RunResult const plain     = CompileAndRun(text, false);
+  RunResult const optimised = CompileAndRun(text, true);
+
+  ASSERT_TRUE(plain.succeeded);
+  ASSERT_TRUE(optimised.succeeded);
+  EXPECT_EQ(plain.output, expected_output);
+  EXPECT_EQ(optimised.output, expected_output);
+  EXPECT_LT(optimised.charge, plain.charge);
+}
+
+TEST(OptimiserTests, integer_and_float_constants_are_folded)
+{
+  static char const *TEXT = R"(
+    function main()
+      var a : Int32 = 1 + 2 * 3 - 8 / 2;
+      var b : UInt64 = 10u64 % 3u64;
+      var c : Float64 = 1.5 * 2.0 - 0.25;
+      var d : Int8 = -(7i8);
+      printLn(a);
+      printLn(b);
+      printLn(c);
+      printLn(d);
+      printLn(3 < 4 && !(2 == 2));
+    endfunction
+  )";
+
+  ExpectCheaperWithSameOutput(TEXT, "3\n1\n2.75\n-7\nfalse\n");
+}
+
+TEST(OptimiserTests, fixed_point_constants_are_folded)
+{
+  static char const *TEXT = R"(
+    function main()
+      var a = 1.5fp64 * 2.0fp64 + 0.25fp64;
+      var b = 3.0fp32 / 2.0fp32 - 1.0fp32;
+      printLn(a);
+      printLn(b);
+      printLn(a > 3.0fp64);
+    endfunction
+  )";
+
+  ExpectCheaperWithSameOutput(TEXT, "3.250000000\n0.5000\ntrue\n");
+}
+
+TEST(OptimiserTests, constant_division_by_zero_is_still_reported_at_run_time)
+{
+  static char const *TEXT = R"(
+    function main()
+      printLn("before");
+      var a : Int32 = 1 / 0;
+      printLn(a);
+    endfunction
+  )";
+
+  RunResult const plain     = CompileAndRun(TEXT, false);
+  RunResult const optimised = CompileAndRun(TEXT, true);
+
+  EXPECT_FALSE(plain.succeeded);
+  EXPECT_FALSE(optimised.succeeded);
+  EXPECT_EQ(optimised.output, plain.output);
+}
+
+TEST(OptimiserTests, loads_and_stores_are_combined)
+{
+  static char const *TEXT = R"(
+    function main()
+      var total : Int64 = 0i64;
+      var scale : Int64 = 3i64;
+      for (i in 0:100)
+        total = total + scale;
+        total = total - 1i64;
+        scale = scale;
+      endfor
+      printLn(total);
+    endfunction
+  )";
+
+  ExpectCheaperWithSameOutput(TEXT, "200\n");
+}
+
+TEST(OptimiserTests, constant_branches_and_dead_code_are_removed)
+{
+  static char const *TEXT = R"(
+    function sign(x : Int32) : Int32
+      if (x < 0)
+        return -1;
+      elseif (x > 0)
+        return 1;
+      else
+        return 0;
+      endif
+    endfunction
+
+    function main()
+      var count = 0;
+      for (i in -5:5)
+        if (true)
+          count += sign(i);
+        else
+          count -= 100;
+        endif
+        while (false)
+          count = 1000;
+        endwhile
+      endfor
+      printLn(count);
+    endfunction
+  )";
+
+  ExpectCheaperWithSameOutput(TEXT, "-1\n");
+}
+
+TEST(OptimiserTests, loops_with_break_and_continue_are_preserved)
+{
+  static char const *TEXT = R"(
+    function main()
+      var sum = 0;
+      var i = 0;
+      while (true)
+        i += 1;
+        if (i % 2 == 0)
+          continue;
+        endif
+        if (i > 2 * 10)
+          break;
+        endif
+        sum = sum + i;
+      endwhile
+      printLn(sum);
+    endfunction
+  )";
+
+  ExpectCheaperWithSameOutput(TEXT, "100\n");
+}
+
+}  // namespace
@@ -82,6 +82,7 @@ public:
     executable_ = std::make_unique<Executable>();
     vm_         = std::make_unique<VM>(module_.get());
     vm_->SetIOObserver(*observer_);
+    vm_->SetOptimiserEnabled(optimiser_enabled_);
     vm_->AttachOutputDevice(fetch::vm::VM::STDOUT, *stdout_);
 
     if (!vm_->GenerateExecutable(*ir_, "default_exe", *executable_, errors))
@@ -157,6 +158,11 @@ public:
     stdout_ = &ostream;
   }
 
+  void setOptimiserEnabled(bool enabled)
+  {
+    optimiser_enabled_ = enabled;
+  }
+
 private:
   std::ostream *stdout_ = &std::cout;
   ObserverPtr   observer_;
@@ -165,4 +171,5 @@ private:
   IRPtr         ir_;
   ExecutablePtr executable_;
   VMPtr         vm_;
+  bool          optimiser_enabled_{false};
 };
@@ -337,6 +337,16 @@ public:
   bool GenerateExecutable(IR const &ir, std::string const &executable_name, Executable &executable,
                           std::vector<std::string> &errors);
 
+  void SetOptimiserEnabled(bool enabled)
+  {
+    optimiser_enabled_ = enabled;
+  }
+
+  bool IsOptimiserEnabled() const
+  {
+    return optimiser_enabled_;
+  }
+
 private:
   struct Scope
   {
@@ -397,6 +407,7 @@ private:
   Executable::Function *   function_{};
   LineToPcMap              line_to_pc_map_;
   std::vector<std::string> errors_;
+  bool                     optimiser_enabled_{false};
 
   void          Initialise(VM *vm, uint16_t num_system_types);
   void          AddLineNumber(uint16_t line, uint16_t pc);
@@ -20,8 +20,12 @@
 #include "vectorise/fixed_point/fixed_point.hpp"
 #include "vm/vm.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <unordered_set>
+#include <vector>
 
 namespace fetch {
 namespace vm {
@@ -42,64 +46,258 @@ protected:
   {}
 };
 
+/**
+ * Describes how the keys of a map are stored, hashed and compared. Primitive keys are stored
+ * unboxed, object keys are stored as the template parameter holding the reference.
+ */
 template <typename T, typename = void>
-struct H;
+struct MapKey;
 
-template <>
-struct H<fixed_point::fp32_t, void>
+template <typename T>
+struct MapKey<T, std::enable_if_t<IsPrimitive<T>::value>>
 {
-  std::size_t operator()(TemplateParameter1 const &key) const
+  using Type = T;
+
+  static T Load(TemplateParameter1 const &key)
   {
-    return std::hash<int32_t>()(key.primitive.Get<int32_t>());
+    return key.primitive.Get<T>();
   }
-};
 
-template <>
-struct H<fixed_point::fp64_t, void>
-{
-  std::size_t operator()(TemplateParameter1 const &key) const
+  static std::size_t Hash(T const &key)
   {
-    return std::hash<int64_t>()(key.primitive.Get<int64_t>());
+    return std::hash<T>()(key);
   }
-};
 
-template <typename T>
-struct H<T, std::enable_if_t<IsPrimitive<T>::value>>
-{
-  std::size_t operator()(TemplateParameter1 const &key) const
+  static bool Equal(T const &lhs, T const &rhs)
   {
-    return std::hash<T>()(key.primitive.Get<T>());
+    return math::IsEqual(lhs, rhs);
   }
 };
 
+template <>
+inline std::size_t MapKey<fixed_point::fp32_t>::Hash(fixed_point::fp32_t const &key)
+{
+  return std::hash<int32_t>()(key.Data());
+}
+
+template <>
+inline std::size_t MapKey<fixed_point::fp64_t>::Hash(fixed_point::fp64_t const &key)
+{
+  return std::hash<int64_t>()(key.Data());
+}
+
 template <typename T>
-struct H<T, std::enable_if_t<IsPtr<T>::value>>
+struct MapKey<T, std::enable_if_t<IsPtr<T>::value>>
 {
-  std::size_t operator()(TemplateParameter1 const &key) const
+  using Type = TemplateParameter1;
+
+  static TemplateParameter1 const &Load(TemplateParameter1 const &key)
+  {
+    return key;
+  }
+
+  static std::size_t Hash(TemplateParameter1 const &key)
   {
     return key.object->GetHashCode();
   }
-};
 
-template <typename T, typename = void>
-struct E;
-template <typename T>
-struct E<T, std::enable_if_t<IsPrimitive<T>::value>>
-{
-  bool operator()(TemplateParameter1 const &lhs, TemplateParameter1 const &rhs) const
+  static bool Equal(TemplateParameter1 const &lhs, TemplateParameter1 const &rhs)
   {
-    return math::IsEqual(lhs.primitive.Get<T>(), rhs.primitive.Get<T>());
+    return lhs.object->IsEqual(lhs.object, rhs.object);
   }
 };
-template <typename T>
-struct E<T, std::enable_if_t<IsPtr<T>::value>>
+
+/**
+ * Open addressing hash table backing the Etch Map.
+ *
+ * Entries are kept densely in insertion order, which is also the order in which they are
+ * iterated. The table itself only holds the indices of the entries and is probed linearly. Every
+ * entry caches the hash of its key, so object keys are hashed once on insertion and growing the
+ * table never calls back into the objects.
+ */
+template <typename Key>
+class FlatMap
 {
-  bool operator()(TemplateParameter1 const &lhs, TemplateParameter1 const &rhs) const
+public:
+  using KeyType = typename MapKey<Key>::Type;
+
+  struct Entry
   {
-    return lhs.object->IsEqual(lhs.object, rhs.object);
+    KeyType            key;
+    TemplateParameter2 value;
+    std::size_t        hash;
+  };
+
+  using Entries       = std::vector<Entry>;
+  using ConstIterator = typename Entries::const_iterator;
+
+  std::size_t size() const
+  {
+    return entries_.size();
   }
+
+  ConstIterator begin() const
+  {
+    return entries_.begin();
+  }
+
+  ConstIterator end() const
+  {
+    return entries_.end();
+  }
+
+  /**
+   * Returns the entries in the order a std::unordered_map would iterate them, had it been given the
+   * same keys in the same order. Maps were serialised in that order before being backed by this
+   * table, and keeping it leaves persisted state and its merkle roots unchanged.
+   */
+  std::vector<Entry const *> SerialisationOrder() const
+  {
+    struct EntryHash
+    {
+      std::size_t operator()(Entry const *entry) const
+      {
+        return entry->hash;
+      }
+    };
+
+    // the keys of the entries are unique, so entries only ever compare equal to themselves
+    std::unordered_set<Entry const *, EntryHash> ordered;
+    for (auto const &entry : entries_)
+    {
+      ordered.insert(&entry);
+    }
+
+    return std::vector<Entry const *>(ordered.begin(), ordered.end());
+  }
+
+  TemplateParameter2 *Find(KeyType const &key)
+  {
+    std::size_t const hash  = MapKey<Key>::Hash(key);
+    uint32_t const    index = slots_.empty() ? EMPTY : slots_[Probe(key, hash)];
+    return (index == EMPTY) ? nullptr : &entries_[index - 1].value;
+  }
+
+  /// Adds the entry unless the key is already present, returns true if it was added
+  bool Insert(KeyType const &key, TemplateParameter2 const &value)
+  {
+    std::size_t const hash = MapKey<Key>::Hash(key);
+    Reserve(entries_.size() + 1);
+
+    uint32_t &slot = slots_[Probe(key, hash)];
+    if (slot != EMPTY)
+    {
+      return false;
+    }
+
+    entries_.push_back(Entry{key, value, hash});
+    slot = static_cast<uint32_t>(entries_.size());
+    return true;
+  }
+
+  /// Adds the entry or replaces the value of an existing one
+  void Set(KeyType const &key, TemplateParameter2 const &value)
+  {
+    std::size_t const hash = MapKey<Key>::Hash(key);
+    Reserve(entries_.size() + 1);
+
+    uint32_t &slot = slots_[Probe(key, hash)];
+    if (slot != EMPTY)
+    {
+      entries_[slot - 1].value = value;
+      return;
+    }
+
+    entries_.push_back(Entry{key, value, hash});
+    slot = static_cast<uint32_t>(entries_.size());
+  }
+
+  void Reserve(std::size_t count)
+  {
+    if (count * MAX_LOAD_DENOMINATOR <= slots_.size() * MAX_LOAD_NUMERATOR)
+    {
+      return;
+    }
+
+    std::size_t capacity = std::max(slots_.size(), MIN_CAPACITY);
+    while (count * MAX_LOAD_DENOMINATOR > capacity * MAX_LOAD_NUMERATOR)
+    {
+      capacity <<= 1;
+    }
+
+    Rehash(capacity);
+    entries_.reserve(count);
+  }
+
+private:
+  static constexpr uint32_t    EMPTY                = 0;
+  static constexpr std::size_t MIN_CAPACITY         = 8;
+  static constexpr std::size_t MAX_LOAD_NUMERATOR   = 3;
+  static constexpr std::size_t MAX_LOAD_DENOMINATOR = 4;
+
+  /// Spreads the hash over the table with Fibonacci hashing, std::hash is the identity for integers
+  std::size_t Position(std::size_t hash) const
+  {
+    return static_cast<std::size_t>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >>
+                                    shift_);
+  }
+
+  /// Returns the slot holding the key, or the empty slot where it would be inserted
+  std::size_t Probe(KeyType const &key, std::size_t hash) const
+  {
+    std::size_t const mask = slots_.size() - 1;
+    for (std::size_t position = Position(hash);; position = (position + 1) & mask)
+    {
+      uint32_t const index = slots_[position];
+      if (index == EMPTY)
+      {
+        return position;
+      }
+
+      Entry const &entry = entries_[index - 1];
+      if ((entry.hash == hash) && MapKey<Key>::Equal(entry.key, key))
+      {
+        return position;
+      }
+    }
+  }
+
+  void Rehash(std::size_t capacity)
+  {
+    slots_.assign(capacity, EMPTY);
+
+    shift_ = 64;
+    for (std::size_t c = capacity; c > 1; c >>= 1)
+    {
+      --shift_;
+    }
+
+    std::size_t const mask = capacity - 1;
+    for (std::size_t i = 0; i < entries_.size(); ++i)
+    {
+      std::size_t position = Position(entries_[i].hash);
+      while (slots_[position] != EMPTY)
+      {
+        position = (position + 1) & mask;
+      }
+      slots_[position] = static_cast<uint32_t>(i + 1);
+    }
+  }
+
+  Entries               entries_;
+  std::vector<uint32_t> slots_;
+  uint32_t              shift_{64};
 };
 
+template <typename Key>
+constexpr uint32_t FlatMap<Key>::EMPTY;
+template <typename Key>
+constexpr std::size_t FlatMap<Key>::MIN_CAPACITY;
+template <typename Key>
+constexpr std::size_t FlatMap<Key>::MAX_LOAD_NUMERATOR;
+template <typename Key>
+constexpr std::size_t FlatMap<Key>::MAX_LOAD_DENOMINATOR;
+
 template <typename Key, typename Value>
 struct Map : public IMap
 {
@@ -115,11 +313,10 @@ struct Map : public IMap
 
   TemplateParameter2 *Find(TemplateParameter1 const &key)
   {
-    auto it = map.find(key);
-    if (it != map.end())
+    TemplateParameter2 *value = map.Find(MapKey<Key>::Load(key));
+    if (value != nullptr)
     {
-      TemplateParameter2 &value = it->second;
-      return &value;
+      return value;
     }
     RuntimeError("map key does not exist");
     return nullptr;
@@ -157,7 +354,7 @@ struct Map : public IMap
   std::enable_if_t<IsPrimitive<U>::value, void> Store(TemplateParameter1 const &key,
                                                       TemplateParameter2 const &value)
   {
-    map[key] = value;
+    map.Set(MapKey<Key>::Load(key), value);
   }
 
   template <typename U>
@@ -166,7 +363,7 @@ struct Map : public IMap
   {
     if (key.object)
     {
-      map[key] = value;
+      map.Set(key, value);
       return;
     }
     RuntimeError("map key is null reference");
@@ -182,14 +379,14 @@ struct Map : public IMap
     auto constructor = buffer.NewMapConstructor();
     auto map_ser     = constructor(map.size());
 
-    for (auto const &v : map)
+    for (auto const *v : map.SerialisationOrder())
     {
-      auto f1 = [&v, this](MsgPackSerializer &serializer) {
-        return SerializeElement<Key>(serializer, v.first);
+      auto f1 = [v, this](MsgPackSerializer &serializer) {
+        return SerializeKey<Key>(serializer, v->key);
       };
 
-      auto f2 = [&v, this](MsgPackSerializer &serializer) {
-        return SerializeElement<Value>(serializer, v.second);
+      auto f2 = [v, this](MsgPackSerializer &serializer) {
+        return SerializeElement<Value>(serializer, v->value);
       };
 
       if (!map_ser.AppendUsingFunction(f1, f2))
@@ -208,6 +405,7 @@ struct Map : public IMap
     TypeId const    value_type_id = type_info.template_parameter_type_ids[1];
 
     auto map_ser = buffer.NewMapDeserializer();
+    map.Reserve(map.size() + map_ser.size());
     for (uint64_t i = 0; i < map_ser.size(); ++i)
     {
       TemplateParameter1 key;
@@ -226,15 +424,30 @@ struct Map : public IMap
         return false;
       }
 
-      map.insert({key, value});
+      map.Insert(MapKey<Key>::Load(key), value);
     }
 
     return true;
   }
 
-  std::unordered_map<TemplateParameter1, TemplateParameter2, H<Key>, E<Key>> map;
+  FlatMap<Key> map;
 
 private:
+  template <typename U>
+  std::enable_if_t<IsPtr<U>::value, bool> SerializeKey(MsgPackSerializer &       buffer,
+                                                       TemplateParameter1 const &key)
+  {
+    return SerializeElement<U>(buffer, key);
+  }
+
+  template <typename U>
+  std::enable_if_t<IsPrimitive<U>::value, bool> SerializeKey(MsgPackSerializer &buffer,
+                                                             U const &          key)
+  {
+    buffer << key;
+    return true;
+  }
+
   template <typename U, typename TemplateParameterType>
   std::enable_if_t<IsPtr<U>::value, bool> SerializeElement(MsgPackSerializer &          buffer,
                                                            TemplateParameterType const &v)
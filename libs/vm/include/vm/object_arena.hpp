@@ -0,0 +1,129 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace fetch {
+namespace vm {
+
+/**
+ * Pool allocator for the objects created while a VM executes a function.
+ *
+ * Objects are carved out of large chunks instead of being allocated individually. Objects released
+ * during the execution return their memory to a free list for their size class, from which later
+ * objects of the same size are served, so an execution which keeps creating and dropping
+ * temporaries runs in a fixed amount of arena memory. Every chunk counts the objects still living
+ * in it, so when an execution finishes the chunks whose objects have all been released are reset
+ * in bulk and reused by the next execution. Objects which escape the execution, e.g. in the return
+ * value, keep their chunk alive until they are released themselves.
+ *
+ * An execution may use at most MAX_CHUNKS chunks, which bounds both the arena memory and the
+ * memory that escaping objects can pin. Allocations made while no arena is active on the calling
+ * thread, allocations too large for the arena and allocations beyond its bound fall back to the
+ * heap.
+ */
+class ObjectArena
+{
+public:
+  struct Statistics
+  {
+    uint64_t arena_allocations{0};  ///< Objects allocated from a chunk
+    uint64_t heap_allocations{0};   ///< Objects the arena could not hold, allocated on the heap
+    uint64_t bytes_allocated{0};    ///< Bytes handed out from chunks, including headers
+    uint64_t blocks_reused{0};      ///< Allocations served from memory released earlier
+    uint64_t chunks_allocated{0};   ///< Chunks obtained from the heap
+    uint64_t chunks_recycled{0};    ///< Chunks reused after all of their objects were released
+    uint64_t chunks_detached{0};    ///< Chunks handed over to objects outliving an execution
+  };
+
+  static constexpr std::size_t CHUNK_SIZE          = 64 * 1024;
+  static constexpr std::size_t MAX_ALLOCATION_SIZE = 1024;
+  static constexpr std::size_t MAX_CHUNKS          = 256;
+  static constexpr std::size_t MAX_RETAINED_CHUNKS = 4;
+
+  /**
+   * Makes an arena the target of object allocations on the calling thread for its lifetime. Scopes
+   * can be nested, the arena is released when its outermost scope ends.
+   */
+  class Scope
+  {
+  public:
+    explicit Scope(ObjectArena &arena);
+    Scope(Scope const &) = delete;
+    Scope(Scope &&)      = delete;
+    ~Scope();
+
+    Scope &operator=(Scope const &) = delete;
+    Scope &operator=(Scope &&) = delete;
+
+  private:
+    ObjectArena &arena_;
+    ObjectArena *previous_;
+  };
+
+  // Construction / Destruction
+  ObjectArena() = default;
+  ObjectArena(ObjectArena const &) = delete;
+  ObjectArena(ObjectArena &&)      = delete;
+  ~ObjectArena();
+
+  static void *Allocate(std::size_t size);
+  static void  Deallocate(void *ptr) noexcept;
+
+  /// @name Statistics
+  /// @{
+  Statistics const &statistics() const;
+  void              ResetStatistics();
+  /// @}
+
+  // Operators
+  ObjectArena &operator=(ObjectArena const &) = delete;
+  ObjectArena &operator=(ObjectArena &&) = delete;
+
+private:
+  struct Chunk;
+  struct Header;
+
+  static constexpr std::size_t ALIGNMENT        = alignof(std::max_align_t);
+  static constexpr std::size_t NUM_SIZE_CLASSES = MAX_ALLOCATION_SIZE / ALIGNMENT;
+
+  using FreeLists = std::array<Header *, NUM_SIZE_CLASSES>;
+
+  static void ReleaseReference(Chunk *chunk) noexcept;
+
+  void * AllocateFromChunk(std::size_t size);
+  void   Recycle(Header *header) noexcept;
+  Chunk *NextChunk();
+  void   Release();
+
+  std::vector<Chunk *> chunks_;  ///< The chunks used by the current execution
+  std::vector<Chunk *> spare_;   ///< Empty chunks kept for the following executions
+  Chunk *              current_{nullptr};
+  FreeLists            free_lists_{};
+  std::size_t          depth_{0};
+  Statistics           statistics_;
+
+  static thread_local ObjectArena *active_;
+};
+
+}  // namespace vm
+}  // namespace fetch
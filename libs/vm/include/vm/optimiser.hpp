@@ -0,0 +1,79 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vm/generator.hpp"
+#include "vm/variant.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace fetch {
+namespace vm {
+
+class VM;
+
+/**
+ * Peephole optimiser run over the bytecode produced by the generator.
+ *
+ * Each function is rewritten until no pass makes further progress:
+ *
+ * - constant folding of primitive and fixed point arithmetic, relational and logical operators
+ * - conditional branches on constant conditions are resolved
+ * - redundant load/store pairs are removed and `x = x op y` is turned into an in-place update
+ * - jumps to jumps are threaded and jumps to returns are replaced by the return itself
+ * - unreachable instructions, e.g. after a return, are removed
+ *
+ * Constant expressions are evaluated by the VM's own operators, so the optimised executable
+ * computes bit-for-bit the same results. Expressions which would raise a runtime error, such as
+ * divisions by zero, are left for the VM to report. Charges are derived from the instructions that
+ * are actually executed, so they remain deterministic for a given source and optimiser setting.
+ */
+class Optimiser
+{
+public:
+  explicit Optimiser(VM *vm);
+  ~Optimiser() = default;
+
+  void Optimise(Executable &executable);
+
+private:
+  using Function    = Executable::Function;
+  using Instruction = Executable::Instruction;
+  using Flags       = std::vector<bool>;
+
+  VM *        vm_{};
+  Executable *executable_{};
+
+  void OptimiseFunction(Function &function);
+  bool FoldConstants(Function &function);
+  bool SimplifyBranches(Function &function);
+  bool EliminateLoadsAndStores(Function &function);
+  bool ThreadJumps(Function &function);
+  bool EliminateUnreachableCode(Function &function);
+  void Compact(Function &function, Flags const &keep);
+
+  bool     GetConstant(Instruction const &instruction, Variant &value) const;
+  void     SetConstant(Instruction &instruction, Variant const &value);
+  bool     FoldUnaryOp(Instruction const &instruction, Variant &operand);
+  bool     FoldBinaryOp(Instruction const &instruction, Variant &lhs, Variant &rhs);
+  uint16_t AddConstant(Variant const &value);
+};
+
+}  // namespace vm
+}  // namespace fetch
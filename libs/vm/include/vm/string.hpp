@@ -88,7 +88,8 @@ struct String : public Object
   void               UpdateString(std::string str);
 
 private:
-  Utf8String utf8_str_;
+  Utf8String  utf8_str_;
+  std::size_t hash_code_{0};  ///< Cached GetHashCode() result, zero until computed
 };
 
 }  // namespace vm
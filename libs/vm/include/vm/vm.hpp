@@ -21,6 +21,7 @@
 #include "vm/common.hpp"
 #include "vm/generator.hpp"
 #include "vm/object.hpp"
+#include "vm/object_arena.hpp"
 #include "vm/opcodes.hpp"
 #include "vm/string.hpp"
 #include "vm/user_defined_object.hpp"
@@ -259,6 +260,25 @@ public:
   bool GenerateExecutable(IR const &ir, std::string const &name, Executable &executable,
                           std::vector<std::string> &errors);
 
+  /**
+   * Enables the bytecode optimiser for subsequently generated executables. Optimised executables
+   * produce the same results but execute, and are charged for, fewer instructions.
+   */
+  void SetOptimiserEnabled(bool enabled)
+  {
+    generator_.SetOptimiserEnabled(enabled);
+  }
+
+  ObjectArena::Statistics const &GetAllocationStatistics() const
+  {
+    return arena_.statistics();
+  }
+
+  void ResetAllocationStatistics()
+  {
+    arena_.ResetStatistics();
+  }
+
   template <typename... Ts>
   bool Execute(Executable const &executable, std::string const &name, std::string &error,
                Variant &output, Ts const &... parameters)
@@ -319,8 +339,11 @@ public:
           LoadExecutable(&executable);
           function_ = f;
 
-          // execute the function
-          success = Execute(error, output);
+          // execute the function, objects created along the way are allocated from the arena
+          {
+            ObjectArena::Scope const arena_scope{arena_};
+            success = Execute(error, output);
+          }
           UnloadExecutable();
         }
       }
@@ -639,6 +662,7 @@ private:
   OpcodeInfoArray                opcode_info_array_;
   OpcodeMap                      opcode_map_;
   Generator                      generator_;
+  ObjectArena                    arena_;
   Executable const *             executable_{};
   Executable::Function const *   function_{};
   std::vector<Ptr<String>>       strings_;
@@ -1840,6 +1864,7 @@ private:
   friend class Object;
   friend class Module;
   friend class Generator;
+  friend class Optimiser;
 };
 
 template <typename T>
@@ -17,6 +17,7 @@
 //------------------------------------------------------------------------------
 
 #include "vm/generator.hpp"
+#include "vm/optimiser.hpp"
 #include "vm/vm.hpp"
 
 #include <cstddef>
@@ -79,6 +80,12 @@ bool Generator::GenerateExecutable(IR const &ir, std::string const &executable_n
   CreateUserDefinedFreeFunctions(ir.root_);
   HandleBlock(ir.root_);
 
+  if (optimiser_enabled_)
+  {
+    Optimiser optimiser(vm_);
+    optimiser.Optimise(executable_);
+  }
+
   executable = executable_;
   scopes_.clear();
   loops_.clear();
@@ -0,0 +1,278 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vm/object_arena.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+namespace fetch {
+namespace vm {
+
+constexpr std::size_t ObjectArena::CHUNK_SIZE;
+constexpr std::size_t ObjectArena::MAX_ALLOCATION_SIZE;
+constexpr std::size_t ObjectArena::MAX_CHUNKS;
+constexpr std::size_t ObjectArena::MAX_RETAINED_CHUNKS;
+constexpr std::size_t ObjectArena::ALIGNMENT;
+constexpr std::size_t ObjectArena::NUM_SIZE_CLASSES;
+
+thread_local ObjectArena *ObjectArena::active_ = nullptr;
+
+struct ObjectArena::Chunk
+{
+  /// The live objects in the chunk, plus one while the chunk is owned by an arena
+  std::atomic<std::size_t> references{1};
+  /// The arena whose free lists take the memory released in the chunk, null once detached
+  std::atomic<ObjectArena *> owner{nullptr};
+  std::size_t                used{0};
+
+  alignas(std::max_align_t) char data[CHUNK_SIZE];
+};
+
+/// Precedes every allocation, identifying the chunk it was carved from (null for the heap)
+struct alignas(std::max_align_t) ObjectArena::Header
+{
+  Chunk *     chunk;
+  std::size_t size;  ///< The size of the block, including the header
+};
+
+namespace {
+
+constexpr std::size_t RoundUp(std::size_t size)
+{
+  return (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+}
+
+}  // namespace
+
+void ObjectArena::ReleaseReference(Chunk *chunk) noexcept
+{
+  if (--chunk->references == 0)
+  {
+    delete chunk;
+  }
+}
+
+ObjectArena::Scope::Scope(ObjectArena &arena)
+  : arena_{arena}
+  , previous_{active_}
+{
+  active_ = &arena_;
+  ++arena_.depth_;
+}
+
+ObjectArena::Scope::~Scope()
+{
+  active_ = previous_;
+  if (--arena_.depth_ == 0)
+  {
+    arena_.Release();
+  }
+}
+
+ObjectArena::~ObjectArena()
+{
+  Release();
+
+  for (auto *chunk : spare_)
+  {
+    ReleaseReference(chunk);
+  }
+}
+
+/**
+ * Allocate memory for an object from the arena active on the calling thread
+ *
+ * @param size The size of the object in bytes
+ * @return The pointer to the memory
+ */
+void *ObjectArena::Allocate(std::size_t size)
+{
+  std::size_t const total = sizeof(Header) + RoundUp(size);
+
+  ObjectArena *arena = active_;
+  if ((arena != nullptr) && (total <= MAX_ALLOCATION_SIZE))
+  {
+    void *ptr = arena->AllocateFromChunk(total);
+    if (ptr != nullptr)
+    {
+      return ptr;
+    }
+  }
+
+  if (arena != nullptr)
+  {
+    ++arena->statistics_.heap_allocations;
+  }
+
+  auto *header  = static_cast<Header *>(::operator new(total));
+  header->chunk = nullptr;
+  header->size  = total;
+  return header + 1;
+}
+
+/**
+ * Release the memory of an object, wherever it was allocated from
+ *
+ * @param ptr The pointer previously returned by Allocate
+ */
+void ObjectArena::Deallocate(void *ptr) noexcept
+{
+  if (ptr == nullptr)
+  {
+    return;
+  }
+
+  Header *header = static_cast<Header *>(ptr) - 1;
+  Chunk * chunk  = header->chunk;
+  if (chunk == nullptr)
+  {
+    ::operator delete(header);
+  }
+  else if ((active_ != nullptr) && (chunk->owner.load(std::memory_order_relaxed) == active_))
+  {
+    active_->Recycle(header);
+  }
+  else
+  {
+    ReleaseReference(chunk);
+  }
+}
+
+ObjectArena::Statistics const &ObjectArena::statistics() const
+{
+  return statistics_;
+}
+
+void ObjectArena::ResetStatistics()
+{
+  statistics_ = Statistics{};
+}
+
+void *ObjectArena::AllocateFromChunk(std::size_t size)
+{
+  Header *&free_list = free_lists_[(size / ALIGNMENT) - 1];
+
+  Header *header = free_list;
+  if (header != nullptr)
+  {
+    // the link to the next free block is kept where the object was
+    free_list = *reinterpret_cast<Header **>(header + 1);
+    ++statistics_.blocks_reused;
+  }
+  else
+  {
+    if ((current_ == nullptr) || (current_->used + size > CHUNK_SIZE))
+    {
+      current_ = NextChunk();
+      if (current_ == nullptr)
+      {
+        return nullptr;
+      }
+    }
+
+    header        = reinterpret_cast<Header *>(current_->data + current_->used);
+    header->chunk = current_;
+    header->size  = size;
+    current_->used += size;
+  }
+
+  ++header->chunk->references;
+
+  ++statistics_.arena_allocations;
+  statistics_.bytes_allocated += size;
+
+  return header + 1;
+}
+
+/**
+ * Return the memory of an object released during the execution to the free list for its size.
+ * The chunk stays referenced by the arena, so this never frees it.
+ */
+void ObjectArena::Recycle(Header *header) noexcept
+{
+  Header *&free_list = free_lists_[(header->size / ALIGNMENT) - 1];
+
+  *reinterpret_cast<Header **>(header + 1) = free_list;
+  free_list                                = header;
+
+  --header->chunk->references;
+}
+
+ObjectArena::Chunk *ObjectArena::NextChunk()
+{
+  if (chunks_.size() >= MAX_CHUNKS)
+  {
+    return nullptr;
+  }
+
+  Chunk *chunk = nullptr;
+  if (!spare_.empty())
+  {
+    chunk = spare_.back();
+    spare_.pop_back();
+    ++statistics_.chunks_recycled;
+  }
+  else
+  {
+    chunk = new Chunk;
+    chunk->owner.store(this, std::memory_order_relaxed);
+    ++statistics_.chunks_allocated;
+  }
+
+  chunks_.push_back(chunk);
+  return chunk;
+}
+
+/**
+ * Called at the end of an execution. Empty chunks are kept for the next execution, chunks which
+ * still contain objects are left to be freed by the last of them.
+ */
+void ObjectArena::Release()
+{
+  // the free blocks belong to chunks which are either reset or handed over below
+  free_lists_.fill(nullptr);
+
+  for (auto *chunk : chunks_)
+  {
+    // only the arena can add references to a chunk, so an empty chunk stays empty
+    if (chunk->references == 1)
+    {
+      if (spare_.size() < MAX_RETAINED_CHUNKS)
+      {
+        chunk->used = 0;
+        spare_.push_back(chunk);
+        continue;
+      }
+    }
+    else
+    {
+      chunk->owner.store(nullptr, std::memory_order_relaxed);
+      ++statistics_.chunks_detached;
+    }
+
+    ReleaseReference(chunk);
+  }
+
+  chunks_.clear();
+  current_ = nullptr;
+}
+
+}  // namespace vm
+}  // namespace fetch
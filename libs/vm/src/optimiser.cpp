@@ -0,0 +1,803 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "math/arithmetic/comparison.hpp"
+#include "vm/opcodes.hpp"
+#include "vm/optimiser.hpp"
+#include "vm/vm.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace fetch {
+namespace vm {
+
+namespace {
+
+using Instruction      = Executable::Instruction;
+using InstructionArray = Executable::InstructionArray;
+using Flags            = std::vector<bool>;
+
+bool IsNumericType(TypeId type_id)
+{
+  return (type_id >= TypeIds::Int8) && (type_id <= TypeIds::Fixed64);
+}
+
+bool IsIntegralType(TypeId type_id)
+{
+  return (type_id >= TypeIds::Int8) && (type_id <= TypeIds::UInt64);
+}
+
+// Instructions whose index is the pc of another instruction in the same function
+bool HasJumpTarget(uint16_t opcode)
+{
+  switch (opcode)
+  {
+  case Opcodes::Break:
+  case Opcodes::Continue:
+  case Opcodes::Jump:
+  case Opcodes::JumpIfFalse:
+  case Opcodes::JumpIfTrue:
+  case Opcodes::JumpIfFalseOrPop:
+  case Opcodes::JumpIfTrueOrPop:
+  case Opcodes::ForRangeIterate:
+    return true;
+  default:
+    return false;
+  }
+}
+
+// Instructions after which execution never continues with the next instruction
+bool IsUnconditionalTransfer(uint16_t opcode)
+{
+  switch (opcode)
+  {
+  case Opcodes::Break:
+  case Opcodes::Continue:
+  case Opcodes::Jump:
+  case Opcodes::Return:
+  case Opcodes::ReturnValue:
+    return true;
+  default:
+    return false;
+  }
+}
+
+// Instructions which push a value without any other observable effect
+bool IsPurePush(uint16_t opcode)
+{
+  switch (opcode)
+  {
+  case Opcodes::PushNull:
+  case Opcodes::PushFalse:
+  case Opcodes::PushTrue:
+  case Opcodes::PushString:
+  case Opcodes::PushConstant:
+  case Opcodes::PushLargeConstant:
+  case Opcodes::PushLocalVariable:
+  case Opcodes::PushSelf:
+    return true;
+  default:
+    return false;
+  }
+}
+
+uint16_t InplaceOpcode(uint16_t opcode)
+{
+  switch (opcode)
+  {
+  case Opcodes::PrimitiveAdd:
+    return Opcodes::LocalVariablePrimitiveInplaceAdd;
+  case Opcodes::PrimitiveSubtract:
+    return Opcodes::LocalVariablePrimitiveInplaceSubtract;
+  case Opcodes::PrimitiveMultiply:
+    return Opcodes::LocalVariablePrimitiveInplaceMultiply;
+  case Opcodes::PrimitiveDivide:
+    return Opcodes::LocalVariablePrimitiveInplaceDivide;
+  case Opcodes::PrimitiveModulo:
+    return Opcodes::LocalVariablePrimitiveInplaceModulo;
+  default:
+    return Opcodes::Unknown;
+  }
+}
+
+Flags FindJumpTargets(InstructionArray const &instructions)
+{
+  Flags targets(instructions.size() + 1, false);
+  for (auto const &instruction : instructions)
+  {
+    if (HasJumpTarget(instruction.opcode) && (instruction.index < targets.size()))
+    {
+      targets[instruction.index] = true;
+    }
+  }
+  return targets;
+}
+
+/**
+ * Checks that a division by the value can be evaluated at compile time. Divisions which fail at
+ * run time are left in place so that the VM reports them, and so are signed divisions by minus one
+ * which may trap on overflow.
+ */
+bool IsSafeDivisor(Variant const &rhs)
+{
+  switch (rhs.type_id)
+  {
+  case TypeIds::Int8:
+  {
+    return (rhs.primitive.i8 != 0) && (rhs.primitive.i8 != -1);
+  }
+  case TypeIds::Int16:
+  {
+    return (rhs.primitive.i16 != 0) && (rhs.primitive.i16 != -1);
+  }
+  case TypeIds::Int32:
+  {
+    return (rhs.primitive.i32 != 0) && (rhs.primitive.i32 != -1);
+  }
+  case TypeIds::Int64:
+  {
+    return (rhs.primitive.i64 != 0) && (rhs.primitive.i64 != -1);
+  }
+  case TypeIds::UInt8:
+  {
+    return rhs.primitive.ui8 != 0;
+  }
+  case TypeIds::UInt16:
+  {
+    return rhs.primitive.ui16 != 0;
+  }
+  case TypeIds::UInt32:
+  {
+    return rhs.primitive.ui32 != 0;
+  }
+  case TypeIds::UInt64:
+  {
+    return rhs.primitive.ui64 != 0;
+  }
+  case TypeIds::Float32:
+  {
+    return math::IsNonZero(rhs.primitive.f32);
+  }
+  case TypeIds::Float64:
+  {
+    return math::IsNonZero(rhs.primitive.f64);
+  }
+  case TypeIds::Fixed32:
+  {
+    return rhs.primitive.i32 != 0;
+  }
+  case TypeIds::Fixed64:
+  {
+    return rhs.primitive.i64 != 0;
+  }
+  default:
+  {
+    return false;
+  }
+  }  // switch
+}
+
+/**
+ * Compares the bit patterns of two primitive constants, so that e.g. 0.0 and -0.0 are distinct
+ */
+bool IsSameConstant(Variant const &lhs, Variant const &rhs)
+{
+  if (lhs.type_id != rhs.type_id)
+  {
+    return false;
+  }
+  switch (lhs.type_id)
+  {
+  case TypeIds::Bool:
+  case TypeIds::Int8:
+  case TypeIds::UInt8:
+  {
+    return lhs.primitive.ui8 == rhs.primitive.ui8;
+  }
+  case TypeIds::Int16:
+  case TypeIds::UInt16:
+  {
+    return lhs.primitive.ui16 == rhs.primitive.ui16;
+  }
+  case TypeIds::Int32:
+  case TypeIds::UInt32:
+  case TypeIds::Float32:
+  case TypeIds::Fixed32:
+  {
+    return lhs.primitive.ui32 == rhs.primitive.ui32;
+  }
+  case TypeIds::Int64:
+  case TypeIds::UInt64:
+  case TypeIds::Float64:
+  case TypeIds::Fixed64:
+  {
+    return lhs.primitive.ui64 == rhs.primitive.ui64;
+  }
+  default:
+  {
+    return false;
+  }
+  }  // switch
+}
+
+}  // namespace
+
+Optimiser::Optimiser(VM *vm)
+  : vm_{vm}
+{}
+
+void Optimiser::Optimise(Executable &executable)
+{
+  executable_ = &executable;
+
+  for (auto &function : executable.functions)
+  {
+    OptimiseFunction(function);
+  }
+  for (auto &contract : executable.contracts)
+  {
+    for (auto &function : contract.functions)
+    {
+      OptimiseFunction(function);
+    }
+  }
+  for (auto &type : executable.user_defined_types)
+  {
+    for (auto &function : type.functions)
+    {
+      OptimiseFunction(function);
+    }
+  }
+
+  executable_ = nullptr;
+}
+
+void Optimiser::OptimiseFunction(Function &function)
+{
+  bool changed = !function.instructions.empty();
+  while (changed)
+  {
+    changed = FoldConstants(function);
+    changed = SimplifyBranches(function) || changed;
+    changed = EliminateLoadsAndStores(function) || changed;
+    changed = ThreadJumps(function) || changed;
+    changed = EliminateUnreachableCode(function) || changed;
+  }
+}
+
+/**
+ * Replaces operators applied to constant operands with the constant result
+ */
+bool Optimiser::FoldConstants(Function &function)
+{
+  auto &            instructions = function.instructions;
+  std::size_t const size         = instructions.size();
+  Flags const       targets      = FindJumpTargets(instructions);
+  Flags             keep(size, true);
+  bool              changed = false;
+
+  for (std::size_t pc = 0; pc < size; ++pc)
+  {
+    // leave some headroom in the constant pool for the folded results
+    if (executable_->constants.size() >= std::numeric_limits<uint16_t>::max())
+    {
+      break;
+    }
+
+    Variant lhs;
+    if (!GetConstant(instructions[pc], lhs))
+    {
+      continue;
+    }
+
+    Variant rhs;
+    if ((pc + 2 < size) && !targets[pc + 1] && !targets[pc + 2] &&
+        GetConstant(instructions[pc + 1], rhs) && FoldBinaryOp(instructions[pc + 2], lhs, rhs))
+    {
+      SetConstant(instructions[pc], lhs);
+      keep[pc + 1] = false;
+      keep[pc + 2] = false;
+      changed      = true;
+      pc += 2;
+    }
+    else if ((pc + 1 < size) && !targets[pc + 1] && FoldUnaryOp(instructions[pc + 1], lhs))
+    {
+      SetConstant(instructions[pc], lhs);
+      keep[pc + 1] = false;
+      changed      = true;
+      pc += 1;
+    }
+  }
+
+  if (changed)
+  {
+    Compact(function, keep);
+  }
+  return changed;
+}
+
+/**
+ * Resolves conditional branches whose condition is known at compile time
+ */
+bool Optimiser::SimplifyBranches(Function &function)
+{
+  auto &            instructions = function.instructions;
+  std::size_t const size         = instructions.size();
+  Flags const       targets      = FindJumpTargets(instructions);
+  Flags             keep(size, true);
+  bool              changed = false;
+
+  for (std::size_t pc = 0; pc + 1 < size; ++pc)
+  {
+    Instruction &     first  = instructions[pc];
+    Instruction const second = instructions[pc + 1];
+
+    bool const is_conditional_jump =
+        (second.opcode == Opcodes::JumpIfFalse) || (second.opcode == Opcodes::JumpIfTrue);
+    if (!is_conditional_jump || targets[pc + 1])
+    {
+      continue;
+    }
+
+    if ((first.opcode == Opcodes::PushTrue) || (first.opcode == Opcodes::PushFalse))
+    {
+      bool const condition = first.opcode == Opcodes::PushTrue;
+      if (condition == (second.opcode == Opcodes::JumpIfTrue))
+      {
+        first       = Instruction(Opcodes::Jump);
+        first.index = second.index;
+      }
+      else
+      {
+        keep[pc] = false;
+      }
+    }
+    else if (first.opcode == Opcodes::Not)
+    {
+      first       = Instruction(second.opcode == Opcodes::JumpIfFalse ? Opcodes::JumpIfTrue
+                                                                      : Opcodes::JumpIfFalse);
+      first.index = second.index;
+    }
+    else
+    {
+      continue;
+    }
+
+    keep[pc + 1] = false;
+    changed      = true;
+    ++pc;
+  }
+
+  if (changed)
+  {
+    Compact(function, keep);
+  }
+  return changed;
+}
+
+/**
+ * Removes values which are pushed only to be discarded or stored straight back where they were
+ * loaded from, and turns `x = x op y` on primitive locals into an in-place update of `x`
+ */
+bool Optimiser::EliminateLoadsAndStores(Function &function)
+{
+  auto &            instructions = function.instructions;
+  std::size_t const size         = instructions.size();
+  Flags const       targets      = FindJumpTargets(instructions);
+  Flags             keep(size, true);
+  bool              changed = false;
+
+  for (std::size_t pc = 0; pc + 1 < size; ++pc)
+  {
+    Instruction &first  = instructions[pc];
+    Instruction &second = instructions[pc + 1];
+    if (targets[pc + 1])
+    {
+      continue;
+    }
+
+    if (IsPurePush(first.opcode) && (second.opcode == Opcodes::Discard))
+    {
+      keep[pc]     = false;
+      keep[pc + 1] = false;
+      changed      = true;
+      ++pc;
+      continue;
+    }
+
+    if (first.opcode != Opcodes::PushLocalVariable)
+    {
+      continue;
+    }
+
+    if ((second.opcode == Opcodes::PopToLocalVariable) && (second.index == first.index))
+    {
+      keep[pc]     = false;
+      keep[pc + 1] = false;
+      changed      = true;
+      ++pc;
+      continue;
+    }
+
+    if ((pc + 3 >= size) || targets[pc + 2] || targets[pc + 3])
+    {
+      continue;
+    }
+
+    Instruction const &op             = instructions[pc + 2];
+    Instruction const &store          = instructions[pc + 3];
+    uint16_t const     inplace_opcode = InplaceOpcode(op.opcode);
+    bool const         is_operand     =
+        (second.opcode == Opcodes::PushConstant) || (second.opcode == Opcodes::PushLocalVariable);
+    if ((inplace_opcode == Opcodes::Unknown) || !is_operand ||
+        (store.opcode != Opcodes::PopToLocalVariable) || (store.index != first.index) ||
+        !IsNumericType(op.type_id) || (op.type_id != store.type_id) || (op.data != op.type_id))
+    {
+      continue;
+    }
+
+    Instruction inplace(inplace_opcode);
+    inplace.type_id = op.type_id;
+    inplace.index   = store.index;
+    inplace.data    = op.data;
+
+    first        = second;
+    second       = inplace;
+    keep[pc + 2] = false;
+    keep[pc + 3] = false;
+    changed      = true;
+    pc += 3;
+  }
+
+  if (changed)
+  {
+    Compact(function, keep);
+  }
+  return changed;
+}
+
+/**
+ * Redirects jumps which land on unconditional jumps to their final destination, replaces jumps to
+ * returns with the return itself and removes jumps to the next instruction
+ */
+bool Optimiser::ThreadJumps(Function &function)
+{
+  auto &            instructions = function.instructions;
+  std::size_t const size         = instructions.size();
+  Flags             keep(size, true);
+  bool              changed = false;
+
+  for (std::size_t pc = 0; pc < size; ++pc)
+  {
+    Instruction &instruction = instructions[pc];
+    if (!HasJumpTarget(instruction.opcode))
+    {
+      continue;
+    }
+
+    // bound the walk so that empty infinite loops terminate
+    uint16_t target = instruction.index;
+    for (std::size_t steps = 0;
+         (steps < size) && (target < size) && (instructions[target].opcode == Opcodes::Jump);
+         ++steps)
+    {
+      target = instructions[target].index;
+    }
+    if (target != instruction.index)
+    {
+      instruction.index = target;
+      changed           = true;
+    }
+
+    if (instruction.opcode != Opcodes::Jump)
+    {
+      continue;
+    }
+
+    if (target == pc + 1)
+    {
+      keep[pc] = false;
+      changed  = true;
+    }
+    else if ((target < size) && ((instructions[target].opcode == Opcodes::Return) ||
+                                 (instructions[target].opcode == Opcodes::ReturnValue)))
+    {
+      instruction = instructions[target];
+      changed     = true;
+    }
+  }
+
+  if (changed)
+  {
+    Compact(function, keep);
+  }
+  return changed;
+}
+
+/**
+ * Removes the instructions which cannot be reached from the start of the function
+ */
+bool Optimiser::EliminateUnreachableCode(Function &function)
+{
+  auto &                instructions = function.instructions;
+  std::size_t const     size         = instructions.size();
+  Flags                 reachable(size, false);
+  std::vector<uint16_t> pending{0};
+
+  while (!pending.empty())
+  {
+    uint16_t pc = pending.back();
+    pending.pop_back();
+
+    // follow the fall through path, queueing the branch targets along the way
+    while ((pc < size) && !reachable[pc])
+    {
+      reachable[pc]                  = true;
+      Instruction const &instruction = instructions[pc];
+      if (HasJumpTarget(instruction.opcode))
+      {
+        pending.push_back(instruction.index);
+      }
+      if (IsUnconditionalTransfer(instruction.opcode))
+      {
+        break;
+      }
+      ++pc;
+    }
+  }
+
+  for (std::size_t pc = 0; pc < size; ++pc)
+  {
+    if (!reachable[pc])
+    {
+      Compact(function, reachable);
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Removes the instructions which are not marked to be kept. Jumps to a removed instruction, and the
+ * line number recorded for it, move on to the next instruction which is kept.
+ */
+void Optimiser::Compact(Function &function, Flags const &keep)
+{
+  auto &            instructions = function.instructions;
+  std::size_t const size         = instructions.size();
+
+  std::vector<uint16_t> new_pcs(size + 1);
+  uint16_t              new_size = 0;
+  for (std::size_t pc = 0; pc < size; ++pc)
+  {
+    new_pcs[pc] = new_size;
+    if (keep[pc])
+    {
+      instructions[new_size++] = instructions[pc];
+    }
+  }
+  new_pcs[size] = new_size;
+  instructions.erase(instructions.begin() + new_size, instructions.end());
+
+  for (auto &instruction : instructions)
+  {
+    if (HasJumpTarget(instruction.opcode))
+    {
+      instruction.index = new_pcs[instruction.index];
+    }
+  }
+
+  Executable::PcToLineMap pc_to_line_map;
+  for (auto const &entry : function.pc_to_line_map)
+  {
+    uint16_t const new_pc = new_pcs[entry.first];
+    if (new_pc < new_size)
+    {
+      pc_to_line_map[new_pc] = entry.second;
+    }
+  }
+  function.pc_to_line_map = std::move(pc_to_line_map);
+}
+
+bool Optimiser::GetConstant(Instruction const &instruction, Variant &value) const
+{
+  switch (instruction.opcode)
+  {
+  case Opcodes::PushFalse:
+  {
+    value.Assign(false, TypeIds::Bool);
+    return true;
+  }
+  case Opcodes::PushTrue:
+  {
+    value.Assign(true, TypeIds::Bool);
+    return true;
+  }
+  case Opcodes::PushConstant:
+  {
+    Variant const &constant = executable_->constants[instruction.index];
+    if (IsNumericType(constant.type_id))
+    {
+      value = constant;
+      return true;
+    }
+    return false;
+  }
+  default:
+  {
+    return false;
+  }
+  }  // switch
+}
+
+void Optimiser::SetConstant(Instruction &instruction, Variant const &value)
+{
+  if (value.type_id == TypeIds::Bool)
+  {
+    instruction = Instruction(value.primitive.ui8 != 0 ? Opcodes::PushTrue : Opcodes::PushFalse);
+    return;
+  }
+
+  instruction       = Instruction(Opcodes::PushConstant);
+  instruction.index = AddConstant(value);
+}
+
+bool Optimiser::FoldUnaryOp(Instruction const &instruction, Variant &operand)
+{
+  switch (instruction.opcode)
+  {
+  case Opcodes::Not:
+  {
+    if (operand.type_id != TypeIds::Bool)
+    {
+      return false;
+    }
+    operand.primitive.ui8 = operand.primitive.ui8 == 0 ? 1 : 0;
+    return true;
+  }
+  case Opcodes::PrimitiveNegate:
+  {
+    if (!IsNumericType(instruction.type_id) || (operand.type_id != instruction.type_id))
+    {
+      return false;
+    }
+    vm_->ExecuteNumericOp<VM::PrimitiveNegate>(instruction.type_id, operand, operand);
+    return true;
+  }
+  default:
+  {
+    return false;
+  }
+  }  // switch
+}
+
+bool Optimiser::FoldBinaryOp(Instruction const &instruction, Variant &lhs, Variant &rhs)
+{
+  TypeId const type_id = instruction.type_id;
+  if ((lhs.type_id != type_id) || (rhs.type_id != type_id))
+  {
+    return false;
+  }
+
+  bool const is_numeric = IsNumericType(type_id);
+  if (!is_numeric && (type_id != TypeIds::Bool))
+  {
+    return false;
+  }
+
+  switch (instruction.opcode)
+  {
+  case Opcodes::PrimitiveEqual:
+  {
+    vm_->ExecutePrimitiveRelationalOp<VM::PrimitiveEqual>(type_id, lhs, rhs);
+    return true;
+  }
+  case Opcodes::PrimitiveNotEqual:
+  {
+    vm_->ExecutePrimitiveRelationalOp<VM::PrimitiveNotEqual>(type_id, lhs, rhs);
+    return true;
+  }
+  case Opcodes::PrimitiveLessThan:
+  {
+    vm_->ExecutePrimitiveRelationalOp<VM::PrimitiveLessThan>(type_id, lhs, rhs);
+    return true;
+  }
+  case Opcodes::PrimitiveLessThanOrEqual:
+  {
+    vm_->ExecutePrimitiveRelationalOp<VM::PrimitiveLessThanOrEqual>(type_id, lhs, rhs);
+    return true;
+  }
+  case Opcodes::PrimitiveGreaterThan:
+  {
+    vm_->ExecutePrimitiveRelationalOp<VM::PrimitiveGreaterThan>(type_id, lhs, rhs);
+    return true;
+  }
+  case Opcodes::PrimitiveGreaterThanOrEqual:
+  {
+    vm_->ExecutePrimitiveRelationalOp<VM::PrimitiveGreaterThanOrEqual>(type_id, lhs, rhs);
+    return true;
+  }
+  case Opcodes::PrimitiveAdd:
+  {
+    if (is_numeric)
+    {
+      vm_->ExecuteNumericOp<VM::PrimitiveAdd>(type_id, lhs, rhs);
+    }
+    return is_numeric;
+  }
+  case Opcodes::PrimitiveSubtract:
+  {
+    if (is_numeric)
+    {
+      vm_->ExecuteNumericOp<VM::PrimitiveSubtract>(type_id, lhs, rhs);
+    }
+    return is_numeric;
+  }
+  case Opcodes::PrimitiveMultiply:
+  {
+    if (is_numeric)
+    {
+      vm_->ExecuteNumericOp<VM::PrimitiveMultiply>(type_id, lhs, rhs);
+    }
+    return is_numeric;
+  }
+  case Opcodes::PrimitiveDivide:
+  {
+    bool const can_fold = is_numeric && IsSafeDivisor(rhs);
+    if (can_fold)
+    {
+      vm_->ExecuteNumericOp<VM::PrimitiveDivide>(type_id, lhs, rhs);
+    }
+    return can_fold;
+  }
+  case Opcodes::PrimitiveModulo:
+  {
+    bool const can_fold = IsIntegralType(type_id) && IsSafeDivisor(rhs);
+    if (can_fold)
+    {
+      vm_->ExecuteIntegralOp<VM::PrimitiveModulo>(type_id, lhs, rhs);
+    }
+    return can_fold;
+  }
+  default:
+  {
+    return false;
+  }
+  }  // switch
+}
+
+uint16_t Optimiser::AddConstant(Variant const &value)
+{
+  auto &constants = executable_->constants;
+  for (std::size_t i = 0; i < constants.size(); ++i)
+  {
+    if (IsSameConstant(constants[i], value))
+    {
+      return static_cast<uint16_t>(i);
+    }
+  }
+
+  constants.push_back(value);
+  return static_cast<uint16_t>(constants.size() - 1);
+}
+
+}  // namespace vm
+}  // namespace fetch
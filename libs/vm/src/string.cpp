@@ -97,6 +97,7 @@ Ptr<String> String::Trim()
   if (IsTemporary())
   {
     fetch::string::Trim(utf8_str_.str_);
+    hash_code_ = 0;
 
     return Ptr<String>::PtrFromThis(this);
   }
@@ -169,6 +170,7 @@ Ptr<String> String::Reverse()
   if (IsTemporary())
   {
     reverse_utf8_string_in_place(utf8_str_.str_);
+    hash_code_ = 0;
 
     return Ptr<String>::PtrFromThis(this);
   }
@@ -244,7 +246,12 @@ int32_t String::SizeInBytes() const
 
 std::size_t String::GetHashCode()
 {
-  return std::hash<std::string>()(utf8_str_.string());
+  // strings used as map keys are hashed repeatedly, so the hash is kept until the string changes
+  if (hash_code_ == 0)
+  {
+    hash_code_ = std::hash<std::string>()(utf8_str_.string());
+  }
+  return hash_code_;
 }
 
 bool String::IsEqual(Ptr<Object> const &lhso, Ptr<Object> const &rhso)
@@ -297,6 +304,7 @@ void String::Add(Ptr<Object> &lhso, Ptr<Object> &rhso)
   if (lhs->IsTemporary())
   {
     lhs->utf8_str_ += rhs->utf8_str_;
+    lhs->hash_code_ = 0;
   }
   else
   {
@@ -323,7 +331,8 @@ bool String::DeserializeFrom(MsgPackSerializer &buffer)
 
 void String::UpdateString(std::string str)
 {
-  utf8_str_ = Utf8String{std::move(str)};
+  utf8_str_  = Utf8String{std::move(str)};
+  hash_code_ = 0;
 }
 
 std::string const &String::string() const